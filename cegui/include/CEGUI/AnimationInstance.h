@@ -31,7 +31,10 @@
 
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/Event.h"
+#include "CEGUI/Interpolator.h"
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -42,6 +45,7 @@
 namespace CEGUI
 {
 class Animation;
+class Affector;
 
 /*!
 \brief
@@ -92,6 +96,15 @@ public:
     //! fired when animation instance loops
     static const String EventAnimationLooped;
 
+    //! Ids of the event names above.
+    static const EventId EventAnimationStartedId;
+    static const EventId EventAnimationStoppedId;
+    static const EventId EventAnimationPausedId;
+    static const EventId EventAnimationUnpausedId;
+    static const EventId EventAnimationFinishedId;
+    static const EventId EventAnimationEndedId;
+    static const EventId EventAnimationLoopedId;
+
     //! internal constructor, please use AnimationManager::instantiateAnimation
     AnimationInstance(Animation* definition);
 
@@ -373,6 +386,20 @@ public:
      */
     const String& getSavedPropertyValue(const String& propertyName);
 
+    /*!
+    \brief
+        Internal method, returns the binding of the interpolator of the given
+        affector to the target property, creating it when necessary.
+
+    \return
+        Pointer to the binding or nullptr if the interpolator can't apply its
+        values natively, in which case String values have to be applied.
+    */
+    InterpolatorBinding* getInterpolatorBinding(const Affector& affector);
+
+    //! Internal method, destroys all bindings of interpolators to properties
+    void purgeInterpolatorBindings();
+
     /*!
     \brief
         Internal method, adds reference to created auto connection
@@ -457,6 +484,18 @@ private:
 
     //! tracks auto event connections we make.
     std::vector<Event::Connection> d_autoConnections;
+
+    //! native binding of one affector to a property of the target
+    struct AffectorBindingRecord
+    {
+        Interpolator* d_interpolator = nullptr;
+        String d_targetProperty;
+        std::uint32_t d_propertiesRevision = 0;
+        std::unique_ptr<InterpolatorBinding> d_binding;
+    };
+
+    //! bindings of affectors to the properties of the target
+    std::unordered_map<const Affector*, AffectorBindingRecord> d_interpolatorBindings;
 };
 
 } // End of  CEGUI namespace section
@@ -42,16 +42,48 @@ public:
                const AutoScaledMode autoscaled, const Sizef& native_res);
 
     void createRenderGeometry(std::vector<GeometryBuffer*>& out, const ImageRenderSettings& renderSettings, size_t canCombineFromIdx) const override;
-\
+
+    /*!
+    \brief
+        Creates the geometry of many images at once. This is equivalent to
+        calling createRenderGeometry for each of them in order, but the quads
+        of consecutive images sharing a texture are generated in one pass.
+
+    \param images
+        Array of \a count images to render.
+
+    \param dest_areas
+        Array of \a count destination areas, used instead of the destination
+        area of \a renderSettings.
+    */
+    static void createRenderGeometryBatch(std::vector<GeometryBuffer*>& out,
+        const BitmapImage* const* images, const Rectf* dest_areas, size_t count,
+        const ImageRenderSettings& renderSettings, size_t canCombineFromIdx);
+
     //! \brief Sets the Texture object of this Image.
     void setTexture(Texture* texture) { d_texture = texture; }
     //! \brief Returns the pointer to the Texture object used by this image.
     const Texture* getTexture() const { return d_texture; }
 
+    void assign(const Image& image) override;
+
 protected:
 
     bool createVertices(TexturedColouredVertex* out, const ImageRenderSettings& renderSettings) const;
 
+    /*!
+    \brief
+        Computes the unclipped quad of the image drawn to \a dest_area, with
+        texture coordinates normalised. Returns false if nothing would be drawn.
+    */
+    bool prepareQuad(const Rectf& dest_area, const ImageRenderSettings& renderSettings,
+        Rectf& destRect, Rectf& texRect) const;
+
+    //! Appends quads prepared by prepareQuad to a combinable or a new buffer in \a out.
+    static void appendQuads(std::vector<GeometryBuffer*>& out, Texture* texture,
+        const Rectf* destRects, const Rectf* texRects, size_t count,
+        const ImageRenderSettings& renderSettings, size_t canCombineFromIdx);
+
     //! Texture used by this image.
     Texture* d_texture = nullptr;
 };
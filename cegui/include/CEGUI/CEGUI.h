@@ -56,6 +56,7 @@
 #include "CEGUI/text/Font.h"
 #include "CEGUI/text/FontGlyph.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/GUIContext.h"
@@ -77,6 +77,11 @@ public:
     */
     static const String EventAcceptedColour;
 
+    //! Ids of the event names above.
+    static const EventId EventOpenedPickerId;
+    static const EventId EventClosedPickerId;
+    static const EventId EventAcceptedColourId;
+
     /*!
     \brief
         Set the current colour of the colour picker manually and refresh the
@@ -76,6 +76,10 @@ public:
     static const String EventColourAccepted;
     static const String EventClosed;
 
+    //! Ids of the event names above.
+    static const EventId EventColourAcceptedId;
+    static const EventId EventClosedId;
+
     RGB_Colour getSelectedColourRGB();
 
     /*!
@@ -30,6 +30,12 @@
 #define _CEGUIDataContainer_h_
 
 #include "CEGUI/Base.h"
+#include <memory>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -74,7 +80,23 @@ public:
 	\param data
         Pointer to the uint8 data buffer.
 	*/
-    void setData(std::uint8_t* data) { mData = data; }
+    void setData(std::uint8_t* data) { mData = data; mOwner.reset(); }
+
+	/*!
+	\brief
+		Set data owned by \a owner rather than by the container, such as a
+		memory mapped file. The data must not be modified, release drops the
+		reference to \a owner instead of deleting the data.
+	*/
+    void setSharedData(std::uint8_t* data, size_t size, std::shared_ptr<void> owner)
+    {
+        mData = data;
+        mSize = size;
+        mOwner = std::move(owner);
+    }
+
+	//! Return whether the data is owned by another object, see setSharedData.
+    bool isDataShared() const { return mOwner != nullptr; }
 
 	/*!
 	\brief
@@ -110,14 +132,23 @@ public:
 	*/
     void release(void);
 
+	//! Exchange the data, and its ownership, with \a other.
+    void swap(RawDataContainer& other);
+
 private:
     /*************************************************************************
 		Implementation Data
 	*************************************************************************/
     std::uint8_t* mData;
     size_t mSize;
+    //! Owner of mData if the container doesn't own it.
+    std::shared_ptr<void> mOwner;
 };
 
 } // End of  CEGUI namespace section
 
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
 #endif	// end of guard _CEGUIDataContainer_h_
@@ -32,6 +32,7 @@
 #include "CEGUI/Logger.h"
 #include <vector>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 
 #if defined(_MSC_VER)
@@ -58,6 +59,8 @@ public:
     // overridden from Logger
     void logEvent(const String& message, LoggingLevel level = LoggingLevel::Standard) override;
     void setLogFilename(const String& filename, bool append = false) override;
+    //! Also true for all levels while entries are cached, the level may still change.
+    bool isLoggingEnabled(LoggingLevel level) const override { return d_caching || level <= d_level; }
 
 protected:
     //! Stream used to implement the logger
@@ -71,6 +74,8 @@ protected:
     Cache d_cache;
     //! true while log entries are being cached (prior to logfile creation)
     bool d_caching;
+    //! Serialises entries logged from several threads, e.g. by a ResourcePreloader.
+    std::mutex d_mutex;
 };
 
 }
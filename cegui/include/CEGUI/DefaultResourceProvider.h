@@ -32,6 +32,8 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/ResourceProvider.h"
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #if defined(_MSC_VER)
@@ -99,7 +101,62 @@ public:
                                      const String& file_pattern,
                                      const String& resource_group) override;
 
+    /*!
+    \brief
+        Set the size from which files are memory mapped read-only instead of
+        being read into a buffer. This covers font files and large images,
+        whose data is then shared with the file cache instead of being copied.
+
+        Memory mapping is only supported on POSIX systems, files are read on
+        other systems.
+
+    \param bytes
+        The size from which files are mapped, 0 to never map files. The
+        default is 64 KiB.
+    */
+    void setMemoryMappingThreshold(size_t bytes) { d_memoryMappingThreshold = bytes; }
+
+    //! Return the size from which files are memory mapped.
+    size_t getMemoryMappingThreshold() const { return d_memoryMappingThreshold; }
+
+    /*!
+    \brief
+        Set whether a file that is mapped already is shared rather than
+        mapped again, e.g. by several fonts loaded from the same font file.
+        This is disabled by default.
+    */
+    void setSharedMappingsEnabled(bool enabled) { d_sharedMappingsEnabled = enabled; }
+
+    //! Return whether mapped files are shared, see setSharedMappingsEnabled.
+    bool isSharedMappingsEnabled() const { return d_sharedMappingsEnabled; }
+
+    //! Memory used by the files that are currently mapped.
+    struct MappingStatistics
+    {
+        //! Number of mappings, a shared mapping is counted once.
+        size_t d_mappingCount;
+        //! Bytes of the files that are mapped.
+        size_t d_mappedBytes;
+        //! Bytes of the mapped files that are in memory.
+        size_t d_residentBytes;
+    };
+
+    //! Return the memory used by the files that are currently mapped.
+    MappingStatistics getMappingStatistics() const;
+
 protected:
+    //! A read-only mapping of a file, unmapped once no container uses it.
+    class FileMapping;
+
+    /*!
+    \brief
+        Map the file \a final_filename into \a output if it is large enough.
+
+    \return
+        false if the file must be read instead.
+    */
+    bool loadMappedFile(const String& final_filename, RawDataContainer& output);
+
     /*!
     \brief
         Return the final path and filename, taking into account the given
@@ -110,6 +167,14 @@ protected:
 
     typedef std::unordered_map<String, String> ResourceGroupMap;
     ResourceGroupMap    d_resourceGroups;
+
+    typedef std::unordered_multimap<String, std::weak_ptr<FileMapping>> MappingRegistry;
+    //! The mappings in use, by final file name.
+    MappingRegistry d_mappings;
+    //! Guards d_mappings, files may be loaded from several threads.
+    mutable std::mutex d_mappingMutex;
+    size_t d_memoryMappingThreshold = 64 * 1024;
+    bool d_sharedMappingsEnabled = false;
 };
 
 } // End of  CEGUI namespace section
@@ -146,6 +146,19 @@ public:
     //! \brief Fired when "AdjustWidthToContent" or "AdjustHeightToContent" changes.
     static const String EventIsSizeAdjustedToContentChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventSizedId;
+    static const EventId EventMovedId;
+    static const EventId EventHorizontalAlignmentChangedId;
+    static const EventId EventVerticalAlignmentChangedId;
+    static const EventId EventRotatedId;
+    static const EventId EventChildAddedId;
+    static const EventId EventChildRemovedId;
+    static const EventId EventChildOrderChangedId;
+    static const EventId EventZOrderChangedId;
+    static const EventId EventNonClientChangedId;
+    static const EventId EventIsSizeAdjustedToContentChangedId;
+
     /*!
     \brief A tiny wrapper to hide some of the dirty work of rect caching
 
@@ -248,9 +261,35 @@ public:
     }
 
     Element();
+    virtual ~Element() override;
     Element(const Element&) = delete;
     Element& operator=(const Element&) = delete;
 
+    /*!
+    \brief
+        Starts a layout transaction. Transactions may be nested.
+
+        While a transaction is active, notifyScreenAreaChanged only marks the
+        element as needing layout. The marked elements are laid out once, parents
+        before children, when the outermost transaction ends or when
+        flushPendingLayout is called, which GUIContext::draw does. EventMoved and
+        EventSized are then fired once per element for the combined change.
+
+    \note
+        The pixel sizes and rects of the marked elements and their children are
+        not updated before the flush.
+    */
+    static void beginLayoutTransaction();
+
+    //! Ends a layout transaction, flushing the pending layout if it was the outermost one.
+    static void endLayoutTransaction();
+
+    //! Returns whether a layout transaction is active.
+    static bool isLayoutTransactionActive() { return s_layoutTransactionDepth > 0; }
+
+    //! Lays out the elements marked during layout transactions.
+    static void flushPendingLayout();
+
     /*!
     \brief Retrieves parent of this element
 
@@ -1032,6 +1071,10 @@ public:
         Such an action, especially if applied recursively, will impact performance
         before everything is cached again.
 
+    \note
+        While a layout transaction is active the element is only marked as
+        needing layout, see beginLayoutTransaction.
+
     \param adjust_size_to_content
         - true - call adjustSizeToContent() if our size is changed.
     */
@@ -1398,6 +1441,35 @@ public:
     */
     virtual bool contentFits() const;
 
+    /*!
+    \brief
+        Measure the element content as it would be laid out in an area reserved
+        for content of the given width, without changing the element.
+
+        This lets "contentFitsForSpecifiedElementSize" be implemented without
+        resizing the element for every size tried by
+        "getSizeAdjustedToContent_bisection", see
+        "FalagardStaticText::contentFitsForSpecifiedWindowSize".
+
+        The default implementation returns false.
+
+    \param content_area_width
+        Width of the area of the element which is reserved for content.
+
+    \param content_size
+        Receives the width and height of the content.
+
+    \param content_intact
+        Receives whether the content remains "intact" in that width.
+
+    \return
+        false if this type of element can't measure its content.
+
+    \see contentFitsForSpecifiedElementSize
+    \see getContentSize
+    */
+    virtual bool measureContent(float content_area_width, Sizef& content_size, bool& content_intact) const;
+
 protected:
 
     //! \brief Add standard CEGUI::Element properties.
@@ -1629,6 +1701,18 @@ protected:
 
     //! If true, the position and size are pixel aligned
     bool d_pixelAligned = true;
+    //! true if the element is waiting for the pending layout to be flushed.
+    bool d_layoutPending = false;
+    //! true if adjustSizeToContent should be called when the pending layout is flushed.
+    bool d_pendingAdjustSizeToContent = false;
+
+private:
+    //! Number of nested layout transactions.
+    static unsigned int s_layoutTransactionDepth;
+    //! true while the pending layout is being flushed.
+    static bool s_flushingLayout;
+    //! Elements marked during layout transactions, nullptr for destroyed ones.
+    static std::vector<Element*> s_pendingLayout;
 };
 
 } // End of  CEGUI namespace section
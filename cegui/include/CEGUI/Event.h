@@ -28,9 +28,11 @@
 #define _CEGUIEvent_h_
 
 #include "CEGUI/String.h"
+#include "CEGUI/EventId.h"
 #include "CEGUI/BoundSlot.h"
 #include "CEGUI/RefCounted.h"
 #include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -181,6 +183,9 @@ public:
     */
     const String& getName() const { return d_name; }
 
+    //! Return the interned id of the Event's name.
+    EventId getId() const { return d_id; }
+
     /*!
     \brief
         Subscribes some function or object to the Event
@@ -236,6 +241,9 @@ public:
     //! \brief Returns the number of connections to this event
     bool getConnectionCount() const { return d_slots.size(); }
 
+    //! \brief Appends the connections to this event to \a connections
+    void getConnections(std::vector<Connection>& connections) const;
+
 protected:
     friend void CEGUI::BoundSlot::disconnect();
     /*!
@@ -256,6 +264,7 @@ protected:
 
     std::multimap<Group, Connection, std::less<Group>> d_slots;  //!< Collection holding ref-counted bound slots
     const String d_name;    //!< Name of this event
+    const EventId d_id;     //!< Interned name of this event
     bool d_isBeingInvoked = false;
 };
 
@@ -0,0 +1,85 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Interned event names
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIEventId_h_
+#define _CEGUIEventId_h_
+
+#include "CEGUI/String.h"
+#include <cstdint>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Interned event name. Every distinct name is assigned a small integer once,
+    so that events can be found and compared without hashing or comparing
+    their names.
+
+    Each Event interns its name when it is created. A name that was never
+    interned therefore can't have any subscribers, EventId::find returns an
+    invalid id for it without adding it to the registry.
+
+    Ids are only valid within the running process and the registry is not
+    thread safe, like the rest of the event system.
+*/
+class CEGUIEXPORT EventId
+{
+public:
+    //! Value of ids that don't refer to any name.
+    static const std::uint32_t InvalidValue = static_cast<std::uint32_t>(-1);
+
+    //! Creates an invalid id.
+    EventId() = default;
+
+    //! Returns the id of \a name, assigning a new one if it has none yet.
+    explicit EventId(const String& name);
+
+    //! Returns the id of \a name, or an invalid id if it was never interned.
+    static EventId find(const String& name);
+
+    //! Returns the number of names interned so far, ids are less than that.
+    static std::uint32_t getInternedCount();
+
+    bool isValid() const { return d_value != InvalidValue; }
+    std::uint32_t getValue() const { return d_value; }
+
+    //! Returns the interned name, or an empty String for an invalid id.
+    const String& getName() const;
+
+    bool operator==(const EventId& other) const { return d_value == other.d_value; }
+    bool operator!=(const EventId& other) const { return d_value != other.d_value; }
+    bool operator<(const EventId& other) const { return d_value < other.d_value; }
+
+private:
+    explicit EventId(std::uint32_t value) : d_value(value) {}
+
+    std::uint32_t d_value = InvalidValue;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIEventId_h_
@@ -32,6 +32,7 @@
 #include "CEGUI/Event.h"
 #include "CEGUI/IteratorBase.h"
 #include <unordered_map>
+#include <vector>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -215,7 +216,7 @@ public:
         String object containing the name of the Event to remove.  If no such
         Event exists, nothing happens.
     */
-    void removeEvent(const String& name) { d_events.erase(name); }
+    void removeEvent(const String& name);
 
     /*!
     \brief
@@ -244,7 +245,7 @@ public:
         - true if an Event named \a name is defined for this EventSet.
         - false if no Event named \a name is defined for this EventSet.
     */
-    bool isEventPresent(const String& name) const { return d_events.find(name) != d_events.end(); }
+    bool isEventPresent(const String& name) const { return getEventObject(EventId::find(name)) != nullptr; }
 
     /*!
     \brief
@@ -377,6 +378,15 @@ public:
     virtual void fireEvent(const String& name, EventArgs& args,
                            const String& eventNamespace = "");
 
+    /*!
+    \brief
+        Fires the event with the interned name \a id, passing the given
+        EventArgs object. This avoids looking up the name of the event, see
+        fireEvent(const String&, EventArgs&, const String&) for the details.
+    */
+    virtual void fireEvent(EventId id, EventArgs& args,
+                           const String& eventNamespace = "");
+
 
     /*!
     \brief
@@ -423,13 +433,25 @@ public:
     */
     Event* getEventObject(const String& name, bool autoAdd = false);
 
+    //! Return a pointer to the Event object with the interned name \a id, or 0.
+    Event* getEventObject(EventId id) const;
+
 protected:
     //! Implementation event firing member
     void fireEvent_impl(const String& name, EventArgs& args);
+    //! Implementation event firing member
+    void fireEvent_impl(EventId id, EventArgs& args);
+    //! Adds an Event whose name is not yet used to the set, taking ownership of it.
+    Event* addEventObject(Event* event);
+    //! Called when an Event was added to the set.
+    virtual void onEventAdded(Event&) {}
     //! Helper to return the script module pointer or throw.
     ScriptModule* getScriptModule() const;
 
-    std::unordered_map<String, std::unique_ptr<Event>> d_events;
+    typedef std::vector<std::unique_ptr<Event>> EventVector;
+    //! The Events of the set sorted by their id. A name is found through its
+    //! id, so no map keyed by the names is needed.
+    EventVector d_events;
 
     bool d_muted = false;    //!< true if events for this EventSet have been muted.
 
@@ -437,7 +459,17 @@ public:
     /*************************************************************************
         Iterator stuff
     *************************************************************************/
-    typedef ConstMapIterator<std::unordered_map<String, std::unique_ptr<Event>>> EventIterator;
+    //! Iterator over the events of an EventSet, in the order of their ids.
+    class EventIterator : public ConstVectorIterator<EventVector>
+    {
+    public:
+        EventIterator(EventVector::const_iterator start_iter, EventVector::const_iterator end_iter) :
+            ConstVectorIterator<EventVector>(start_iter, end_iter)
+        {}
+
+        //! Return the name of the event at the current iterator position.
+        const String& getCurrentKey() const { return getCurrentValue()->getName(); }
+    };
 
     /*!
     \brief
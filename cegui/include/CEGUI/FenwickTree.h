@@ -0,0 +1,177 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Defines a binary indexed tree for maintaining prefix sums
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFenwickTree_h_
+#define _CEGUIFenwickTree_h_
+
+#include <vector>
+#include <cstddef>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+
+/*!
+\brief
+    Binary indexed (Fenwick) tree over a sequence of non-negative values.
+
+    Changing a single value and querying the sum of the first n values are
+    both O(log n), which makes it suitable for tracking the offsets of
+    variable-height rows, where one row changing size must not require
+    recomputing the offsets of all the rows after it.
+*/
+template<typename T>
+class FenwickTree
+{
+public:
+    //! Replaces the content with the values in [\a first, \a last), in O(n).
+    template<typename InputIterator>
+    void assign(InputIterator first, InputIterator last)
+    {
+        d_values.assign(first, last);
+        d_tree.assign(d_values.size() + 1, T());
+
+        for (size_t i = 1; i < d_tree.size(); ++i)
+        {
+            d_tree[i] += d_values[i - 1];
+
+            const size_t parent = i + (i & (~i + 1));
+            if (parent < d_tree.size())
+                d_tree[parent] += d_tree[i];
+        }
+    }
+
+    //! Appends \a value, in O(log n).
+    void push_back(T value)
+    {
+        if (d_tree.empty())
+            d_tree.push_back(T());
+
+        d_values.push_back(value);
+
+        // the new node covers the value and the nodes of its children
+        const size_t i = d_tree.size();
+        const size_t first = i - (i & (~i + 1));
+        T node = value;
+        for (size_t child = i - 1; child > first; child -= child & (~child + 1))
+            node += d_tree[child];
+
+        d_tree.push_back(node);
+    }
+
+    void clear()
+    {
+        d_values.clear();
+        d_tree.clear();
+    }
+
+    size_t size() const { return d_values.size(); }
+    bool empty() const { return d_values.empty(); }
+
+    //! Returns the value at \a index.
+    T get(size_t index) const { return d_values[index]; }
+
+    //! Sets the value at \a index, in O(log n).
+    void set(size_t index, T value)
+    {
+        const T delta = value - d_values[index];
+        d_values[index] = value;
+
+        for (size_t i = index + 1; i < d_tree.size(); i += i & (~i + 1))
+            d_tree[i] += delta;
+    }
+
+    //! Returns the sum of the first \a count values.
+    T getPrefixSum(size_t count) const
+    {
+        T sum = T();
+        for (size_t i = count; i > 0; i -= i & (~i + 1))
+            sum += d_tree[i];
+
+        return sum;
+    }
+
+    //! Returns the sum of all values.
+    T getTotal() const { return getPrefixSum(d_values.size()); }
+
+    /*!
+    \brief
+        Returns the smallest index for which the sum of the values up to and
+        including it is not less than \a sum, or size() if there is none.
+    */
+    size_t lowerBound(T sum) const
+    {
+        size_t step = 1;
+        while (step * 2 < d_tree.size())
+            step *= 2;
+
+        size_t pos = 0;
+        for (; step > 0; step /= 2)
+        {
+            if (pos + step < d_tree.size() && d_tree[pos + step] < sum)
+            {
+                pos += step;
+                sum -= d_tree[pos];
+            }
+        }
+
+        return pos;
+    }
+
+    /*!
+    \brief
+        Returns the smallest index for which the sum of the values up to and
+        including it is greater than \a sum, or size() if there is none.
+    */
+    size_t upperBound(T sum) const
+    {
+        size_t step = 1;
+        while (step * 2 < d_tree.size())
+            step *= 2;
+
+        size_t pos = 0;
+        for (; step > 0; step /= 2)
+        {
+            if (pos + step < d_tree.size() && !(sum < d_tree[pos + step]))
+            {
+                pos += step;
+                sum -= d_tree[pos];
+            }
+        }
+
+        return pos;
+    }
+
+private:
+    std::vector<T> d_values;
+    //! 1-based tree nodes; d_tree[i] holds the sum of the values in
+    //! (i - lowbit(i), i].
+    std::vector<T> d_tree;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIFenwickTree_h_
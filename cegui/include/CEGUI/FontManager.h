@@ -44,6 +44,7 @@ namespace CEGUI
 {
 class FreeTypeFont;
 class PixmapFont;
+class ResourcePreloader;
 
 
 /*!
@@ -115,6 +116,15 @@ public:
     static FontList createFromFile(const String& xml_filename, const String& resource_group = "",
         XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
 
+    /*!
+    \brief
+        Queues the XML file \a xml_filename and the FreeType font files it
+        refers to in \a preloader, so that a later createFromFile call uses
+        the prepared files.
+    */
+    static void prepareFromFile(ResourcePreloader& preloader, const String& xml_filename,
+                                const String& resource_group = "");
+
     /*!
     \brief
         Creates Font instances from a string and adds them to the collection.
@@ -290,6 +300,15 @@ public:
     */
     void notifyDisplaySizeChanged(const Sizef& size);
 
+    /*!
+    \brief
+        Calls Font::processPendingGlyphs on all fonts.
+
+    \return
+        true if any font changed its glyph images.
+    */
+    bool processPendingGlyphs();
+
     /*!
     \brief
         Writes a full XML font file for the specified Font to the given
@@ -108,6 +108,8 @@ class URect;
 class USize;
 struct TexturedColouredVertex;
 struct ColouredVertex;
+class TextComponent;
+struct TextComponentCache;
 class WidgetLookFeel;
 class Window;
 class WindowFactory;
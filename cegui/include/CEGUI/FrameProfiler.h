@@ -0,0 +1,269 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Scoped timers and counters describing where a frame is spent
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFrameProfiler_h_
+#define _CEGUIFrameProfiler_h_
+
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+#include <array>
+#include <chrono>
+#include <iosfwd>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+//! Values counted by the FrameProfiler for each frame.
+enum class ProfilerCounter : std::uint8_t
+{
+    //! Windows that re-created their geometry.
+    WindowRedraws,
+    //! Calls to Window::invalidate, including the recursive ones.
+    WindowInvalidations,
+    //! GeometryBuffers drawn, i.e. draw calls issued to the renderer.
+    GeometryBuffers,
+    //! Vertices of the GeometryBuffers drawn.
+    Vertices,
+    //! Elements whose screen area was recalculated.
+    LayoutUpdates,
+    EventsFired,
+
+    Count
+};
+
+//! A timed scope recorded by the FrameProfiler.
+struct CEGUIEXPORT ProfilerSample
+{
+    //! Name of the scope, must be a string literal.
+    const char* d_name;
+    //! What the scope worked on, e.g. the type of a window or an event name.
+    String d_detail;
+    //! Start time, in nanoseconds since the creation of the profiler.
+    std::uint64_t d_start;
+    //! Duration in nanoseconds.
+    std::uint64_t d_duration;
+    //! Number of enclosing scopes.
+    std::uint32_t d_depth;
+};
+
+//! Everything recorded by the FrameProfiler between two frame boundaries.
+struct CEGUIEXPORT ProfilerFrame
+{
+    //! Sequential number of the frame, starting at zero.
+    std::uint64_t d_number = 0;
+    //! Start time, in nanoseconds since the creation of the profiler.
+    std::uint64_t d_start = 0;
+    std::uint64_t d_duration = 0;
+    //! Samples in the order their scopes were entered.
+    std::vector<ProfilerSample> d_samples;
+    //! Samples not recorded because the per frame limit was reached.
+    size_t d_droppedSamples = 0;
+    std::array<std::uint64_t, static_cast<size_t>(ProfilerCounter::Count)> d_counters {};
+
+    std::uint64_t getCounter(ProfilerCounter counter) const
+    {
+        return d_counters[static_cast<size_t>(counter)];
+    }
+
+    /*!
+    \brief
+        Returns the total time, in nanoseconds, spent in the scopes named
+        \a name. When \a detail is not empty only scopes with that detail
+        are counted, e.g. the geometry creation of a single widget type.
+        Time spent in nested scopes of the same name is counted once.
+    */
+    std::uint64_t getTotalTime(const char* name, const String& detail = String()) const;
+};
+
+/*!
+\brief
+    Records how long the main parts of a frame take, i.e. drawing the
+    GUIContexts and RenderingSurfaces, updating, laying out and redrawing
+    windows and firing events, and counts the work done per frame.
+
+    The instrumentation in CEGUI is only compiled in when the library is built
+    with CEGUI_USE_FRAME_PROFILER, otherwise the CEGUI_PROFILE_* macros expand
+    to nothing and the profiler records only what the application reports.
+    Recording must also be turned on with setEnabled.
+
+    The frames are kept in a ring buffer of a configurable size and can be
+    exported in the Chrome trace event format, which chrome://tracing and
+    Perfetto can open. System::renderAllGUIContexts ends the current frame,
+    applications not using it must call endFrame themselves.
+
+    The profiler is not thread safe, it must only be used from the thread
+    running the GUI.
+*/
+class CEGUIEXPORT FrameProfiler :
+    public Singleton<FrameProfiler>
+{
+public:
+    FrameProfiler();
+    ~FrameProfiler();
+
+    static FrameProfiler& getSingleton();
+    static FrameProfiler* getSingletonPtr();
+
+    //! Returns the profiler if it exists and records, nullptr otherwise.
+    static FrameProfiler* getActive();
+
+    //! Returns the name of a counter as used in the exported trace.
+    static const char* getCounterName(ProfilerCounter counter);
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return d_enabled; }
+
+    //! Sets how many of the last frames are kept.
+    void setHistorySize(size_t frames);
+    size_t getHistorySize() const { return d_historySize; }
+
+    //! Sets how many samples a frame may hold, further samples are dropped.
+    void setMaxSamplesPerFrame(size_t samples) { d_maxSamplesPerFrame = samples; }
+    size_t getMaxSamplesPerFrame() const { return d_maxSamplesPerFrame; }
+
+    /*!
+    \brief
+        Starts a timed scope and returns its index in the current frame, or
+        -1 if it is not recorded. Prefer ProfileScope to calling this
+        directly.
+    */
+    size_t beginSample(const char* name, const String* detail = nullptr);
+
+    //! Ends a scope started by beginSample.
+    void endSample(size_t sample);
+
+    void addCount(ProfilerCounter counter, std::uint64_t count = 1)
+    {
+        d_current.d_counters[static_cast<size_t>(counter)] += count;
+    }
+
+    //! Closes the current frame, stores it in the history and starts a new one.
+    void endFrame();
+
+    //! Returns the number of frames in the history.
+    size_t getFrameCount() const { return d_frameCount; }
+
+    //! Returns a frame from the history, the oldest one has index zero.
+    const ProfilerFrame& getFrame(size_t index) const;
+
+    //! Returns the most recently finished frame, the history must not be empty.
+    const ProfilerFrame& getLastFrame() const { return getFrame(d_frameCount - 1); }
+
+    //! Drops the history and the data recorded for the current frame.
+    void clear();
+
+    //! Writes the frames in the history as Chrome trace event JSON.
+    void writeChromeTrace(std::ostream& out) const;
+
+protected:
+    std::uint64_t now() const;
+    void resetCurrentFrame(std::uint64_t start);
+
+    std::chrono::steady_clock::time_point d_epoch;
+
+    //! Frame data is recorded into.
+    ProfilerFrame d_current;
+    //! Ring buffer of finished frames, d_firstFrame is the oldest one.
+    std::vector<ProfilerFrame> d_frames;
+    size_t d_firstFrame = 0;
+    size_t d_frameCount = 0;
+    std::uint64_t d_nextFrameNumber = 0;
+
+    size_t d_historySize = 120;
+    size_t d_maxSamplesPerFrame = 65536;
+    std::uint32_t d_depth = 0;
+    bool d_enabled = false;
+};
+
+/*!
+\brief
+    Times the enclosing scope, if there is an active FrameProfiler.
+*/
+class CEGUIEXPORT ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name) :
+        d_profiler(FrameProfiler::getActive())
+    {
+        if (d_profiler)
+            d_sample = d_profiler->beginSample(name);
+    }
+
+    ProfileScope(const char* name, const String& detail) :
+        d_profiler(FrameProfiler::getActive())
+    {
+        if (d_profiler)
+            d_sample = d_profiler->beginSample(name, &detail);
+    }
+
+    ~ProfileScope()
+    {
+        if (d_profiler)
+            d_profiler->endSample(d_sample);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    FrameProfiler* d_profiler;
+    size_t d_sample = static_cast<size_t>(-1);
+};
+
+}
+
+#define CEGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CEGUI_PROFILE_CONCAT(a, b) CEGUI_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef CEGUI_USE_FRAME_PROFILER
+//! Times the rest of the enclosing scope under the given name.
+#   define CEGUI_PROFILE_SCOPE(name) \
+        CEGUI::ProfileScope CEGUI_PROFILE_CONCAT(ceguiProfileScope, __LINE__)(name)
+//! Like CEGUI_PROFILE_SCOPE, \a detail must be a String valid during the call.
+#   define CEGUI_PROFILE_SCOPE_DETAIL(name, detail) \
+        CEGUI::ProfileScope CEGUI_PROFILE_CONCAT(ceguiProfileScope, __LINE__)(name, detail)
+//! Adds \a count to one of the ProfilerCounter values of the current frame.
+#   define CEGUI_PROFILE_COUNT(counter, count) \
+        do { \
+            if (CEGUI::FrameProfiler* ceguiProfiler = CEGUI::FrameProfiler::getActive()) \
+                ceguiProfiler->addCount(CEGUI::ProfilerCounter::counter, count); \
+        } while (false)
+#else
+#   define CEGUI_PROFILE_SCOPE(name) ((void)0)
+#   define CEGUI_PROFILE_SCOPE_DETAIL(name, detail) ((void)0)
+#   define CEGUI_PROFILE_COUNT(counter, count) ((void)0)
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
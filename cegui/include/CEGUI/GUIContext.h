@@ -90,6 +90,15 @@ public:
         */
     static const String EventTooltipTransition;
 
+    //! Ids of the event names above.
+    static const EventId EventRootWindowChangedId;
+    static const EventId EventCursorImageChangedId;
+    static const EventId EventDefaultCursorImageChangedId;
+    static const EventId EventDefaultFontChangedId;
+    static const EventId EventTooltipActiveId;
+    static const EventId EventTooltipInactiveId;
+    static const EventId EventTooltipTransitionId;
+
     //! A rect that is used to unset cursor constraints
     static const URect NoCursorConstraint;
 
@@ -0,0 +1,162 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Compiles GUILayouts to a binary form and loads them
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGUILayout_binaryHandler_h_
+#define _CEGUIGUILayout_binaryHandler_h_
+
+#include "CEGUI/WindowManager.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Compiles GUILayout XML into binary layouts and creates the windows of
+    binary layouts.
+
+    A binary layout holds the elements of a GUILayout XML document in order,
+    with the imported layouts inlined. All strings (window types, names,
+    property names and string values) are stored once in a table at the start
+    of the data and referred to by index. The compiler creates the windows of
+    the layout to find the type of each property; values of properties of the
+    common types are stored in their native representation and are applied
+    through TypedProperty::setNative, so loading doesn't parse or convert any
+    text. Values of other properties are stored as strings.
+
+    All numbers are stored little-endian:
+    - header: the magic "CGBL", the format version and the string count.
+    - string table: the byte count and the UTF-8 code units of each string.
+    - records: a RecordType followed by the strings and value of the element.
+*/
+class GUILayout_binaryHandler
+{
+    typedef WindowManager::PropertyCallback PropertyCallback;
+public:
+    //! The format version written and the only one that is loaded.
+    static const std::uint32_t NativeVersion;
+
+    GUILayout_binaryHandler(PropertyCallback* callback = nullptr, void* userdata = nullptr) :
+        d_propertyCallback(callback),
+        d_userData(userdata)
+    {}
+
+    /*!
+    \brief
+        Creates the windows of the binary layout in \a source and returns the
+        root window.
+
+    \exception InvalidRequestException
+        Thrown if the data isn't a binary layout of the native version, or if
+        a window can't be created. The windows created so far are destroyed.
+    */
+    Window* load(const RawDataContainer& source);
+
+    //! Compiles the GUILayout XML file \a filename and writes the binary layout to \a out_stream.
+    static void compileFile(const String& filename, const String& resourceGroup,
+                            OutStream& out_stream);
+
+    //! Compiles the GUILayout XML held in \a source and writes the binary layout to \a out_stream.
+    static void compileString(const String& source, OutStream& out_stream);
+
+private:
+    class Writer;
+    class Compiler;
+
+    //! Element of the layout a record stands for.
+    enum class RecordType : std::uint8_t
+    {
+        WindowStart,
+        WindowEnd,
+        AutoWindowStart,
+        AutoWindowEnd,
+        Property,
+        UserString,
+        Event
+    };
+
+    //! Representation of a property value.
+    enum class ValueType : std::uint8_t
+    {
+        String,
+        Bool,
+        Int,
+        UInt,
+        Float,
+        UDim,
+        UVector2,
+        USize,
+        URect,
+        UBox,
+        Colour,
+        ColourRect
+    };
+
+    void readWindowStart();
+    void readAutoWindowStart();
+    void readProperty();
+    template<typename T>
+    void readPropertyValue(Window& window, const String& name);
+    //! Returns the window the current record belongs to.
+    Window& getCurrentWindow() const;
+
+    void readBytes(void* out, size_t count);
+    std::uint8_t readByte();
+    std::uint32_t readUInt();
+    const String& readString();
+
+    void readNative(String& value) { value = readString(); }
+    void readNative(bool& value) { value = readByte() != 0; }
+    void readNative(std::int32_t& value) { value = static_cast<std::int32_t>(readUInt()); }
+    void readNative(std::uint32_t& value) { value = readUInt(); }
+    void readNative(float& value);
+    void readNative(UDim& value);
+    void readNative(UVector2& value);
+    void readNative(USize& value);
+    void readNative(URect& value);
+    void readNative(UBox& value);
+    void readNative(Colour& value);
+    void readNative(ColourRect& value);
+
+    //! Destroy all windows created so far.
+    void cleanupLoadedWindows();
+
+    //! Window being defined and whether it was created by the load.
+    typedef std::pair<Window*, bool> WindowStackEntry;
+
+    PropertyCallback* d_propertyCallback;
+    void* d_userData;
+    const std::uint8_t* d_data = nullptr;
+    const std::uint8_t* d_dataEnd = nullptr;
+    std::vector<String> d_strings;
+    std::vector<WindowStackEntry> d_stack;
+    Window* d_root = nullptr;
+};
+
+}
+
+#endif
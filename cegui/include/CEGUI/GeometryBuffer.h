@@ -168,6 +168,9 @@ public:
     */
     void setCustomTransform(const glm::mat4x4& transformation);
 
+    //! Returns the custom transformation matrix set for the buffer.
+    const glm::mat4x4& getCustomTransform() const { return d_customTransform; }
+
     /*!
     \brief
         Set the clipping region to be used when rendering this buffer. The
@@ -191,6 +194,9 @@ public:
     */
     void setStencilRenderingActive(PolygonFillRule fill_rule) { d_polygonFillRule = fill_rule; }
 
+    //! Returns the fill rule used when rendering the geometry.
+    PolygonFillRule getPolygonFillRule() const { return d_polygonFillRule; }
+
     /*!
     \brief
         Sets the number of vertices that should be rendered after the stencil buffer was filled.
@@ -200,6 +206,9 @@ public:
     */
     void setStencilPostRenderingVertexCount(unsigned int vertex_count) { d_postStencilVertexCount = vertex_count; }
 
+    //! Returns the number of vertices rendered after the stencil buffer was filled.
+    unsigned int getStencilPostRenderingVertexCount() const { return d_postStencilVertexCount; }
+
     /*!
     \brief
         Append the geometry data to the existing data
@@ -225,6 +234,90 @@ public:
     */
     void appendSolidRect(const Rectf& rect, const ColourRect& colours);
 
+    /*!
+    \brief
+        Appends solid coloured rectangles, two triangles each. The buffer must
+        use the ColouredVertex layout.
+
+    \param rects
+        Array of \a count rectangles to generate vertices for.
+
+    \param colours
+        Colours of the rectangle corners. Either a single ColourRect shared by
+        all rectangles, or one per rectangle, see \a colour_count.
+
+    \param colour_count
+        Number of elements in \a colours, must be 1 or \a count.
+
+    \param clip_rect
+        If not nullptr, the rectangles are clipped against it. Rectangles
+        that end up empty are skipped.
+
+    \return
+        The number of rectangles appended.
+    */
+    size_t appendSolidRects(const Rectf* rects, size_t count, const ColourRect* colours,
+        size_t colour_count, const Rectf* clip_rect = nullptr);
+
+    /*!
+    \brief
+        Appends textured quads, two triangles each. The buffer must use the
+        TexturedColouredVertex layout.
+
+    \param dest_rects
+        Array of \a count rectangles the quads cover.
+
+    \param tex_rects
+        Array of \a count normalised texture coordinate rectangles, mapped
+        onto the corresponding \a dest_rects before clipping.
+
+    \param colours
+        Colours of the quad corners. Either a single ColourRect shared by all
+        quads, or one per quad, see \a colour_count.
+
+    \param colour_count
+        Number of elements in \a colours, must be 1 or \a count.
+
+    \param clip_rect
+        If not nullptr, the quads are clipped against it and their texture
+        coordinates adjusted accordingly. Quads that end up empty are skipped.
+
+    \return
+        The number of quads appended.
+    */
+    size_t appendTexturedQuads(const Rectf* dest_rects, const Rectf* tex_rects, size_t count,
+        const ColourRect* colours, size_t colour_count, const Rectf* clip_rect = nullptr);
+
+    /*!
+    \brief
+        Writes the vertices of textured quads, in the TexturedColouredVertex
+        layout, as done by appendTexturedQuads.
+
+    \param out
+        Destination, must have room for 6 vertices per quad.
+
+    \return
+        The number of quads written.
+    */
+    static size_t writeTexturedQuads(float* out, const Rectf* dest_rects, const Rectf* tex_rects,
+        size_t count, const ColourRect* colours, size_t colour_count, const Rectf* clip_rect);
+
+    //! Writes the vertices of solid rectangles, as done by appendSolidRects.
+    static size_t writeSolidRects(float* out, const Rectf* rects, size_t count,
+        const ColourRect* colours, size_t colour_count, const Rectf* clip_rect);
+
+    //! Returns whether the quad functions above can use SSE2 or NEON.
+    static bool isSIMDQuadKernelAvailable();
+
+    /*!
+    \brief
+        Sets whether the quad functions above use SSE2 or NEON when available,
+        instead of the portable code. They are enabled by default, disabling
+        them is meant for testing and debugging.
+    */
+    static void setSIMDQuadKernelEnabled(bool enabled);
+    static bool isSIMDQuadKernelEnabled();
+
     /*!
     \brief
         Append a single vertex to the buffer.
@@ -506,6 +599,48 @@ public:
 
     const std::vector<float>& getVertexData() const { return d_vertexData; }
 
+    /*!
+    \brief
+        Returns whether the vertices of this GeometryBuffer can be merged with
+        those of other buffers into a single vertex stream. This requires that
+        no RenderEffect and no stencil filling is used, and that the model
+        matrix is a plain translation.
+    */
+    bool isMergeable() const;
+
+    /*!
+    \brief
+        Returns whether this GeometryBuffer and \a other are drawn with the
+        same vertex layout, shader, shader parameters, blend mode and alpha.
+    */
+    bool hasSameRenderState(const GeometryBuffer& other) const;
+
+    /*!
+    \brief
+        Makes this GeometryBuffer use the shader parameters, blend mode and
+        alpha of \a other. The vertex layouts of both buffers must be the same.
+
+    \return
+        false if the RenderMaterial of this buffer uses a different shader or
+        different parameters than the one of \a other, nothing is changed then.
+    */
+    bool copyRenderState(const GeometryBuffer& other);
+
+    /*!
+    \brief
+        Returns the bounding rectangle of the vertices, offset by the
+        translation of the buffer. Returns an empty Rectf if there are no
+        vertices.
+    */
+    Rectf getTranslatedBounds() const;
+
+    /*!
+    \brief
+        Appends the vertices of \a source, offset by the translation of
+        \a source. Both buffers must use the same vertex layout.
+    */
+    void appendTranslatedGeometry(const GeometryBuffer& source);
+
 protected:
 
     GeometryBuffer(RefCounted<RenderMaterial> renderMaterial);
@@ -93,6 +93,28 @@ public:
 		Nothing.
 	*/
     void fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "") override;
+
+	/*!
+	\brief
+		Fires the event with the interned name \a id, see fireEvent(const String&, EventArgs&, const String&).
+	*/
+    void fireEvent(EventId id, EventArgs& args, const String& eventNamespace = "") override;
+
+	/*!
+	\brief
+		Fires the global event for the event \a id of the namespace \a eventNamespace.
+
+		Names nothing was subscribed to in any namespace are filtered out without
+		building the namespaced name, so firing events nobody listens to globally
+		is cheap.
+	*/
+    void fireGlobalEvent(EventId id, EventArgs& args, const String& eventNamespace);
+
+protected:
+    void onEventAdded(Event& event) override;
+
+    //! Flags, indexed by EventId, of event names used by the events of this set, without namespace.
+    std::vector<bool> d_subscribedNames;
 };
 
 } // End of  CEGUI namespace section
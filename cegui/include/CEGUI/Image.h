@@ -309,6 +309,13 @@ public:
     */
     void setNativeResolution(const Sizef& native_res);
 
+    /*!
+    \brief
+        Copies everything but the name from \a image, which must be of the
+        same type as this Image. Used to update Image objects in place when
+        their imageset is reloaded.
+    */
+    virtual void assign(const Image& image);
 
     /*!
     \brief
@@ -35,6 +35,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/ImageFactory.h"
 #include <unordered_map>
+#include <unordered_set>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -44,6 +45,9 @@
 namespace CEGUI
 {
 class ImageFactory;
+class ResourcePreloader;
+class Texture;
+class SVGData;
 
 class CEGUIEXPORT ImageManager :
         public Singleton<ImageManager>,
@@ -144,9 +148,44 @@ public:
     void loadImageset(const String& filename, const String& resource_group = "");
     void loadImagesetFromString(const String& source);
 
+    /*!
+    \brief
+        Queues the imageset file \a filename and the image file of the
+        imageset in \a preloader, so that a later loadImageset call uses the
+        prepared files.
+    */
+    static void prepareImageset(ResourcePreloader& preloader, const String& filename,
+                                const String& resource_group = "");
+
+    /*!
+    \brief
+        Destroys the images whose names start with \a prefix followed by a
+        '/', such as the images of the imageset named \a prefix. The images
+        are indexed by prefix, so this only visits the images of the
+        collection.
+
+    \param delete_texture
+        Whether to also destroy the texture named \a prefix.
+    */
     void destroyImageCollection(const String& prefix,
                                 const bool delete_texture = true);
 
+    /*!
+    \brief
+        Reloads an imageset that was loaded before, updating the existing
+        Image objects in place so that windows using them don't have to look
+        them up again.
+
+        The file is parsed before anything is changed, if that fails the
+        imageset is left as it was. The texture or SVGData of the imageset is
+        then reloaded from its file, images that exist already are assigned
+        their new settings, images that are new are created and images of the
+        collection that are no longer in the file are destroyed. An image whose
+        type changed is replaced by a new Image object. An imageset that was
+        not loaded before is loaded as by loadImageset.
+    */
+    void reloadImageset(const String& filename, const String& resource_group = "");
+
     void addBitmapImageFromFile(const String& name,
                           const String& filename,
                           const String& resource_group = "");
@@ -212,9 +251,31 @@ private:
     //! helper to delete an image given an map iterator.
     void destroy(ImageMap::iterator& iter);
 
+    //! Creates an image of the current imageset's type without registering it.
+    ImagePair createImage(const XMLAttributes& attributes) const;
+    //! Adds an image created by createImage to the image and collection maps.
+    void registerImage(const ImagePair& image);
+    //! Adds or removes an image from the collections of the prefixes of its name.
+    void addToCollections(Image& image);
+    void removeFromCollections(Image& image);
+
     // XML parsing helper functions.
     void elementImagesetStart(const XMLAttributes& attributes);
 
+    //! State of the imageset parsed by reloadImageset.
+    struct ImagesetReload
+    {
+        //! Name of the imageset, the prefix of the names of its images.
+        String d_name;
+        String d_imageFile;
+        String d_resourceGroup;
+        //! Texture or SVGData that existed before and has to be reloaded.
+        Texture* d_texture = nullptr;
+        SVGData* d_svgData = nullptr;
+        //! Images parsed from the file, not registered yet.
+        ImageMap d_images;
+    };
+
     // Get or create the Imageset's texture
     void retrieveImagesetTexture(const String& name, const String& filename, const String &resource_group);
 
@@ -232,6 +293,10 @@ private:
     ImageFactoryRegistry d_factories;
     //! container holding the images.
     ImageMap d_images;
+    //! images by each prefix of their names that is followed by a '/'.
+    std::unordered_map<String, std::unordered_set<Image*>> d_imageCollections;
+    //! imageset being parsed by reloadImageset, nullptr when loading as usual.
+    ImagesetReload* d_reload = nullptr;
 };
 
 //---------------------------------------------------------------------------//
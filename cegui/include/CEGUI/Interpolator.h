@@ -33,6 +33,45 @@
 
 namespace CEGUI
 {
+class Property;
+class PropertyReceiver;
+
+/*!
+\brief
+    Binding of an Interpolator to one Property of one animation target
+
+    Bindings are created by Interpolator::createBinding once per
+    AnimationInstance and Affector. They keep key frame and base values parsed
+    in the native type of the property and apply the interpolated result
+    through the native setter, so that no String conversion and no property
+    lookup by name is needed while the animation is running.
+
+\see
+    Interpolator::createBinding
+*/
+class CEGUIEXPORT InterpolatorBinding
+{
+public:
+    //! destructor
+    virtual ~InterpolatorBinding() = default;
+
+    //! native counterpart of Interpolator::interpolateAbsolute
+    virtual void applyAbsolute(const String& value1,
+                               const String& value2,
+                               float position) = 0;
+
+    //! native counterpart of Interpolator::interpolateRelative
+    virtual void applyRelative(const String& base,
+                               const String& value1,
+                               const String& value2,
+                               float position) = 0;
+
+    //! native counterpart of Interpolator::interpolateRelativeMultiply
+    virtual void applyRelativeMultiply(const String& base,
+                                       const String& value1,
+                                       const String& value2,
+                                       float position) = 0;
+};
 
 /*!
 \brief
@@ -83,6 +122,22 @@ public:
             const String& value1,
             const String& value2,
             float position) = 0;
+
+    /*!
+    \brief
+        Creates a binding that applies values interpolated by this Interpolator
+        directly to the given Property of the given target.
+
+    \return
+        A new InterpolatorBinding that the caller takes ownership of, or
+        nullptr if this Interpolator can't work with the native type of the
+        property. The String based interpolate methods are used in that case.
+    */
+    virtual InterpolatorBinding* createBinding(PropertyReceiver* /*target*/,
+                                               Property* /*property*/)
+    {
+        return nullptr;
+    }
 };
 
 } // End of  CEGUI namespace section
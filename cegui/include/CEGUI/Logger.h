@@ -97,6 +97,22 @@ public:
 	LoggingLevel	getLoggingLevel(void) const		{return d_level;}
 
 
+    /*!
+    \brief
+        Return whether a message of the given level would be logged. Check this
+        before building an expensive message, so that nothing has to be
+        formatted for messages that are filtered out.
+
+    \param level
+        LoggingLevel of the message.
+
+    \return
+        - true if logEvent would use a message of level \a level.
+        - false if such a message would be discarded.
+    */
+    virtual bool isLoggingEnabled(LoggingLevel level) const { return level <= d_level; }
+
+
 	/*!
 	\brief
 		Add an event to the log.
@@ -168,6 +168,21 @@ public:
 	virtual void	set(PropertyReceiver* receiver, const String& value) = 0;
 
 
+    /*!
+    \brief
+        Sets the value of the property on \a target to its value on \a source.
+        Both objects must have this Property. Typed properties copy the native
+        value, the base implementation goes through a String.
+
+    \param source
+        Pointer to the object the value is read from.
+
+    \param target
+        Pointer to the object the value is assigned to.
+    */
+    virtual void copyValue(const PropertyReceiver* source, PropertyReceiver* target);
+
+
 	/*!
 	\brief
 		Returns whether the property is at it's default value.
@@ -33,6 +33,7 @@
 #include "CEGUI/IteratorBase.h"
 #include "CEGUI/TplWindowProperty.h" // for CEGUI_DEFINE_PROPERTY, see below //???move both out of here?
 #include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -95,6 +96,12 @@ Properties added to them.
 It is recommended to use the \a CEGUI_DEFINE_PROPERTY macro instead of using
 PropertySet::addProperty directly. This takes care of property initialisation
 as well as it's addition to the PropertySet instance.
+
+The properties defined by the macro are added with PropertySet::addClassProperty.
+PropertySets that had the same class properties added in the same order, which
+is the case for all instances of a class, share a single immutable table of
+them. Only the properties added with PropertySet::addProperty, e.g. the
+properties defined by a WidgetLookFeel, are stored per instance.
 */
 class CEGUIEXPORT PropertySet : public PropertyReceiver
 {
@@ -103,7 +110,7 @@ public:
 	\brief
 		Constructs a new PropertySet object
 	*/
-    PropertySet(void) {}
+    PropertySet(void);
 
 
     /*!
@@ -129,6 +136,19 @@ public:
 	*/
     void addProperty(Property* property);
 
+    /*!
+    \brief
+        Adds a Property that is added to every instance of a class. The table
+        of such properties is shared by all PropertySets that had the same
+        class properties added in the same order. The Property must exist for
+        as long as any PropertySet does, i.e. it should be static. This is
+        what CEGUI_DEFINE_PROPERTY uses.
+
+    \exception NullObjectException		Thrown if \a property is NULL.
+    \exception AlreadyExistsException	Thrown if a Property with the same name as \a property already exists in the PropertySet
+    */
+    void addClassProperty(Property* property);
+
 
     /*!
 	\brief
@@ -211,14 +231,7 @@ public:
     template<typename T>
     typename PropertyHelper<T>::return_type getProperty(const String& name) const
     {
-        PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-        if (pos == d_properties.end())
-        {
-            throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-        }
-
-        Property* baseProperty = pos->second;
+        Property* baseProperty = getPropertyInstance(name);
         TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
 
         if (typedProperty)
@@ -257,14 +270,7 @@ public:
     template<typename T>
     void    setProperty(const String& name, typename PropertyHelper<T>::pass_type value)
     {
-        PropertyRegistry::iterator pos = d_properties.find(name);
-
-        if (pos == d_properties.end())
-        {
-            throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-        }
-
-        Property* baseProperty = pos->second;
+        Property* baseProperty = getPropertyInstance(name);
         TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
 
         if (typedProperty)
@@ -305,16 +311,87 @@ public:
 	*/
     String getPropertyDefault(const String& name) const;
 
+    /*!
+    \brief
+        Returns a number that changes whenever a Property is added to or
+        removed from this PropertySet.
+
+        This allows to keep Property pointers obtained via
+        PropertySet::getPropertyInstance and to check cheaply whether they
+        are still valid for this set.
+    */
+    std::uint32_t getPropertiesRevision() const { return d_propertiesRevision; }
+
 private:
     typedef std::unordered_map<String, Property*> PropertyRegistry;
+    /*!
+        Class properties shared by all PropertySets that added them in the
+        same order. The tables are global and may be used from several
+        threads at once.
+    */
+    struct PropertyTable;
+
+    //! Returns the Property named \a name, or 0 if there is none.
+    Property* findProperty(const String& name) const;
+
+    //! Moves the class properties into d_properties, so that they can be removed.
+    void unshareClassProperties();
+
+    //! Table of the class properties, 0 once they were moved into d_properties.
+    const PropertyTable* d_classProperties;
+    //! Properties added to this instance only.
     PropertyRegistry	d_properties;
+    //! incremented whenever the set of properties changes
+    std::uint32_t d_propertiesRevision = 0;
 
 
 public:
     /*************************************************************************
 		Iterator stuff
 	*************************************************************************/
-    typedef	ConstMapIterator<PropertyRegistry> PropertyIterator;
+    /*!
+    \brief
+        Iterator over the class properties and the instance properties of a
+        PropertySet. It is invalidated when properties are added to or removed
+        from the set.
+    */
+    class CEGUIEXPORT PropertyIterator
+    {
+    public:
+        PropertyIterator(const std::vector<Property*>* classProperties,
+                         const PropertyRegistry& properties);
+
+        //! Return the Property at the current iterator position.
+        Property* getCurrentValue() const;
+
+        //! Return the name of the Property at the current iterator position.
+        const String& getCurrentKey() const { return getCurrentValue()->getName(); }
+
+        bool isAtEnd() const;
+        bool isAtStart() const;
+
+        //! Set the iterator current position to the start position.
+        void toStart();
+
+        //! Set the iterator current position to the end position.
+        void toEnd();
+
+        PropertyIterator& operator++();
+        PropertyIterator operator++(int);
+
+        bool operator==(const PropertyIterator& rhs) const;
+        bool operator!=(const PropertyIterator& rhs) const { return !(*this == rhs); }
+
+        Property* operator*() const { return getCurrentValue(); }
+
+    private:
+        //! Class properties in the order they were added, may be 0.
+        const std::vector<Property*>* d_classProperties;
+        size_t d_classIndex;
+        PropertyRegistry::const_iterator d_startIter;
+        PropertyRegistry::const_iterator d_currIter;
+        PropertyRegistry::const_iterator d_endIter;
+    };
 
     /*!
     \brief
@@ -345,7 +422,7 @@ Example of usage inside addStandardProperties or a similar method:
     static ::CEGUI::TplWindowProperty<class_type, property_native_type> sProperty(\
             name, help, propertyOrigin, setter, getter, default_value);\
     \
-    this->addProperty(&sProperty);\
+    this->addClassProperty(&sProperty);\
 }
 
 /*!
@@ -374,7 +451,7 @@ Example of usage inside addStandardProperties or similar method:
     static ::CEGUI::TplWindowProperty<class_type, property_native_type> sProperty(\
             name, help, propertyOrigin, setter, getter, default_value, false);\
     \
-    this->addProperty(&sProperty);\
+    this->addClassProperty(&sProperty);\
 }
 
 } // End of  CEGUI namespace section
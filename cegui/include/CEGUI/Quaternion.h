@@ -31,7 +31,7 @@
 #define _CEGUIQuaternion_h_
 
 #include "CEGUI/Base.h"
-#include "CEGUI/Interpolator.h"
+#include "CEGUI/TplInterpolators.h"
 #include <cmath>
 
 #include <glm/glm.hpp>
@@ -70,6 +70,27 @@ public:
                                                const String& value1,
                                                const String& value2,
                                                float position) override;
+
+    //! \copydoc Interpolator::createBinding
+    InterpolatorBinding* createBinding(PropertyReceiver* target,
+                                       Property* property) override;
+
+    //! native version of interpolateAbsolute
+    glm::quat interpolateAbsoluteNative(const glm::quat& val1,
+                                        const glm::quat& val2,
+                                        float position);
+
+    //! native version of interpolateRelative
+    glm::quat interpolateRelativeNative(const glm::quat& bas,
+                                        const glm::quat& val1,
+                                        const glm::quat& val2,
+                                        float position);
+
+    //! native version of interpolateRelativeMultiply
+    glm::quat interpolateRelativeMultiplyNative(const glm::quat& bas,
+                                                float val1,
+                                                float val2,
+                                                float position);
 };
 
 }
@@ -39,6 +39,15 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//! Draw call counts of a RenderQueue, before and after merging GeometryBuffers.
+struct CEGUIEXPORT RenderQueueBatchStats
+{
+    //! Number of queued GeometryBuffers with vertices.
+    size_t d_bufferCount = 0;
+    //! Number of draw calls after merging.
+    size_t d_drawCallCount = 0;
+};
+
 /*!
 \brief
     Class that represents a queue of GeometryBuffer objects to be rendered.
@@ -48,10 +57,23 @@ namespace CEGUI
     take ownership of them - it is up to other parts of the system to manage the
     lifetime of the GeometryBuffer objects (and to remove them from any
     RenderQueue to which they may be attached prior to destoying them).
+
+    When batching is enabled, updateBatches merges queued GeometryBuffers that
+    share vertex layout, shader, shader parameters, blend mode, alpha and
+    effective clipping into vertex streams owned by the queue, so that they
+    are drawn with a single draw call. A buffer is moved to an earlier batch
+    only if it does not overlap anything drawn in between, so the result looks
+    the same as drawing the buffers one by one.
 */
 class CEGUIEXPORT RenderQueue 
 {
 public:
+    RenderQueue() = default;
+    ~RenderQueue();
+
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
     /*!
     \brief
         Draw all GeometryBuffer objects currently listed in the RenderQueue.
@@ -103,10 +125,46 @@ public:
     typedef std::vector<GeometryBuffer*> BufferList;
     BufferList& getBuffers()         {return d_buffers;}
 
+    /*!
+    \brief
+        Enables or disables merging of the queued GeometryBuffers. Disabled
+        by default.
+    */
+    void setBatchingEnabled(bool enabled);
+    bool isBatchingEnabled() const { return d_batchingEnabled; }
+
+    /*!
+    \brief
+        Merges the queued GeometryBuffers into batches, from their current
+        content. Does nothing if batching is disabled. Batches are dropped
+        when the queue is modified, until this is called again.
+    */
+    void updateBatches();
+
+    /*!
+    \brief
+        Returns the GeometryBuffers that draw() draws: the merged batches if
+        they are up to date, otherwise the queued buffers.
+    */
+    const BufferList& getDrawBuffers() const { return d_batchesValid ? d_drawBuffers : d_buffers; }
+
+    //! Returns the draw call counts of the last updateBatches call.
+    const RenderQueueBatchStats& getBatchStats() const { return d_batchStats; }
+
 private:
 
+    //! Destroys the GeometryBuffers holding merged vertices.
+    void destroyBatchBuffers();
+
     //! Collection of GeometryBuffer objects that comprise this RenderQueue.
     BufferList d_buffers;
+    //! Buffers drawn when batching: merged batches and unmerged queued buffers.
+    BufferList d_drawBuffers;
+    //! GeometryBuffers owned by the queue and holding merged vertices.
+    BufferList d_batchBuffers;
+    RenderQueueBatchStats d_batchStats;
+    bool d_batchingEnabled = false;
+    bool d_batchesValid = false;
 };
 
 } // End of  CEGUI namespace section
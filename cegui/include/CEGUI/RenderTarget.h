@@ -74,6 +74,9 @@ public:
      */
     static const String EventAreaChanged;
 
+    //! Id of the event name above.
+    static const EventId EventAreaChangedId;
+
     /*!
     \brief
         Draw geometry from the given GeometryBuffer onto the surface that
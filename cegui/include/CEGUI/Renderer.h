@@ -85,6 +85,25 @@ enum class DefaultShaderType : int
 
 //----------------------------------------------------------------------------//
 
+/*!
+\brief
+    Statistics about the reuse of GeometryBuffer objects through the pool that
+    is maintained by each Renderer.
+*/
+struct CEGUIEXPORT GeometryBufferPoolStats
+{
+    //! Number of GeometryBuffer requests that were served from the pool.
+    size_t d_hits = 0;
+    //! Number of GeometryBuffer requests that required a new GeometryBuffer.
+    size_t d_misses = 0;
+    //! Number of GeometryBuffer objects currently waiting in the pool.
+    size_t d_pooledBuffers = 0;
+    //! Bytes of vertex storage kept allocated by the pooled GeometryBuffers.
+    size_t d_pooledBytes = 0;
+};
+
+//----------------------------------------------------------------------------//
+
 /*!
 \brief
     Abstract class defining the basic required interface for Renderer objects.
@@ -173,12 +192,44 @@ public:
     */
     void destroyGeometryBuffer(GeometryBuffer& buffer);
 
+    /*!
+    \brief
+        Destroys all GeometryBuffers in the given list and clears it.
+
+        The buffers are returned to the pool in reverse order, so that an owner
+        requesting the same kinds of GeometryBuffer again in the same order
+        gets back exactly the buffers it had before, with their vertex storage
+        already allocated.
+
+    \param buffers
+        The list of GeometryBuffer objects to be destroyed.
+    */
+    void destroyGeometryBuffers(std::vector<GeometryBuffer*>& buffers);
+
     /*!
     \brief
         Destroys all GeometryBuffer objects created by this Renderer.
     */
     void destroyAllGeometryBuffers();
 
+    /*!
+    \brief
+        Frees all GeometryBuffer objects which are currently kept in the pool
+        of reusable buffers, together with their vertex storage.
+    */
+    void clearGeometryBufferPool();
+
+    /*!
+    \brief
+        Returns statistics about the reuse of pooled GeometryBuffer objects.
+
+    \see Renderer::resetGeometryBufferPoolStats
+    */
+    GeometryBufferPoolStats getGeometryBufferPoolStats() const;
+
+    //! Resets the hit and miss counters of the GeometryBuffer pool.
+    void resetGeometryBufferPoolStats();
+
     /*!
     \brief
         Create a TextureTarget that can be used to cache imagery; this is a
@@ -550,6 +601,10 @@ private:
     std::set<GeometryBuffer*> d_geometryBuffers;
     //! Pool of reusable geometry buffers
     std::map<const ShaderWrapper*, std::vector<GeometryBuffer*>> d_geomeryBufferPool;
+    //! Number of geometry buffer requests served from the pool
+    size_t d_geometryBufferPoolHits = 0;
+    //! Number of geometry buffer requests that required a new buffer
+    size_t d_geometryBufferPoolMisses = 0;
     //! The Font scale factor to be used when rendering Fonts (except Bitmap Fonts).
     float d_fontScale;
 };
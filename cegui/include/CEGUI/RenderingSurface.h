@@ -125,6 +125,10 @@ public:
      */
     static const String EventRenderQueueEnded;
 
+    //! Ids of the event names above.
+    static const EventId EventRenderQueueStartedId;
+    static const EventId EventRenderQueueEndedId;
+
     /*!
     \brief
         Constructor for RenderingSurface objects.
@@ -362,6 +366,18 @@ public:
 
     std::map<RenderQueueID, RenderQueue>& getRenderQueueList() { return d_queues; }
 
+    /*!
+    \brief
+        Enables or disables merging of GeometryBuffers in the rendering queues
+        of this surface and of the RenderingWindows it owns, see RenderQueue.
+        Disabled by default.
+    */
+    void setGeometryBatchingEnabled(bool enabled);
+    bool isGeometryBatchingEnabled() const { return d_geometryBatchingEnabled; }
+
+    //! Returns the draw call counts of all rendering queues from their last draw.
+    RenderQueueBatchStats getGeometryBatchStats() const;
+
 protected:
     /** draw the surface content. Default impl draws the render queues.
      * NB: Called between RenderTarget activate and deactivate calls.
@@ -385,6 +401,8 @@ protected:
     RenderTarget* d_target;
     //! holds invalidated state of target (as far as we are concerned)
     bool d_invalidated = true;
+    //! true if the rendering queues merge their GeometryBuffers.
+    bool d_geometryBatchingEnabled = false;
 };
 
 } // End of  CEGUI namespace section
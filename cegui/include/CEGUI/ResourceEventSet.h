@@ -59,6 +59,11 @@ public:
         * to the name of the resource that the event is related to.
         */
     static const String EventResourceReplaced;
+
+    //! Ids of the event names above.
+    static const EventId EventResourceCreatedId;
+    static const EventId EventResourceDestroyedId;
+    static const EventId EventResourceReplacedId;
 };
 
 
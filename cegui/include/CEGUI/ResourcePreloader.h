@@ -0,0 +1,250 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Reads, parses and decodes resource files on worker threads
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIResourcePreloader_h_
+#define _CEGUIResourcePreloader_h_
+
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Sizef.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class XMLHandler;
+class RawDataContainer;
+class XMLDocumentRecorder;
+
+/*!
+\brief
+    Prepares resource files on worker threads, so that loading them on the
+    calling thread only has to create textures and register the resources.
+
+    Files are read through the ResourceProvider, XML files are parsed into a
+    list of elements and image files are decoded by the ImageCodec. While a
+    ResourcePreloader exists, XMLParser::parseXMLFile replays the elements of
+    the prepared XML files and ImageManager and FreeTypeFont use the prepared
+    image and font files. Resources are still loaded in the usual order, so
+    the result is the same as without the preloader. Files that fail to be
+    prepared are loaded as usual, which reports the error.
+
+    The ResourceProvider, XMLParser and ImageCodec must support being used
+    from several threads at once, the DefaultResourceProvider, the Expat
+    parser and the STB and TGA codecs do.
+*/
+class CEGUIEXPORT ResourcePreloader
+{
+public:
+    //! Time spent on a prepared file.
+    struct FileTiming
+    {
+        String d_filename;
+        String d_resourceGroup;
+        //! Seconds spent on a worker thread reading, parsing or decoding the file.
+        double d_prepareTime;
+        //! Seconds spent on the loading thread using the prepared file.
+        double d_finaliseTime;
+        //! False if the file couldn't be prepared and was loaded as usual.
+        bool d_prepared;
+    };
+
+    //! The elements of a parsed XML file.
+    class CEGUIEXPORT XMLDocument
+    {
+    public:
+        //! Calls the methods of \a handler for the elements, as the parser did.
+        void replay(XMLHandler& handler) const;
+
+    private:
+        friend class XMLDocumentRecorder;
+
+        struct Node
+        {
+            enum class Type { ElementStart, ElementEnd, Text } d_type;
+            //! The element name or the text.
+            String d_value;
+            XMLAttributes d_attributes;
+        };
+
+        std::vector<Node> d_nodes;
+    };
+
+    /*!
+    \brief
+        Function called on a worker thread once an XML file is parsed, to
+        queue the files the XML file refers to.
+    */
+    typedef std::function<void(ResourcePreloader&, const XMLDocument&)> XMLCallback;
+
+    /*!
+    \brief
+        Starts the workers and makes this the active preloader.
+
+    \param thread_count
+        Number of worker threads, at least one is always created.
+    */
+    explicit ResourcePreloader(size_t thread_count);
+
+    //! Stops the workers, dropping the files that are not prepared yet.
+    ~ResourcePreloader();
+
+    ResourcePreloader(const ResourcePreloader&) = delete;
+    ResourcePreloader& operator=(const ResourcePreloader&) = delete;
+
+    //! Returns the preloader whose files are used when loading resources, if any.
+    static ResourcePreloader* getActive() { return s_active; }
+
+    /*!
+    \brief
+        Queues an XML file to be read and parsed. May be called from a
+        worker thread.
+
+    \param callback
+        Function called once the file is parsed.
+    */
+    void queueXMLFile(const String& filename, const String& resource_group,
+                      const String& schema_name, XMLCallback callback = nullptr);
+
+    //! Queues an image file to be read and decoded. May be called from a worker thread.
+    void queueImageFile(const String& filename, const String& resource_group);
+
+    //! Queues a file to be read. May be called from a worker thread.
+    void queueDataFile(const String& filename, const String& resource_group);
+
+    //! Waits until all queued files, including the ones they refer to, are prepared.
+    void wait();
+
+    /*!
+    \brief
+        Replays the elements of a prepared XML file to \a handler.
+
+    \return
+        false if the file wasn't prepared, it must then be parsed as usual.
+    */
+    bool parseXMLFile(XMLHandler& handler, const String& filename,
+                      const String& resource_group);
+
+    /*!
+    \brief
+        Creates a texture from a prepared image file.
+
+    \return
+        The texture, or nullptr if the file wasn't prepared, it must then be
+        loaded as usual.
+    */
+    Texture* createTexture(const String& name, const String& filename,
+                           const String& resource_group);
+
+    /*!
+    \brief
+        Moves the data of a prepared file to \a output, the data must be
+        unloaded through the ResourceProvider.
+
+    \return
+        false if the file wasn't prepared or was used already, it must then be
+        loaded as usual.
+    */
+    bool loadRawDataContainer(const String& filename, RawDataContainer& output,
+                              const String& resource_group);
+
+    //! Returns the timings of the files queued so far, in the order they were queued.
+    std::vector<FileTiming> getFileTimings() const;
+
+    size_t getThreadCount() const { return d_workers.size(); }
+
+protected:
+    enum class FileType
+    {
+        XML,
+        Image,
+        Data
+    };
+
+    struct File
+    {
+        FileType d_type;
+        String d_filename;
+        String d_resourceGroup;
+        String d_schemaName;
+        XMLCallback d_callback;
+        bool d_prepared = false;
+        double d_prepareTime = 0.0;
+        double d_finaliseTime = 0.0;
+
+        XMLDocument d_document;
+        std::vector<std::uint8_t> d_pixels;
+        Sizef d_imageSize;
+        Texture::PixelFormat d_pixelFormat = Texture::PixelFormat::Rgba;
+        std::unique_ptr<RawDataContainer> d_data;
+    };
+
+    void queueFile(std::unique_ptr<File> file);
+    //! Returns the file if it was prepared.
+    File* findPreparedFile(FileType type, const String& filename,
+                           const String& resource_group) const;
+    static String makeKey(FileType type, const String& filename,
+                          const String& resource_group);
+
+    void workerMain();
+    void prepareFile(File& file);
+    void prepareXMLFile(File& file, const RawDataContainer& data);
+    void prepareImageFile(File& file, const RawDataContainer& data);
+
+    static ResourcePreloader* s_active;
+    ResourcePreloader* d_previousActive;
+
+    std::vector<std::thread> d_workers;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_jobAvailable;
+    std::condition_variable d_jobsDone;
+    std::deque<File*> d_jobs;
+    size_t d_busyWorkers = 0;
+    bool d_stopping = false;
+
+    //! All queued files, in the order they were queued.
+    std::vector<std::unique_ptr<File>> d_files;
+    std::unordered_map<String, File*> d_filesByKey;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
@@ -40,6 +40,8 @@
 
 namespace CEGUI
 {
+class ResourcePreloader;
+
 /*!
 \brief
 	A class that groups a set of GUI elements and initialises the system to access those elements.
@@ -85,6 +87,13 @@ public:
 	*/
 	void	loadResources(void);
 
+    /*!
+    \brief
+        Queues the files of the resources of this scheme in \a preloader, so
+        that a later loadResources call uses the prepared files.
+    */
+    void prepareResources(ResourcePreloader& preloader) const;
+
 
 	/*!
 	\brief
@@ -30,7 +30,9 @@
 #include "CEGUI/Singleton.h"
 #include "CEGUI/XmlResourceExistsAction.h"
 #include "CEGUI/ResourceEventSet.h"
+#include "CEGUI/ResourcePreloader.h"
 #include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -104,6 +106,25 @@ public:
     Scheme& createFromFile(const String& xml_filename, const String& resource_group = "",
         XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
 
+    /*!
+    \brief
+        Creates new Scheme instances from several XML files and adds them to
+        the collection, in the order of \a xml_filenames.
+
+        If a loading thread count is set, the scheme files and the files of
+        the resources of the schemes are read, parsed and decoded on that many
+        worker threads before the schemes are created. The created schemes and
+        resources are the same as when each file is given to createFromFile.
+
+    \return
+        The Scheme instances, in the order of \a xml_filenames.
+
+    \see SchemeManager::setLoadingThreadCount
+    */
+    std::vector<Scheme*> createFromFiles(const std::vector<String>& xml_filenames,
+        const String& resource_group = "",
+        XmlResourceExistsAction resourceExistsAction = XmlResourceExistsAction::Return);
+
     /*!
     \brief
         Creates a new Scheme instance from a string and adds it to the collection.
@@ -199,6 +220,34 @@ public:
     */
     bool getAutoLoadResources() const;
 
+    /*!
+    \brief
+        Sets the number of worker threads preparing the files of schemes and
+        their resources when schemes are created from files.
+
+    \param count
+        Number of worker threads, 0 loads all files on the calling thread.
+        This is the default.
+
+    \note
+        The ResourceProvider, XMLParser and ImageCodec must support being used
+        from several threads at once.
+
+    \see ResourcePreloader
+    */
+    void setLoadingThreadCount(size_t count) { d_loadingThreadCount = count; }
+
+    //! Returns the number of worker threads preparing files of schemes.
+    size_t getLoadingThreadCount() const { return d_loadingThreadCount; }
+
+    /*!
+    \brief
+        Returns the time spent on each file prepared by worker threads the
+        last time schemes were created with a loading thread count set.
+    */
+    const std::vector<ResourcePreloader::FileTiming>& getResourceLoadTimings() const
+        { return d_resourceLoadTimings; }
+
 protected:
     //! implementation of object destruction.
     void destroyObject(SchemeRegistry::iterator ob);
@@ -210,6 +259,9 @@ protected:
     //! Function called each time a new object is added to the collection.
     void doPostObjectAdditionAction(Scheme& scheme);
 
+    //! Stores and logs the timings of the files prepared by \a preloader.
+    void logResourceLoadTimings(const ResourcePreloader& preloader);
+
 
     //! String holding the text for the resource type managed.
     const String d_resourceType;
@@ -219,6 +271,12 @@ protected:
 
     //! If true, Scheme::loadResources is called after "create" is called for it
     bool d_autoLoadResources;
+
+    //! Number of worker threads preparing files, 0 if they are loaded sequentially.
+    size_t d_loadingThreadCount;
+
+    //! Timings of the files prepared by the last parallel load.
+    std::vector<ResourcePreloader::FileTiming> d_resourceLoadTimings;
 };
 
 } // End of  CEGUI namespace section
@@ -79,6 +79,10 @@ public:
      */
     static const String EventTextParserChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventDisplaySizeChangedId;
+    static const EventId EventTextParserChangedId;
+
     /*************************************************************************
         Construction and Destruction
     *************************************************************************/
@@ -31,6 +31,8 @@
 
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/TypedProperty.h"
+#include <unordered_map>
 
 namespace CEGUI
 {
@@ -49,6 +51,128 @@ private:
     const String d_type;
 };
 
+/*!
+ \brief Cache of String values parsed to a native type
+ 
+ Values are remembered by the address of the String they were parsed from and
+ are only parsed again when the content of that String changes.
+ */
+template<typename T>
+class TplInterpolatorValueCache
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    //! returns the native value of \a str, parsing it only if necessary
+    const T& get(const String& str)
+    {
+        Entry& entry = d_entries[&str];
+
+        if (!entry.d_parsed || entry.d_source != str)
+        {
+            entry.d_value = Helper::fromString(str);
+            entry.d_source = str;
+            entry.d_parsed = true;
+        }
+
+        return entry.d_value;
+    }
+
+private:
+    struct Entry
+    {
+        String d_source;
+        T d_value = T();
+        bool d_parsed = false;
+    };
+
+    // NB: the keys are only ever compared, never dereferenced
+    std::unordered_map<const String*, Entry> d_entries;
+};
+
+/*!
+ \brief Generic InterpolatorBinding for interpolators with native methods
+ 
+ The interpolator \a I has to provide interpolateAbsoluteNative,
+ interpolateRelativeNative and interpolateRelativeMultiplyNative that work on
+ values of type \a T.
+ */
+template<typename T, class I>
+class TplInterpolatorBinding : public InterpolatorBinding
+{
+public:
+    TplInterpolatorBinding(I& interpolator, PropertyReceiver* target,
+                           TypedProperty<T>& property):
+        d_interpolator(interpolator),
+        d_target(target),
+        d_property(property)
+    {}
+
+    //! \copydoc InterpolatorBinding::applyAbsolute
+    void applyAbsolute(const String& value1,
+                       const String& value2,
+                       float position) override
+    {
+        const T& val1 = d_values.get(value1);
+        const T& val2 = d_values.get(value2);
+
+        d_property.setNative(d_target,
+            d_interpolator.interpolateAbsoluteNative(val1, val2, position));
+    }
+
+    //! \copydoc InterpolatorBinding::applyRelative
+    void applyRelative(const String& base,
+                       const String& value1,
+                       const String& value2,
+                       float position) override
+    {
+        const T& bas = d_values.get(base);
+        const T& val1 = d_values.get(value1);
+        const T& val2 = d_values.get(value2);
+
+        d_property.setNative(d_target,
+            d_interpolator.interpolateRelativeNative(bas, val1, val2, position));
+    }
+
+    //! \copydoc InterpolatorBinding::applyRelativeMultiply
+    void applyRelativeMultiply(const String& base,
+                               const String& value1,
+                               const String& value2,
+                               float position) override
+    {
+        const T& bas = d_values.get(base);
+        const float val1 = d_factors.get(value1);
+        const float val2 = d_factors.get(value2);
+
+        d_property.setNative(d_target,
+            d_interpolator.interpolateRelativeMultiplyNative(bas, val1, val2, position));
+    }
+
+    /*!
+     \brief Creates a binding if \a property is a TypedProperty of type T
+     
+     \return new binding or nullptr if \a property has a different native type
+     */
+    static InterpolatorBinding* create(I& interpolator, PropertyReceiver* target,
+                                       Property* property)
+    {
+        TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>*>(property);
+        if (!typedProperty)
+            return nullptr;
+
+        return new TplInterpolatorBinding<T, I>(interpolator, target, *typedProperty);
+    }
+
+private:
+    I& d_interpolator;
+    PropertyReceiver* d_target;
+    TypedProperty<T>& d_property;
+    //! parsed key frame and base values
+    TplInterpolatorValueCache<T> d_values;
+    //! parsed key frame values used as factors by relative multiply application
+    TplInterpolatorValueCache<float> d_factors;
+};
+
 /*!
  \brief Generic linear interpolator class
  
@@ -70,12 +194,8 @@ public:
                                const String& value2,
                                float position) override
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateAbsoluteNative(
+            Helper::fromString(value1), Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelative
@@ -84,13 +204,9 @@ public:
                                const String& value2,
                                float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateRelativeNative(
+            Helper::fromString(base), Helper::fromString(value1),
+            Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelativeMultiply
@@ -99,15 +215,44 @@ public:
                                        const String& value2,
                                        float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename PropertyHelper<float>::return_type val1 = PropertyHelper<float>::fromString(value1);
-        typename PropertyHelper<float>::return_type val2 = PropertyHelper<float>::fromString(value2);
+        return Helper::toString(interpolateRelativeMultiplyNative(
+            Helper::fromString(base), PropertyHelper<float>::fromString(value1),
+            PropertyHelper<float>::fromString(value2), position));
+    }
 
-        const float mul = val1 * (1.0f - position) + val2 * (position);
+    //! \copydoc Interpolator::createBinding
+    InterpolatorBinding* createBinding(PropertyReceiver* target,
+                                       Property* property) override
+    {
+        return TplInterpolatorBinding<T, TplLinearInterpolator<T> >::create(*this, target, property);
+    }
 
-        const T result = static_cast<const T>(bas * mul);
+    //! native version of interpolateAbsolute
+    T interpolateAbsoluteNative(typename Helper::pass_type val1,
+                                typename Helper::pass_type val2,
+                                float position)
+    {
+        return static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
+    }
 
-        return Helper::toString(result);
+    //! native version of interpolateRelative
+    T interpolateRelativeNative(typename Helper::pass_type bas,
+                                typename Helper::pass_type val1,
+                                typename Helper::pass_type val2,
+                                float position)
+    {
+        return static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
+    }
+
+    //! native version of interpolateRelativeMultiply
+    T interpolateRelativeMultiplyNative(typename Helper::pass_type bas,
+                                        float val1,
+                                        float val2,
+                                        float position)
+    {
+        const float mul = val1 * (1.0f - position) + val2 * (position);
+
+        return static_cast<const T>(bas * mul);
     }
 };
 
@@ -133,44 +278,64 @@ public:
                                const String& value2,
                                float position) override
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateAbsoluteNative(
+            Helper::fromString(value1), Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelative
-    String interpolateRelative(const String& /*base*/,
+    String interpolateRelative(const String& base,
                                const String& value1,
                                const String& value2,
                                float position) override
     {
-        // NB: TplDiscreteRelativeInterpolator below implements this as expected
-        //typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
-        
-        return Helper::toString(result);
+        return Helper::toString(interpolateRelativeNative(
+            Helper::fromString(base), Helper::fromString(value1),
+            Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelativeMultiply
     String interpolateRelativeMultiply(const String& base,
                                        const String& /*value1*/,
                                        const String& /*value2*/,
-                                       float /*position*/) override
+                                       float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        /*const float val1 = PropertyHelper<float>::fromString(value1);
-        const float val2 = PropertyHelper<float>::fromString(value2);
+        return Helper::toString(interpolateRelativeMultiplyNative(
+            Helper::fromString(base), 0.0f, 0.0f, position));
+    }
 
-        const float mul = val1 * (1.0f - position) + val2 * (position);*/
+    //! \copydoc Interpolator::createBinding
+    InterpolatorBinding* createBinding(PropertyReceiver* target,
+                                       Property* property) override
+    {
+        return TplInterpolatorBinding<T, TplDiscreteInterpolator<T> >::create(*this, target, property);
+    }
 
+    //! native version of interpolateAbsolute
+    T interpolateAbsoluteNative(typename Helper::pass_type val1,
+                                typename Helper::pass_type val2,
+                                float position)
+    {
+        return position < 0.5 ? val1 : val2;
+    }
+
+    //! native version of interpolateRelative
+    virtual T interpolateRelativeNative(typename Helper::pass_type /*bas*/,
+                                        typename Helper::pass_type val1,
+                                        typename Helper::pass_type val2,
+                                        float position)
+    {
+        // NB: TplDiscreteRelativeInterpolator below implements this as expected
+        return position < 0.5 ? val1 : val2;
+    }
+
+    //! native version of interpolateRelativeMultiply
+    T interpolateRelativeMultiplyNative(typename Helper::pass_type bas,
+                                        float /*val1*/,
+                                        float /*val2*/,
+                                        float /*position*/)
+    {
         // there is nothing we can do, we have no idea what operators T has overloaded
-        return Helper::toString(bas);
+        return bas;
     }
 };
 
@@ -191,20 +356,14 @@ public:
     TplDiscreteRelativeInterpolator(const String& type):
         TplDiscreteInterpolator<T>(type)
     {}
-    
-    //! \copydoc Interpolator::interpolateRelative
-    String interpolateRelative(const String& base,
-                               const String& value1,
-                               const String& value2,
-                               float position) override
+
+    //! \copydoc TplDiscreteInterpolator::interpolateRelativeNative
+    T interpolateRelativeNative(typename Helper::pass_type bas,
+                                typename Helper::pass_type val1,
+                                typename Helper::pass_type val2,
+                                float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = bas + (position < 0.5 ? val1 : val2);
-        
-        return Helper::toString(result);
+        return bas + (position < 0.5 ? val1 : val2);
     }
 };
 
@@ -73,6 +73,12 @@ public:
         setNative(receiver, Helper::fromString(value));
     }
 
+    //! \copydoc Property::copyValue
+    void copyValue(const PropertyReceiver* source, PropertyReceiver* target) override
+    {
+        setNative(target, getNative(source));
+    }
+
     /*!
     \brief native set method, sets the property given a native type
     
@@ -86,7 +86,7 @@ public:
         return USize(d_width * vec.x, d_height * vec.y);
     }
 
-    inline USize operator*(const float x)
+    inline USize operator*(const float x) const
     {
         return (*this * UDim(x, x));
     }
@@ -31,6 +31,8 @@
 
 #include "CEGUI/Element.h"
 #include "CEGUI/InputEvent.h"
+#include <memory>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -447,6 +449,53 @@ public:
      */
     static const String EventSemanticEvent;
 
+    //! Ids of the event names above.
+    static const EventId EventUpdatedId;
+    static const EventId EventNameChangedId;
+    static const EventId EventTextChangedId;
+    static const EventId EventFontChangedId;
+    static const EventId EventTooltipTypeChangedId;
+    static const EventId EventTooltipTextChangedId;
+    static const EventId EventAlphaChangedId;
+    static const EventId EventIDChangedId;
+    static const EventId EventActivatedId;
+    static const EventId EventDeactivatedId;
+    static const EventId EventShownId;
+    static const EventId EventHiddenId;
+    static const EventId EventEnabledId;
+    static const EventId EventDisabledId;
+    static const EventId EventClippedByParentChangedId;
+    static const EventId EventDestroyedByParentChangedId;
+    static const EventId EventInheritsAlphaChangedId;
+    static const EventId EventAlwaysOnTopChangedId;
+    static const EventId EventInputCaptureGainedId;
+    static const EventId EventInputCaptureLostId;
+    static const EventId EventInvalidatedId;
+    static const EventId EventRenderingStartedId;
+    static const EventId EventRenderingEndedId;
+    static const EventId EventDestructionStartedId;
+    static const EventId EventDragDropItemEntersId;
+    static const EventId EventDragDropItemLeavesId;
+    static const EventId EventDragDropItemDroppedId;
+    static const EventId EventWindowRendererAttachedId;
+    static const EventId EventWindowRendererDetachedId;
+    static const EventId EventMarginChangedId;
+    static const EventId EventCursorEntersAreaId;
+    static const EventId EventCursorLeavesAreaId;
+    static const EventId EventCursorEntersSurfaceId;
+    static const EventId EventCursorLeavesSurfaceId;
+    static const EventId EventCursorMoveId;
+    static const EventId EventScrollId;
+    static const EventId EventMouseButtonDownId;
+    static const EventId EventMouseButtonUpId;
+    static const EventId EventClickId;
+    static const EventId EventDoubleClickId;
+    static const EventId EventTripleClickId;
+    static const EventId EventKeyDownId;
+    static const EventId EventKeyUpId;
+    static const EventId EventCharacterKeyId;
+    static const EventId EventSemanticEventId;
+
     // XML element and attribute names that relate to Window.
     static const String WindowXMLElementName;
     static const String AutoWindowXMLElementName;
@@ -1199,6 +1248,18 @@ public:
     */
     std::vector<GeometryBuffer*>& getGeometryBuffers() { return d_geometryBuffers; }
 
+    /*!
+    \brief
+        Return the text laid out by a falagard TextComponent for this Window,
+        creating an empty entry the first time. The entries are dropped when
+        the LookNFeel of the Window changes and when its WidgetLookFeel is
+        erased or replaced.
+    */
+    TextComponentCache& getTextComponentCache(const TextComponent& component) const;
+
+    //! Drop the text laid out by falagard TextComponents for this Window.
+    void clearTextComponentCaches();
+
     /*!
     \brief
         Get the name of the LookNFeel assigned to this window.
@@ -2120,6 +2181,9 @@ public:
     */
     void setUserString(const String& name, const String& value);
 
+    //! Removes all user strings, including those backing the text and look n' feel properties.
+    void clearUserStrings();
+
     /*!
     \brief
         Draws the Window object and all of it's attached
@@ -2469,7 +2533,9 @@ public:
 
     /*!
     \brief
-        Clones this Window and returns the result
+        Clones this Window and returns the result. Property values are copied
+        natively, and the clone is taken from the recycle pool of the type if
+        there is one (see WindowManager::setRecyclePoolSize).
 
     \param
         deepCopy if true, even children are copied
@@ -2559,6 +2625,7 @@ public:
     void adjustSizeToContent() override;
     bool contentFitsForSpecifiedElementSize(const Sizef& element_size) const override;
     bool contentFits() const override;
+    bool measureContent(float content_area_width, Sizef& content_size, bool& content_intact) const override;
 
     /*!
     \brief
@@ -3293,6 +3360,8 @@ protected:
     std::vector<String> d_bannedXMLProperties;
     //! List of geometry buffers that cache the geometry drawn by this Window.
     std::vector<GeometryBuffer*> d_geometryBuffers;
+    //! Text laid out for this Window by the TextComponents of its LookNFeel.
+    mutable std::unordered_map<const TextComponent*, std::unique_ptr<TextComponentCache>> d_textComponentCaches;
     //! Child window objects arranged in rendering order.
     std::vector<Window*> d_drawList;
 
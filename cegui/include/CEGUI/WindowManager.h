@@ -32,6 +32,7 @@
 #include "CEGUI/Singleton.h"
 #include "CEGUI/EventSet.h"
 
+#include <unordered_map>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -71,6 +72,10 @@ public:
      */
     static const String EventWindowDestroyed;
 
+    //! Ids of the event names above.
+    static const EventId EventWindowCreatedId;
+    static const EventId EventWindowDestroyedId;
+
     static const String GUILayoutSchemaName; //!< Filename of the XML schema used for validating GUILayout files.
 
 	/*!
@@ -240,6 +245,45 @@ public:
     */
     Window* loadLayoutFromString(const String& source, PropertyCallback* callback = nullptr, void* userdata = nullptr);
 
+    /*!
+    \brief
+        Creates a set of windows (a GUI layout) from a binary layout written by
+        compileLayoutFromFile or writeBinaryLayoutToStream, for example by the
+        layout compiler tool.
+
+        Loading a binary layout doesn't involve the XMLParser. The property
+        values of common types are stored in their native representation and
+        are set without string conversions, unless a \a callback is given.
+
+    \param filename
+        String object holding the filename of the binary layout.
+
+    \param resourceGroup
+        Resource group identifier to be passed to the resource provider when loading the layout file.
+
+    \param callback
+        PropertyCallback function to be called for each property loaded from the layout, with the
+        value converted to a string.  The value the callback leaves in the string is applied.
+
+    \param userdata
+        Client code data pointer passed to the PropertyCallback function.
+
+    \return
+        Pointer to the root Window object defined in the layout.
+
+    \exception FileIOException          thrown if the file \a filename can't be loaded.
+    \exception InvalidRequestException  thrown if \a filename is empty or the file isn't a valid binary layout.
+    */
+    Window* loadLayoutFromBinary(const String& filename, const String& resourceGroup = "", PropertyCallback* callback = nullptr, void* userdata = nullptr);
+
+    /*!
+    \brief
+        Creates a set of windows (a GUI layout) from the binary layout in \a source.
+
+    \see loadLayoutFromBinary
+    */
+    Window* loadLayoutFromBinaryContainer(const RawDataContainer& source, PropertyCallback* callback = nullptr, void* userdata = nullptr);
+
     /*!
     \brief
         Return whether the window dead pool is empty.
@@ -263,6 +307,42 @@ public:
     */
     void cleanDeadPool(void);
 
+    /*!
+    \brief
+        Set how many destroyed windows of the given type are kept for reuse.
+
+        A destroyed window of a type with a recycle pool is detached from its
+        parent, loses its non-auto child windows, its animation instances and
+        every event subscription made after it was created, and is put into
+        the pool instead of the dead pool.
+        createWindow then takes windows of that type from the pool, skipping
+        the factory and the window renderer and look n' feel initialisation.
+        A reused window and its auto windows get the properties and user
+        strings of a freshly created window of the type, copied natively from
+        a prototype kept for each pool.
+
+    \note
+        Only state that is exposed through properties is reset. Windows
+        created before the pool, and windows where anything subscribed to
+        EventDestructionStarted of the window or its auto windows, are
+        destroyed as usual, pooled windows don't fire that event. Recycling is opt-in per type, only enable it for types whose state
+        is fully described by their properties; don't use pools for widgets
+        that keep other content, like the items of a list.
+
+    \param type
+        Type of the windows, as passed to createWindow.
+
+    \param size
+        Maximum number of pooled windows, 0 destroys the pool and its windows.
+    */
+    void setRecyclePoolSize(const String& type, size_t size);
+
+    //! Return the maximum number of pooled windows of the given type.
+    size_t getRecyclePoolSize(const String& type) const;
+
+    //! Return the number of windows of the given type waiting for reuse.
+    size_t getRecycledWindowCount(const String& type) const;
+
     /*!
     \brief
         Writes a full XML window layout, starting at the given Window to the given OutStream.
@@ -310,6 +390,44 @@ public:
     */
     void saveLayoutToFile(const Window& window, const String& filename) const;
 
+    /*!
+    \brief
+        Compiles a GUILayout XML file into a binary layout, which
+        loadLayoutFromBinary loads without parsing XML.
+
+        The windows of the layout are created while compiling, so the schemes
+        defining the window types used by the layout must be loaded. Imported
+        layouts are compiled into the binary layout.
+
+    \param filename
+        String object holding the filename of the XML layout to be compiled.
+
+    \param out_stream
+        OutStream object where data is to be sent, it should be opened in
+        binary mode.
+
+    \param resourceGroup
+        Resource group identifier to be passed to the resource provider when loading the layout file.
+
+    \exception InvalidRequestException thrown if the layout can't be loaded.
+    */
+    void compileLayoutFromFile(const String& filename, OutStream& out_stream, const String& resourceGroup = "") const;
+
+    /*!
+    \brief
+        Writes a binary window layout, starting at the given Window, to the
+        given OutStream. The binary layout is compiled from the XML written by
+        writeLayoutToStream.
+
+    \param window
+        Window object to become the root of the layout.
+
+    \param out_stream
+        OutStream object where data is to be sent, it should be opened in
+        binary mode.
+    */
+    void writeBinaryLayoutToStream(const Window& window, OutStream& out_stream) const;
+
     /*!
     \brief
         Returns the default resource group currently set for layouts.
@@ -395,6 +513,35 @@ private:
     //! function to set up RenderEffect on a window
     void initialiseRenderEffect(Window* wnd, const String& effect) const;
 
+    //! create and initialise a window without registering it.
+    Window* createUnregisteredWindow(const String& type, const String& name);
+
+    //! remove a window from the registry, returns false if it isn't in it.
+    bool unregisterWindow(const Window* window);
+
+    //! put a destroyed window into its recycle pool, returns false if there is no room.
+    bool recycleWindow(Window* window);
+
+    //! append the connections to the event named \a eventName, or to all
+    //! events if it is empty, of a window and its auto windows.
+    static void collectConnections(const Window& window, const String& eventName,
+                                   std::vector<Event::Connection>& connections);
+
+    //! reset a pooled window and its auto windows to the state of the prototype.
+    static void resetRecycledWindow(Window& window, const Window& prototype);
+
+    //! destroy the windows and the prototype of a recycle pool.
+    void destroyRecycledWindows(const String& type);
+
+    //! Windows of one type kept for reuse.
+    struct RecyclePool
+    {
+        size_t d_maxSize = 0;
+        //! freshly created window the reused ones are reset to.
+        Window* d_prototype = nullptr;
+        std::vector<Window*> d_windows;
+    };
+
     /*************************************************************************
 		Implementation Data
 	*************************************************************************/
@@ -402,7 +549,13 @@ private:
 
     //! collection of created windows.
 	WindowVector d_windowRegistry;
+    //! position of each created window in d_windowRegistry.
+    std::unordered_map<const Window*, size_t> d_windowIndex;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
+    //! pools of destroyed windows kept for reuse, by window type.
+    std::unordered_map<String, RecyclePool> d_recyclePools;
+    //! subscriptions of the windows of pooled types when they were created.
+    std::unordered_map<const Window*, std::vector<Event::Connection>> d_creationConnections;
 
     std::uint32_t d_uid_counter;  //!< Counter used to generate unique window names.
     static String d_defaultResourceGroup;   //!< holds default resource group
@@ -418,6 +571,8 @@ public:
 	/*!
 	\brief
 		Return a WindowManager::WindowIterator object to iterate over the currently defined Windows.
+		The order of the windows is unspecified, destroying a window moves
+		the last one into its place.
 	*/
 	WindowIterator	getIterator(void) const;
 
@@ -244,6 +244,17 @@ public:
     */
     virtual bool contentFits() const;
 
+    /*!
+    \brief
+        Measure the window content as it would be laid out in an area reserved
+        for content of the given width, without changing the window.
+
+        See the documentaion for "Window::measureContent" for more details.
+
+    \see Window::measureContent
+    */
+    virtual bool measureContent(float content_area_width, Sizef& content_size, bool& content_intact) const;
+
 protected:
     /*************************************************************************
         Implementation methods
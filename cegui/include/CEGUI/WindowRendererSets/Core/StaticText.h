@@ -417,8 +417,9 @@ public:
             the height independently of each other, and then, if necessary,
             fixes it to comply with "getWindow()->getAspectMode()".
         2) Call "adjustSizeToContent_wordWrap_notKeepingAspectRatio", which
-            starts by adjusting the height if necessary, and then adjusts the
-            width by try and error (using bisection). 
+            starts by adjusting the height if necessary, and then sets the
+            width to that of the text without word-wrapping, measured
+            directly.
         3) Call "adjustSizeToContent_wordWrap_keepingAspectRatio", which
             works by try and error (using bisection): it tries various
             combinations of width and height, but only those in which the
@@ -426,6 +427,9 @@ public:
             "getWindow()->getAspectRatio()"). In practice the attempts are
             limited to those heights in which exactly a whole number of lines
             fits, because there's no point to try other heights.
+
+        The sizes tried are checked by measuring the text, the widget is only
+        resized once the size is found.
     */
     void adjustSizeToContent() override;
 
@@ -450,6 +454,11 @@ public:
         the whole widget content (the text) visible, without the need for
         scrollbars, and without the need to split a word between 2 or more
         lines.
+
+        The text is measured for the text area the widget would have without
+        scrollbars, the widget isn't resized.
+
+    \see measureContent
     */
     bool contentFitsForSpecifiedWindowSize(const Sizef& window_size) const override;
 
@@ -461,6 +470,16 @@ public:
     */
     bool contentFits() const override;
 
+    /*!
+    \brief
+        Measure the text as it would be formatted in a text area of the given
+        width, without changing the widget.
+
+        The text is formatted in a copy of the formatted text of the widget,
+        which is kept until the formatting is invalidated.
+    */
+    bool measureContent(float content_area_width, Sizef& content_size, bool& content_intact) const override;
+
     /*!
     \brief
         Invalidate string formatting, scrollbars visibility and actual
@@ -511,6 +530,10 @@ protected:
 
 
     mutable RenderedText d_renderedText;
+    //! Copy of d_renderedText formatted for the widths measured by measureContent.
+    mutable RenderedText d_measuredText;
+    //! Extent of the text without word wrapping.
+    mutable Sizef d_unwrappedTextExtent;
     std::vector<Event::ScopedConnection> d_connections;
     ColourRect d_textCols = ColourRect(0xFFFFFFFF);       //!< Colours used when rendering the text.
 
@@ -565,6 +588,8 @@ protected:
 
     //! True when string formatting, scrollbars visibility and actual text formatting are up to date.
     mutable bool d_formatValid = false;
+    //! True when d_measuredText and d_unwrappedTextExtent are up to date.
+    mutable bool d_measuredTextValid = false;
 
 private:
 
@@ -576,6 +601,8 @@ private:
     Scrollbar* getHorzScrollbarWithoutUpdate() const;
     Rectf getTextRenderAreaWithoutUpdate() const;
     const ComponentArea& getTextComponentAreaWithoutUpdate() const;
+    const ComponentArea& getTextComponentAreaForScrollbars(bool v_visible, bool h_visible) const;
+    void updateMeasuredText() const;
     const Sizef& getTextExtentWithoutUpdate() const;
     void adjustSizeToContent_wordWrap_keepingAspectRatio(const Sizef& contentMaxSize,
         USize& size_func, float window_max_width, float epsilon);
@@ -39,6 +39,25 @@
 namespace CEGUI
 {
 
+/*!
+\brief
+    Text laid out by a TextComponent for one window, kept by that window.
+
+    A TextComponent belongs to a WidgetLookFeel shared by all windows using
+    the look, so the rendered text can't be stored in the component itself
+    without re-rendering it each time another window is drawn.
+*/
+struct CEGUIEXPORT TextComponentCache
+{
+    RenderedText d_renderedText;
+
+    // Inputs d_renderedText was created from
+    const Font* d_font = nullptr;
+    const TextParser* d_parser = nullptr;
+    String d_text;
+    DefaultParagraphDirection d_bidiDir = DefaultParagraphDirection::Automatic;
+};
+
 //! \brief Class that encapsulates information for a Falagard text component.
 class CEGUIEXPORT TextComponent : public FalagardComponentBase
 {
@@ -298,25 +317,16 @@ protected:
 
     Font* getFontObject(const Window& window) const;
     TextParser* getTextParser(const Window& window) const;
-    void updateRenderedText(const Window& srcWindow, const Sizef& size) const;
+    //! Updates the text laid out for \a srcWindow and returns it.
+    RenderedText& updateRenderedText(const Window& srcWindow, const Sizef& size) const;
 
 private:
 
-    mutable RenderedText d_renderedText;
-
-    // Cache for avoiding redundant calulations
-    mutable const Font* d_lastFont = nullptr;
-    mutable const TextParser* d_lastParser = nullptr;
-    mutable String d_lastText;
-
     String d_text; //!< text rendered by this component, either string or property name.
     String d_font; //!< font to use, either font name or property name.
 
     String d_wordWrapProperty;
 
-    // Cache for avoiding redundant calulations
-    mutable DefaultParagraphDirection d_lastBidiDir = DefaultParagraphDirection::Automatic;
-
     FormattingSetting<VerticalTextFormatting> d_vertFormatting = VerticalTextFormatting::TopAligned;
     FormattingSetting<HorizontalTextFormatting> d_horzFormatting = HorizontalTextFormatting::LeftAligned;
     FormattingSetting<DefaultParagraphDirection> d_paragraphDir = DefaultParagraphDirection::LeftToRight;
@@ -40,6 +40,8 @@
 
 namespace CEGUI
 {
+    class ResourcePreloader;
+
     /*!
     \brief
         Manager class that gives top-level access to widget data based "look and feel" specifications loaded into the system.
@@ -114,6 +116,14 @@ namespace CEGUI
         */
         void parseLookNFeelSpecificationFromFile(const String& filename, const String& resourceGroup = "");
 
+        /*!
+        \brief
+            Queues the look & feel file \a filename in \a preloader, so that a
+            later parseLookNFeelSpecificationFromFile call uses the prepared file.
+        */
+        static void prepareLookNFeelSpecificationFromFile(ResourcePreloader& preloader,
+            const String& filename, const String& resourceGroup = "");
+
         /*!
         \see WidgetLookManager::parseLookNFeelSpecificationFromContainer
         */
@@ -31,6 +31,7 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
+#include "CEGUI/svg/SVGGeometryCache.h"
 
 #include <vector>
 
@@ -142,6 +143,14 @@ public:
     */
     const std::vector<SVGBasicShape*>& getShapes() const;
 
+    /*!
+    \brief
+        Returns the cache holding the tesselated geometry of the shapes. Adding
+        or destroying shapes clears it, changes made to the shapes themselves
+        require clearing it manually.
+    */
+    SVGGeometryCache& getGeometryCache() { return d_geometryCache; }
+
     /*!
     \brief
         Returns the SVGData's width in pixels.
@@ -269,6 +278,9 @@ protected:
     //! The basic shapes that were added to the SVGData
     std::vector<SVGBasicShape*> d_svgBasicShapes;
 
+    //! The tesselated geometry of the shapes
+    SVGGeometryCache d_geometryCache;
+
 private:
     /*!
     \brief
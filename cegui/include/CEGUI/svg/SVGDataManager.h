@@ -43,6 +43,7 @@
 namespace CEGUI
 {
 class SVGData;
+struct SVGGeometryCacheStats;
 
 class CEGUIEXPORT SVGDataManager :
         public Singleton<SVGDataManager>
@@ -141,6 +142,13 @@ public:
     */
     bool isSVGDataDefined(const String& name) const;
 
+    /*!
+    \brief
+        Returns the sums of the geometry cache counters and memory usage of
+        all SVGData objects created with this manager.
+    */
+    SVGGeometryCacheStats getGeometryCacheStats() const;
+
 
     //! container type used to hold the SVGData objects.
     typedef std::map<String, SVGData*> SVGDataMap;
@@ -0,0 +1,155 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Caches the tesselated geometry of SVGData
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _SVGGeometryCache_h_
+#define _SVGGeometryCache_h_
+
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/GeometryBuffer.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class SVGBasicShape;
+
+//! Usage counters of one or more SVGGeometryCache objects.
+struct CEGUIEXPORT SVGGeometryCacheStats
+{
+    //! Draws that reused tesselated geometry.
+    size_t d_hits = 0;
+    //! Draws that had to tesselate the shapes.
+    size_t d_misses = 0;
+    //! Number of cached scale and anti-aliasing combinations.
+    size_t d_entryCount = 0;
+    //! Bytes used by the cached vertices.
+    size_t d_memoryUsage = 0;
+};
+
+/*!
+\brief
+    Keeps the tesselated geometry of the shapes of an SVGData object, so that
+    redrawing an SVGImage copies vertices instead of tesselating all shapes
+    again.
+
+    The geometry is cached per scale and anti-aliasing setting. As the
+    tesselation depends on the scale, scales are quantised into buckets of
+    1/ScaleBucketsPerOctave octave and the shapes are tesselated at the scale
+    of their bucket. Consecutive shapes that don't need stencil filling are
+    transformed into the coordinates of the SVG document and merged into a
+    single GeometryBuffer.
+
+    The cache does not notice changes made directly to the shapes, call clear
+    after modifying them.
+*/
+class CEGUIEXPORT SVGGeometryCache
+{
+public:
+    //! Number of scale buckets per doubling of the scale.
+    static const int ScaleBucketsPerOctave = 32;
+
+    /*!
+    \brief
+        Appends GeometryBuffers that render \a shapes with the given settings
+        to \a out, tesselating the shapes only if no geometry is cached for
+        the scale and anti-aliasing setting.
+    */
+    void createRenderGeometry(std::vector<GeometryBuffer*>& out,
+                              const std::vector<SVGBasicShape*>& shapes,
+                              const SVGImage::SVGImageRenderSettings& render_settings);
+
+    //! Drops all cached geometry.
+    void clear();
+
+    /*!
+    \brief
+        Sets how many scale and anti-aliasing combinations are kept, the least
+        recently used one is dropped when the limit is exceeded. Zero disables
+        caching and tesselates the shapes on every draw.
+    */
+    void setMaxEntryCount(size_t count);
+    size_t getMaxEntryCount() const { return d_maxEntryCount; }
+
+    //! Returns the usage counters and the memory used by the cached geometry.
+    SVGGeometryCacheStats getStats() const;
+
+    //! Resets the hit and miss counters.
+    void resetStats();
+
+    //! Returns the bucket of a scale factor.
+    static int getScaleBucket(float scale);
+
+    //! Returns the scale factor the shapes are tesselated at for a bucket.
+    static float getBucketScale(int bucket);
+
+protected:
+    //! Vertices rendered by a single GeometryBuffer.
+    struct Batch
+    {
+        std::vector<float> d_vertexData;
+        //! Transformation not applied to the vertices, only used with stencil filling.
+        glm::mat4 d_transform;
+        PolygonFillRule d_fillRule;
+        unsigned int d_postStencilVertexCount;
+    };
+
+    struct Entry
+    {
+        glm::ivec2 d_scaleBucket;
+        bool d_antiAliasing;
+        //! Value of d_useCounter when the entry was last used.
+        size_t d_lastUse;
+        std::vector<Batch> d_batches;
+    };
+
+    //! Returns the entry for the settings, tesselating the shapes if there is none.
+    const Entry& getEntry(const std::vector<SVGBasicShape*>& shapes,
+                          const SVGImage::SVGImageRenderSettings& render_settings);
+
+    //! Tesselates the shapes at the scale of the entry's buckets.
+    static void tesselate(Entry& entry, const std::vector<SVGBasicShape*>& shapes,
+                          const SVGImage::SVGImageRenderSettings& render_settings);
+
+    std::vector<Entry> d_entries;
+    size_t d_maxEntryCount = 8;
+    size_t d_useCounter = 0;
+    size_t d_hits = 0;
+    size_t d_misses = 0;
+};
+
+}
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif
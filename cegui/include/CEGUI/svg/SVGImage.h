@@ -106,6 +106,8 @@ public:
     */
     void setUseGeometryAntialiasing(bool use_geometry_antialiasing);
 
+    void assign(const Image& image) override;
+
 protected:
     /*!
         \brief
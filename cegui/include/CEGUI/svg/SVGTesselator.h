@@ -220,6 +220,11 @@ public:
         const SVGPolygon* polyline,
         const SVGImage::SVGImageRenderSettings& render_settings);
 
+    //! Helper function for setting an SVG GeometryBuffer's render settings and transformation matrix
+    static void setupGeometryBufferSettings(CEGUI::GeometryBuffer* geometry_buffer,
+                                            const SVGImage::SVGImageRenderSettings &render_settings,
+                                            const glm::mat4& cegui_transformation_matrix);
+
 private:
     /*!
 	\brief
@@ -387,11 +392,6 @@ private:
         const glm::mat3x3& svg_transformation,
         const bool is_fill_needing_stencil);
 
-    //! Helper function for setting an SVG GeometryBuffer's render settings and transformation matrix
-    static void setupGeometryBufferSettings(CEGUI::GeometryBuffer* geometry_buffer,
-                                            const SVGImage::SVGImageRenderSettings &render_settings,
-                                            const glm::mat4& cegui_transformation_matrix);
-
     //! Turns a matrix as defined by SVG into a matrix that can be used internally by the CEGUI Renderers
     static glm::mat4 createRenderableMatrixFromSVGMatrix(glm::mat3 svg_matrix);
 
@@ -62,6 +62,9 @@ public:
      */
     static const String EventRenderSizeChanged;
 
+    //! Id of the event name above.
+    static const EventId EventRenderSizeChangedId;
+
     /*! The code point of the replacement character defined by the Unicode standard.
         This is typically rendered as rectangle or question-mark inside a box and
         is used whenever a unicode code point can not be rendered because it is not
@@ -69,7 +72,7 @@ public:
     */
     static const char32_t UnicodeReplacementCharacter;
 
-    virtual ~Font() = default;
+    virtual ~Font();
 
     /*!
     \brief
@@ -224,6 +227,15 @@ public:
     virtual Image* getOutline(uint32_t index, float thickness = 1.f) = 0;
     //! \brief Calculates and returns kerning between two glyphs (in pixels, not rounded)
     virtual float getKerning(const FontGlyph* /*prev*/, const FontGlyph& /*curr*/) const { return 0.f; }
+    /*!
+    \brief
+        Finishes glyphs that were loaded in the background. Called by the
+        System once per frame, before rendering.
+
+    \return
+        true if any glyph image changed and cached text geometry is outdated.
+    */
+    virtual bool processPendingGlyphs() { return false; }
 
 
     /*!
@@ -32,6 +32,7 @@
 #include "CEGUI/text/Font.h"
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/text/FreeTypeFontGlyph.h"
+#include "CEGUI/text/GlyphAtlasManager.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -45,6 +46,7 @@
 namespace CEGUI
 {
 class BitmapImage;
+class FreeTypeGlyphRasteriser;
 
 /*!
 \brief
@@ -56,8 +58,18 @@ class BitmapImage;
 
     Glyphs are rendered dynamically on demand, so a large font with lots
     of glyphs won't slow application startup time.
+
+    By default each font packs its glyphs into its own textures. Fonts that
+    use the shared glyph atlas store them in the GlyphAtlasManager instead,
+    where rarely used glyphs may be evicted and are then rendered again the
+    next time they are needed.
+
+    With asynchronous rasterisation enabled, only the metrics of a missing
+    glyph are loaded when it is first requested. Its bitmap is rendered on a
+    worker thread and shows up the next time processPendingGlyphs is called,
+    until then the placeholder glyph (if any) is drawn in its place.
 */
-class CEGUIEXPORT FreeTypeFont : public Font
+class CEGUIEXPORT FreeTypeFont : public Font, public GlyphAtlasClient
 {
 public:
 
@@ -163,6 +175,58 @@ public:
     //! Returns whether the Freetype font is rendered anti-aliased or not.
     bool isAntiAliased() const { return d_antiAliased; }
 
+    /*!
+    \brief
+        Sets whether the glyphs of this font are stored in the atlas shared
+        by all fonts (see GlyphAtlasManager) instead of in textures owned by
+        this font. Changing it re-creates the glyphs.
+    */
+    void setUseSharedGlyphAtlas(bool use);
+    //! Returns whether the glyphs of this font are stored in the shared glyph atlas.
+    bool isUsingSharedGlyphAtlas() const { return d_useSharedGlyphAtlas; }
+
+    void notifyGlyphEvicted(BitmapImage* image, std::uint64_t key) override;
+
+    /*!
+    \brief
+        Sets whether glyph bitmaps are rendered on worker threads instead of
+        when the glyph is first requested.
+    */
+    void setAsyncRasterisationEnabled(bool enabled);
+    //! Returns whether glyph bitmaps are rendered on worker threads.
+    bool isAsyncRasterisationEnabled() const { return d_rasteriser != nullptr; }
+
+    //! Sets the number of worker threads used for asynchronous rasterisation.
+    void setAsyncRasterisationThreadCount(size_t count);
+    //! Returns the number of worker threads used for asynchronous rasterisation.
+    size_t getAsyncRasterisationThreadCount() const { return d_asyncThreadCount; }
+
+    /*!
+    \brief
+        Sets the code point of the glyph drawn in place of glyphs that are
+        still being rendered asynchronously. Zero, the default, draws nothing,
+        so the glyphs appear with a delay of usually one frame.
+    */
+    void setPlaceholderCodePoint(char32_t code_point) { d_placeholderCodePoint = code_point; }
+    //! Returns the code point of the glyph drawn in place of pending glyphs.
+    char32_t getPlaceholderCodePoint() const { return d_placeholderCodePoint; }
+
+    /*!
+    \brief
+        Loads the glyphs of all code points in the range [\a first, \a last].
+        With asynchronous rasterisation enabled they are queued to the worker
+        threads, which makes this cheap to call at startup.
+    */
+    void preloadGlyphs(char32_t first, char32_t last);
+
+    //! Returns the number of glyphs queued for asynchronous rasterisation.
+    size_t getPendingGlyphCount() const { return d_pendingGlyphCount; }
+
+    bool processPendingGlyphs() override;
+
+    //! Converts a FreeType bitmap to pixels of a glyph atlas texture.
+    static std::vector<argb_t> createGlyphTextureData(const FT_Bitmap& glyph_bitmap);
+
     //! Returns the Freetype font face
     const FT_Face& getFontFace() const { return d_fontFace; }
     //! Returns the FreeType load flags
@@ -235,15 +299,34 @@ protected:
 
     void handleFontSizeOrFontUnitChange();
 
-    //! Rasterises the glyph and adds it into a glyph atlas texture
+    /*!
+    \brief
+        Rasterises the glyph and adds it into a glyph atlas texture.
+
+    \param key
+        Identifies the image in the shared glyph atlas: the glyph index for
+        glyphs, combined with the thickness in the high bits for outlines.
+    */
     BitmapImage* rasterise(const String& name, const FT_Bitmap& ft_bitmap,
-        int32_t glyphLeft, int32_t glyphTop, uint32_t glyphWidth, uint32_t glyphHeight);
+        int32_t glyphLeft, int32_t glyphTop, uint32_t glyphWidth, uint32_t glyphHeight,
+        std::uint64_t key);
 
     size_t findTextureLineWithFittingSpot(uint32_t glyphWidth, uint32_t glyphHeight) const;
     size_t addNewLineIfFitting(uint32_t glyphHeight, uint32_t glyphWidth);
 
+    //! Adds already rendered glyph pixels into a glyph atlas texture
+    BitmapImage* addGlyphImage(const String& name, const std::vector<argb_t>& pixels,
+        int32_t glyphLeft, int32_t glyphTop, uint32_t glyphWidth, uint32_t glyphHeight,
+        std::uint64_t key);
+
+    //! Renders the glyph at \a index on the calling thread.
+    FreeTypeFontGlyph* renderGlyph(uint32_t index);
+    //! Queues the glyph at \a index for asynchronous rasterisation.
+    void queueGlyph(uint32_t index);
+    //! Returns the image drawn in place of glyphs being rendered asynchronously.
+    Image* getPlaceholderImage();
+
     void createGlyphAtlasTexture();
-    static std::vector<argb_t> createGlyphTextureData(const FT_Bitmap& glyph_bitmap);
 
     void writeXMLToStream_impl(XMLSerializer& xml_stream) const override;
 
@@ -255,6 +338,8 @@ protected:
     FontSizeUnit d_sizeUnit;
     //! True if the font should be rendered as anti-aliased by freeType.
     bool d_antiAliased;
+    //! True if the glyphs are stored in the GlyphAtlasManager.
+    bool d_useSharedGlyphAtlas = false;
     //! FreeType-specific font handle
     FT_Face d_fontFace = nullptr;
     FT_Stroker d_stroker = nullptr;
@@ -263,6 +348,15 @@ protected:
 
     std::vector<FreeTypeFontGlyph> d_glyphs;
     std::vector<bool> d_glyphLoadStatus;
+    //! True for glyphs queued for asynchronous rasterisation. Their image is
+    //! the placeholder, which they don't own.
+    std::vector<bool> d_glyphPending;
+    size_t d_pendingGlyphCount = 0;
+
+    //! Renders glyphs in the background, present only in asynchronous mode.
+    std::unique_ptr<FreeTypeGlyphRasteriser> d_rasteriser;
+    size_t d_asyncThreadCount;
+    char32_t d_placeholderCodePoint = 0;
 
     //! Contains mappings from freetype indices to Font glyphs
     std::unordered_map<FT_UInt, uint32_t> d_indexToGlyphMap;
@@ -0,0 +1,150 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Renders FreeType glyph bitmaps on worker threads
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFreeTypeGlyphRasteriser_h_
+#define _CEGUIFreeTypeGlyphRasteriser_h_
+
+#include "CEGUI/Colour.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class RawDataContainer;
+
+/*!
+\brief
+    Pool of worker threads rendering glyph bitmaps for a FreeTypeFont.
+
+    Each worker owns a FreeType library instance and a face created from the
+    font data of the font, so no FreeType object is shared between threads.
+    Finished glyphs are collected until the font picks them up, which it does
+    on the rendering thread via takeResults.
+*/
+class CEGUIEXPORT FreeTypeGlyphRasteriser
+{
+public:
+    //! A rendered glyph, in the form expected by the glyph atlases.
+    struct Result
+    {
+        //! Index of the glyph in the font.
+        std::uint32_t d_index;
+        //! True if FreeType failed to render the glyph.
+        bool d_failed;
+        std::vector<argb_t> d_pixels;
+        std::uint32_t d_width;
+        std::uint32_t d_height;
+        std::int32_t d_left;
+        std::int32_t d_top;
+        float d_advance;
+        FT_Pos d_lsbDelta;
+        FT_Pos d_rsbDelta;
+    };
+
+    /*!
+    \brief
+        Starts the workers.
+
+    \param font_data
+        The font file in memory. It must stay valid until the rasteriser
+        is destroyed.
+
+    \param thread_count
+        Number of worker threads, at least one is always created.
+    */
+    FreeTypeGlyphRasteriser(const RawDataContainer& font_data, size_t thread_count);
+
+    //! Stops the workers, dropping the glyphs that are not rendered yet.
+    ~FreeTypeGlyphRasteriser();
+
+    FreeTypeGlyphRasteriser(const FreeTypeGlyphRasteriser&) = delete;
+    FreeTypeGlyphRasteriser& operator=(const FreeTypeGlyphRasteriser&) = delete;
+
+    /*!
+    \brief
+        Sets the pixel size and the FreeType load flags glyphs are rendered
+        with. Glyphs queued or rendered with the previous settings are dropped.
+    */
+    void setParameters(FT_UInt pixel_height, FT_Int32 load_flags);
+
+    //! Queues a glyph to be rendered.
+    void queue(std::uint32_t index, FT_UInt ft_glyph_index);
+
+    //! Drops all queued glyphs and all results not taken yet.
+    void cancelAll();
+
+    //! Returns the glyphs rendered since the last call.
+    std::vector<Result> takeResults();
+
+    size_t getThreadCount() const { return d_workers.size(); }
+
+protected:
+    struct Job
+    {
+        std::uint32_t d_index;
+        FT_UInt d_ftGlyphIndex;
+        FT_UInt d_pixelHeight;
+        FT_Int32 d_loadFlags;
+        //! Value of d_generation when the job was queued.
+        std::uint64_t d_generation;
+    };
+
+    void workerMain();
+    bool renderGlyph(FT_Face face, const Job& job, Result& result) const;
+
+    const std::uint8_t* d_fontData;
+    size_t d_fontDataSize;
+
+    std::vector<std::thread> d_workers;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_jobAvailable;
+    std::deque<Job> d_jobs;
+    std::vector<Result> d_results;
+    bool d_stopping = false;
+
+    FT_UInt d_pixelHeight = 0;
+    FT_Int32 d_loadFlags = 0;
+    //! Incremented whenever pending work becomes obsolete.
+    std::uint64_t d_generation = 0;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
@@ -0,0 +1,260 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Defines a glyph atlas that can be shared by multiple fonts
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGlyphAtlasManager_h_
+#define _CEGUIGlyphAtlasManager_h_
+
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Colour.h"
+#include "CEGUI/Sizef.h"
+#include "CEGUI/Rectf.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class BitmapImage;
+class Texture;
+
+/*!
+\brief
+    Interface of the owners of glyphs stored in the GlyphAtlasManager, used to
+    notify them when their glyphs are evicted.
+*/
+class CEGUIEXPORT GlyphAtlasClient
+{
+public:
+    virtual ~GlyphAtlasClient() = default;
+
+    /*!
+    \brief
+        Called when a glyph of this client got evicted from the atlas to make
+        room for other glyphs. The client must stop using the image; it can add
+        the glyph again the next time it is needed. The atlas destroys the
+        image at the start of the next frame, as geometry being built in the
+        current one may still refer to it.
+
+    \param image
+        The image that was returned by GlyphAtlasManager::addGlyph.
+
+    \param key
+        The key that was passed to GlyphAtlasManager::addGlyph.
+    */
+    virtual void notifyGlyphEvicted(BitmapImage* image, std::uint64_t key) = 0;
+};
+
+//! Occupancy and eviction counters of the GlyphAtlasManager.
+struct CEGUIEXPORT GlyphAtlasStats
+{
+    //! Number of atlas pages (textures) currently allocated.
+    size_t d_pageCount = 0;
+    //! Number of glyphs currently stored in the atlas.
+    size_t d_glyphCount = 0;
+    //! Pixels covered by the glyphs currently stored, padding included.
+    size_t d_usedPixels = 0;
+    //! Total pixels of all allocated pages.
+    size_t d_totalPixels = 0;
+    //! Number of glyphs evicted since the counters were last reset.
+    size_t d_evictedGlyphs = 0;
+    //! Number of pages emptied by eviction since the counters were last reset.
+    size_t d_evictedPages = 0;
+
+    //! Returns the fraction of the allocated page area covered by glyphs.
+    float getOccupancy() const
+    {
+        return d_totalPixels ? static_cast<float>(d_usedPixels) / d_totalPixels : 0.0f;
+    }
+};
+
+/*!
+\brief
+    Manages glyph atlas pages that are shared by all fonts that opt into it.
+
+    Glyphs from every client are packed into a set of equally sized textures
+    using the skyline bottom-left heuristic, so text using different fonts or
+    sizes usually ends up on the same texture and can be batched together.
+
+    When no page has room for a new glyph and the page limit is reached, the
+    least recently used page is emptied: all its glyphs are evicted and their
+    clients notified through GlyphAtlasClient::notifyGlyphEvicted. Clients
+    mark glyphs as used via touchGlyph.
+*/
+class CEGUIEXPORT GlyphAtlasManager :
+    public Singleton<GlyphAtlasManager>
+{
+public:
+    GlyphAtlasManager();
+    ~GlyphAtlasManager();
+
+    static GlyphAtlasManager& getSingleton();
+    static GlyphAtlasManager* getSingletonPtr();
+
+    /*!
+    \brief
+        Packs a glyph into the atlas and uploads its pixels.
+
+    \param client
+        The owner of the glyph, notified if the glyph gets evicted.
+
+    \param key
+        Arbitrary value identifying the glyph for \a client.
+
+    \param name
+        Name of the returned image.
+
+    \param pixels
+        The glyph pixels, \a size.d_width * \a size.d_height values in rows.
+
+    \param offset
+        The rendering offset of the returned image.
+
+    \return
+        A new BitmapImage referencing the glyph in the atlas. It is owned by
+        the caller, which must call removeGlyph before destroying it.
+
+    \exception InvalidRequestException
+        thrown if the glyph is larger than a page.
+    */
+    BitmapImage* addGlyph(GlyphAtlasClient& client, std::uint64_t key,
+        const String& name, const Sizef& size, const std::vector<argb_t>& pixels,
+        const glm::vec2& offset, const Sizef& native_res);
+
+    //! Releases the space of a glyph that its client no longer needs.
+    void removeGlyph(const BitmapImage* image);
+
+    //! Releases the space of all glyphs of \a client.
+    void removeClientGlyphs(const GlyphAtlasClient& client);
+
+    //! Marks a glyph as used, so it is evicted after colder ones.
+    void touchGlyph(const BitmapImage* image);
+
+    //! Returns whether \a image was added to, and is still held by, the atlas.
+    bool isGlyphInAtlas(const BitmapImage* image) const;
+
+    /*!
+    \brief
+        Sets the width and height of the atlas pages. It is clamped to the
+        maximum texture size of the renderer and only affects new pages.
+    */
+    void setPageSize(std::uint32_t size) { d_pageSize = size; }
+    std::uint32_t getPageSize() const { return d_pageSize; }
+
+    //! Sets the maximum number of pages allocated before glyphs get evicted.
+    void setMaxPageCount(size_t count) { d_maxPageCount = count; }
+    size_t getMaxPageCount() const { return d_maxPageCount; }
+
+    /*!
+    \brief
+        Evicts every glyph and releases all pages, notifying the clients.
+        Pages created afterwards use the current page size.
+    */
+    void evictAllGlyphs();
+
+    //! Destroys the images and pages evicted so far. Called by System before each frame.
+    void destroyEvictedImages();
+
+    //! Returns the occupancy and eviction counters.
+    GlyphAtlasStats getStats() const;
+
+    //! Resets the eviction counters.
+    void resetStats();
+
+protected:
+    //! A span of the skyline: the top of the used area from d_x to d_x + d_width.
+    struct SkylineNode
+    {
+        std::uint32_t d_x;
+        std::uint32_t d_y;
+        std::uint32_t d_width;
+    };
+
+    struct Page
+    {
+        Texture* d_texture;
+        std::uint32_t d_size;
+        std::vector<SkylineNode> d_skyline;
+        size_t d_glyphCount;
+        //! The most recent use of any glyph on this page.
+        std::uint64_t d_lastUse;
+    };
+
+    struct GlyphEntry
+    {
+        GlyphAtlasClient* d_client;
+        std::uint64_t d_key;
+        size_t d_page;
+        size_t d_area;
+    };
+
+    //! Finds a spot for a rectangle of the given size, using the skyline
+    //! bottom-left heuristic. Returns false if the page has no room.
+    static bool findPosition(const Page& page, std::uint32_t width,
+        std::uint32_t height, std::uint32_t& x, std::uint32_t& y, size_t& node_index);
+    static void addSkylineLevel(Page& page, size_t node_index,
+        std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height);
+
+    //! Returns the size of pages created now, the page size clamped to the texture size limit.
+    std::uint32_t getNewPageSize() const;
+    size_t createPage();
+    void resetPage(Page& page);
+    //! Evicts every glyph of the least recently used page and returns it.
+    size_t evictColdestPage();
+    //! Notifies the clients of evicted glyphs and queues their images for destruction.
+    void notifyGlyphsEvicted(const std::vector<std::pair<BitmapImage*, GlyphEntry>>& evicted);
+    void releaseEntry(const GlyphEntry& entry);
+
+    std::vector<Page> d_pages;
+    std::unordered_map<const BitmapImage*, GlyphEntry> d_glyphs;
+    //! Images of evicted glyphs, waiting for destroyEvictedImages.
+    std::vector<BitmapImage*> d_evictedImages;
+    //! Textures of released pages, waiting for destroyEvictedImages.
+    std::vector<Texture*> d_evictedTextures;
+
+    std::uint32_t d_pageSize;
+    size_t d_maxPageCount;
+    //! Incremented on each use of a glyph; gives the LRU order.
+    std::uint64_t d_useClock;
+    size_t d_usedPixels;
+    size_t d_evictedGlyphs;
+    size_t d_evictedPages;
+    //! Number of pages ever created; used to keep texture names unique.
+    size_t d_createdPageCount;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
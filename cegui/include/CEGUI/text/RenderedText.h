@@ -26,6 +26,7 @@
  ***************************************************************************/
 #pragma once
 #include "CEGUI/text/RenderedTextParagraph.h"
+#include "CEGUI/FenwickTree.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -54,6 +55,25 @@ public:
     bool renderText(const String& text, TextParser* parser = nullptr, Font* defaultFont = nullptr,
         DefaultParagraphDirection defaultParagraphDir = DefaultParagraphDirection::LeftToRight);
 
+    /*!
+    \brief
+        Updates the rendered text after \a oldLength code units at \a start of
+        the text it was rendered from were replaced with \a newLength ones.
+
+        Only the paragraphs touched by the edit are laid out again, the following
+        ones are just moved, and the next updateFormatting only wraps the new
+        paragraphs. The whole text is rendered with renderText instead when a
+        parser is used, when the font or the paragraph direction differ from the
+        ones used before or when the edit changes the direction inherited by the
+        following paragraphs.
+
+    \param text
+        The whole text after the edit.
+    */
+    bool replaceText(const String& text, size_t start, size_t oldLength, size_t newLength,
+        TextParser* parser = nullptr, Font* defaultFont = nullptr,
+        DefaultParagraphDirection defaultParagraphDir = DefaultParagraphDirection::LeftToRight);
+
     void updateDynamicObjectExtents(const Window* hostWindow = nullptr);
     bool updateFormatting(float areaWidth);
 
@@ -96,16 +116,29 @@ public:
 protected:
 
     size_t findParagraphIndex(size_t textIndex, float& offsetY) const;
+    void updateParagraphHeights();
 
     std::vector<RenderedTextParagraph> d_paragraphs;
     std::vector<RenderedTextElementPtr> d_elements;
+    //! Heights of d_paragraphs, for finding paragraphs and their offsets in O(log n)
+    FenwickTree<float> d_paragraphHeights;
     const Font* d_defaultFont = nullptr;
     Sizef d_extents;
+    float d_extentsLeft = 0.f; //!< Left edge of the extents, negative when lines overflow to the left
     float d_areaWidth = -1.f;
 
+    //! Paragraphs replaced since the last updateFormatting, unless all of them are dirty
+    size_t d_dirtyParagraphsStart = 0;
+    size_t d_dirtyParagraphsEnd = 0;
+    size_t d_overflowingParagraphCount = 0;
+
+    DefaultParagraphDirection d_defaultParagraphDir = DefaultParagraphDirection::LeftToRight;
     HorizontalTextFormatting d_horzFormatting = HorizontalTextFormatting::LeftAligned;
     HorizontalTextFormatting d_lastJustifiedLineFormatting = HorizontalTextFormatting::LeftAligned;
     bool d_wordWrap = false;
+    bool d_parsed = false; //!< The text was rendered with a parser, so it can't be edited in place
+    bool d_allParagraphsDirty = true; //!< The next updateFormatting must visit every paragraph
+    bool d_extentsWidthDirty = false; //!< A paragraph at the edge of the extents was replaced
 };
 
 }
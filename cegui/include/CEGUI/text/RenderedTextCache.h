@@ -0,0 +1,159 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    LRU cache of laid out text shared by all RenderedText objects
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#pragma once
+#include "CEGUI/Singleton.h"
+#include "CEGUI/text/RenderedTextParagraph.h"
+#include "CEGUI/text/DefaultParagraphDirection.h"
+#include <list>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class TextParser;
+
+//! Counters of the RenderedTextCache.
+struct CEGUIEXPORT RenderedTextCacheStats
+{
+    size_t d_entryCount = 0;
+    //! Estimated memory used by the cached entries, in bytes.
+    size_t d_memoryUsage = 0;
+    size_t d_hits = 0;
+    size_t d_misses = 0;
+    //! Number of entries dropped to stay within the memory budget.
+    size_t d_evictions = 0;
+};
+
+/*!
+\brief
+    Keeps the results of RenderedText::renderText, i.e. parsed, bidi mapped
+    and shaped paragraphs, so that a text rendered again with the same parser,
+    default font and paragraph direction is copied instead of laid out again.
+
+    Only texts consisting of styled glyphs are cached, texts with embedded
+    images or widgets are always laid out from scratch. Entries using a font
+    are dropped when that font changes or is destroyed. A TextParser whose
+    output for the same input changes must call clear().
+*/
+class CEGUIEXPORT RenderedTextCache :
+    public Singleton<RenderedTextCache>
+{
+public:
+    RenderedTextCache();
+    ~RenderedTextCache();
+
+    static RenderedTextCache& getSingleton();
+    static RenderedTextCache* getSingletonPtr();
+
+    /*!
+    \brief
+        Looks up a cached layout and copies it into \a paragraphs and
+        \a elements. Returns false if there is no such entry.
+    */
+    bool find(const String& text, const TextParser* parser, const Font* defaultFont,
+        DefaultParagraphDirection dir, std::vector<RenderedTextParagraph>& paragraphs,
+        std::vector<RenderedTextElementPtr>& elements);
+
+    //! Stores a copy of a layout, if it can be cached and fits into the budget.
+    void add(const String& text, const TextParser* parser, const Font* defaultFont,
+        DefaultParagraphDirection dir, const std::vector<RenderedTextParagraph>& paragraphs,
+        const std::vector<RenderedTextElementPtr>& elements);
+
+    //! Drops all entries that use \a font.
+    void invalidateFont(const Font* font);
+
+    //! Drops all entries.
+    void clear();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return d_enabled; }
+
+    //! Sets the estimated memory, in bytes, the entries may use.
+    void setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget() const { return d_memoryBudget; }
+
+    RenderedTextCacheStats getStats() const;
+    //! Resets the hit, miss and eviction counters.
+    void resetStats();
+
+protected:
+    struct Key
+    {
+        String d_text;
+        const TextParser* d_parser;
+        const Font* d_defaultFont;
+        DefaultParagraphDirection d_dir;
+
+        bool operator ==(const Key& other) const
+        {
+            return d_parser == other.d_parser && d_defaultFont == other.d_defaultFont &&
+                d_dir == other.d_dir && d_text == other.d_text;
+        }
+    };
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        Key d_key;
+        std::vector<RenderedTextParagraph> d_paragraphs;
+        std::vector<RenderedTextElementPtr> d_elements;
+        //! Fonts used by the elements, for invalidation.
+        std::vector<const Font*> d_fonts;
+        size_t d_memoryUsage;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    void removeEntry(EntryList::iterator it);
+    //! Drops the least recently used entries until the budget is respected.
+    void trim();
+
+    //! Entries from the most to the least recently used.
+    EntryList d_entries;
+    std::unordered_map<Key, EntryList::iterator, KeyHasher> d_index;
+
+    bool d_enabled = true;
+    size_t d_memoryBudget = 4 * 1024 * 1024;
+    size_t d_memoryUsage = 0;
+    size_t d_hits = 0;
+    size_t d_misses = 0;
+    size_t d_evictions = 0;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
@@ -53,7 +53,7 @@ struct RenderedGlyph
     float advance;    //!< Shift to be applied to the pen after drawing this glyph
 
     uint32_t fontGlyphIndex; //!< Actual font glyph, may be invalid for missing glyphs and for embedded objects
-    uint32_t sourceIndex;    //!< Starting index of the corresponding sequence in the logical text
+    uint32_t sourceIndex;    //!< Starting index of the corresponding sequence in the logical text, relative to the paragraph
     uint16_t elementIndex;   //!< Index of controlling RenderedTextElement, stored instead of pointer to reduce struct size
     uint8_t sourceLength;    //!< This may be up to 4 for multibyte UTF-8 source, and even more for embedded objects
 
@@ -85,8 +85,14 @@ public:
     //! Assign elements and calculate glyph traits. Called once when preparing the text.
     void setupGlyphs(const std::u32string& text, const std::vector<uint16_t>& elementIndices,
         const std::vector<RenderedTextElementPtr>& elements);
-    //! Remaps UTF-32 source indices into original indices (UTF-32 or UTF-8) if required
+    //! Remaps UTF-32 source indices into original indices (UTF-32 or UTF-8) if required, makes glyph ones paragraph relative
     void remapSourceIndices(const std::vector<size_t>& originalIndices, size_t sourceLength);
+    //! Moves the paragraph in the logical text, e.g. after an edit of the text before it
+    void shiftSourceIndices(std::ptrdiff_t offset)
+    {
+        d_sourceStartIndex = static_cast<uint32_t>(d_sourceStartIndex + offset);
+        d_sourceEndIndex = static_cast<uint32_t>(d_sourceEndIndex + offset);
+    }
 
     //! Generate geometry buffers for rendering this text object
     void createRenderGeometry(std::vector<GeometryBuffer*>& out, glm::vec2& penPosition,
@@ -116,6 +122,7 @@ public:
     bool isLastJustifiedLineFormattingDefault() const { return d_defaultLastJustifiedLineFormatting; }
     bool isWordWrapDefault() const { return d_defaultWordWrap; }
     bool isFittingIntoAreaWidth() const { return d_fitsIntoAreaWidth; }
+    bool areLinesDirty() const { return d_linesDirty; }
 
     void setBidiDirection(DefaultParagraphDirection dir) { d_bidiDir = dir; }
     DefaultParagraphDirection getBidiDirection() const { return d_bidiDir; }
@@ -181,7 +188,7 @@ protected:
     std::vector<Line> d_lines;
 
     uint32_t d_sourceStartIndex = 0;  //!< Starting index of the paragraph in the logical text
-    uint32_t d_sourceEndIndex = 0;  //!< Starting index of the paragraph in the logical text
+    uint32_t d_sourceEndIndex = 0;  //!< Ending index of the paragraph in the logical text
     float d_height = 0.f;
 
     DefaultParagraphDirection d_bidiDir = DefaultParagraphDirection::Automatic;
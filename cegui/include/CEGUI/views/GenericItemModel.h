@@ -242,6 +242,7 @@ public:
     bool isValidIndex(const ModelIndex& model_index) const override;
     ModelIndex makeIndex(size_t child, const ModelIndex& parent_index) override;
     bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const override;
+    bool areIndicesIdentifiedByModelData() const override { return true; }
     int compareIndices(const ModelIndex& index1, const ModelIndex& index2) const override;
     ModelIndex getParentIndex(const ModelIndex& model_index) const override;
     int getChildId(const ModelIndex& model_index) const override;
@@ -166,6 +166,14 @@ public:
     //! Name of the event triggered \b after existing children's data was changed
     static const String EventChildrenDataChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventChildrenWillBeAddedId;
+    static const EventId EventChildrenAddedId;
+    static const EventId EventChildrenWillBeRemovedId;
+    static const EventId EventChildrenRemovedId;
+    static const EventId EventChildrenDataWillChangeId;
+    static const EventId EventChildrenDataChangedId;
+
     /*!
     \brief
         Returns true if the specified ModelIndex is valid, false otherwise.
@@ -214,6 +222,19 @@ public:
     */
     virtual bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const;
 
+    /*!
+    \brief
+        Returns true if every item of this model has its own ModelIndex::d_modelData,
+        so that two indices refer to the same item exactly when their
+        d_modelData pointers are equal.
+
+        Views then find selected indices by d_modelData in constant time, and
+        two distinct items never show as selected together, even if
+        areIndicesEqual considers them equal. Otherwise views compare each
+        selected index with areIndicesEqual. The default returns false.
+    */
+    virtual bool areIndicesIdentifiedByModelData() const { return false; }
+
     /*!
     \brief
         Compares semantically the contents of the specified two indices and returns:
@@ -33,6 +33,7 @@
 #include "CEGUI/WindowRenderer.h"
 #include "CEGUI/ColourRect.h"
 #include "CEGUI/views/ItemModel.h"
+#include <unordered_set>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -186,6 +187,14 @@ public:
     //! Triggered when items are added, removed or when the view's item are cleared.
     static const String EventViewContentsChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventVertScrollbarDisplayModeChangedId;
+    static const EventId EventHorzScrollbarDisplayModeChangedId;
+    static const EventId EventSelectionChangedId;
+    static const EventId EventMultiselectModeChangedId;
+    static const EventId EventSortModeChangedId;
+    static const EventId EventViewContentsChangedId;
+
     //! Sets the ItemModel to be used inside this view.
     virtual void setModel(ItemModel* item_model);
 
@@ -271,8 +280,41 @@ public:
     virtual bool setSelectedIndex(const ModelIndex& index);
     virtual bool setIndexSelectionState(const ModelIndex& index, bool selected);
 
+    /*!
+    \brief
+        Returns whether the item specified by the \a index is selected, in O(1).
+
+    \remark
+        Selected indices are looked up by their model data, so the model must
+        use the same ModelIndex::d_modelData for the indices of an item.
+    */
     virtual bool isIndexSelected(const ModelIndex& index) const;
 
+    /*!
+    \brief
+        Adds the children of \a parent_index with ids from \a start_child_id to
+        \a end_child_id (inclusive) to the selection, firing a single
+        EventSelectionChanged.
+
+    \return
+        True if the selection changed, false otherwise. If multi-select is
+        disabled, a range of one item replaces the selection and larger
+        ranges are ignored.
+    */
+    bool selectRange(const ModelIndex& parent_index, size_t start_child_id,
+                     size_t end_child_id);
+
+    /*!
+    \brief
+        Selects all children of the model's root index, firing a single
+        EventSelectionChanged.
+
+    \return
+        True if the selection changed, false otherwise. Nothing is selected if
+        multi-select is disabled and the root has more than one child.
+    */
+    bool selectAll();
+
     /*!
     \brief
         Ensures that the item specified by the \a index is visible by setting
@@ -363,6 +405,9 @@ protected:
     bool d_isDirty;
     bool d_needsFullRender;
     std::vector<ModelIndexSelectionState> d_indexSelectionStates;
+    //! Model data of the indices in d_indexSelectionStates, for O(1) lookups
+    //! in models where ItemModel::areIndicesIdentifiedByModelData is true.
+    std::unordered_set<const void*> d_selectedModelData;
     ModelIndex d_lastSelectedIndex;
     ModelIndex d_lastHoveredIndex;
     const Image* d_selectionBrush;
@@ -388,7 +433,7 @@ protected:
         float rendered_area, ScrollbarDisplayMode display_mode);
     virtual ItemViewWindowRenderer* getViewRenderer();
     void updateScrollbarDisplayMode(ScrollbarDisplayMode& target_mode,
-        ScrollbarDisplayMode new_mode, String change_event);
+        ScrollbarDisplayMode new_mode, EventId change_event);
 
     void initialiseComponents() override;
 
@@ -424,6 +469,17 @@ protected:
     void disconnectModelEvents();
 
     int getSelectedIndexPosition(const ModelIndex& index) const;
+    /*!
+    \brief
+        Adds the child \a child_id of \a parent_index to the selection, without
+        firing EventSelectionChanged.
+
+    \return
+        True if the child was added, false if it was already selected.
+    */
+    bool addSelectionState(const ModelIndex& parent_index, size_t child_id);
+    //! Removes the selection state at \a position in d_indexSelectionStates.
+    void removeSelectionState(size_t position);
     virtual bool handleSelection(const glm::vec2& localPos, bool should_select,
         bool is_cumulative, bool is_range);
     virtual bool handleSelection(const ModelIndex& index, bool should_select,
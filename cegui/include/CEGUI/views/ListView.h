@@ -95,8 +95,21 @@ public:
     ListView(const String& type, const String& name);
     virtual ~ListView() override;
 
+    /*!
+    \brief
+        Returns the rendering states of the items, in display order.
+
+        When virtualization is enabled only the rows inside the visible scroll
+        window (plus the virtualization margin) are materialized, and the first
+        returned item starts at getItemsOffset() instead of at the top of the
+        view content.
+    */
     const std::vector<ListViewItemRenderingState*>& getItems() const;
 
+    //! Returns the vertical offset, in view content space, of the first item
+    //! returned by getItems().
+    float getItemsOffset() const;
+
     void prepareForRender() override;
 
     ModelIndex indexAtLocal(const glm::vec2& localPos) override;
@@ -107,6 +120,26 @@ public:
     bool isWordWrapEnabled() const { return d_wordWrap; }
     void setWordWrapEnabled(bool wrap);
 
+    /*!
+    \brief
+        Enables or disables virtualization of the list items.
+
+        A virtualized ListView does not lay out every row of the model: rows
+        that were never visible use the font's line spacing as an estimated
+        height, and only the rows in the visible scroll window plus
+        getVirtualizationMargin() rows on each side are laid out and rendered.
+        This keeps the cost of preparing and rendering the list independent of
+        the model size, at the expense of approximate scrollbar extents for
+        rows that wrap onto multiple lines.
+    */
+    void setVirtualizationEnabled(bool enabled);
+    bool isVirtualizationEnabled() const { return d_virtualizationEnabled; }
+
+    //! Sets the number of rows above and below the visible area that are laid
+    //! out when virtualization is enabled.
+    void setVirtualizationMargin(std::uint32_t rows);
+    std::uint32_t getVirtualizationMargin() const { return d_virtualizationMargin; }
+
 protected:
 
     bool onChildrenAdded(const EventArgs& args) override;
@@ -122,11 +155,39 @@ protected:
 
     Rectf getIndexRect(const ModelIndex& index) override;
 
+    //! Lays out only the rows intersecting the visible scroll window.
+    void prepareVirtualizedItems();
+    //! Recomputes d_rowOffsets starting at the given display position.
+    void updateRowOffsets(size_t first_row);
+    //! Returns the display position of the row containing the vertical
+    //! content offset \a y, or the row count if there is none.
+    size_t getRowAtOffset(float y) const;
+    //! Returns the height used for rows that have not been laid out yet.
+    float getEstimatedRowHeight() const;
+
+    /*!
+        The laid out items. When virtualization is disabled this is indexed by
+        child id and holds every row; otherwise it only holds the materialized
+        rows, in display order.
+    */
     std::vector<ListViewItemRenderingState> d_items;
     std::vector<ListViewItemRenderingState*> d_sortedItems;
 
+    //! Child ids, in display (sorted) order.
+    std::vector<size_t> d_displayOrder;
+    //! Display position of each child id; the inverse of d_displayOrder.
+    std::vector<size_t> d_displayPositions;
+    //! Height of each row, indexed by child id.
+    std::vector<float> d_rowHeights;
+    //! Top of each row in display order, plus the total height as last element.
+    std::vector<float> d_rowOffsets;
+    //! Display position of the first item in d_sortedItems.
+    size_t d_firstItemRow = 0;
+
     HorizontalTextFormatting d_horzFormatting = HorizontalTextFormatting::LeftAligned;
     bool d_wordWrap = false;
+    bool d_virtualizationEnabled = false;
+    std::uint32_t d_virtualizationMargin = 8;
 };
 
 }
@@ -33,6 +33,7 @@
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/text/RenderedText.h"
+#include "CEGUI/FenwickTree.h"
 #include <vector>
 
 #if defined (_MSC_VER)
@@ -115,13 +116,27 @@ public:
     bool d_subtreeIsExpanded;
     int d_nestedLevel;
 
+    //! Height of this item's own row. Zero for the root item.
+    float d_rowHeight;
+    //! Height of this item's row plus the rows of all its rendered descendants.
+    float d_subtreeHeight;
+    //! Position of this item in its parent's d_renderedChildren.
+    size_t d_renderedIndex;
+
     TreeView* d_attachedTreeView;
 
 protected:
     //! Holds the unsorted children on which all tree operations are done.
     std::vector<TreeViewItemRenderingState> d_children;
+    //! Subtree heights of d_renderedChildren, in rendered order.
+    FenwickTree<float> d_childrenHeights;
 
+    //! Rebuilds and sorts d_renderedChildren for the whole subtree.
     void sortChildren();
+    //! Rebuilds and sorts d_renderedChildren of this item only.
+    void updateRenderedChildren();
+    //! Recomputes d_childrenHeights and d_subtreeHeight from the rendered children.
+    void updateChildrenHeights();
 
     friend class TreeView;
 };
@@ -141,6 +156,10 @@ public:
     static const String EventSubtreeExpanded;
     static const String EventSubtreeCollapsed;
 
+    //! Ids of the event names above.
+    static const EventId EventSubtreeExpandedId;
+    static const EventId EventSubtreeCollapsedId;
+
     TreeView(const String& type, const String& name);
     virtual ~TreeView();
 
@@ -176,6 +195,18 @@ public:
     */
     void toggleSubtree(TreeViewItemRenderingState& item);
 
+    /*!
+    \brief
+        Enables or disables incremental layout.
+
+        In incremental mode selection changes and scrolling never re-layout
+        the tree, and model changes only lay out the affected rows and update
+        the heights of their ancestors. Otherwise every invalidation lays out
+        all expanded items again.
+    */
+    void setIncrementalLayoutEnabled(bool enabled);
+    bool isIncrementalLayoutEnabled() const { return d_incrementalLayout; }
+
 protected:
     using ItemView::handleSelection;
 
@@ -185,6 +216,9 @@ protected:
 
     bool onChildrenRemoved(const EventArgs& args) override;
     bool onChildrenAdded(const EventArgs& args) override;
+    bool onChildrenDataChanged(const EventArgs& args) override;
+    bool onScrollPositionChanged(const EventArgs& args) override;
+    void onSelectionChanged(ItemViewEventArgs& args) override;
 
     virtual void onSubtreeExpanded(ItemViewEventArgs& args);
     virtual void onSubtreeCollapsed(ItemViewEventArgs& args);
@@ -199,6 +233,7 @@ private:
         float& rendered_max_width, float& rendered_total_height);
 
     float d_subtreeExpanderMargin;
+    bool d_incrementalLayout;
 
     void addTreeViewProperties();
 
@@ -211,8 +246,17 @@ private:
     void fillRenderingState(TreeViewItemRenderingState& state, const ModelIndex& index, float& rendered_max_width, float& rendered_total_height);
 
     ModelIndex indexAtWithAction(const glm::vec2& localPos, TreeViewItemAction action);
-    ModelIndex indexAtRecursive(TreeViewItemRenderingState& item, float& cur_height,
-        const glm::vec2& window_position, bool& handled, TreeViewItemAction action);
+
+    ModelIndex getIndexForItem(const TreeViewItemRenderingState& item) const;
+    //! Fills \a path with the items from the root down to \a index; returns
+    //! false if \a index is not materialized.
+    bool getTreeViewItemPath(const ModelIndex& index,
+        std::vector<TreeViewItemRenderingState*>& path);
+    //! Propagates the subtree height of the item at \a index to its ancestors.
+    void updateAncestorHeights(const ModelIndex& index);
+    void updateSelectionStates(TreeViewItemRenderingState& item);
+    //! Refreshes scrollbars and geometry after an incremental change.
+    void updateViewExtents();
 
     void clearItemRenderedChildren(TreeViewItemRenderingState& item, float& renderedTotalHeight);
     void handleSelectionAction(TreeViewItemRenderingState& item, bool toggles_expander);
@@ -49,6 +49,9 @@ public:
      */
     static const String EventListSelectionAccepted;
 
+    //! Id of the event name above.
+    static const EventId EventListSelectionAcceptedId;
+
     ComboDropList(const String& type, const String& name);
 
     /*!
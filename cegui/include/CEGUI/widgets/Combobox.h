@@ -165,6 +165,24 @@ public:
      */
     static const String EventListSelectionAccepted;
 
+    //! Ids of the event names above.
+    static const EventId EventReadOnlyModeChangedId;
+    static const EventId EventValidationStringChangedId;
+    static const EventId EventMaximumTextLengthChangedId;
+    static const EventId EventTextValidityChangedId;
+    static const EventId EventCaretMovedId;
+    static const EventId EventTextSelectionChangedId;
+    static const EventId EventEditboxFullId;
+    static const EventId EventTextAcceptedId;
+    static const EventId EventListContentsChangedId;
+    static const EventId EventListSelectionChangedId;
+    static const EventId EventSortModeChangedId;
+    static const EventId EventVertScrollbarModeChangedId;
+    static const EventId EventHorzScrollbarModeChangedId;
+    static const EventId EventDropListDisplayedId;
+    static const EventId EventDropListRemovedId;
+    static const EventId EventListSelectionAcceptedId;
+
     Combobox(const String& type, const String& name);
 
     void initialiseComponents() override;
@@ -99,6 +99,16 @@ public:
         */
     static const String EventDragDropTargetChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventDragStartedId;
+    static const EventId EventDragEndedId;
+    static const EventId EventDragPositionChangedId;
+    static const EventId EventDragEnabledChangedId;
+    static const EventId EventDragAlphaChangedId;
+    static const EventId EventDragCursorChangedId;
+    static const EventId EventDragThresholdChangedId;
+    static const EventId EventDragDropTargetChangedId;
+
     DragContainer(const String& type, const String& name);
 
     /*************************************************************************
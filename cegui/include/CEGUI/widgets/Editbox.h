@@ -55,6 +55,9 @@ public:
      */
     static const String EventTextAccepted;
 
+    //! Id of the event name above.
+    static const EventId EventTextAcceptedId;
+
     Editbox(const String& type, const String& name);
 
     /*!
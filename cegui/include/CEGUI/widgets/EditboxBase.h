@@ -136,6 +136,18 @@ public:
      */
     static const String EventTextValidityChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventReadOnlyModeChangedId;
+    static const EventId EventTextMaskingEnabledChangedId;
+    static const EventId EventTextMaskingCodepointChangedId;
+    static const EventId EventMaximumTextLengthChangedId;
+    static const EventId EventDefaultParagraphDirectionChangedId;
+    static const EventId EventCaretMovedId;
+    static const EventId EventTextSelectionChangedId;
+    static const EventId EventEditboxFullId;
+    static const EventId EventValidationStringChangedId;
+    static const EventId EventTextValidityChangedId;
+
     EditboxBase(const String& type, const String& name);
     virtual ~EditboxBase() override;
 
@@ -509,6 +521,14 @@ protected:
 
     virtual bool insertString(String&& strToInsert);
     void deleteRange(size_t start, size_t length);
+
+    /*!
+    \brief
+        Set the text resulting from replacing \a oldLength code units at
+        \a start of the current text with \a newLength ones. Unlike setText
+        this lets the rendered text be updated for the edited paragraphs only.
+    */
+    void setEditedText(const String& text, size_t start, size_t oldLength, size_t newLength);
     void handleCaretMovement(size_t newIndex, bool select);
 
     void handleSelectAll();
@@ -663,7 +683,14 @@ protected:
     //! true when a selection is being dragged.
     bool d_dragPanningEnabled = true;
 
+    //! Edit of the text not yet applied to d_renderedText, valid if d_renderedTextEdited is set.
+    size_t d_textEditStart = 0;
+    size_t d_textEditOldLength = 0;
+    size_t d_textEditNewLength = 0;
+
     bool d_renderedTextDirty = true;
+    //! true when d_renderedText only misses the edit above and can be updated in place.
+    bool d_renderedTextEdited = false;
     bool d_formattingDirty = true;
 
     //! specifies whether validator was created by us, or supplied by user.
@@ -69,6 +69,12 @@ public:
      */
     static const String EventDragSizingEnded;
 
+    //! Ids of the event names above.
+    static const EventId EventRollupToggledId;
+    static const EventId EventCloseClickedId;
+    static const EventId EventDragSizingStartedId;
+    static const EventId EventDragSizingEndedId;
+
     static constexpr float DefaultSizingBorderSize = 8.f;    //!< Default size for the sizing border (in pixels)
 
     static const String TitlebarName;      //!< Widget name for the titlebar component.
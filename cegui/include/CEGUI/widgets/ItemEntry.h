@@ -88,6 +88,9 @@ public:
      */
     static const String EventSelectionChanged;
 
+    //! Id of the event name above.
+    static const EventId EventSelectionChangedId;
+
 	/*************************************************************************
 		Accessors
 	*************************************************************************/
@@ -115,6 +115,11 @@ public:
      */
     static const String EventSortModeChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventListContentsChangedId;
+    static const EventId EventSortEnabledChangedId;
+    static const EventId EventSortModeChangedId;
+
 	/*************************************************************************
 		Accessor Methods
 	*************************************************************************/
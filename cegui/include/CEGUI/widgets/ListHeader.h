@@ -187,6 +187,20 @@ public:
      */
 	static const String EventSegmentRenderOffsetChanged;
 
+	//! Ids of the event names above.
+	static const EventId EventSortColumnChangedId;
+	static const EventId EventSortDirectionChangedId;
+	static const EventId EventSegmentSizedId;
+	static const EventId EventSegmentClickedId;
+	static const EventId EventSplitterDoubleClickedId;
+	static const EventId EventSegmentSequenceChangedId;
+	static const EventId EventSegmentAddedId;
+	static const EventId EventSegmentRemovedId;
+	static const EventId EventSortSettingChangedId;
+	static const EventId EventDragMoveSettingChangedId;
+	static const EventId EventDragSizeSettingChangedId;
+	static const EventId EventSegmentRenderOffsetChangedId;
+
 	// values
 	static const float	ScrollSpeed;				//!< Speed to scroll at when dragging outside header.
 	static const float	MinimumSegmentPixelWidth;	//!< Miniumum width of a segment in pixels.
@@ -116,6 +116,18 @@ public:
      */
 	static const String EventClickableSettingChanged;
 
+	//! Ids of the event names above.
+	static const EventId EventSegmentClickedId;
+	static const EventId EventSplitterDoubleClickedId;
+	static const EventId EventSizingSettingChangedId;
+	static const EventId EventSortDirectionChangedId;
+	static const EventId EventMovableSettingChangedId;
+	static const EventId EventSegmentDragStartId;
+	static const EventId EventSegmentDragStopId;
+	static const EventId EventSegmentDragPositionChangedId;
+	static const EventId EventSegmentSizedId;
+	static const EventId EventClickableSettingChangedId;
+
 	// Defaults
     static const float DefaultSizingArea;       //!< Default size of the sizing area.
     static const float SegmentMoveThreshold;    //!< Amount the cursor must be dragged before drag-moving is initiated.
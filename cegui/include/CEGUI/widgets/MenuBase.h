@@ -86,6 +86,10 @@ public:
      */
     static const String EventPopupClosed;
 
+    //! Ids of the event names above.
+    static const EventId EventPopupOpenedId;
+    static const EventId EventPopupClosedId;
+
     MenuBase(const String& type, const String& name);
 
     //! Get the item spacing for this menu.
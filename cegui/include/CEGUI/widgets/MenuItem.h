@@ -45,6 +45,9 @@ public:
      */
     static const String EventClicked;
 
+    //! Id of the event name above.
+    static const EventId EventClickedId;
+
     MenuItem(const String& type, const String& name);
 
     /*!
@@ -31,6 +31,8 @@
 
 #include "../Window.h"
 #include "./ListHeader.h" // FIXME: ListHeaderSegment::SortDirection
+#include "../FenwickTree.h"
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -167,6 +169,19 @@ public:
      */
 	static const String EventListColumnMoved;
 
+	//! Ids of the event names above.
+	static const EventId EventSelectionModeChangedId;
+	static const EventId EventNominatedSelectColumnChangedId;
+	static const EventId EventNominatedSelectRowChangedId;
+	static const EventId EventVertScrollbarModeChangedId;
+	static const EventId EventHorzScrollbarModeChangedId;
+	static const EventId EventSelectionChangedId;
+	static const EventId EventListContentsChangedId;
+	static const EventId EventSortColumnChangedId;
+	static const EventId EventSortDirectionChangedId;
+	static const EventId EventListColumnSizedId;
+	static const EventId EventListColumnMovedId;
+
     /*************************************************************************
         Child Widget name constants
     *************************************************************************/
@@ -745,6 +760,22 @@ public:
     */
     float   getTotalRowsHeight(void) const;
 
+    /*!
+    \brief
+        Return, in pixels, the distance from the top of the first row to the
+        top of the row at index \a row_idx.  If \a row_idx is greater than or
+        equal to the number of rows, the total height of the rows is returned.
+    */
+    float   getRowOffset(unsigned int row_idx) const;
+
+    /*!
+    \brief
+        Return the index of the row at the pixel distance \a offset from the
+        top of the first row, or getRowCount() if \a offset is beyond the last
+        row.
+    */
+    unsigned int    getRowAtOffset(float offset) const;
+
     /*!
     \brief
         Return the pixel width of the widest item in the given column
@@ -754,6 +785,10 @@ public:
     /*!
     \brief
         Return, in pixels, the height of the highest item in the given row.
+
+    \note
+        Row heights are cached when items are set.  Call handleUpdatedItemData
+        after modifying attached items so the heights are updated.
     */
     float   getHighestRowItemHeight(unsigned int row_idx) const;
 
@@ -993,6 +1028,40 @@ public:
 	unsigned int	insertRow(ListboxItem* item, unsigned int col_id, unsigned int row_idx, unsigned int row_id = 0);
 
 
+	/*!
+	\brief
+		Start a batch of changes to the list content.
+
+		Until the matching call to endUpdate, adding, inserting, removing and
+		setting rows and items does not reconfigure the scrollbars nor fire
+		EventListContentsChanged; this is done once when the outermost batch
+		ends.  If the list is being sorted, added rows are appended and the
+		list is sorted when the batch ends, so row indices returned while the
+		batch is active may change at that point.
+
+		Calls may be nested.
+	*/
+	void	beginUpdate(void);
+
+
+	/*!
+	\brief
+		End a batch of changes started with beginUpdate.  When the outermost
+		batch ends, the list is sorted as required and EventListContentsChanged
+		is fired if the content was changed.
+
+	\exception InvalidRequestException	thrown if no batch was started.
+	*/
+	void	endUpdate(void);
+
+
+	/*!
+	\brief
+		Return whether a batch of changes started with beginUpdate is active.
+	*/
+	bool	isUpdating(void) const		{return d_updateDepth != 0;}
+
+
 	/*!
 	\brief
 		Remove the list box row with index \a row_idx.  Any ListboxItem in row \a row_idx using autoDelete mode will be deleted.
@@ -1484,6 +1553,37 @@ protected:
 	void	configureScrollbars(void);
 
 
+	/*!
+	\brief
+		Notify the list that its content has changed.  Fires the contents
+		changed notification, or records it while a batch of changes is active.
+	*/
+	void	notifyListContentsChanged(void);
+
+
+	/*!
+	\brief
+		Update the cached heights of all rows from the pixel size of their items.
+	*/
+	void	updateRowHeights(void);
+
+
+	/*!
+	\brief
+		Mark the cached row offsets and item positions as invalid, they are
+		rebuilt when next needed.  Must be called after rows are reordered.
+	*/
+	void	invalidateRowCaches(void);
+
+
+	//! Rebuild the cached row offsets if they are invalid.
+	void	validateRowHeights(void) const;
+
+
+	//! Rebuild the cached item positions if they are invalid.
+	void	validateItemGridRefs(void) const;
+
+
 	/*!
 	\brief
 		select all strings between positions \a start and \a end.  (inclusive).  Returns true if something was modified.
@@ -1681,6 +1781,7 @@ protected:
 		RowItems	d_items;
 		unsigned int		d_sortColumn;
 		unsigned int		d_rowID;
+		float		d_height = 0.0f;	//!< Height of the highest item in the row.
 
 		// operators
 		ListboxItem* const& operator[](unsigned int idx) const	{return d_items[idx];}
@@ -1697,6 +1798,13 @@ protected:
 	static bool pred_descend(const ListRow& a, const ListRow& b);
 
 
+	/*!
+	\brief
+		Update the cached height of \a row from the pixel size of its items.
+	*/
+	void	updateRowHeight(ListRow& row) const;
+
+
 	/*************************************************************************
 		Implementation Data
 	*************************************************************************/
@@ -1721,6 +1829,16 @@ protected:
 	typedef std::vector<ListRow> ListItemGrid;
 	ListItemGrid	d_grid;			//!< Holds the list box data.
 
+	//! Heights of the rows, to find the row offsets in O(log n).
+	mutable FenwickTree<float>	d_rowHeights;
+	mutable bool	d_rowHeightsValid;	//!< false if d_rowHeights must be rebuilt.
+	//! Grid position of each item, to find an item without scanning the grid.
+	mutable std::unordered_map<const ListboxItem*, MCLGridRef>	d_itemGridRefs;
+	mutable bool	d_itemGridRefsValid;	//!< false if d_itemGridRefs must be rebuilt.
+
+	unsigned int	d_updateDepth;			//!< Nesting depth of beginUpdate calls.
+	bool	d_contentsChangedInUpdate;	//!< true if the content changed during the active batch.
+
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
@@ -68,6 +68,10 @@ public:
      */
 	static const String EventProgressDone;
 
+	//! Ids of the event names above.
+	static const EventId EventProgressChangedId;
+	static const EventId EventProgressDoneId;
+
 
 	/************************************************************************
 		Accessor Functions
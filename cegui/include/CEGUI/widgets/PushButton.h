@@ -46,6 +46,9 @@ public:
      */
 	static const String EventClicked;
 
+	//! Id of the event name above.
+	static const EventId EventClickedId;
+
     using ButtonBase::ButtonBase;
 
 protected:
@@ -99,6 +99,12 @@ public:
      * WindowEventArgs::window set to the ScrollablePane that has been scrolled.
      */
     static const String EventContentPaneScrolled;
+
+    //! Ids of the event names above.
+    static const EventId EventContentPaneChangedId;
+    static const EventId EventVertScrollbarModeChangedId;
+    static const EventId EventHorzScrollbarModeChangedId;
+    static const EventId EventContentPaneScrolledId;
     //! Widget name for the vertical scrollbar component.
     static const String VertScrollbarName;
     //! Widget name for the horizontal scrollbar component.
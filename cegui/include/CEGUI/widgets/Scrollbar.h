@@ -119,6 +119,12 @@ public:
      */
     static const String EventScrollConfigChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventScrollPositionChangedId;
+    static const EventId EventThumbTrackStartedId;
+    static const EventId EventThumbTrackEndedId;
+    static const EventId EventScrollConfigChangedId;
+
     //! Widget name for the thumb component.
     static const String ThumbName;
     //! Widget name for the increase button component.
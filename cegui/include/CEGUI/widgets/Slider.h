@@ -123,6 +123,14 @@ public:
      */
 	static const String EventThumbTrackEnded;
 
+	//! Ids of the event names above.
+	static const EventId EventValueChangedId;
+	static const EventId EventMinimumValueChangedId;
+	static const EventId EventMaximumValueChangedId;
+	static const EventId EventStepChangedId;
+	static const EventId EventThumbTrackStartedId;
+	static const EventId EventThumbTrackEndedId;
+
     /*************************************************************************
         Child Widget name suffix constants
     *************************************************************************/
@@ -92,6 +92,13 @@ public:
         */
     static const String EventTextInputModeChanged;
 
+    //! Ids of the event names above.
+    static const EventId EventValueChangedId;
+    static const EventId EventMinimumValueChangedId;
+    static const EventId EventMaximumValueChangedId;
+    static const EventId EventStepChangedId;
+    static const EventId EventTextInputModeChangedId;
+
     /*************************************************************************
         Component widget name strings
     *************************************************************************/
@@ -69,6 +69,11 @@ public:
      */
 	static const String EventScrolled;
 
+	//! Ids of the event names above.
+	static const EventId EventClickedId;
+	static const EventId EventDraggedId;
+	static const EventId EventScrolledId;
+
 	/*************************************************************************
 		Construction and Destruction
 	*************************************************************************/
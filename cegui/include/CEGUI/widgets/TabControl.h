@@ -97,6 +97,9 @@ public:
      */
 	static const String EventSelectionChanged;
 
+	//! Id of the event name above.
+	static const EventId EventSelectionChangedId;
+
     /*************************************************************************
         Child Widget name constants
     *************************************************************************/
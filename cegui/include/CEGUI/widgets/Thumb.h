@@ -84,6 +84,11 @@ public:
      */
 	static const String EventThumbTrackEnded;
 
+	//! Ids of the event names above.
+	static const EventId EventThumbPositionChangedId;
+	static const EventId EventThumbTrackStartedId;
+	static const EventId EventThumbTrackEndedId;
+
 
 	/*************************************************************************
 		Accessor Functions
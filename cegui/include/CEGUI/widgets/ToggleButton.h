@@ -44,6 +44,9 @@ public:
      */
     static const String EventSelectStateChanged;
 
+    //! Id of the event name above.
+    static const EventId EventSelectStateChangedId;
+
     //!returns true if the toggle button is in the selected state.
     bool isSelected(void) const { return d_selected; }
 
@@ -343,41 +343,46 @@ void Affector::apply(AnimationInstance* instance)
         right->alterInterpolationPosition(
             leftDistance / (leftDistance + rightDistance));
 
+    // the native binding avoids converting values to and from String
+    InterpolatorBinding* binding = instance->getInterpolatorBinding(*this);
+
     // absolute application method
     if (d_applicationMethod == ApplicationMethod::ApplyAbsolute)
     {
-        const String result = d_interpolator->interpolateAbsolute(
-                                  left->getValueForAnimation(instance),
-                                  right->getValueForAnimation(instance),
-                                  interpolationPosition);
-
-        target->setProperty(d_targetProperty, result);
+        const String& value1 = left->getValueForAnimation(instance);
+        const String& value2 = right->getValueForAnimation(instance);
+
+        if (binding)
+            binding->applyAbsolute(value1, value2, interpolationPosition);
+        else
+            target->setProperty(d_targetProperty,
+                d_interpolator->interpolateAbsolute(value1, value2, interpolationPosition));
     }
     // relative application method
     else if (d_applicationMethod == ApplicationMethod::ApplyRelative)
     {
         const String& base = instance->getSavedPropertyValue(getTargetProperty());
-
-        const String result = d_interpolator->interpolateRelative(
-                                  base,
-                                  left->getValueForAnimation(instance),
-                                  right->getValueForAnimation(instance),
-                                  interpolationPosition);
-
-        target->setProperty(d_targetProperty, result);
+        const String& value1 = left->getValueForAnimation(instance);
+        const String& value2 = right->getValueForAnimation(instance);
+
+        if (binding)
+            binding->applyRelative(base, value1, value2, interpolationPosition);
+        else
+            target->setProperty(d_targetProperty,
+                d_interpolator->interpolateRelative(base, value1, value2, interpolationPosition));
     }
     // relative multiply application method
     else if (d_applicationMethod == ApplicationMethod::ApplyRelativeMultiply)
     {
         const String& base = instance->getSavedPropertyValue(getTargetProperty());
-
-        const String result = d_interpolator->interpolateRelativeMultiply(
-                                  base,
-                                  left->getValueForAnimation(instance),
-                                  right->getValueForAnimation(instance),
-                                  interpolationPosition);
-
-        target->setProperty(d_targetProperty, result);
+        const String& value1 = left->getValueForAnimation(instance);
+        const String& value2 = right->getValueForAnimation(instance);
+
+        if (binding)
+            binding->applyRelativeMultiply(base, value1, value2, interpolationPosition);
+        else
+            target->setProperty(d_targetProperty,
+                d_interpolator->interpolateRelativeMultiply(base, value1, value2, interpolationPosition));
     }
     // todo: more application methods?
     else
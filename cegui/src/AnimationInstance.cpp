@@ -28,6 +28,7 @@
  ***************************************************************************/
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/Animation.h"
+#include "CEGUI/Affector.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/Logger.h"
@@ -46,6 +47,14 @@ const String AnimationInstance::EventAnimationFinished("AnimationFinished");
 const String AnimationInstance::EventAnimationEnded("AnimationEnded");
 const String AnimationInstance::EventAnimationLooped("AnimationLooped");
 
+const EventId AnimationInstance::EventAnimationStartedId(EventAnimationStarted);
+const EventId AnimationInstance::EventAnimationStoppedId(EventAnimationStopped);
+const EventId AnimationInstance::EventAnimationPausedId(EventAnimationPaused);
+const EventId AnimationInstance::EventAnimationUnpausedId(EventAnimationUnpaused);
+const EventId AnimationInstance::EventAnimationFinishedId(EventAnimationFinished);
+const EventId AnimationInstance::EventAnimationEndedId(EventAnimationEnded);
+const EventId AnimationInstance::EventAnimationLoopedId(EventAnimationLooped);
+
 //----------------------------------------------------------------------------//
 AnimationInstance::AnimationInstance(Animation* definition):
     d_definition(definition)
@@ -67,6 +76,7 @@ void AnimationInstance::setTarget(PropertySet* target)
     d_target = target;
 
     purgeSavedPropertyValues();
+    purgeInterpolatorBindings();
 
     if (d_definition->getAutoStart() && !isRunning())
         start();
@@ -399,6 +409,37 @@ const String& AnimationInstance::getSavedPropertyValue(const String& propertyNam
     return it->second;
 }
 
+//----------------------------------------------------------------------------//
+InterpolatorBinding* AnimationInstance::getInterpolatorBinding(const Affector& affector)
+{
+    assert(d_target);
+
+    AffectorBindingRecord& record = d_interpolatorBindings[&affector];
+
+    // the property is resolved again only when something it depends on changed
+    if (record.d_interpolator != affector.getInterpolator() ||
+        record.d_propertiesRevision != d_target->getPropertiesRevision() ||
+        record.d_targetProperty != affector.getTargetProperty())
+    {
+        record.d_interpolator = affector.getInterpolator();
+        record.d_targetProperty = affector.getTargetProperty();
+        record.d_propertiesRevision = d_target->getPropertiesRevision();
+        record.d_binding.reset();
+
+        if (record.d_interpolator && d_target->isPropertyPresent(record.d_targetProperty))
+            record.d_binding.reset(record.d_interpolator->createBinding(
+                d_target, d_target->getPropertyInstance(record.d_targetProperty)));
+    }
+
+    return record.d_binding.get();
+}
+
+//----------------------------------------------------------------------------//
+void AnimationInstance::purgeInterpolatorBindings()
+{
+    d_interpolatorBindings.clear();
+}
+
 //----------------------------------------------------------------------------//
 void AnimationInstance::addAutoConnection(Event::Connection conn)
 {
@@ -426,7 +467,7 @@ void AnimationInstance::onAnimationStarted()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationStarted, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationStartedId, args, EventNamespace);
     }
 }
 
@@ -436,7 +477,7 @@ void AnimationInstance::onAnimationStopped()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationStopped, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationStoppedId, args, EventNamespace);
     }
 }
 
@@ -446,7 +487,7 @@ void AnimationInstance::onAnimationPaused()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationPaused, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationPausedId, args, EventNamespace);
     }
 }
 
@@ -456,7 +497,7 @@ void AnimationInstance::onAnimationUnpaused()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationUnpaused, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationUnpausedId, args, EventNamespace);
     }
 }
 
@@ -466,7 +507,7 @@ void AnimationInstance::onAnimationFinished()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationFinished, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationFinishedId, args, EventNamespace);
     }
 }
 
@@ -476,7 +517,7 @@ void AnimationInstance::onAnimationEnded()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationEnded, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationEndedId, args, EventNamespace);
     }
 }
 
@@ -486,7 +527,7 @@ void AnimationInstance::onAnimationLooped()
     if (d_eventReceiver)
     {
         AnimationEventArgs args(this);
-        d_eventReceiver->fireEvent(EventAnimationLooped, args, EventNamespace);
+        d_eventReceiver->fireEvent(EventAnimationLoopedId, args, EventNamespace);
     }
 }
 
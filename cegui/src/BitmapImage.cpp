@@ -80,47 +80,105 @@ BitmapImage::BitmapImage(const String& name, Texture* texture,
     , d_texture(texture)
 {}
 
+//----------------------------------------------------------------------------//
+void BitmapImage::assign(const Image& image)
+{
+    Image::assign(image);
+    d_texture = static_cast<const BitmapImage&>(image).d_texture;
+}
+
 //----------------------------------------------------------------------------//
 void BitmapImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     const ImageRenderSettings& renderSettings, size_t canCombineFromIdx) const
 {
-    TexturedColouredVertex vbuffer[6];
-    if (!createVertices(vbuffer, renderSettings))
-        return;
+    Rectf destRect, texRect;
+    if (prepareQuad(renderSettings.d_destArea, renderSettings, destRect, texRect))
+        appendQuads(out, d_texture, &destRect, &texRect, 1, renderSettings, canCombineFromIdx);
+}
+
+//----------------------------------------------------------------------------//
+void BitmapImage::createRenderGeometryBatch(std::vector<GeometryBuffer*>& out,
+    const BitmapImage* const* images, const Rectf* dest_areas, size_t count,
+    const ImageRenderSettings& renderSettings, size_t canCombineFromIdx)
+{
+    std::vector<Rectf> destRects;
+    std::vector<Rectf> texRects;
+
+    size_t runStart = 0;
+    while (runStart < count)
+    {
+        // Images sharing a texture go to the same buffer
+        Texture* texture = images[runStart]->d_texture;
+        size_t runEnd = runStart + 1;
+        while (runEnd < count && images[runEnd]->d_texture == texture)
+            ++runEnd;
+
+        destRects.clear();
+        texRects.clear();
+        destRects.reserve(runEnd - runStart);
+        texRects.reserve(runEnd - runStart);
+        for (size_t i = runStart; i < runEnd; ++i)
+        {
+            Rectf destRect, texRect;
+            if (images[i]->prepareQuad(dest_areas[i], renderSettings, destRect, texRect))
+            {
+                destRects.push_back(destRect);
+                texRects.push_back(texRect);
+            }
+        }
+
+        if (!destRects.empty())
+            appendQuads(out, texture, destRects.data(), texRects.data(), destRects.size(),
+                renderSettings, canCombineFromIdx);
+
+        runStart = runEnd;
+    }
+}
 
+//----------------------------------------------------------------------------//
+void BitmapImage::appendQuads(std::vector<GeometryBuffer*>& out, Texture* texture,
+    const Rectf* destRects, const Rectf* texRects, size_t count,
+    const ImageRenderSettings& renderSettings, size_t canCombineFromIdx)
+{
     // Try to find an existing buffer suitable for combining. Note that we
     // don't check the whole 'out' because geometry ordering may be important.
-    GeometryBuffer* buffer = nullptr;
     if (canCombineFromIdx < out.size())
     {
         // TODO: need more checks than just a texture? Clipping region, alpha.
         auto it = std::find_if(out.cbegin() + canCombineFromIdx, out.cend(),
-            [tex = d_texture](const GeometryBuffer* buffer)
+            [texture](const GeometryBuffer* buffer)
         {
-            return tex == buffer->getMainTexture();
+            return texture == buffer->getMainTexture();
         });
         if (it != out.end())
-            buffer = *it;
+        {
+            (*it)->appendTexturedQuads(destRects, texRects, count,
+                &renderSettings.d_multiplyColours, 1, renderSettings.d_clipArea);
+            return;
+        }
     }
 
-    if (!buffer)
-    {
-        buffer = &System::getSingleton().getRenderer()->createGeometryBufferTextured();
-        buffer->setClippingActive(!!renderSettings.d_clipArea);
-        if (renderSettings.d_clipArea)
-            buffer->setClippingRegion(*renderSettings.d_clipArea);
-        buffer->setMainTexture(d_texture);
-        buffer->setAlpha(renderSettings.d_alpha);
-        out.push_back(buffer);
-    }
+    auto renderer = System::getSingleton().getRenderer();
+    auto buffer = &renderer->createGeometryBufferTextured();
+    buffer->setClippingActive(!!renderSettings.d_clipArea);
+    if (renderSettings.d_clipArea)
+        buffer->setClippingRegion(*renderSettings.d_clipArea);
+    buffer->setMainTexture(texture);
+    buffer->setAlpha(renderSettings.d_alpha);
 
-    buffer->appendGeometry(vbuffer, 6);
+    // Quads only touching an edge of the clip area end up empty
+    if (buffer->appendTexturedQuads(destRects, texRects, count,
+            &renderSettings.d_multiplyColours, 1, renderSettings.d_clipArea))
+        out.push_back(buffer);
+    else
+        renderer->destroyGeometryBuffer(*buffer);
 }
 
 //----------------------------------------------------------------------------//
-bool BitmapImage::createVertices(TexturedColouredVertex* out, const ImageRenderSettings& renderSettings) const
+bool BitmapImage::prepareQuad(const Rectf& dest_area, const ImageRenderSettings& renderSettings,
+    Rectf& destRect, Rectf& texRect) const
 {
-    Rectf destRect = renderSettings.d_destArea;
+    destRect = dest_area;
     destRect.offset(d_scaledOffset);
 
     if (renderSettings.d_alignToPixels)
@@ -132,70 +190,31 @@ bool BitmapImage::createVertices(TexturedColouredVertex* out, const ImageRenderS
             return false;
     }
 
-    // When not clipped, we draw the whole image
-    Rectf texRect = d_imageArea;
-
-    // Apply clipping if needed
-    if (renderSettings.d_clipArea)
+    // Skip images entirely outside of the clip area early, the rest of the
+    // clipping is done when generating vertices
+    if (const Rectf* clip = renderSettings.d_clipArea)
     {
-        const Rectf unclippedDestRect = destRect;
-        if (destRect.intersect(*renderSettings.d_clipArea))
-        {
-            if (destRect.empty())
-                return false;
-
-            const glm::vec2 scaleDestToImg(
-                d_imageArea.getWidth() / unclippedDestRect.getWidth(),
-                d_imageArea.getHeight() / unclippedDestRect.getHeight());
-
-            texRect += (destRect - unclippedDestRect) * scaleDestToImg;
-        }
+        if (destRect.right() < clip->left() || destRect.left() > clip->right() ||
+            destRect.bottom() < clip->top() || destRect.top() > clip->bottom())
+            return false;
     }
 
-    // Turn pixels into normalized texture coords
+    // When not clipped, we draw the whole image. Turn pixels into normalized texture coords.
+    texRect = d_imageArea;
     texRect *= d_texture->getTexelScaling();
 
-    // vertex 0
-    out[0].setColour(renderSettings.d_multiplyColours.d_top_left);
-    out[0].d_position = glm::vec3(destRect.left(), destRect.top(), 0.0f);
-    out[0].d_texCoords = glm::vec2(texRect.left(), texRect.top());
-
-    // vertex 1
-    out[1].setColour(renderSettings.d_multiplyColours.d_bottom_left);
-    out[1].d_position = glm::vec3(destRect.left(), destRect.bottom(), 0.0f);
-    out[1].d_texCoords = glm::vec2(texRect.left(), texRect.bottom());
-
-    // vertex 2
-    out[2].setColour(renderSettings.d_multiplyColours.d_bottom_right);
-    out[2].d_position.x = destRect.right();
-    out[2].d_position.z = 0.0f;
-    out[2].d_texCoords.x = texRect.right();
-
-    // Quad splitting done from top-left to bottom-right diagonal
-    out[2].d_position.y = destRect.bottom();
-    out[2].d_texCoords.y = texRect.bottom();
-
-    // vertex 3
-    out[3].setColour(renderSettings.d_multiplyColours.d_top_right);
-    out[3].d_position = glm::vec3(destRect.right(), destRect.top(), 0.0f);
-    out[3].d_texCoords = glm::vec2(texRect.right(), texRect.top());
-
-    // vertex 4
-    out[4].setColour(renderSettings.d_multiplyColours.d_top_left);
-    out[4].d_position.x = destRect.left();
-    out[4].d_position.z = 0.0f;
-    out[4].d_texCoords.x = texRect.left();
-
-    // Quad splitting done from top-left to bottom-right diagonal
-    out[4].d_position.y = destRect.top();
-    out[4].d_texCoords.y = texRect.top();
-
-    // vertex 5
-    out[5].setColour(renderSettings.d_multiplyColours.d_bottom_right);
-    out[5].d_position = glm::vec3(destRect.right(), destRect.bottom(), 0.0f);
-    out[5].d_texCoords = glm::vec2(texRect.right(), texRect.bottom());
-
     return true;
 }
 
+//----------------------------------------------------------------------------//
+bool BitmapImage::createVertices(TexturedColouredVertex* out, const ImageRenderSettings& renderSettings) const
+{
+    Rectf destRect, texRect;
+    if (!prepareQuad(renderSettings.d_destArea, renderSettings, destRect, texRect))
+        return false;
+
+    return GeometryBuffer::writeTexturedQuads(reinterpret_cast<float*>(out), &destRect, &texRect, 1,
+        &renderSettings.d_multiplyColours, 1, renderSettings.d_clipArea) == 1;
+}
+
 }
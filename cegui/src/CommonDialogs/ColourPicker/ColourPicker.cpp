@@ -47,6 +47,10 @@ const String ColourPicker::WidgetTypeName("CEGUI/ColourPicker");
 const String ColourPicker::EventOpenedPicker("OpenedPicker");
 const String ColourPicker::EventClosedPicker("ClosedPicker");
 const String ColourPicker::EventAcceptedColour("AcceptedColour");
+
+const EventId ColourPicker::EventOpenedPickerId(EventOpenedPicker);
+const EventId ColourPicker::EventClosedPickerId(EventClosedPicker);
+const EventId ColourPicker::EventAcceptedColourId(EventAcceptedColour);
 //----------------------------------------------------------------------------//
 // Child Widget names
 const String ColourPicker::ColourRectName("__auto_colourrect__");
@@ -115,7 +119,7 @@ void ColourPicker::setColour(const Colour& newColour)
     d_selectedColour = newColour;
 
     WindowEventArgs e(this);
-    fireEvent(EventAcceptedColour, e, EventNamespace);
+    fireEvent(EventAcceptedColourId, e, EventNamespace);
 
     Colour selectedColourNoAlpha = d_selectedColour;
     selectedColourNoAlpha.setAlpha(1.0f);
@@ -202,7 +206,7 @@ void ColourPicker::onColourRectClicked(WindowEventArgs& e)
             d_colourPickerControlsWindow->setColours(d_selectedColour);
             d_colourPickerControlsWindow->setPreviousColour(d_selectedColour);
             d_colourPickerControlsWindow->refreshAllElements();
-            fireEvent(EventOpenedPicker, e, EventNamespace);
+            fireEvent(EventOpenedPickerId, e, EventNamespace);
         }
         else
         {
@@ -212,7 +216,7 @@ void ColourPicker::onColourRectClicked(WindowEventArgs& e)
                 removeChild(d_colourPickerControlsWindow);
 
                 d_colourPickerControlsWindow->setCallingColourPicker(nullptr);
-                fireEvent(EventClosedPicker, e, EventNamespace);
+                fireEvent(EventClosedPickerId, e, EventNamespace);
             }
         }
     }
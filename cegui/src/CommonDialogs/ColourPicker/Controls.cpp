@@ -66,6 +66,9 @@ const String ColourPickerControls::EventNamespace("ColourPickerControls");
 const String ColourPickerControls::WidgetTypeName("CEGUI/ColourPickerControls");
 const String ColourPickerControls::EventColourAccepted("ColourAccepted");
 const String ColourPickerControls::EventClosed("Closed");
+
+const EventId ColourPickerControls::EventColourAcceptedId(EventColourAccepted);
+const EventId ColourPickerControls::EventClosedId(EventClosed);
 const String ColourPickerControls::ColourRectPropertyName("Colour");
 //----------------------------------------------------------------------------//
 const String ColourPickerControls::ColourPickerControlsPickingTextureImageName("ColourPickingTexture");
@@ -1213,7 +1216,7 @@ void ColourPickerControls::onCancelButtonClicked(WindowEventArgs& e)
     if (this->getParent() != nullptr)
         this->getParent()->removeChild(this);
 
-    fireEvent(EventClosed, e, EventNamespace);
+    fireEvent(EventClosedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1224,8 +1227,8 @@ void ColourPickerControls::onAcceptButtonClicked(WindowEventArgs& e)
     if (this->getParent() != nullptr)
         this->getParent()->removeChild(this);
 
-    fireEvent(EventColourAccepted, e, EventNamespace);
-    fireEvent(EventClosed, e, EventNamespace);
+    fireEvent(EventColourAcceptedId, e, EventNamespace);
+    fireEvent(EventClosedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -27,6 +27,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/DataContainer.h"
+#include <utility>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -34,7 +35,14 @@ namespace CEGUI
 
 void RawDataContainer::release(void)
 {
-    if (mData)
+    if (mOwner)
+    {
+        mOwner.reset();
+
+        mData = nullptr;
+        mSize = 0;
+    }
+    else if (mData)
     {
         delete[] mData;
 
@@ -43,4 +51,11 @@ void RawDataContainer::release(void)
     }
 }
 
+void RawDataContainer::swap(RawDataContainer& other)
+{
+    std::swap(mData, other.mData);
+    std::swap(mSize, other.mSize);
+    mOwner.swap(other.mOwner);
+}
+
 } // End of  CEGUI namespace section
@@ -71,6 +71,11 @@ void DefaultLogger::logEvent(const String& message,
 {
     using namespace std;
 
+    if (!isLoggingEnabled(level))
+        return;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+
     time_t et;
     time(&et);
     tm* etm = localtime(&et);
@@ -164,6 +169,8 @@ void DefaultLogger::logEvent(const String& message,
 //----------------------------------------------------------------------------//
 void DefaultLogger::setLogFilename(const String& filename, bool append)
 {
+    std::lock_guard<std::mutex> lock(d_mutex);
+
     // close current log file (if any)
     if (d_ostream.is_open())
         d_ostream.close();
@@ -37,13 +37,48 @@
 #else
 #   include <sys/types.h>
 #   include <sys/stat.h>
+#   include <sys/mman.h>
 #   include <dirent.h>
+#   include <fcntl.h>
 #   include <fnmatch.h>
+#   include <unistd.h>
+#   include <algorithm>
+#   include <vector>
 #endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+#if !defined(__WIN32__) && !defined(_WIN32) && !defined(__ANDROID__)
+#   if defined(__linux__)
+typedef unsigned char MincoreVecType;
+#   else
+typedef char MincoreVecType;
+#   endif
+#endif
+
+//----------------------------------------------------------------------------//
+class DefaultResourceProvider::FileMapping
+{
+public:
+    FileMapping(void* address, size_t size) :
+        d_address(address),
+        d_size(size)
+    {}
+
+    ~FileMapping()
+    {
+#if !defined(__WIN32__) && !defined(_WIN32) && !defined(__ANDROID__)
+        munmap(d_address, d_size);
+#endif
+    }
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    void* d_address;
+    size_t d_size;
+};
 
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::loadRawDataContainer(const String& filename,
@@ -78,6 +113,9 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
     const size_t size_read = AAsset_read(file, buffer, size);
     AAsset_close(file);
 #else
+    if (loadMappedFile(final_filename, output))
+        return;
+
 #   if defined(__WIN32__) || defined(_WIN32)
     FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
 #   else
@@ -119,6 +157,107 @@ void DefaultResourceProvider::unloadRawDataContainer(RawDataContainer& data)
     data.release();
 }
 
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::loadMappedFile(const String& final_filename,
+                                             RawDataContainer& output)
+{
+#if defined(__WIN32__) || defined(_WIN32) || defined(__ANDROID__)
+    CEGUI_UNUSED(final_filename);
+    CEGUI_UNUSED(output);
+    return false;
+#else
+    if (!d_memoryMappingThreshold)
+        return false;
+
+    std::lock_guard<std::mutex> lock(d_mappingMutex);
+
+    if (d_sharedMappingsEnabled)
+    {
+        const auto range = d_mappings.equal_range(final_filename);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (std::shared_ptr<FileMapping> mapping = it->second.lock())
+            {
+                output.setSharedData(static_cast<std::uint8_t*>(mapping->d_address),
+                                     mapping->d_size, mapping);
+                return true;
+            }
+        }
+    }
+
+#   if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    const int file = open(String::convertUtf32ToUtf8(final_filename.getString()).c_str(), O_RDONLY);
+#   else
+    const int file = open(final_filename.c_str(), O_RDONLY);
+#   endif
+
+    // reading the file reports the error
+    if (file < 0)
+        return false;
+
+    void* address = MAP_FAILED;
+    size_t size = 0;
+    struct stat info;
+    if (fstat(file, &info) == 0 && S_ISREG(info.st_mode) &&
+        static_cast<size_t>(info.st_size) >= d_memoryMappingThreshold)
+    {
+        size = static_cast<size_t>(info.st_size);
+        address = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+    }
+
+    // the mapping stays valid once the file is closed
+    close(file);
+
+    if (address == MAP_FAILED)
+        return false;
+
+    // forget the mappings that were unmapped
+    for (auto it = d_mappings.begin(); it != d_mappings.end();)
+        it = it->second.expired() ? d_mappings.erase(it) : std::next(it);
+
+    std::shared_ptr<FileMapping> mapping(new FileMapping(address, size));
+    d_mappings.emplace(final_filename, mapping);
+    output.setSharedData(static_cast<std::uint8_t*>(address), size, std::move(mapping));
+    return true;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+DefaultResourceProvider::MappingStatistics
+DefaultResourceProvider::getMappingStatistics() const
+{
+    MappingStatistics statistics = { 0, 0, 0 };
+
+#if !defined(__WIN32__) && !defined(_WIN32) && !defined(__ANDROID__)
+    std::lock_guard<std::mutex> lock(d_mappingMutex);
+
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<MincoreVecType> pages;
+    for (const auto& entry : d_mappings)
+    {
+        const std::shared_ptr<FileMapping> mapping = entry.second.lock();
+        if (!mapping)
+            continue;
+
+        ++statistics.d_mappingCount;
+        statistics.d_mappedBytes += mapping->d_size;
+
+        pages.resize((mapping->d_size + pageSize - 1) / pageSize);
+        if (mincore(mapping->d_address, mapping->d_size, pages.data()) != 0)
+            continue;
+
+        for (size_t i = 0; i < pages.size(); ++i)
+        {
+            if (pages[i] & 1)
+                statistics.d_residentBytes +=
+                    std::min(pageSize, mapping->d_size - i * pageSize);
+        }
+    }
+#endif
+
+    return statistics;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::setResourceGroupDirectory(
                                                 const String& resourceGroup,
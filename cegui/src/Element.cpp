@@ -35,6 +35,7 @@
 #include "CEGUI/System.h" // FIXME: only for root container size - display size
 #include "CEGUI/Renderer.h" // FIXME: only for root container size - display size
 #include "CEGUI/Logger.h"
+#include "CEGUI/FrameProfiler.h"
 
 #include <algorithm>
 
@@ -59,6 +60,22 @@ const String Element::EventZOrderChanged("ZOrderChanged");
 const String Element::EventNonClientChanged("NonClientChanged");
 const String Element::EventIsSizeAdjustedToContentChanged("IsSizeAdjustedToContentChanged");
 
+const EventId Element::EventSizedId(EventSized);
+const EventId Element::EventMovedId(EventMoved);
+const EventId Element::EventHorizontalAlignmentChangedId(EventHorizontalAlignmentChanged);
+const EventId Element::EventVerticalAlignmentChangedId(EventVerticalAlignmentChanged);
+const EventId Element::EventRotatedId(EventRotated);
+const EventId Element::EventChildAddedId(EventChildAdded);
+const EventId Element::EventChildRemovedId(EventChildRemoved);
+const EventId Element::EventChildOrderChangedId(EventChildOrderChanged);
+const EventId Element::EventZOrderChangedId(EventZOrderChanged);
+const EventId Element::EventNonClientChangedId(EventNonClientChanged);
+const EventId Element::EventIsSizeAdjustedToContentChangedId(EventIsSizeAdjustedToContentChanged);
+
+unsigned int Element::s_layoutTransactionDepth = 0;
+bool Element::s_flushingLayout = false;
+std::vector<Element*> Element::s_pendingLayout;
+
 //----------------------------------------------------------------------------//
 // NB: we promised not to change incoming elements, but we don't want to prevent users from changing return values
 std::pair<Element*, Element*> Element::getSiblingsInCommonAncestor(const Element* e1, const Element* e2)
@@ -135,10 +152,90 @@ Element::Element():
     addElementProperties();
 }
 
+//----------------------------------------------------------------------------//
+Element::~Element()
+{
+    if (d_layoutPending)
+        std::replace(s_pendingLayout.begin(), s_pendingLayout.end(), this, static_cast<Element*>(nullptr));
+}
+
+//----------------------------------------------------------------------------//
+void Element::beginLayoutTransaction()
+{
+    ++s_layoutTransactionDepth;
+}
+
+//----------------------------------------------------------------------------//
+void Element::endLayoutTransaction()
+{
+    if (!s_layoutTransactionDepth)
+        throw InvalidRequestException("No layout transaction is active.");
+
+    if (!--s_layoutTransactionDepth)
+        flushPendingLayout();
+}
+
+//----------------------------------------------------------------------------//
+void Element::flushPendingLayout()
+{
+    if (s_flushingLayout || s_pendingLayout.empty())
+        return;
+
+    CEGUI_PROFILE_SCOPE("Element::flushPendingLayout");
+
+    // Lay out parents before their children, so that children already laid
+    // out by their parent's layout are skipped
+    std::vector<std::pair<size_t, Element*>> ordered;
+    ordered.reserve(s_pendingLayout.size());
+    for (Element* element : s_pendingLayout)
+    {
+        if (!element)
+            continue;
+
+        size_t depth = 0;
+        for (const Element* parent = element->d_parent; parent; parent = parent->d_parent)
+            ++depth;
+        ordered.emplace_back(depth, element);
+    }
+
+    std::stable_sort(ordered.begin(), ordered.end(),
+        [](const std::pair<size_t, Element*>& a, const std::pair<size_t, Element*>& b)
+        { return a.first < b.first; });
+
+    // Elements destroyed by event handlers during the flush are nulled in s_pendingLayout
+    s_pendingLayout.clear();
+    for (const auto& entry : ordered)
+        s_pendingLayout.push_back(entry.second);
+
+    s_flushingLayout = true;
+    size_t i = 0;
+    try
+    {
+        for (; i < s_pendingLayout.size(); ++i)
+        {
+            Element* element = s_pendingLayout[i];
+            if (element && element->d_layoutPending)
+                element->notifyScreenAreaChanged(element->d_pendingAdjustSizeToContent);
+        }
+    }
+    catch (...)
+    {
+        // Keep the elements that were not laid out yet for the next flush
+        s_pendingLayout.erase(s_pendingLayout.begin(), s_pendingLayout.begin() + i + 1);
+        s_flushingLayout = false;
+        throw;
+    }
+
+    s_pendingLayout.clear();
+    s_flushingLayout = false;
+}
+
 //----------------------------------------------------------------------------//
 void Element::setArea(const UVector2& pos, const USize& size, bool adjust_size_to_content)
 {
-    // TODO: early exit if equal? or return false from notifyScreenAreaChanged if unchanged?
+    if (d_area.d_min == pos &&
+        (d_area.getSize() == size || d_area.d_max == pos + UVector2(size.d_width, size.d_height)))
+        return;
 
     d_area.setPositionAndSize(pos, size);
     notifyScreenAreaChanged(adjust_size_to_content);
@@ -147,6 +244,23 @@ void Element::setArea(const UVector2& pos, const USize& size, bool adjust_size_t
 //----------------------------------------------------------------------------//
 void Element::notifyScreenAreaChanged(bool adjust_size_to_content)
 {
+    if (s_layoutTransactionDepth && !s_flushingLayout)
+    {
+        if (!d_layoutPending)
+        {
+            d_layoutPending = true;
+            s_pendingLayout.push_back(this);
+        }
+        d_pendingAdjustSizeToContent |= adjust_size_to_content;
+        return;
+    }
+
+    d_layoutPending = false;
+    d_pendingAdjustSizeToContent = false;
+
+    CEGUI_PROFILE_SCOPE("Element::notifyScreenAreaChanged");
+    CEGUI_PROFILE_COUNT(LayoutUpdates, 1);
+
     // Update pixel size and detect resizing
     const Sizef oldSize = d_pixelSize;
     d_pixelSize = calculatePixelSize();
@@ -675,6 +789,13 @@ bool Element::contentFits() const
     throw InvalidRequestException("This function isn't implemented for this type of element.");
 }
 
+//----------------------------------------------------------------------------//
+bool Element::measureContent(float /*content_area_width*/, Sizef& /*content_size*/,
+                             bool& /*content_intact*/) const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 void Element::setRotation(const glm::quat& rotation)
 {
@@ -902,7 +1023,7 @@ void Element::setAdjustHeightToContent(bool value)
 void Element::onIsSizeAdjustedToContentChanged(ElementEventArgs& e)
 {
     adjustSizeToContent();
-    fireEvent(EventIsSizeAdjustedToContentChanged, e, EventNamespace);
+    fireEvent(EventIsSizeAdjustedToContentChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1065,13 +1186,13 @@ Rectf Element::getUnclippedInnerRect_impl(bool skipAllPixelAlignment) const
 //----------------------------------------------------------------------------//
 void Element::onSized(ElementEventArgs& e)
 {
-    fireEvent(EventSized, e, EventNamespace);
+    fireEvent(EventSizedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Element::onMoved(ElementEventArgs& e)
 {
-    fireEvent(EventMoved, e, EventNamespace);
+    fireEvent(EventMovedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1079,7 +1200,7 @@ void Element::onHorizontalAlignmentChanged(ElementEventArgs& e)
 {
     notifyScreenAreaChanged();
 
-    fireEvent(EventHorizontalAlignmentChanged, e, EventNamespace);
+    fireEvent(EventHorizontalAlignmentChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1087,31 +1208,31 @@ void Element::onVerticalAlignmentChanged(ElementEventArgs& e)
 {
     notifyScreenAreaChanged();
 
-    fireEvent(EventVerticalAlignmentChanged, e, EventNamespace);
+    fireEvent(EventVerticalAlignmentChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Element::onRotated(ElementEventArgs& e)
 {
-    fireEvent(EventRotated, e, EventNamespace);
+    fireEvent(EventRotatedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Element::onChildAdded(ElementEventArgs& e)
 {
-    fireEvent(EventChildAdded, e, EventNamespace);
+    fireEvent(EventChildAddedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Element::onChildRemoved(ElementEventArgs& e)
 {
-    fireEvent(EventChildRemoved, e, EventNamespace);
+    fireEvent(EventChildRemovedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Element::onChildOrderChanged(ElementEventArgs& e)
 {
-    fireEvent(EventChildOrderChanged, e, EventNamespace);
+    fireEvent(EventChildOrderChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1119,7 +1240,7 @@ void Element::onNonClientChanged(ElementEventArgs& e)
 {
     notifyScreenAreaChanged();
 
-    fireEvent(EventNonClientChanged, e, EventNamespace);
+    fireEvent(EventNonClientChangedId, e, EventNamespace);
 }
 
 #if defined(_MSC_VER)
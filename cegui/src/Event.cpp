@@ -34,7 +34,8 @@ namespace CEGUI
 
 //----------------------------------------------------------------------------//
 Event::Event(const String& name) :
-    d_name(name)
+    d_name(name),
+    d_id(name)
 {
 }
 
@@ -75,6 +76,15 @@ void Event::unsubscribeAll()
         d_slots.clear();
 }
 
+//----------------------------------------------------------------------------//
+void Event::getConnections(std::vector<Connection>& connections) const
+{
+    // slots unsubscribed while the event is invoked are left as null entries
+    for (const auto& groupAndSlot : d_slots)
+        if (groupAndSlot.second)
+            connections.push_back(groupAndSlot.second);
+}
+
 //----------------------------------------------------------------------------//
 void Event::operator()(EventArgs& args)
 {
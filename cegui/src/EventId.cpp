@@ -0,0 +1,85 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Interned event names
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/EventId.h"
+#include <deque>
+#include <unordered_map>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+namespace
+{
+struct EventIdRegistry
+{
+    std::unordered_map<String, std::uint32_t> d_ids;
+    //! Names by id, a deque keeps references to them valid
+    std::deque<String> d_names;
+};
+
+// Constructed on first use, as event names are also interned by static objects
+EventIdRegistry& getRegistry()
+{
+    static EventIdRegistry registry;
+    return registry;
+}
+}
+
+//----------------------------------------------------------------------------//
+EventId::EventId(const String& name)
+{
+    EventIdRegistry& registry = getRegistry();
+    const auto result = registry.d_ids.emplace(name,
+        static_cast<std::uint32_t>(registry.d_names.size()));
+
+    if (result.second)
+        registry.d_names.push_back(name);
+
+    d_value = result.first->second;
+}
+
+//----------------------------------------------------------------------------//
+EventId EventId::find(const String& name)
+{
+    const EventIdRegistry& registry = getRegistry();
+    const auto it = registry.d_ids.find(name);
+    return it != registry.d_ids.end() ? EventId(it->second) : EventId();
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t EventId::getInternedCount()
+{
+    return static_cast<std::uint32_t>(getRegistry().d_names.size());
+}
+
+//----------------------------------------------------------------------------//
+const String& EventId::getName() const
+{
+    static const String empty;
+    return isValid() ? getRegistry().d_names[d_value] : empty;
+}
+
+}
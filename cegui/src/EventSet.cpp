@@ -28,12 +28,19 @@
  ***************************************************************************/
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/ScriptModule.h"
 #include "CEGUI/System.h"
+#include <algorithm>
 
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+static bool isEventBefore(const std::unique_ptr<Event>& event, EventId id)
+{
+    return event->getId() < id;
+}
 
 //----------------------------------------------------------------------------//
 void EventSet::addEvent(const String& name)
@@ -42,7 +49,7 @@ void EventSet::addEvent(const String& name)
         throw AlreadyExistsException(
             "An event named '" + name + "' already exists in the EventSet.");
 
-    d_events.emplace(name, new Event(name));
+    addEventObject(new Event(name));
 }
 
 //----------------------------------------------------------------------------//
@@ -56,7 +63,16 @@ void EventSet::addEvent(Event& event)
             "An event named '" + event.getName() + "' already exists in the EventSet.");
     }
 
-    d_events.emplace(event.getName(), &event);
+    addEventObject(&event);
+}
+
+//----------------------------------------------------------------------------//
+void EventSet::removeEvent(const String& name)
+{
+    const EventId id = EventId::find(name);
+    auto it = std::lower_bound(d_events.begin(), d_events.end(), id, isEventBefore);
+    if (it != d_events.end() && (*it)->getId() == id)
+        d_events.erase(it);
 }
 
 //----------------------------------------------------------------------------//
@@ -109,8 +125,8 @@ void EventSet::unsubscribeAll(const String& eventName)
 //----------------------------------------------------------------------------//
 void EventSet::unsubscribeAll()
 {
-    for (auto& pair : d_events)
-        pair.second->unsubscribeAll();
+    for (auto& event : d_events)
+        event->unsubscribeAll();
 }
 
 //----------------------------------------------------------------------------//
@@ -118,20 +134,51 @@ void EventSet::fireEvent(const String& name,
                          EventArgs& args,
                          const String& eventNamespace)
 {
+    fireEvent(EventId::find(name), args, eventNamespace);
+}
+
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent(EventId id,
+                         EventArgs& args,
+                         const String& eventNamespace)
+{
+    CEGUI_PROFILE_SCOPE_DETAIL("EventSet::fireEvent", id.getName());
+    CEGUI_PROFILE_COUNT(EventsFired, 1);
+
+    // Every Event interns its name, so nothing can be subscribed to a name without id
+    if (!id.isValid())
+        return;
+
     if (GlobalEventSet* ges = GlobalEventSet::getSingletonPtr())
-        ges->fireEvent(name, args, eventNamespace);
+        ges->fireGlobalEvent(id, args, eventNamespace);
 
-    fireEvent_impl(name, args);
+    fireEvent_impl(id, args);
 }
 
 //----------------------------------------------------------------------------//
 Event* EventSet::getEventObject(const String& name, bool autoAdd)
 {
-    auto it = d_events.find(name);
-    if (it != d_events.end())
-        return it->second.get();
+    if (Event* event = getEventObject(EventId::find(name)))
+        return event;
 
-    return autoAdd ? d_events.emplace(name, new Event(name)).first->second.get() : nullptr;
+    return autoAdd ? addEventObject(new Event(name)) : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+Event* EventSet::getEventObject(EventId id) const
+{
+    auto it = std::lower_bound(d_events.begin(), d_events.end(), id, isEventBefore);
+    return (it != d_events.end() && (*it)->getId() == id) ? it->get() : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+Event* EventSet::addEventObject(Event* event)
+{
+    d_events.emplace(std::lower_bound(d_events.begin(), d_events.end(),
+        event->getId(), isEventBefore), event);
+
+    onEventAdded(*event);
+    return event;
 }
 
 //----------------------------------------------------------------------------//
@@ -142,4 +189,12 @@ void EventSet::fireEvent_impl(const String& name, EventArgs& args)
             (*ev)(args);
 }
 
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent_impl(EventId id, EventArgs& args)
+{
+    if (!d_muted)
+        if (Event* ev = getEventObject(id))
+            (*ev)(args);
+}
+
 }
@@ -35,6 +35,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
+#include "CEGUI/ResourcePreloader.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/SharedStringStream.h"
 
@@ -48,6 +49,38 @@ namespace CEGUI
 // singleton instance pointer
 template<> FontManager* Singleton<FontManager>::ms_Singleton = nullptr;
 
+//----------------------------------------------------------------------------//
+// Queues the files of the FreeType fonts of a prepared font file in the
+// ResourcePreloader.
+class FontFileFinder : public XMLHandler
+{
+public:
+    FontFileFinder(ResourcePreloader& preloader, const String& default_group) :
+        d_preloader(preloader),
+        d_defaultGroup(default_group)
+    {}
+
+    const String& getDefaultResourceGroup() const override { return d_defaultGroup; }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override
+    {
+        if (element != Font_xmlHandler::FontElement ||
+            attributes.getValueAsString(Font_xmlHandler::FontTypeAttribute) !=
+                Font_xmlHandler::FontTypeFreeType)
+            return;
+
+        const String resource_group(attributes.getValueAsString(
+            Font_xmlHandler::FontResourceGroupAttribute));
+        d_preloader.queueDataFile(
+            attributes.getValueAsString(Font_xmlHandler::FontFilenameAttribute),
+            resource_group.empty() ? d_defaultGroup : resource_group);
+    }
+
+private:
+    ResourcePreloader& d_preloader;
+    const String& d_defaultGroup;
+};
+
 const String FontManager::ResourceTypeName = "Font";
 
 
@@ -204,6 +237,15 @@ void FontManager::notifyDisplaySizeChanged(const Sizef& size)
     for (const auto& pair : d_registeredFonts)
         pair.second->notifyDisplaySizeChanged(size);
 }
+
+bool FontManager::processPendingGlyphs()
+{
+    bool changed = false;
+    for (const auto& pair : d_registeredFonts)
+        changed |= pair.second->processPendingGlyphs();
+    return changed;
+}
+
 void FontManager::writeFontToStream(const String& name,
                                     OutStream& out_stream) const
 {
@@ -234,6 +276,22 @@ FontManager::FontList FontManager::createFromFile(const String& xml_filename,
     return createdFonts;
 }
 
+void FontManager::prepareFromFile(ResourcePreloader& preloader,
+    const String& xml_filename, const String& resource_group)
+{
+    const String defaultGroup(Font::getDefaultResourceGroup());
+
+    preloader.queueXMLFile(xml_filename,
+        resource_group.empty() ? defaultGroup : resource_group,
+        Font_xmlHandler::FontSchemaName,
+        [defaultGroup](ResourcePreloader& preloader,
+                       const ResourcePreloader::XMLDocument& document)
+        {
+            FontFileFinder finder(preloader, defaultGroup);
+            document.replay(finder);
+        });
+}
+
 FontManager::FontList FontManager::createFromString(const String& source,
     XmlResourceExistsAction resourceExistsAction)
 {
@@ -307,7 +365,7 @@ void FontManager::destroyObject(
     d_registeredFonts.erase(ob);
 
     // fire event signaling an object has been destroyed
-    fireEvent(EventResourceDestroyed, args, EventNamespace);
+    fireEvent(EventResourceDestroyedId, args, EventNamespace);
 }
 
 void FontManager::createAll(const String& pattern,
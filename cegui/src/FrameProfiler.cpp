@@ -0,0 +1,308 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Scoped timers and counters describing where a frame is spent
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FrameProfiler.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Singleton instance pointer
+template<> FrameProfiler* Singleton<FrameProfiler>::ms_Singleton = nullptr;
+
+//----------------------------------------------------------------------------//
+static const char* const s_counterNames[] =
+{
+    "WindowRedraws",
+    "WindowInvalidations",
+    "GeometryBuffers",
+    "Vertices",
+    "LayoutUpdates",
+    "EventsFired"
+};
+
+static_assert(sizeof(s_counterNames) / sizeof(s_counterNames[0]) ==
+    static_cast<size_t>(ProfilerCounter::Count), "A counter has no name");
+
+//----------------------------------------------------------------------------//
+static void writeJsonString(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; *str; ++str)
+    {
+        const unsigned char c = static_cast<unsigned char>(*str);
+        if (c == '"' || c == '\\')
+            out << '\\' << *str;
+        else if (c < 0x20)
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') <<
+                static_cast<unsigned>(c) << std::dec << std::setfill(' ');
+        else
+            out << *str;
+    }
+    out << '"';
+}
+
+//----------------------------------------------------------------------------//
+static void writeMicroseconds(std::ostream& out, std::uint64_t ns)
+{
+    out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000 <<
+        std::setfill(' ');
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t ProfilerFrame::getTotalTime(const char* name, const String& detail) const
+{
+    std::uint64_t total = 0;
+    std::uint64_t coveredUntil = 0;
+    for (const auto& sample : d_samples)
+    {
+        if (sample.d_start < coveredUntil || std::strcmp(sample.d_name, name) ||
+                (!detail.empty() && sample.d_detail != detail))
+            continue;
+
+        total += sample.d_duration;
+        coveredUntil = sample.d_start + sample.d_duration;
+    }
+
+    return total;
+}
+
+//----------------------------------------------------------------------------//
+FrameProfiler::FrameProfiler() :
+    d_epoch(std::chrono::steady_clock::now())
+{
+}
+
+//----------------------------------------------------------------------------//
+FrameProfiler::~FrameProfiler() = default;
+
+//----------------------------------------------------------------------------//
+FrameProfiler& FrameProfiler::getSingleton()
+{
+    return Singleton<FrameProfiler>::getSingleton();
+}
+
+//----------------------------------------------------------------------------//
+FrameProfiler* FrameProfiler::getSingletonPtr()
+{
+    return Singleton<FrameProfiler>::getSingletonPtr();
+}
+
+//----------------------------------------------------------------------------//
+FrameProfiler* FrameProfiler::getActive()
+{
+    FrameProfiler* profiler = ms_Singleton;
+    return (profiler && profiler->d_enabled) ? profiler : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+const char* FrameProfiler::getCounterName(ProfilerCounter counter)
+{
+    return s_counterNames[static_cast<size_t>(counter)];
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::setEnabled(bool enabled)
+{
+    if (d_enabled == enabled)
+        return;
+
+    d_enabled = enabled;
+
+    // Don't report the time spent with recording turned off as a frame
+    resetCurrentFrame(now());
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::setHistorySize(size_t frames)
+{
+    if (!frames)
+        throw InvalidRequestException("The history must hold at least one frame.");
+
+    // Unroll the ring buffer, keeping the most recent frames
+    std::rotate(d_frames.begin(), d_frames.begin() + d_firstFrame, d_frames.end());
+    if (d_frameCount > frames)
+    {
+        d_frames.erase(d_frames.begin(), d_frames.begin() + (d_frameCount - frames));
+        d_frameCount = frames;
+    }
+
+    d_frames.resize(std::min(d_frames.size(), frames));
+    d_firstFrame = 0;
+    d_historySize = frames;
+}
+
+//----------------------------------------------------------------------------//
+size_t FrameProfiler::beginSample(const char* name, const String* detail)
+{
+    ++d_depth;
+
+    if (d_current.d_samples.size() >= d_maxSamplesPerFrame)
+    {
+        ++d_current.d_droppedSamples;
+        return static_cast<size_t>(-1);
+    }
+
+    d_current.d_samples.push_back({ name, detail ? *detail : String(), now(), 0, d_depth - 1 });
+    return d_current.d_samples.size() - 1;
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::endSample(size_t sample)
+{
+    if (d_depth)
+        --d_depth;
+
+    // The sample may be gone if the frame ended or was cleared in its scope
+    if (sample < d_current.d_samples.size())
+    {
+        ProfilerSample& s = d_current.d_samples[sample];
+        s.d_duration = now() - s.d_start;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::endFrame()
+{
+    if (!d_enabled)
+        return;
+
+    const std::uint64_t time = now();
+    d_current.d_number = d_nextFrameNumber++;
+    d_current.d_duration = time - d_current.d_start;
+
+    // Reuse the storage of the oldest frame once the history is full
+    if (d_frameCount < d_historySize)
+    {
+        if (d_frames.size() <= d_frameCount)
+            d_frames.emplace_back();
+        std::swap(d_frames[d_frameCount], d_current);
+        ++d_frameCount;
+    }
+    else
+    {
+        std::swap(d_frames[d_firstFrame], d_current);
+        d_firstFrame = (d_firstFrame + 1) % d_historySize;
+    }
+
+    resetCurrentFrame(time);
+}
+
+//----------------------------------------------------------------------------//
+const ProfilerFrame& FrameProfiler::getFrame(size_t index) const
+{
+    if (index >= d_frameCount)
+        throw InvalidRequestException("There is no frame with index " +
+            PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(index)));
+
+    return d_frames[(d_firstFrame + index) % d_frames.size()];
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::clear()
+{
+    d_frames.clear();
+    d_firstFrame = 0;
+    d_frameCount = 0;
+    resetCurrentFrame(now());
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::writeChromeTrace(std::ostream& out) const
+{
+    out << "{\"traceEvents\":[";
+
+    bool first = true;
+    std::ostringstream detail;
+    for (size_t i = 0; i < d_frameCount; ++i)
+    {
+        const ProfilerFrame& frame = getFrame(i);
+
+        out << (first ? "\n" : ",\n") << "{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+        writeMicroseconds(out, frame.d_start);
+        out << ",\"dur\":";
+        writeMicroseconds(out, frame.d_duration);
+        out << ",\"args\":{\"number\":" << frame.d_number << ",\"droppedSamples\":" <<
+            frame.d_droppedSamples << "}}";
+        first = false;
+
+        for (const auto& sample : frame.d_samples)
+        {
+            out << ",\n{\"name\":";
+            writeJsonString(out, sample.d_name);
+            out << ",\"cat\":\"cegui\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+            writeMicroseconds(out, sample.d_start);
+            out << ",\"dur\":";
+            writeMicroseconds(out, sample.d_duration);
+            if (!sample.d_detail.empty())
+            {
+                detail.str(std::string());
+                detail << sample.d_detail;
+                out << ",\"args\":{\"detail\":";
+                writeJsonString(out, detail.str().c_str());
+                out << '}';
+            }
+            out << '}';
+        }
+
+        // Counters are reported at the end of the frame they belong to
+        out << ",\n{\"name\":\"Counters\",\"cat\":\"frame\",\"ph\":\"C\",\"pid\":1,\"tid\":1,\"ts\":";
+        writeMicroseconds(out, frame.d_start + frame.d_duration);
+        out << ",\"args\":{";
+        for (size_t c = 0; c < frame.d_counters.size(); ++c)
+        {
+            out << (c ? ",\"" : "\"") << s_counterNames[c] << "\":" << frame.d_counters[c];
+        }
+        out << "}}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t FrameProfiler::now() const
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - d_epoch).count());
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::resetCurrentFrame(std::uint64_t start)
+{
+    d_current.d_start = start;
+    d_current.d_duration = 0;
+    d_current.d_samples.clear();
+    d_current.d_droppedSamples = 0;
+    d_current.d_counters.fill(0);
+}
+
+}
@@ -32,6 +32,7 @@
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowNavigator.h"
 #include "CEGUI/System.h"
@@ -49,6 +50,14 @@ const String GUIContext::EventDefaultFontChanged("DefaultFontChanged");
 const String GUIContext::EventTooltipActive("TooltipActive");
 const String GUIContext::EventTooltipInactive("TooltipInactive");
 const String GUIContext::EventTooltipTransition("TooltipTransition");
+
+const EventId GUIContext::EventRootWindowChangedId(EventRootWindowChanged);
+const EventId GUIContext::EventCursorImageChangedId(EventCursorImageChanged);
+const EventId GUIContext::EventDefaultCursorImageChangedId(EventDefaultCursorImageChanged);
+const EventId GUIContext::EventDefaultFontChangedId(EventDefaultFontChanged);
+const EventId GUIContext::EventTooltipActiveId(EventTooltipActive);
+const EventId GUIContext::EventTooltipInactiveId(EventTooltipInactive);
+const EventId GUIContext::EventTooltipTransitionId(EventTooltipTransition);
 const URect GUIContext::NoCursorConstraint(cegui_reldim(0.f), cegui_reldim(0.f), cegui_reldim(1.f), cegui_reldim(1.f));
 
 //----------------------------------------------------------------------------//
@@ -104,7 +113,7 @@ void GUIContext::setRootWindow(Window* new_root)
 
     markAsDirty();
 
-    fireEvent(EventRootWindowChanged, args);
+    fireEvent(EventRootWindowChangedId, args);
 }
 
 //----------------------------------------------------------------------------//
@@ -272,6 +281,11 @@ Window* GUIContext::getWindowContainingCursor()
 //----------------------------------------------------------------------------//
 void GUIContext::draw(std::uint32_t drawModeMask)
 {
+    CEGUI_PROFILE_SCOPE("GUIContext::draw");
+
+    // Lay out elements changed during a layout transaction, this may invalidate the content
+    Element::flushPendingLayout();
+
     // Cursor is always dirty because it must be redrawn each frame
     const bool drawCursor = (drawModeMask & DrawModeFlagMouseCursor);
     
@@ -291,6 +305,8 @@ void GUIContext::drawContent(std::uint32_t drawModeMask)
     if (!drawModeMask)
         return;
 
+    CEGUI_PROFILE_SCOPE("GUIContext::drawContent");
+
     RenderingSurface::drawContent(drawModeMask);
 
     if ((drawModeMask & DrawModeFlagMouseCursor) && d_cursorVisible && d_cursorImage)
@@ -299,9 +315,7 @@ void GUIContext::drawContent(std::uint32_t drawModeMask)
         if (d_cursorDirty)
         {
             d_cursorDirty = false;
-            for (auto currentBuffer : d_cursorGeometry)
-                System::getSingleton().getRenderer()->destroyGeometryBuffer(*currentBuffer);
-            d_cursorGeometry.clear();
+            System::getSingleton().getRenderer()->destroyGeometryBuffers(d_cursorGeometry);
 
             const auto imgOffset = d_cursorImage->getRenderedOffset();
             const auto imgSize = d_cursorImage->getRenderedSize();
@@ -582,12 +596,12 @@ void GUIContext::showTooltip(bool force)
     WindowEventArgs args(d_tooltipWindow);
     if (wasShown)
     {
-        fireEvent(EventTooltipTransition, args, EventNamespace);
+        fireEvent(EventTooltipTransitionId, args, EventNamespace);
     }
     else
     {
         d_tooltipWindow->show(force);
-        fireEvent(EventTooltipActive, args, EventNamespace);
+        fireEvent(EventTooltipActiveId, args, EventNamespace);
     }
 }
 
@@ -624,7 +638,7 @@ void GUIContext::hideTooltip(bool force)
     tooltipWnd->hide(force);
 
     WindowEventArgs args(tooltipWnd);
-    fireEvent(EventTooltipInactive, args, EventNamespace);
+    fireEvent(EventTooltipInactiveId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1421,7 +1435,7 @@ void GUIContext::setCursorImage(const Image* image)
     positionTooltip();
 
     GUIContextEventArgs args(this);
-    fireEvent(EventCursorImageChanged, args, EventNamespace);
+    fireEvent(EventCursorImageChangedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1444,7 +1458,7 @@ void GUIContext::setDefaultCursorImage(const Image* image)
     d_cursorDirty = true;
 
     GUIContextEventArgs args(this);
-    fireEvent(EventDefaultCursorImageChanged, args, EventNamespace);
+    fireEvent(EventDefaultCursorImageChangedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1495,7 +1509,7 @@ void GUIContext::setDefaultFont(Font* font)
         d_rootWindow->notifyDefaultFontChanged();
 
     GUIContextEventArgs args(this);
-    fireEvent(EventDefaultFontChanged, args, EventNamespace);
+    fireEvent(EventDefaultFontChangedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
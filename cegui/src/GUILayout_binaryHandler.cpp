@@ -0,0 +1,971 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Compiles GUILayouts to a binary form and loads them
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GUILayout_binaryHandler.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/TypedProperty.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/GUILayout_xmlHandler.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/XMLAttributes.h"
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace CEGUI
+{
+static const char BinaryLayoutMagic[4] = { 'C', 'G', 'B', 'L' };
+
+// The version of the binary format, independent of the XML layout version
+const std::uint32_t GUILayout_binaryHandler::NativeVersion = 1;
+
+//! Builds the binary form of a layout.
+class GUILayout_binaryHandler::Writer
+{
+public:
+    void writeRecord(RecordType type) { writeByte(static_cast<std::uint8_t>(type)); }
+    void writeString(const String& value) { writeUInt(getStringIndex(value)); }
+    //! Writes the value of \a property, natively if the type of \a property is known.
+    void writeValue(const Property* property, const String& value);
+    void writeToStream(OutStream& out_stream) const;
+
+private:
+    template<typename T>
+    bool writeNativeValue(const Property& property, const String& value, ValueType type);
+
+    void writeByte(std::uint8_t value) { d_records.push_back(static_cast<char>(value)); }
+    void writeUInt(std::uint32_t value) { appendUInt(d_records, value); }
+    static void appendUInt(std::string& out, std::uint32_t value);
+    std::uint32_t getStringIndex(const String& value);
+
+    void writeNative(bool value) { writeByte(value ? 1 : 0); }
+    void writeNative(std::int32_t value) { writeUInt(static_cast<std::uint32_t>(value)); }
+    void writeNative(std::uint32_t value) { writeUInt(value); }
+    void writeNative(float value);
+    void writeNative(const UDim& value);
+    void writeNative(const UVector2& value);
+    void writeNative(const USize& value);
+    void writeNative(const URect& value);
+    void writeNative(const UBox& value);
+    void writeNative(const Colour& value);
+    void writeNative(const ColourRect& value);
+
+    std::vector<std::string> d_strings;
+    std::unordered_map<String, std::uint32_t> d_stringIndices;
+    std::string d_records;
+};
+
+/*!
+    Writes the records of a GUILayout XML document. The windows are created as
+    they would be by GUILayout_xmlHandler, so the auto windows can be referenced
+    and the properties can be looked up to store their values natively.
+*/
+class GUILayout_binaryHandler::Compiler : public XMLHandler
+{
+public:
+    //! \a parent is the window an imported layout is attached to.
+    Compiler(Writer& writer, std::vector<Window*>& createdWindows, Window* parent = nullptr) :
+        d_writer(writer),
+        d_createdWindows(createdWindows),
+        d_parent(parent)
+    {}
+
+    //! Destroys the windows created to compile a layout.
+    static void destroyWindows(std::vector<Window*>& windows);
+
+    const String& getSchemaName() const override { return WindowManager::GUILayoutSchemaName; }
+    const String& getDefaultResourceGroup() const override
+    {
+        return WindowManager::getSingleton().getDefaultResourceGroup();
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override;
+    void elementEnd(const String& element) override;
+    void text(const String& text) override { d_stringItemValue += text; }
+
+private:
+    void elementWindowStart(const XMLAttributes& attributes);
+    void elementAutoWindowStart(const XMLAttributes& attributes);
+    void elementUserStringStart(const XMLAttributes& attributes);
+    void elementPropertyStart(const XMLAttributes& attributes);
+    void elementLayoutImportStart(const XMLAttributes& attributes);
+    void elementEventStart(const XMLAttributes& attributes);
+    void writeUserString(const String& name, const String& value);
+    void writeProperty(const String& name, const String& value);
+
+    Writer& d_writer;
+    //! All windows created, including the ones of imported layouts.
+    std::vector<Window*>& d_createdWindows;
+    Window* d_parent;
+    std::vector<Window*> d_stack;
+    String d_stringItemName;
+    String d_stringItemValue;
+};
+
+//----------------------------------------------------------------------------//
+Window* GUILayout_binaryHandler::load(const RawDataContainer& source)
+{
+    d_data = source.getDataPtr();
+    d_dataEnd = d_data + source.getSize();
+
+    char magic[sizeof(BinaryLayoutMagic)];
+    readBytes(magic, sizeof(magic));
+    if (std::memcmp(magic, BinaryLayoutMagic, sizeof(magic)) != 0)
+        throw InvalidRequestException("The data is not a binary layout.");
+
+    const std::uint32_t version = readUInt();
+    if (version != NativeVersion)
+    {
+        throw InvalidRequestException(
+            "You are attempting to load a binary layout of version " +
+            PropertyHelper<std::uint32_t>::toString(version) +
+            " but this CEGUI version is only meant to load binary layouts of "
+            "version " + PropertyHelper<std::uint32_t>::toString(NativeVersion) +
+            ". Compile the layout again with the layout compiler of this "
+            "CEGUI version.");
+    }
+
+    // every string takes at least the bytes of its length
+    const std::uint32_t stringCount = readUInt();
+    if (stringCount > static_cast<size_t>(d_dataEnd - d_data) / sizeof(std::uint32_t))
+        throw InvalidRequestException("The binary layout is truncated.");
+
+    d_strings.clear();
+    d_strings.reserve(stringCount);
+    for (std::uint32_t i = 0; i < stringCount; ++i)
+    {
+        const std::uint32_t length = readUInt();
+        if (length > static_cast<size_t>(d_dataEnd - d_data))
+            throw InvalidRequestException("The binary layout is truncated.");
+
+        d_strings.push_back(String(reinterpret_cast<const char*>(d_data), length));
+        d_data += length;
+    }
+
+    try
+    {
+        while (d_data != d_dataEnd)
+        {
+            switch (static_cast<RecordType>(readByte()))
+            {
+            case RecordType::WindowStart:
+                readWindowStart();
+                break;
+            case RecordType::WindowEnd:
+                getCurrentWindow().endInitialisation();
+                d_stack.pop_back();
+                break;
+            case RecordType::AutoWindowStart:
+                readAutoWindowStart();
+                break;
+            case RecordType::AutoWindowEnd:
+                getCurrentWindow();
+                d_stack.pop_back();
+                break;
+            case RecordType::Property:
+                readProperty();
+                break;
+            case RecordType::UserString:
+            {
+                Window& window = getCurrentWindow();
+                const String& name = readString();
+                window.setUserString(name, readString());
+                break;
+            }
+            case RecordType::Event:
+            {
+                Window& window = getCurrentWindow();
+                const String& name = readString();
+                const String& function = readString();
+                try
+                {
+                    window.subscribeScriptedEvent(name, function);
+                }
+                catch (Exception&)
+                {
+                    // Don't do anything here, but the error will have been logged.
+                }
+                break;
+            }
+            default:
+                throw InvalidRequestException("The binary layout contains an unknown record.");
+            }
+        }
+
+        if (!d_root || !d_stack.empty())
+            throw InvalidRequestException("The binary layout is truncated.");
+    }
+    catch (...)
+    {
+        cleanupLoadedWindows();
+        throw;
+    }
+
+    Window* const root = d_root;
+    d_root = nullptr;
+    d_strings.clear();
+    return root;
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::compileFile(const String& filename,
+    const String& resourceGroup, OutStream& out_stream)
+{
+    Writer writer;
+    std::vector<Window*> createdWindows;
+    Compiler compiler(writer, createdWindows);
+
+    try
+    {
+        System::getSingleton().getXMLParser()->parseXMLFile(compiler, filename,
+            WindowManager::GUILayoutSchemaName,
+            resourceGroup.empty() ? compiler.getDefaultResourceGroup() : resourceGroup);
+    }
+    catch (...)
+    {
+        Compiler::destroyWindows(createdWindows);
+        throw;
+    }
+
+    Compiler::destroyWindows(createdWindows);
+    writer.writeToStream(out_stream);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::compileString(const String& source, OutStream& out_stream)
+{
+    Writer writer;
+    std::vector<Window*> createdWindows;
+    Compiler compiler(writer, createdWindows);
+
+    try
+    {
+        System::getSingleton().getXMLParser()->parseXMLString(compiler, source,
+            WindowManager::GUILayoutSchemaName);
+    }
+    catch (...)
+    {
+        Compiler::destroyWindows(createdWindows);
+        throw;
+    }
+
+    Compiler::destroyWindows(createdWindows);
+    writer.writeToStream(out_stream);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readWindowStart()
+{
+    const String& type = readString();
+    const String& name = readString();
+
+    // a layout has a single root window
+    if (d_stack.empty() && d_root)
+        throw InvalidRequestException("The binary layout has more than one root window.");
+
+    Window* wnd;
+    try
+    {
+        wnd = WindowManager::getSingleton().createWindow(type, name);
+    }
+    catch (AlreadyExistsException&)
+    {
+        throw InvalidRequestException(
+            "Layout loading has been aborted since Window named '" + name + "' already exists.");
+    }
+    catch (UnknownObjectException& e)
+    {
+        throw InvalidRequestException(
+            String("Layout loading has been aborted with error:\n") + e.getMessage());
+    }
+
+    // add this window to the current parent (if any)
+    if (!d_stack.empty())
+        d_stack.back().first->addChild(wnd);
+    else
+        d_root = wnd;
+
+    d_stack.push_back(WindowStackEntry(wnd, true));
+    wnd->beginInitialisation();
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readAutoWindowStart()
+{
+    Window& parent = getCurrentWindow();
+    const String& name = readString();
+
+    try
+    {
+        d_stack.push_back(WindowStackEntry(parent.getChildAutoWindow(name), false));
+    }
+    catch (UnknownObjectException&)
+    {
+        throw InvalidRequestException(
+            "layout loading has been aborted since auto window '" +
+            name + "' could not be referenced.");
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readProperty()
+{
+    Window& window = getCurrentWindow();
+    const String& name = readString();
+
+    switch (static_cast<ValueType>(readByte()))
+    {
+    case ValueType::String:
+        readPropertyValue<String>(window, name);
+        break;
+    case ValueType::Bool:
+        readPropertyValue<bool>(window, name);
+        break;
+    case ValueType::Int:
+        readPropertyValue<std::int32_t>(window, name);
+        break;
+    case ValueType::UInt:
+        readPropertyValue<std::uint32_t>(window, name);
+        break;
+    case ValueType::Float:
+        readPropertyValue<float>(window, name);
+        break;
+    case ValueType::UDim:
+        readPropertyValue<UDim>(window, name);
+        break;
+    case ValueType::UVector2:
+        readPropertyValue<UVector2>(window, name);
+        break;
+    case ValueType::USize:
+        readPropertyValue<USize>(window, name);
+        break;
+    case ValueType::URect:
+        readPropertyValue<URect>(window, name);
+        break;
+    case ValueType::UBox:
+        readPropertyValue<UBox>(window, name);
+        break;
+    case ValueType::Colour:
+        readPropertyValue<Colour>(window, name);
+        break;
+    case ValueType::ColourRect:
+        readPropertyValue<ColourRect>(window, name);
+        break;
+    default:
+        throw InvalidRequestException("The binary layout contains an unknown "
+            "type of value for property '" + name + "'.");
+    }
+}
+
+//----------------------------------------------------------------------------//
+Window& GUILayout_binaryHandler::getCurrentWindow() const
+{
+    if (d_stack.empty())
+        throw InvalidRequestException("The binary layout has a record outside of a window.");
+
+    return *d_stack.back().first;
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+void GUILayout_binaryHandler::readPropertyValue(Window& window, const String& name)
+{
+    T value;
+    readNative(value);
+
+    try
+    {
+        // the callback gets and may modify the value as a string, like when
+        // loading XML
+        if (d_propertyCallback)
+        {
+            String propertyName(name);
+            String propertyValue(PropertyHelper<T>::toString(value));
+            if ((*d_propertyCallback)(&window, propertyName, propertyValue, d_userData))
+                window.setProperty(propertyName, propertyValue);
+        }
+        else
+        {
+            window.setProperty<T>(name, value);
+        }
+    }
+    catch (Exception&)
+    {
+        // Don't do anything here, but the error will have been logged.
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readBytes(void* out, size_t count)
+{
+    if (count > static_cast<size_t>(d_dataEnd - d_data))
+        throw InvalidRequestException("The binary layout is truncated.");
+
+    std::memcpy(out, d_data, count);
+    d_data += count;
+}
+
+//----------------------------------------------------------------------------//
+std::uint8_t GUILayout_binaryHandler::readByte()
+{
+    std::uint8_t value;
+    readBytes(&value, 1);
+    return value;
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t GUILayout_binaryHandler::readUInt()
+{
+    std::uint8_t bytes[4];
+    readBytes(bytes, sizeof(bytes));
+    return static_cast<std::uint32_t>(bytes[0]) |
+           (static_cast<std::uint32_t>(bytes[1]) << 8) |
+           (static_cast<std::uint32_t>(bytes[2]) << 16) |
+           (static_cast<std::uint32_t>(bytes[3]) << 24);
+}
+
+//----------------------------------------------------------------------------//
+const String& GUILayout_binaryHandler::readString()
+{
+    const std::uint32_t index = readUInt();
+    if (index >= d_strings.size())
+        throw InvalidRequestException("The binary layout refers to a string that doesn't exist.");
+
+    return d_strings[index];
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(float& value)
+{
+    const std::uint32_t bits = readUInt();
+    std::memcpy(&value, &bits, sizeof(value));
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(UDim& value)
+{
+    readNative(value.d_scale);
+    readNative(value.d_offset);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(UVector2& value)
+{
+    readNative(value.d_x);
+    readNative(value.d_y);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(USize& value)
+{
+    readNative(value.d_width);
+    readNative(value.d_height);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(URect& value)
+{
+    readNative(value.d_min);
+    readNative(value.d_max);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(UBox& value)
+{
+    readNative(value.d_top);
+    readNative(value.d_left);
+    readNative(value.d_bottom);
+    readNative(value.d_right);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(Colour& value)
+{
+    float red, green, blue, alpha;
+    readNative(red);
+    readNative(green);
+    readNative(blue);
+    readNative(alpha);
+    value.set(red, green, blue, alpha);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::readNative(ColourRect& value)
+{
+    readNative(value.d_top_left);
+    readNative(value.d_top_right);
+    readNative(value.d_bottom_left);
+    readNative(value.d_bottom_right);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::cleanupLoadedWindows()
+{
+    // work backwards like GUILayout_xmlHandler, since the client may have
+    // specified that certain windows are not auto-destroyed
+    while (!d_stack.empty())
+    {
+        // only destroy if not an auto window
+        if (d_stack.back().second)
+        {
+            Window* wnd = d_stack.back().first;
+
+            if (wnd->getParent())
+                wnd->getParent()->removeChild(wnd);
+
+            WindowManager::getSingleton().destroyWindow(wnd);
+        }
+
+        d_stack.pop_back();
+    }
+
+    d_root = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeValue(const Property* property,
+                                                 const String& value)
+{
+    if (property && (
+        writeNativeValue<float>(*property, value, ValueType::Float) ||
+        writeNativeValue<bool>(*property, value, ValueType::Bool) ||
+        writeNativeValue<UVector2>(*property, value, ValueType::UVector2) ||
+        writeNativeValue<USize>(*property, value, ValueType::USize) ||
+        writeNativeValue<URect>(*property, value, ValueType::URect) ||
+        writeNativeValue<UDim>(*property, value, ValueType::UDim) ||
+        writeNativeValue<std::int32_t>(*property, value, ValueType::Int) ||
+        writeNativeValue<std::uint32_t>(*property, value, ValueType::UInt) ||
+        writeNativeValue<UBox>(*property, value, ValueType::UBox) ||
+        writeNativeValue<ColourRect>(*property, value, ValueType::ColourRect) ||
+        writeNativeValue<Colour>(*property, value, ValueType::Colour)))
+        return;
+
+    // strings, values of other types and values of unknown properties are
+    // set from the string, like when loading XML
+    writeByte(static_cast<std::uint8_t>(ValueType::String));
+    writeString(value);
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+bool GUILayout_binaryHandler::Writer::writeNativeValue(const Property& property,
+    const String& value, ValueType type)
+{
+    if (!dynamic_cast<const TypedProperty<T>*>(&property))
+        return false;
+
+    // TypedProperty::set converts the string the same way
+    T native;
+    try
+    {
+        native = PropertyHelper<T>::fromString(value);
+    }
+    catch (Exception&)
+    {
+        // the string is stored, so that the error happens when loading
+        return false;
+    }
+
+    writeByte(static_cast<std::uint8_t>(type));
+    writeNative(native);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeToStream(OutStream& out_stream) const
+{
+    std::string header(BinaryLayoutMagic, sizeof(BinaryLayoutMagic));
+    appendUInt(header, NativeVersion);
+    appendUInt(header, static_cast<std::uint32_t>(d_strings.size()));
+    for (const std::string& str : d_strings)
+    {
+        appendUInt(header, static_cast<std::uint32_t>(str.size()));
+        header += str;
+    }
+
+    out_stream.write(header.data(), header.size());
+    out_stream.write(d_records.data(), d_records.size());
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::appendUInt(std::string& out, std::uint32_t value)
+{
+    for (size_t i = 0; i < 4; ++i)
+        out.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t GUILayout_binaryHandler::Writer::getStringIndex(const String& value)
+{
+    const auto it = d_stringIndices.find(value);
+    if (it != d_stringIndices.end())
+        return it->second;
+
+    const std::uint32_t index = static_cast<std::uint32_t>(d_strings.size());
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    d_strings.push_back(String::convertUtf32ToUtf8(value.getString()));
+#else
+    d_strings.push_back(std::string(value.c_str(), value.size()));
+#endif
+    d_stringIndices.emplace(value, index);
+    return index;
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUInt(bits);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const UDim& value)
+{
+    writeNative(value.d_scale);
+    writeNative(value.d_offset);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const UVector2& value)
+{
+    writeNative(value.d_x);
+    writeNative(value.d_y);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const USize& value)
+{
+    writeNative(value.d_width);
+    writeNative(value.d_height);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const URect& value)
+{
+    writeNative(value.d_min);
+    writeNative(value.d_max);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const UBox& value)
+{
+    writeNative(value.d_top);
+    writeNative(value.d_left);
+    writeNative(value.d_bottom);
+    writeNative(value.d_right);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const Colour& value)
+{
+    writeNative(value.getRed());
+    writeNative(value.getGreen());
+    writeNative(value.getBlue());
+    writeNative(value.getAlpha());
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Writer::writeNative(const ColourRect& value)
+{
+    writeNative(value.d_top_left);
+    writeNative(value.d_top_right);
+    writeNative(value.d_bottom_left);
+    writeNative(value.d_bottom_right);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::destroyWindows(std::vector<Window*>& windows)
+{
+    // the children are destroyed first, windows may not be destroyed by
+    // their parent
+    WindowManager& wmgr = WindowManager::getSingleton();
+    for (auto it = windows.rbegin(); it != windows.rend(); ++it)
+    {
+        Window* wnd = *it;
+        if (!wmgr.isAlive(wnd))
+            continue;
+
+        if (wnd->getParent())
+            wnd->getParent()->removeChild(wnd);
+
+        wmgr.destroyWindow(wnd);
+    }
+
+    windows.clear();
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementStart(const String& element,
+                                                     const XMLAttributes& attributes)
+{
+    if (element == GUILayout_xmlHandler::GUILayoutElement)
+    {
+        const String version(attributes.getValueAsString(
+            GUILayout_xmlHandler::GUILayoutVersionAttribute, "unknown"));
+
+        if (version != GUILayout_xmlHandler::NativeVersion)
+        {
+            throw InvalidRequestException(
+                "You are attempting to compile a layout of version '" + version +
+                "' but this CEGUI version is only meant to load layouts of "
+                "version '" + GUILayout_xmlHandler::NativeVersion + "'.");
+        }
+    }
+    else if (element == Window::WindowXMLElementName)
+        elementWindowStart(attributes);
+    else if (element == Window::AutoWindowXMLElementName)
+        elementAutoWindowStart(attributes);
+    else if (element == Window::UserStringXMLElementName)
+        elementUserStringStart(attributes);
+    else if (element == Property::XMLElementName)
+        elementPropertyStart(attributes);
+    else if (element == GUILayout_xmlHandler::LayoutImportElement)
+        elementLayoutImportStart(attributes);
+    else if (element == GUILayout_xmlHandler::EventElement)
+        elementEventStart(attributes);
+    else
+    {
+        Logger::getSingleton().logEvent("GUILayout_binaryHandler::Compiler::elementStart - "
+            "Unexpected data was found while parsing the gui-layout file: '" +
+            element + "' is unknown.", LoggingLevel::Error);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementEnd(const String& element)
+{
+    if (d_stack.empty())
+        return;
+
+    if (element == Window::WindowXMLElementName)
+    {
+        d_writer.writeRecord(RecordType::WindowEnd);
+        d_stack.back()->endInitialisation();
+        d_stack.pop_back();
+    }
+    else if (element == Window::AutoWindowXMLElementName)
+    {
+        d_writer.writeRecord(RecordType::AutoWindowEnd);
+        d_stack.pop_back();
+    }
+    // long user strings and properties
+    else if (element == Window::UserStringXMLElementName)
+    {
+        if (!d_stringItemName.empty())
+            writeUserString(d_stringItemName, d_stringItemValue);
+    }
+    else if (element == Property::XMLElementName)
+    {
+        if (!d_stringItemName.empty())
+            writeProperty(d_stringItemName, d_stringItemValue);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementWindowStart(const XMLAttributes& attributes)
+{
+    const String windowType(
+        attributes.getValueAsString(Window::WindowTypeXMLAttributeName));
+    const String windowName(
+        attributes.getValueAsString(Window::WindowNameXMLAttributeName));
+
+    Window* wnd;
+    try
+    {
+        wnd = WindowManager::getSingleton().createWindow(windowType, windowName);
+    }
+    catch (AlreadyExistsException&)
+    {
+        throw InvalidRequestException(
+            "Layout compiling has been aborted since Window named '" + windowName + "' already exists.");
+    }
+    catch (UnknownObjectException& e)
+    {
+        throw InvalidRequestException(
+            String("Layout compiling has been aborted with error:\n") + e.getMessage());
+    }
+    d_createdWindows.push_back(wnd);
+
+    if (!d_stack.empty())
+        d_stack.back()->addChild(wnd);
+    else if (d_parent)
+        d_parent->addChild(wnd);
+
+    d_stack.push_back(wnd);
+    wnd->beginInitialisation();
+
+    d_writer.writeRecord(RecordType::WindowStart);
+    d_writer.writeString(windowType);
+    d_writer.writeString(windowName);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementAutoWindowStart(const XMLAttributes& attributes)
+{
+    if (d_stack.empty())
+        return;
+
+    const String name(
+        attributes.getValueAsString(Window::AutoWindowNamePathXMLAttributeName));
+
+    try
+    {
+        d_stack.push_back(d_stack.back()->getChildAutoWindow(name));
+    }
+    catch (UnknownObjectException&)
+    {
+        throw InvalidRequestException(
+            "layout compiling has been aborted since auto window '" +
+            name + "' could not be referenced.");
+    }
+
+    d_writer.writeRecord(RecordType::AutoWindowStart);
+    d_writer.writeString(name);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementUserStringStart(const XMLAttributes& attributes)
+{
+    const String name(
+        attributes.getValueAsString(Window::UserStringNameXMLAttributeName));
+
+    String value;
+    if (attributes.exists(Window::UserStringValueXMLAttributeName))
+        value = attributes.getValueAsString(Window::UserStringValueXMLAttributeName);
+
+    d_stringItemValue.clear();
+    if (!value.empty())
+    {
+        d_stringItemName.clear();
+        writeUserString(name, value);
+    }
+    else
+    {
+        // the value is the text of the element
+        d_stringItemName = name;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementPropertyStart(const XMLAttributes& attributes)
+{
+    const String name(
+        attributes.getValueAsString(Property::NameXMLAttributeName));
+
+    String value;
+    if (attributes.exists(Property::ValueXMLAttributeName))
+        value = attributes.getValueAsString(Property::ValueXMLAttributeName);
+
+    d_stringItemValue.clear();
+    if (!value.empty())
+    {
+        d_stringItemName.clear();
+        writeProperty(name, value);
+    }
+    else
+    {
+        // the value is the text of the element
+        d_stringItemName = name;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementLayoutImportStart(const XMLAttributes& attributes)
+{
+    // the imported layout is compiled in place, attached to the window being
+    // defined
+    Compiler importCompiler(d_writer, d_createdWindows,
+                            d_stack.empty() ? d_parent : d_stack.back());
+
+    const String resourceGroup(attributes.getValueAsString(
+        GUILayout_xmlHandler::LayoutImportResourceGroupAttribute));
+
+    System::getSingleton().getXMLParser()->parseXMLFile(importCompiler,
+        attributes.getValueAsString(GUILayout_xmlHandler::LayoutImportFilenameAttribute),
+        WindowManager::GUILayoutSchemaName,
+        resourceGroup.empty() ? getDefaultResourceGroup() : resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::elementEventStart(const XMLAttributes& attributes)
+{
+    if (d_stack.empty())
+        return;
+
+    // the compiled windows are destroyed again, so the events are not
+    // subscribed
+    d_writer.writeRecord(RecordType::Event);
+    d_writer.writeString(attributes.getValueAsString(GUILayout_xmlHandler::EventNameAttribute));
+    d_writer.writeString(attributes.getValueAsString(GUILayout_xmlHandler::EventFunctionAttribute));
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::writeUserString(const String& name,
+                                                        const String& value)
+{
+    if (d_stack.empty())
+        return;
+
+    d_stack.back()->setUserString(name, value);
+
+    d_writer.writeRecord(RecordType::UserString);
+    d_writer.writeString(name);
+    d_writer.writeString(value);
+}
+
+//----------------------------------------------------------------------------//
+void GUILayout_binaryHandler::Compiler::writeProperty(const String& name,
+                                                      const String& value)
+{
+    if (d_stack.empty())
+        return;
+
+    Window* const window = d_stack.back();
+
+    d_writer.writeRecord(RecordType::Property);
+    d_writer.writeString(name);
+    d_writer.writeValue(window->isPropertyPresent(name) ?
+                            window->getPropertyInstance(name) : nullptr,
+                        value);
+
+    // later properties and auto windows may depend on this property
+    try
+    {
+        window->setProperty(name, value);
+    }
+    catch (Exception&)
+    {
+        // Don't do anything here, but the error will have been logged.
+    }
+}
+
+//----------------------------------------------------------------------------//
+}
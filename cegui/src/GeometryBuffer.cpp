@@ -31,11 +31,408 @@
 #include "CEGUI/Renderer.h" // for BlendMode
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/ColourRect.h"
+#include "CEGUI/Exceptions.h"
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CEGUI_QUAD_KERNEL_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#   include <arm_neon.h>
+#   define CEGUI_QUAD_KERNEL_NEON
+#endif
 
 namespace CEGUI
 {
+// The quad kernels load these directly as 4 floats. Colour starts with its
+// (a, r, g, b) components, followed by the cached ARGB value.
+static_assert(sizeof(Rectf) == 4 * sizeof(float), "Rectf must be made of 4 floats");
+static_assert(std::is_standard_layout<Colour>::value && sizeof(Colour) >= 4 * sizeof(float),
+    "Colour must start with 4 floats");
+
+//---------------------------------------------------------------------------//
+// Operations of the quad kernels. A rect is held as (left, top, right, bottom),
+// a colour as (r, g, b, a), and a point in the first two lanes.
+namespace
+{
+// Portable version, also used when the SIMD kernels are disabled.
+struct ScalarQuadOps
+{
+    struct Vec
+    {
+        float v[4];
+    };
+
+    static inline Vec loadRect(const Rectf& rect)
+    {
+        return { { rect.d_min.x, rect.d_min.y, rect.d_max.x, rect.d_max.y } };
+    }
+
+    static inline Vec loadColour(const Colour& colour)
+    {
+        return { { colour.getRed(), colour.getGreen(), colour.getBlue(), colour.getAlpha() } };
+    }
+
+    static inline void clipRect(Vec& rect, Vec clip)
+    {
+        rect.v[0] = std::max(rect.v[0], clip.v[0]);
+        rect.v[1] = std::max(rect.v[1], clip.v[1]);
+        rect.v[2] = std::min(rect.v[2], clip.v[2]);
+        rect.v[3] = std::min(rect.v[3], clip.v[3]);
+    }
+
+    static inline bool isEmptyRect(Vec rect)
+    {
+        return rect.v[2] <= rect.v[0] || rect.v[3] <= rect.v[1];
+    }
+
+    static inline Vec adjustTexRect(Vec tex, Vec dest, Vec clipped)
+    {
+        const float scaleX = (tex.v[2] - tex.v[0]) / (dest.v[2] - dest.v[0]);
+        const float scaleY = (tex.v[3] - tex.v[1]) / (dest.v[3] - dest.v[1]);
+        return { {
+            tex.v[0] + (clipped.v[0] - dest.v[0]) * scaleX,
+            tex.v[1] + (clipped.v[1] - dest.v[1]) * scaleY,
+            tex.v[2] + (clipped.v[2] - dest.v[2]) * scaleX,
+            tex.v[3] + (clipped.v[3] - dest.v[3]) * scaleY } };
+    }
+
+    static inline void getCorners(Vec rect, Vec& tl, Vec& bl, Vec& br, Vec& tr)
+    {
+        tl = { { rect.v[0], rect.v[1], 0.f, 0.f } };
+        bl = { { rect.v[0], rect.v[3], 0.f, 0.f } };
+        br = { { rect.v[2], rect.v[3], 0.f, 0.f } };
+        tr = { { rect.v[2], rect.v[1], 0.f, 0.f } };
+    }
+
+    static inline void writeVertex(float* out, Vec pos, Vec colour)
+    {
+        out[0] = pos.v[0];
+        out[1] = pos.v[1];
+        out[2] = 0.f;
+        std::memcpy(out + 3, colour.v, sizeof(colour.v));
+    }
+
+    static inline void writeVertex(float* out, Vec pos, Vec colour, Vec uv)
+    {
+        writeVertex(out, pos, colour);
+        out[7] = uv.v[0];
+        out[8] = uv.v[1];
+    }
+};
+
+#if defined(CEGUI_QUAD_KERNEL_SSE2)
+
+struct SIMDQuadOps
+{
+    using Vec = __m128;
+
+    static inline Vec loadRect(const Rectf& rect)
+    {
+        return _mm_loadu_ps(&rect.d_min.x);
+    }
+
+    static inline Vec loadColour(const Colour& colour)
+    {
+        // Colour is stored as (a, r, g, b)
+        const Vec argb = _mm_loadu_ps(reinterpret_cast<const float*>(&colour));
+        return _mm_shuffle_ps(argb, argb, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    static inline void clipRect(Vec& rect, Vec clip)
+    {
+        const Vec lo = _mm_max_ps(rect, clip);
+        const Vec hi = _mm_min_ps(rect, clip);
+        rect = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 2, 1, 0));
+    }
+
+    static inline bool isEmptyRect(Vec rect)
+    {
+        const Vec mins = _mm_movelh_ps(rect, rect);
+        const Vec maxs = _mm_movehl_ps(rect, rect);
+        return (_mm_movemask_ps(_mm_cmple_ps(maxs, mins)) & 0x3) != 0;
+    }
+
+    static inline Vec adjustTexRect(Vec tex, Vec dest, Vec clipped)
+    {
+        const Vec texSize = _mm_sub_ps(_mm_movehl_ps(tex, tex), tex);
+        const Vec destSize = _mm_sub_ps(_mm_movehl_ps(dest, dest), dest);
+        Vec scale = _mm_div_ps(texSize, destSize);
+        scale = _mm_movelh_ps(scale, scale);
+        return _mm_add_ps(tex, _mm_mul_ps(_mm_sub_ps(clipped, dest), scale));
+    }
+
+    static inline void getCorners(Vec rect, Vec& tl, Vec& bl, Vec& br, Vec& tr)
+    {
+        const Vec zero = _mm_setzero_ps();
+        tl = _mm_movelh_ps(rect, zero);
+        bl = _mm_shuffle_ps(rect, zero, _MM_SHUFFLE(0, 0, 3, 0));
+        br = _mm_movehl_ps(zero, rect);
+        tr = _mm_shuffle_ps(rect, zero, _MM_SHUFFLE(0, 0, 1, 2));
+    }
+
+    // Vertices are written in order, so the 4th lane of the position is then
+    // overwritten by the colour.
+    static inline void writeVertex(float* out, Vec pos, Vec colour)
+    {
+        _mm_storeu_ps(out, pos);
+        _mm_storeu_ps(out + 3, colour);
+    }
+
+    static inline void writeVertex(float* out, Vec pos, Vec colour, Vec uv)
+    {
+        _mm_storeu_ps(out, pos);
+        _mm_storeu_ps(out + 3, colour);
+        _mm_storel_pi(reinterpret_cast<__m64*>(out + 7), uv);
+    }
+};
+
+#elif defined(CEGUI_QUAD_KERNEL_NEON)
+
+struct SIMDQuadOps
+{
+    using Vec = float32x4_t;
+
+    static inline Vec loadRect(const Rectf& rect)
+    {
+        return vld1q_f32(&rect.d_min.x);
+    }
+
+    static inline Vec loadColour(const Colour& colour)
+    {
+        // Colour is stored as (a, r, g, b)
+        const Vec argb = vld1q_f32(reinterpret_cast<const float*>(&colour));
+        return vextq_f32(argb, argb, 1);
+    }
+
+    static inline void clipRect(Vec& rect, Vec clip)
+    {
+        rect = vcombine_f32(vget_low_f32(vmaxq_f32(rect, clip)), vget_high_f32(vminq_f32(rect, clip)));
+    }
+
+    static inline bool isEmptyRect(Vec rect)
+    {
+        const uint32x2_t empty = vcle_f32(vget_high_f32(rect), vget_low_f32(rect));
+        return (vget_lane_u32(empty, 0) | vget_lane_u32(empty, 1)) != 0;
+    }
+
+    static inline Vec adjustTexRect(Vec tex, Vec dest, Vec clipped)
+    {
+        const float32x2_t texSize = vsub_f32(vget_high_f32(tex), vget_low_f32(tex));
+        const float32x2_t destSize = vsub_f32(vget_high_f32(dest), vget_low_f32(dest));
+#if defined(__aarch64__)
+        const float32x2_t scale = vdiv_f32(texSize, destSize);
+#else
+        float32x2_t scale = vdup_n_f32(0.f);
+        scale = vset_lane_f32(vget_lane_f32(texSize, 0) / vget_lane_f32(destSize, 0), scale, 0);
+        scale = vset_lane_f32(vget_lane_f32(texSize, 1) / vget_lane_f32(destSize, 1), scale, 1);
+#endif
+        return vmlaq_f32(tex, vsubq_f32(clipped, dest), vcombine_f32(scale, scale));
+    }
+
+    static inline void getCorners(Vec rect, Vec& tl, Vec& bl, Vec& br, Vec& tr)
+    {
+        const float32x2_t zero = vdup_n_f32(0.f);
+        const float32x2_t lt = vget_low_f32(rect);
+        const float32x2_t rb = vget_high_f32(rect);
+        tl = vcombine_f32(lt, zero);
+        bl = vcombine_f32(vset_lane_f32(vget_lane_f32(rb, 1), lt, 1), zero);
+        br = vcombine_f32(rb, zero);
+        tr = vcombine_f32(vset_lane_f32(vget_lane_f32(lt, 1), rb, 1), zero);
+    }
+
+    // Vertices are written in order, so the 4th lane of the position is then
+    // overwritten by the colour.
+    static inline void writeVertex(float* out, Vec pos, Vec colour)
+    {
+        vst1q_f32(out, pos);
+        vst1q_f32(out + 3, colour);
+    }
+
+    static inline void writeVertex(float* out, Vec pos, Vec colour, Vec uv)
+    {
+        vst1q_f32(out, pos);
+        vst1q_f32(out + 3, colour);
+        vst1_f32(out + 7, vget_low_f32(uv));
+    }
+};
+
+#endif
+
+//---------------------------------------------------------------------------//
+// Corner colours in the order of the quad vertices, see appendSolidRect
+template <typename Ops>
+inline void loadQuadColours(const ColourRect& colours, typename Ops::Vec& tl,
+    typename Ops::Vec& bl, typename Ops::Vec& br, typename Ops::Vec& tr)
+{
+    tl = Ops::loadColour(colours.d_top_left);
+    bl = Ops::loadColour(colours.d_bottom_left);
+    br = Ops::loadColour(colours.d_bottom_right);
+    tr = Ops::loadColour(colours.d_top_right);
+}
+
+//---------------------------------------------------------------------------//
+template <typename Ops>
+size_t writeTexturedQuadsWith(float* out, const Rectf* dest_rects, const Rectf* tex_rects,
+    size_t count, const ColourRect* colours, size_t colour_count, const Rectf* clip_rect)
+{
+    using Vec = typename Ops::Vec;
+    constexpr size_t stride = GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT;
+
+    const bool perQuadColours = (colour_count > 1);
+    Vec cTL, cBL, cBR, cTR;
+    loadQuadColours<Ops>(colours[0], cTL, cBL, cBR, cTR);
+
+    const Vec clip = clip_rect ? Ops::loadRect(*clip_rect) : Vec();
+
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Vec dest = Ops::loadRect(dest_rects[i]);
+        Vec pos = dest;
+        if (clip_rect)
+            Ops::clipRect(pos, clip);
+
+        if (Ops::isEmptyRect(pos))
+            continue;
+
+        Vec tex = Ops::loadRect(tex_rects[i]);
+        if (clip_rect)
+            tex = Ops::adjustTexRect(tex, dest, pos);
+
+        if (perQuadColours)
+            loadQuadColours<Ops>(colours[i], cTL, cBL, cBR, cTR);
+
+        Vec pTL, pBL, pBR, pTR;
+        Ops::getCorners(pos, pTL, pBL, pBR, pTR);
+        Vec tTL, tBL, tBR, tTR;
+        Ops::getCorners(tex, tTL, tBL, tBR, tTR);
+
+        // Quad splitting done from top-left to bottom-right diagonal
+        Ops::writeVertex(out, pTL, cTL, tTL);
+        Ops::writeVertex(out + stride, pBL, cBL, tBL);
+        Ops::writeVertex(out + 2 * stride, pBR, cBR, tBR);
+        Ops::writeVertex(out + 3 * stride, pTR, cTR, tTR);
+        Ops::writeVertex(out + 4 * stride, pTL, cTL, tTL);
+        Ops::writeVertex(out + 5 * stride, pBR, cBR, tBR);
+
+        out += 6 * stride;
+        ++written;
+    }
+
+    return written;
+}
+
+//---------------------------------------------------------------------------//
+template <typename Ops>
+size_t writeSolidRectsWith(float* out, const Rectf* rects, size_t count,
+    const ColourRect* colours, size_t colour_count, const Rectf* clip_rect)
+{
+    using Vec = typename Ops::Vec;
+    constexpr size_t stride = GeometryBuffer::COLORED_VERTEX_FLOAT_COUNT;
+
+    const bool perQuadColours = (colour_count > 1);
+    Vec cTL, cBL, cBR, cTR;
+    loadQuadColours<Ops>(colours[0], cTL, cBL, cBR, cTR);
+
+    const Vec clip = clip_rect ? Ops::loadRect(*clip_rect) : Vec();
+
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vec pos = Ops::loadRect(rects[i]);
+        if (clip_rect)
+            Ops::clipRect(pos, clip);
+
+        if (Ops::isEmptyRect(pos))
+            continue;
+
+        if (perQuadColours)
+            loadQuadColours<Ops>(colours[i], cTL, cBL, cBR, cTR);
+
+        Vec pTL, pBL, pBR, pTR;
+        Ops::getCorners(pos, pTL, pBL, pBR, pTR);
+
+        Ops::writeVertex(out, pTL, cTL);
+        Ops::writeVertex(out + stride, pBL, cBL);
+        Ops::writeVertex(out + 2 * stride, pBR, cBR);
+        Ops::writeVertex(out + 3 * stride, pTR, cTR);
+        Ops::writeVertex(out + 4 * stride, pTL, cTL);
+        Ops::writeVertex(out + 5 * stride, pBR, cBR);
+
+        out += 6 * stride;
+        ++written;
+    }
+
+    return written;
+}
+}
+
+#if defined(CEGUI_QUAD_KERNEL_SSE2) || defined(CEGUI_QUAD_KERNEL_NEON)
+static bool s_SIMDQuadKernelsEnabled = true;
+#endif
+
+//---------------------------------------------------------------------------//
+size_t GeometryBuffer::writeTexturedQuads(float* out, const Rectf* dest_rects,
+    const Rectf* tex_rects, size_t count, const ColourRect* colours, size_t colour_count,
+    const Rectf* clip_rect)
+{
+#if defined(CEGUI_QUAD_KERNEL_SSE2) || defined(CEGUI_QUAD_KERNEL_NEON)
+    if (s_SIMDQuadKernelsEnabled)
+        return writeTexturedQuadsWith<SIMDQuadOps>(out, dest_rects, tex_rects, count,
+            colours, colour_count, clip_rect);
+#endif
+
+    return writeTexturedQuadsWith<ScalarQuadOps>(out, dest_rects, tex_rects, count,
+        colours, colour_count, clip_rect);
+}
+
+//---------------------------------------------------------------------------//
+size_t GeometryBuffer::writeSolidRects(float* out, const Rectf* rects, size_t count,
+    const ColourRect* colours, size_t colour_count, const Rectf* clip_rect)
+{
+#if defined(CEGUI_QUAD_KERNEL_SSE2) || defined(CEGUI_QUAD_KERNEL_NEON)
+    if (s_SIMDQuadKernelsEnabled)
+        return writeSolidRectsWith<SIMDQuadOps>(out, rects, count, colours, colour_count,
+            clip_rect);
+#endif
+
+    return writeSolidRectsWith<ScalarQuadOps>(out, rects, count, colours, colour_count,
+        clip_rect);
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isSIMDQuadKernelAvailable()
+{
+#if defined(CEGUI_QUAD_KERNEL_SSE2) || defined(CEGUI_QUAD_KERNEL_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::setSIMDQuadKernelEnabled(bool enabled)
+{
+#if defined(CEGUI_QUAD_KERNEL_SSE2) || defined(CEGUI_QUAD_KERNEL_NEON)
+    s_SIMDQuadKernelsEnabled = enabled;
+#else
+    (void)enabled;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isSIMDQuadKernelEnabled()
+{
+#if defined(CEGUI_QUAD_KERNEL_SSE2) || defined(CEGUI_QUAD_KERNEL_NEON)
+    return s_SIMDQuadKernelsEnabled;
+#else
+    return false;
+#endif
+}
 
 //---------------------------------------------------------------------------//
 GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
@@ -99,24 +496,67 @@ void GeometryBuffer::appendGeometry(const float* vertexArray, size_t arraySize)
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendSolidRect(const Rectf& rect, const ColourRect& colours)
 {
-    if (rect.empty())
-        return;
+    appendSolidRects(&rect, 1, &colours, 1);
+}
 
-    ColouredVertex v[6];
-    v[0].setColour(colours.d_top_left);
-    v[0].d_position = glm::vec3(rect.left(), rect.top(), 0.0f);
-    v[1].setColour(colours.d_bottom_left);
-    v[1].d_position = glm::vec3(rect.left(), rect.bottom(), 0.0f);
-    v[2].setColour(colours.d_bottom_right);
-    v[2].d_position = glm::vec3(rect.right(), rect.bottom(), 0.0f);
-    v[3].setColour(colours.d_top_right);
-    v[3].d_position = glm::vec3(rect.right(), rect.top(), 0.0f);
-    v[4].setColour(colours.d_top_left);
-    v[4].d_position = glm::vec3(rect.left(), rect.top(), 0.0f);
-    v[5].setColour(colours.d_bottom_right);
-    v[5].d_position = glm::vec3(rect.right(), rect.bottom(), 0.0f);
+//---------------------------------------------------------------------------//
+size_t GeometryBuffer::appendSolidRects(const Rectf* rects, size_t count,
+    const ColourRect* colours, size_t colour_count, const Rectf* clip_rect)
+{
+    if (!rects || !count)
+        return 0;
+
+    if (getVertexAttributeElementCount() != static_cast<int>(COLORED_VERTEX_FLOAT_COUNT))
+        throw InvalidRequestException("The geometry buffer does not use coloured vertices.");
+
+    if (!colours || (colour_count != 1 && colour_count != count))
+        throw InvalidRequestException("Either one ColourRect or one per rectangle is required.");
+
+    const size_t prevFloatCount = d_vertexData.size();
+    d_vertexData.resize(prevFloatCount + count * 6 * COLORED_VERTEX_FLOAT_COUNT);
+
+    const size_t written = writeSolidRects(d_vertexData.data() + prevFloatCount,
+        rects, count, colours, colour_count, clip_rect);
+
+    d_vertexData.resize(prevFloatCount + written * 6 * COLORED_VERTEX_FLOAT_COUNT);
 
-    appendGeometry(v, 6);
+    if (written)
+    {
+        d_vertexCount = d_vertexData.size() / COLORED_VERTEX_FLOAT_COUNT;
+        onGeometryChanged();
+    }
+
+    return written;
+}
+
+//---------------------------------------------------------------------------//
+size_t GeometryBuffer::appendTexturedQuads(const Rectf* dest_rects, const Rectf* tex_rects,
+    size_t count, const ColourRect* colours, size_t colour_count, const Rectf* clip_rect)
+{
+    if (!dest_rects || !tex_rects || !count)
+        return 0;
+
+    if (getVertexAttributeElementCount() != static_cast<int>(TEXTURED_VERTEX_FLOAT_COUNT))
+        throw InvalidRequestException("The geometry buffer does not use textured vertices.");
+
+    if (!colours || (colour_count != 1 && colour_count != count))
+        throw InvalidRequestException("Either one ColourRect or one per quad is required.");
+
+    const size_t prevFloatCount = d_vertexData.size();
+    d_vertexData.resize(prevFloatCount + count * 6 * TEXTURED_VERTEX_FLOAT_COUNT);
+
+    const size_t written = writeTexturedQuads(d_vertexData.data() + prevFloatCount,
+        dest_rects, tex_rects, count, colours, colour_count, clip_rect);
+
+    d_vertexData.resize(prevFloatCount + written * 6 * TEXTURED_VERTEX_FLOAT_COUNT);
+
+    if (written)
+    {
+        d_vertexCount = d_vertexData.size() / TEXTURED_VERTEX_FLOAT_COUNT;
+        onGeometryChanged();
+    }
+
+    return written;
 }
 
 //---------------------------------------------------------------------------//
@@ -319,5 +759,153 @@ glm::mat4 GeometryBuffer::getModelMatrix() const
     return modelMatrix;
 }
 
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::isMergeable() const
+{
+    return !d_effect && d_polygonFillRule == PolygonFillRule::NoFilling &&
+        !d_vertexAttributes.empty() && d_vertexAttributes[0] == VertexAttributeType::Position0 &&
+        d_rotation == glm::quat(1.f, 0.f, 0.f, 0.f) && d_scale == glm::vec3(1.f, 1.f, 1.f) &&
+        d_customTransform == glm::mat4x4(1.f);
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::hasSameRenderState(const GeometryBuffer& other) const
+{
+    if (d_blendMode != other.d_blendMode || d_alpha != other.d_alpha ||
+        d_vertexAttributes != other.d_vertexAttributes)
+        return false;
+
+    if (d_renderMaterial == other.d_renderMaterial)
+        return true;
+
+    if (d_renderMaterial->getShaderWrapper() != other.d_renderMaterial->getShaderWrapper())
+        return false;
+
+    const auto& params = d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    const auto& otherParams = other.d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+    if (params.size() != otherParams.size())
+        return false;
+
+    // Both maps are sorted by name
+    auto otherIt = otherParams.begin();
+    for (const auto& param : params)
+    {
+        if (param.first != otherIt->first || !param.second->equal(otherIt->second))
+            return false;
+        ++otherIt;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::copyRenderState(const GeometryBuffer& other)
+{
+    // The material is not shared, it may be modified independently later
+    if (d_renderMaterial->getShaderWrapper() != other.d_renderMaterial->getShaderWrapper())
+        return false;
+
+    ShaderParameterBindings* bindings = d_renderMaterial->getShaderParamBindings();
+    const auto& otherParams = other.d_renderMaterial->getShaderParamBindings()->getShaderParameterBindings();
+
+    // Parameters can be added but not removed
+    for (const auto& param : bindings->getShaderParameterBindings())
+    {
+        auto it = otherParams.find(param.first);
+        if (it == otherParams.end() || it->second->getType() != param.second->getType())
+            return false;
+    }
+
+    // Sets up the cached main texture parameter, if used
+    if (const Texture* texture = other.getMainTexture())
+        d_renderMaterial->setMainTexture(texture);
+
+    for (const auto& param : otherParams)
+    {
+        ShaderParameter* ownParam = bindings->getParameter(param.first);
+        if (!ownParam)
+        {
+            switch (param.second->getType())
+            {
+                case ShaderParamType::Int:
+                    bindings->setParameter(param.first, 0);
+                    break;
+                case ShaderParamType::Float:
+                    bindings->setParameter(param.first, 0.f);
+                    break;
+                case ShaderParamType::Texture:
+                    bindings->setParameter(param.first, static_cast<const Texture*>(nullptr));
+                    break;
+                case ShaderParamType::Matrix4X4:
+                    bindings->setParameter(param.first, glm::mat4(1.f));
+                    break;
+                default:
+                    return false;
+            }
+
+            ownParam = bindings->getParameter(param.first);
+        }
+
+        ownParam->takeOverParameterValue(param.second);
+    }
+
+    d_blendMode = other.d_blendMode;
+    d_alpha = other.d_alpha;
+    return true;
 }
 
+//----------------------------------------------------------------------------//
+Rectf GeometryBuffer::getTranslatedBounds() const
+{
+    if (!d_vertexCount)
+        return Rectf();
+
+    const size_t stride = static_cast<size_t>(getVertexAttributeElementCount());
+    const float* pos = d_vertexData.data();
+    const float* end = pos + d_vertexCount * stride;
+
+    glm::vec2 minPos(pos[0], pos[1]);
+    glm::vec2 maxPos = minPos;
+    for (pos += stride; pos < end; pos += stride)
+    {
+        minPos.x = std::min(minPos.x, pos[0]);
+        minPos.y = std::min(minPos.y, pos[1]);
+        maxPos.x = std::max(maxPos.x, pos[0]);
+        maxPos.y = std::max(maxPos.y, pos[1]);
+    }
+
+    const glm::vec2 offset(d_translation.x, d_translation.y);
+    return Rectf(minPos + offset, maxPos + offset);
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::appendTranslatedGeometry(const GeometryBuffer& source)
+{
+    if (!source.d_vertexCount)
+        return;
+
+    const size_t stride = static_cast<size_t>(getVertexAttributeElementCount());
+    const size_t prevFloatCount = d_vertexData.size();
+    const size_t floatCount = source.d_vertexCount * stride;
+    d_vertexData.resize(prevFloatCount + floatCount);
+
+    float* dest = d_vertexData.data() + prevFloatCount;
+    std::memcpy(dest, source.d_vertexData.data(), floatCount * sizeof(float));
+
+    const glm::vec3& offset = source.d_translation;
+    if (offset != glm::vec3(0.f, 0.f, 0.f))
+    {
+        for (float* pos = dest; pos < dest + floatCount; pos += stride)
+        {
+            pos[0] += offset.x;
+            pos[1] += offset.y;
+            pos[2] += offset.z;
+        }
+    }
+
+    d_vertexCount = d_vertexData.size() / stride;
+
+    onGeometryChanged();
+}
+
+}
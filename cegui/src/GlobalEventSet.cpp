@@ -93,4 +93,37 @@ namespace CEGUI
         fireEvent_impl(evt_name, args);
 	}
 
+	/*************************************************************************
+		Overridden fireEvent taking an interned event name.
+	*************************************************************************/
+	void GlobalEventSet::fireEvent(EventId id, EventArgs& args, const String& eventNamespace)
+	{
+        fireGlobalEvent(id, args, eventNamespace);
+	}
+
+	/*************************************************************************
+		Fire the namespaced global event, if anything may be subscribed to it
+	*************************************************************************/
+	void GlobalEventSet::fireGlobalEvent(EventId id, EventArgs& args, const String& eventNamespace)
+	{
+        if (id.isValid() && id.getValue() < d_subscribedNames.size() &&
+            d_subscribedNames[id.getValue()])
+            GlobalEventSet::fireEvent(id.getName(), args, eventNamespace);
+	}
+
+	/*************************************************************************
+		Remember the name of a new event, without its namespace
+	*************************************************************************/
+	void GlobalEventSet::onEventAdded(Event& event)
+	{
+        const String& full_name = event.getName();
+        const size_t separator = full_name.rfind('/');
+        const EventId id(separator == String::npos ? full_name : full_name.substr(separator + 1));
+
+        if (id.getValue() >= d_subscribedNames.size())
+            d_subscribedNames.resize(id.getValue() + 1, false);
+
+        d_subscribedNames[id.getValue()] = true;
+	}
+
 } // End of  CEGUI namespace section
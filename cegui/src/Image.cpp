@@ -179,6 +179,17 @@ void Image::setNativeResolution(const Sizef& native_res)
         updateScaledSizeAndOffset(System::getSingleton().getRenderer()->getDisplaySize());
 }
 
+//----------------------------------------------------------------------------//
+void Image::assign(const Image& image)
+{
+    d_imageArea = image.d_imageArea;
+    d_pixelOffset = image.d_pixelOffset;
+    d_autoScaled = image.d_autoScaled;
+    d_nativeResolution = image.d_nativeResolution;
+    d_scaledSize = image.d_scaledSize;
+    d_scaledOffset = image.d_scaledOffset;
+}
+
 //----------------------------------------------------------------------------//
 void Image::notifyDisplaySizeChanged(const Sizef& renderer_display_size)
 {
@@ -39,8 +39,9 @@
 #include "CEGUI/svg/SVGImage.h"
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/ResourcePreloader.h"
 
-#include <algorithm>
+#include <vector>
 
 namespace CEGUI
 {
@@ -51,19 +52,6 @@ template<> ImageManager* Singleton<ImageManager>::ms_Singleton = nullptr;
 //----------------------------------------------------------------------------//
 String ImageManager::d_imagesetDefaultResourceGroup;
 
-//----------------------------------------------------------------------------//
-// predicate functor class to match items using a given prefix string.
-class ImagePrefixMatchPred
-{
-    const String d_prefix;
-
-public:
-    ImagePrefixMatchPred(const String& prefix) : d_prefix(prefix + '/') {}
-
-    bool operator()(const std::pair<String, std::pair<Image*, ImageFactory*> >& v)
-    { return v.first.find(d_prefix) == 0; }
-};
-
 //----------------------------------------------------------------------------//
 // Internal Strings holding XML element and attribute names
 const String ImagesetSchemaName("Imageset.xsd");
@@ -101,6 +89,52 @@ static CEGUI::String s_imagesetType = "";
 static AutoScaledMode s_autoScaled = AutoScaledMode::Disabled;
 static Sizef s_nativeResolution(640.0f, 480.0f);
 
+//----------------------------------------------------------------------------//
+// Queues the image file of a prepared imageset file in the ResourcePreloader.
+class ImagesetFileFinder : public XMLHandler
+{
+public:
+    ImagesetFileFinder(ResourcePreloader& preloader, const String& default_group) :
+        d_preloader(preloader),
+        d_defaultGroup(default_group)
+    {}
+
+    const String& getDefaultResourceGroup() const override { return d_defaultGroup; }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override
+    {
+        if (element != ImagesetElement ||
+            attributes.getValueAsString(ImagesetTypeAttribute, "BitmapImage") != "BitmapImage")
+            return;
+
+        const String resource_group(
+            attributes.getValueAsString(ImagesetResourceGroupAttribute));
+        d_preloader.queueImageFile(
+            attributes.getValueAsString(ImagesetImageFileAttribute),
+            resource_group.empty() ? d_defaultGroup : resource_group);
+    }
+
+private:
+    ResourcePreloader& d_preloader;
+    const String& d_defaultGroup;
+};
+
+//----------------------------------------------------------------------------//
+// Creates a texture from an image file, using the file prepared by the active
+// ResourcePreloader if there is one.
+static Texture& createTextureFromFile(const String& name, const String& filename,
+                                      const String& resource_group)
+{
+    if (ResourcePreloader* preloader = ResourcePreloader::getActive())
+    {
+        if (Texture* texture = preloader->createTexture(name, filename, resource_group))
+            return *texture;
+    }
+
+    return System::getSingleton().getRenderer()->createTexture(name, filename,
+                                                               resource_group);
+}
+
 //----------------------------------------------------------------------------//
 ImageManager::ImageManager()
 {
@@ -165,9 +199,9 @@ Image& ImageManager::create(const String& type, const String& name)
 
     ImageFactory* factory = i->second;
     Image& image = factory->create(name);
-    d_images[name] = std::make_pair(&image, factory);
+    registerImage(std::make_pair(&image, factory));
 
-        String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
+    String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
 
     Logger::getSingleton().logEvent(
         "[ImageManager] Created image: '" + name + "' (" + addressStr + 
@@ -189,7 +223,23 @@ Image& ImageManager::create(const XMLAttributes& attributes)
         throw AlreadyExistsException(
             "Image already exists: " + name);
 
-    ImageFactoryRegistry::iterator i(d_factories.find(s_imagesetType));
+    const ImagePair image = createImage(attributes);
+    registerImage(image);
+
+    String addressStr = SharedStringstream::GetPointerAddressAsString(image.first);
+    Logger::getSingleton().logEvent(
+        "[ImageManager] Created image: '" + name + "' (" + addressStr + 
+        ") of type: " + s_imagesetType);
+
+    return *image.first;
+}
+
+//----------------------------------------------------------------------------//
+ImageManager::ImagePair ImageManager::createImage(const XMLAttributes& attributes) const
+{
+    const String name = attributes.getValueAsString(ImageNameAttribute);
+
+    ImageFactoryRegistry::const_iterator i(d_factories.find(s_imagesetType));
 
     if (i == d_factories.end())
         throw UnknownObjectException(
@@ -211,14 +261,42 @@ Image& ImageManager::create(const XMLAttributes& attributes)
         throw InvalidRequestException(message);
     }
 
-    d_images[name] = std::make_pair(&image, factory);
+    return std::make_pair(&image, factory);
+}
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
-    Logger::getSingleton().logEvent(
-        "[ImageManager] Created image: '" + name + "' (" + addressStr + 
-        ") of type: " + s_imagesetType);
+//----------------------------------------------------------------------------//
+void ImageManager::registerImage(const ImagePair& image)
+{
+    d_images[image.first->getName()] = image;
+    addToCollections(*image.first);
+}
 
-    return image;
+//----------------------------------------------------------------------------//
+void ImageManager::addToCollections(Image& image)
+{
+    const String& name = image.getName();
+
+    for (String::size_type pos = name.find('/'); pos != String::npos;
+         pos = name.find('/', pos + 1))
+        d_imageCollections[name.substr(0, pos)].insert(&image);
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::removeFromCollections(Image& image)
+{
+    const String& name = image.getName();
+
+    for (String::size_type pos = name.find('/'); pos != String::npos;
+         pos = name.find('/', pos + 1))
+    {
+        auto collection = d_imageCollections.find(name.substr(0, pos));
+        if (collection == d_imageCollections.end())
+            continue;
+
+        collection->second.erase(&image);
+        if (collection->second.empty())
+            d_imageCollections.erase(collection);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -242,6 +320,8 @@ void ImageManager::destroy(ImageMap::iterator& iter)
     Logger::getSingleton().logEvent(
         "[ImageManager] Deleted image: " + iter->first);
 
+    removeFromCollections(*iter->second.first);
+
     // use the stored factory to destroy the image it created.
     iter->second.second->destroy(*iter->second.first);
 
@@ -288,6 +368,24 @@ void ImageManager::loadImageset(const String& filename,
             resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::prepareImageset(ResourcePreloader& preloader,
+                                   const String& filename,
+                                   const String& resource_group)
+{
+    const String defaultGroup(d_imagesetDefaultResourceGroup);
+
+    preloader.queueXMLFile(filename,
+        resource_group.empty() ? defaultGroup : resource_group,
+        ImagesetSchemaName,
+        [defaultGroup](ResourcePreloader& preloader,
+                       const ResourcePreloader::XMLDocument& document)
+        {
+            ImagesetFileFinder finder(preloader, defaultGroup);
+            document.replay(finder);
+        });
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::loadImagesetFromString(const String& source)
 {
@@ -302,24 +400,109 @@ void ImageManager::destroyImageCollection(const String& prefix,
     Logger::getSingleton().logEvent(
         "[ImageManager] Destroying image collection with prefix: " + prefix);
 
-    ImagePrefixMatchPred p(prefix);
-
-    ImageMap::iterator i;
-    while ((i = std::find_if(d_images.begin(), d_images.end(), p)) != d_images.end())
-        destroy(i);
+    auto collection = d_imageCollections.find(prefix);
+    if (collection != d_imageCollections.end())
+    {
+        // destroying the images removes them from the collection
+        const std::vector<Image*> images(collection->second.begin(),
+                                         collection->second.end());
+        for (Image* image : images)
+        {
+            ImageMap::iterator i = d_images.find(image->getName());
+            destroy(i);
+        }
+    }
 
     if (delete_texture)
         System::getSingleton().getRenderer()->destroyTexture(prefix);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::reloadImageset(const String& filename,
+                                  const String& resource_group)
+{
+    Logger::getSingleton().logEvent(
+        "[ImageManager] Reloading imageset: " + filename);
+
+    // parse the file into unregistered images, so that nothing changes if it
+    // fails
+    ImagesetReload reload;
+    d_reload = &reload;
+
+    try
+    {
+        loadImageset(filename, resource_group);
+
+        if (reload.d_texture)
+            reload.d_texture->loadFromFile(reload.d_imageFile,
+                                           reload.d_resourceGroup);
+        else if (reload.d_svgData)
+        {
+            reload.d_svgData->destroyShapes();
+            reload.d_svgData->loadFromFile(reload.d_imageFile,
+                                           reload.d_resourceGroup);
+        }
+    }
+    catch (...)
+    {
+        d_reload = nullptr;
+
+        for (ImageMap::iterator i = reload.d_images.begin();
+             i != reload.d_images.end(); ++i)
+            i->second.second->destroy(*i->second.first);
+
+        throw;
+    }
+
+    d_reload = nullptr;
+
+    std::unordered_set<Image*> removed;
+    auto collection = d_imageCollections.find(reload.d_name);
+    if (collection != d_imageCollections.end())
+        removed = collection->second;
+
+    for (ImageMap::iterator i = reload.d_images.begin();
+         i != reload.d_images.end(); ++i)
+    {
+        ImageMap::iterator existing = d_images.find(i->first);
+
+        if (existing != d_images.end())
+        {
+            removed.erase(existing->second.first);
+
+            // update the image in place if the type didn't change
+            if (existing->second.second == i->second.second)
+            {
+                existing->second.first->assign(*i->second.first);
+                i->second.second->destroy(*i->second.first);
+                continue;
+            }
+
+            destroy(existing);
+        }
+
+        registerImage(i->second);
+    }
+
+    for (Image* image : removed)
+    {
+        ImageMap::iterator i = d_images.find(image->getName());
+        destroy(i);
+    }
+
+    System::getSingleton().invalidateAllCachedRendering();
+
+    Logger::getSingleton().logEvent(
+        "[ImageManager] Reloaded imageset: " + reload.d_name);
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::addBitmapImageFromFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
     // create texture from image
-    Texture* tex = &System::getSingleton().getRenderer()->
-        createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+    Texture* tex = &createTextureFromFile(name, filename,
+        resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
 
     BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
     image.setTexture(tex);
@@ -403,6 +586,14 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
 
     validateImagesetFileVersion(attributes);
 
+    if (d_reload)
+    {
+        d_reload->d_name = name;
+        d_reload->d_imageFile = filename;
+        d_reload->d_resourceGroup = resource_group.empty() ?
+            d_imagesetDefaultResourceGroup : resource_group;
+    }
+
     if(s_imagesetType == "BitmapImage")
         retrieveImagesetTexture(name, filename, resource_group);
     else if(s_imagesetType == "SVGImage")
@@ -453,7 +644,8 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
     const String image_name(image_data_name + '/' +
         attributes.getValueAsString(ImageNameAttribute));
 
-    if (isDefined(image_name))
+    if (d_reload ? d_reload->d_images.find(image_name) != d_reload->d_images.end() :
+                   isDefined(image_name))
     {
         Logger::getSingleton().logEvent(
             "[ImageManager] WARNING: Using existing image :" + image_name);
@@ -490,7 +682,16 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
                      PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(s_nativeResolution.d_height)));
 
     d_deleteChainedHandler = false;
-    d_chainedHandler = &create(rw_attrs);
+
+    if (d_reload)
+    {
+        // registered once the whole imageset is parsed
+        const ImagePair image = createImage(rw_attrs);
+        d_reload->d_images[image_name] = image;
+        d_chainedHandler = image.first;
+    }
+    else
+        d_chainedHandler = &create(rw_attrs);
 }
 
 //----------------------------------------------------------------------------//
@@ -501,14 +702,18 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
     // if the texture already exists
     if (renderer->isTextureDefined(name))
     {
-        Logger::getSingleton().logEvent(
-            "[ImageManager] WARNING: Using existing texture: " + name);
         s_texture = &renderer->getTexture(name);
+
+        if (d_reload)
+            d_reload->d_texture = s_texture;
+        else
+            Logger::getSingleton().logEvent(
+                "[ImageManager] WARNING: Using existing texture: " + name);
     }
     else
     {
         // create texture from image
-        s_texture = &renderer->createTexture(name, filename,
+        s_texture = &createTextureFromFile(name, filename,
             resource_group.empty() ? d_imagesetDefaultResourceGroup :
             resource_group);
     }
@@ -521,9 +726,13 @@ void ImageManager::retrieveImagesetSVGData(const String& name, const String& fil
 
     if (svgDataManager.isSVGDataDefined(name))
     {
-        Logger::getSingleton().logEvent(
-            "[ImageManager] WARNING: Using existing SVGData: " + name);
         s_SVGData = &svgDataManager.getSVGData(name);
+
+        if (d_reload)
+            d_reload->d_svgData = s_SVGData;
+        else
+            Logger::getSingleton().logEvent(
+                "[ImageManager] WARNING: Using existing SVGData: " + name);
     }
     else
     {
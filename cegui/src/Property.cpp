@@ -36,6 +36,12 @@ const String Property::XMLElementName("Property");
 const String Property::NameXMLAttributeName("name");
 const String Property::ValueXMLAttributeName("value");
 
+//----------------------------------------------------------------------------//
+void Property::copyValue(const PropertyReceiver* source, PropertyReceiver* target)
+{
+    set(target, get(source));
+}
+
 //----------------------------------------------------------------------------//
 bool Property::isDefault(const PropertyReceiver* receiver) const
 {
@@ -28,10 +28,115 @@
  ***************************************************************************/
 #include "CEGUI/PropertySet.h"
 #include "CEGUI/Exceptions.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace CEGUI
 {
 
+/*************************************************************************
+	Table of class properties, shared by all PropertySets that added the
+	same class properties in the same order. The tables form a tree, each
+	one knows the tables that result from adding another property to it.
+	The tree is global and extended lazily, PropertySets created on
+	different threads may extend it at once; this is guarded by getMutex().
+*************************************************************************/
+struct PropertySet::PropertyTable
+{
+    PropertyTable(const PropertyTable* parent, Property* property) :
+        d_parent(parent),
+        d_property(property)
+    {
+    }
+
+    //! Returns the table without any properties.
+    static const PropertyTable* getRoot()
+    {
+        static const PropertyTable root(nullptr, nullptr);
+        return &root;
+    }
+
+    //! Returns the table with \a property added after the properties of this one.
+    const PropertyTable* getChild(Property* property) const
+    {
+        std::lock_guard<std::mutex> lock(getMutex());
+
+        const auto child = d_children.find(property);
+        if (child != d_children.end())
+            return child->second.get();
+
+        // Only done once per table, all other PropertySets find the child above
+        for (const PropertyTable* table = this; table->d_property; table = table->d_parent)
+        {
+            if (table->d_property->getName() == property->getName())
+                throw AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet.");
+        }
+
+        return d_children.emplace(property,
+            std::unique_ptr<PropertyTable>(new PropertyTable(this, property))).first->second.get();
+    }
+
+    Property* find(const String& name) const
+    {
+        build();
+        const auto pos = d_lookup.find(name);
+        return pos != d_lookup.end() ? pos->second : nullptr;
+    }
+
+    //! Returns the properties in the order they were added.
+    const std::vector<Property*>& getProperties() const
+    {
+        build();
+        return d_properties;
+    }
+
+private:
+    //! Guards the creation of child tables and building of the lookups.
+    static std::mutex& getMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    //! Collects the properties, tables passed through while adding properties never need them.
+    void build() const
+    {
+        if (d_built.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(getMutex());
+        if (d_built.load(std::memory_order_relaxed))
+            return;
+
+        for (const PropertyTable* table = this; table->d_property; table = table->d_parent)
+            d_properties.push_back(table->d_property);
+        std::reverse(d_properties.begin(), d_properties.end());
+
+        d_lookup.reserve(d_properties.size());
+        for (Property* property : d_properties)
+            d_lookup.emplace(property->getName(), property);
+
+        d_built.store(true, std::memory_order_release);
+    }
+
+    const PropertyTable* const d_parent;
+    Property* const d_property;
+    mutable std::unordered_map<const Property*, std::unique_ptr<PropertyTable>> d_children;
+    mutable std::vector<Property*> d_properties;
+    mutable PropertyRegistry d_lookup;
+    mutable std::atomic<bool> d_built{false};
+};
+
+/*************************************************************************
+	Constructor
+*************************************************************************/
+PropertySet::PropertySet(void) :
+    d_classProperties(PropertyTable::getRoot())
+{
+}
+
 /*************************************************************************
 	Add a new property to the set
 *************************************************************************/
@@ -42,11 +147,40 @@ void PropertySet::addProperty(Property* property)
 		throw NullObjectException("The given Property object pointer is invalid.");
 	}
 
-	if (!d_properties.insert(std::make_pair(property->getName(), property)).second)
+	if ((d_classProperties && d_classProperties->find(property->getName())) ||
+		!d_properties.insert(std::make_pair(property->getName(), property)).second)
 	{
 		throw AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet.");
 	}
 
+    ++d_propertiesRevision;
+    property->initialisePropertyReceiver(this);
+}
+
+/*************************************************************************
+	Add a property that all instances of a class have to the set
+*************************************************************************/
+void PropertySet::addClassProperty(Property* property)
+{
+    if (!property)
+    {
+        throw NullObjectException("The given Property object pointer is invalid.");
+    }
+
+    if (!d_classProperties)
+    {
+        addProperty(property);
+        return;
+    }
+
+    if (d_properties.find(property->getName()) != d_properties.end())
+    {
+        throw AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet.");
+    }
+
+    d_classProperties = d_classProperties->getChild(property);
+
+    ++d_propertiesRevision;
     property->initialisePropertyReceiver(this);
 }
 
@@ -55,11 +189,16 @@ void PropertySet::addProperty(Property* property)
 *************************************************************************/
 void PropertySet::removeProperty(const String& name)
 {
+	// The shared table can't change, this set gets its own copy instead
+	if (d_classProperties && d_classProperties->find(name))
+		unshareClassProperties();
+
 	PropertyRegistry::iterator pos = d_properties.find(name);
 
 	if (pos != d_properties.end())
 	{
 		d_properties.erase(pos);
+		++d_propertiesRevision;
 	}
 }
 
@@ -68,14 +207,14 @@ void PropertySet::removeProperty(const String& name)
 *************************************************************************/
 Property* PropertySet::getPropertyInstance(const String& name) const
 {
-    PropertyRegistry::const_iterator pos = d_properties.find(name);
+    Property* property = findProperty(name);
 
-    if (pos == d_properties.end())
+    if (!property)
     {
         throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
     }
 
-    return pos->second;
+    return property;
 }
 
 /*************************************************************************
@@ -83,7 +222,9 @@ Property* PropertySet::getPropertyInstance(const String& name) const
 *************************************************************************/
 void PropertySet::clearProperties(void)
 {
+	d_classProperties = PropertyTable::getRoot();
 	d_properties.clear();
+	++d_propertiesRevision;
 }
 
 /*************************************************************************
@@ -91,7 +232,7 @@ void PropertySet::clearProperties(void)
 *************************************************************************/
 bool PropertySet::isPropertyPresent(const String& name) const
 {
-	return (d_properties.find(name) != d_properties.end());
+	return findProperty(name) != nullptr;
 }
 
 /*************************************************************************
@@ -99,14 +240,7 @@ bool PropertySet::isPropertyPresent(const String& name) const
 *************************************************************************/
 const String& PropertySet::getPropertyHelp(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
-
-	return pos->second->getHelp();
+	return getPropertyInstance(name)->getHelp();
 }
 
 /*************************************************************************
@@ -114,14 +248,7 @@ const String& PropertySet::getPropertyHelp(const String& name) const
 *************************************************************************/
 String PropertySet::getProperty(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
-
-	return pos->second->get(this);
+	return getPropertyInstance(name)->get(this);
 }
 
 /*************************************************************************
@@ -129,14 +256,7 @@ String PropertySet::getProperty(const String& name) const
 *************************************************************************/
 void PropertySet::setProperty(const String& name,const String& value)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
-
-	pos->second->set(this, value);
+	getPropertyInstance(name)->set(this, value);
 }
 
 
@@ -146,7 +266,8 @@ void PropertySet::setProperty(const String& name,const String& value)
 *************************************************************************/
 PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 {
-	return PropertyIterator(d_properties.begin(), d_properties.end());
+	return PropertyIterator(d_classProperties ? &d_classProperties->getProperties() : nullptr,
+		d_properties);
 }
 
 
@@ -155,14 +276,7 @@ PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 *************************************************************************/
 bool PropertySet::isPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
-
-	return pos->second->isDefault(this);
+	return getPropertyInstance(name)->isDefault(this);
 }
 
 
@@ -171,14 +285,103 @@ bool PropertySet::isPropertyDefault(const String& name) const
 *************************************************************************/
 String PropertySet::getPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	return getPropertyInstance(name)->getDefault(this);
+}
 
-	if (pos == d_properties.end())
-	{
-		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
-	}
+/*************************************************************************
+	Return the property with the given name or 0
+*************************************************************************/
+Property* PropertySet::findProperty(const String& name) const
+{
+    if (d_classProperties)
+    {
+        if (Property* property = d_classProperties->find(name))
+            return property;
+    }
+
+    if (d_properties.empty())
+        return nullptr;
+
+    PropertyRegistry::const_iterator pos = d_properties.find(name);
+    return pos != d_properties.end() ? pos->second : nullptr;
+}
+
+/*************************************************************************
+	Copy the shared class properties into the properties of this set
+*************************************************************************/
+void PropertySet::unshareClassProperties()
+{
+    for (Property* property : d_classProperties->getProperties())
+        d_properties.emplace(property->getName(), property);
+
+    d_classProperties = nullptr;
+}
 
-	return pos->second->getDefault(this);
+/*************************************************************************
+	PropertyIterator
+*************************************************************************/
+PropertySet::PropertyIterator::PropertyIterator(
+        const std::vector<Property*>* classProperties,
+        const PropertyRegistry& properties) :
+    d_classProperties(classProperties),
+    d_classIndex(0),
+    d_startIter(properties.begin()),
+    d_currIter(properties.begin()),
+    d_endIter(properties.end())
+{
+}
+
+Property* PropertySet::PropertyIterator::getCurrentValue() const
+{
+    if (d_classProperties && d_classIndex < d_classProperties->size())
+        return (*d_classProperties)[d_classIndex];
+
+    return d_currIter->second;
+}
+
+bool PropertySet::PropertyIterator::isAtEnd() const
+{
+    return (!d_classProperties || d_classIndex == d_classProperties->size()) &&
+        d_currIter == d_endIter;
+}
+
+bool PropertySet::PropertyIterator::isAtStart() const
+{
+    return d_classIndex == 0 && d_currIter == d_startIter;
+}
+
+void PropertySet::PropertyIterator::toStart()
+{
+    d_classIndex = 0;
+    d_currIter = d_startIter;
+}
+
+void PropertySet::PropertyIterator::toEnd()
+{
+    d_classIndex = d_classProperties ? d_classProperties->size() : 0;
+    d_currIter = d_endIter;
+}
+
+PropertySet::PropertyIterator& PropertySet::PropertyIterator::operator++()
+{
+    if (d_classProperties && d_classIndex < d_classProperties->size())
+        ++d_classIndex;
+    else if (d_currIter != d_endIter)
+        ++d_currIter;
+
+    return *this;
+}
+
+PropertySet::PropertyIterator PropertySet::PropertyIterator::operator++(int)
+{
+    PropertyIterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+bool PropertySet::PropertyIterator::operator==(const PropertyIterator& rhs) const
+{
+    return d_classIndex == rhs.d_classIndex && d_currIter == rhs.d_currIter;
 }
 
 } // End of  CEGUI namespace section
@@ -50,10 +50,8 @@ String QuaternionSlerpInterpolator::interpolateAbsolute(const String& value1,
                                     const String& value2,
                                     float position)
 {
-    Helper::return_type val1 = Helper::fromString(value1);
-    Helper::return_type val2 = Helper::fromString(value2);
-
-    return Helper::toString(glm::slerp(val1, val2, position));
+    return Helper::toString(interpolateAbsoluteNative(
+        Helper::fromString(value1), Helper::fromString(value2), position));
 }
 
 //----------------------------------------------------------------------------//
@@ -62,24 +60,61 @@ String QuaternionSlerpInterpolator::interpolateRelative(const String& base,
                                     const String& value2,
                                     float position)
 {
-    Helper::return_type bas = Helper::fromString(base);
-    Helper::return_type val1 = Helper::fromString(value1);
-    Helper::return_type val2 = Helper::fromString(value2);
-
-    return Helper::toString(bas * glm::slerp(val1, val2, position));
+    return Helper::toString(interpolateRelativeNative(
+        Helper::fromString(base), Helper::fromString(value1),
+        Helper::fromString(value2), position));
 }
 
 //----------------------------------------------------------------------------//
 String QuaternionSlerpInterpolator::interpolateRelativeMultiply(
-                                            const String& /*base*/,
+                                            const String& base,
                                             const String& /*value1*/,
                                             const String& /*value2*/,
+                                            float position)
+{
+    return Helper::toString(interpolateRelativeMultiplyNative(
+        Helper::fromString(base), 0.0f, 0.0f, position));
+}
+
+//----------------------------------------------------------------------------//
+InterpolatorBinding* QuaternionSlerpInterpolator::createBinding(
+                                            PropertyReceiver* target,
+                                            Property* property)
+{
+    return TplInterpolatorBinding<glm::quat, QuaternionSlerpInterpolator>::create(
+        *this, target, property);
+}
+
+//----------------------------------------------------------------------------//
+glm::quat QuaternionSlerpInterpolator::interpolateAbsoluteNative(
+                                            const glm::quat& val1,
+                                            const glm::quat& val2,
+                                            float position)
+{
+    return glm::slerp(val1, val2, position);
+}
+
+//----------------------------------------------------------------------------//
+glm::quat QuaternionSlerpInterpolator::interpolateRelativeNative(
+                                            const glm::quat& bas,
+                                            const glm::quat& val1,
+                                            const glm::quat& val2,
+                                            float position)
+{
+    return bas * glm::slerp(val1, val2, position);
+}
+
+//----------------------------------------------------------------------------//
+glm::quat QuaternionSlerpInterpolator::interpolateRelativeMultiplyNative(
+                                            const glm::quat& /*bas*/,
+                                            float /*val1*/,
+                                            float /*val2*/,
                                             float /*position*/)
 {
     throw InvalidRequestException("ApplicationMethod::RELATIVE_MULTIPLY doesn't make sense "
         "with Quaternions! Please use absolute or relative application method.");
 
-    return Helper::toString(glm::quat(1, 0, 0, 0));
+    return glm::quat(1, 0, 0, 0);
 }
 
 //----------------------------------------------------------------------------//
@@ -26,30 +26,62 @@
  ***************************************************************************/
 #include "CEGUI/RenderQueue.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/FrameProfiler.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// Number of preceding batches a buffer may be merged into
+static const size_t s_batchLookback = 16;
+
+//----------------------------------------------------------------------------//
+static bool overlaps(const Rectf& a, const Rectf& b)
+{
+    return a.left() < b.right() && b.left() < a.right() &&
+        a.top() < b.bottom() && b.top() < a.bottom();
+}
+
+//----------------------------------------------------------------------------//
+RenderQueue::~RenderQueue()
+{
+    destroyBatchBuffers();
+}
+
 //----------------------------------------------------------------------------//
 void RenderQueue::draw(std::uint32_t drawModeMask) const
 {
     // draw the buffers
-    BufferList::const_iterator i = d_buffers.begin();
-    for ( ; i != d_buffers.end(); ++i)
-        (*i)->draw(drawModeMask);
+    for (auto buffer : getDrawBuffers())
+        buffer->draw(drawModeMask);
+
+#ifdef CEGUI_USE_FRAME_PROFILER
+    if (FrameProfiler* profiler = FrameProfiler::getActive())
+    {
+        const auto& buffers = getDrawBuffers();
+        profiler->addCount(ProfilerCounter::GeometryBuffers, buffers.size());
+        for (auto buffer : buffers)
+            profiler->addCount(ProfilerCounter::Vertices, buffer->getVertexCount());
+    }
+#endif
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::addGeometryBuffers(const std::vector<GeometryBuffer*>& geometry_buffers)
 {
     d_buffers.insert(d_buffers.end(), geometry_buffers.begin(), geometry_buffers.end());
+    d_batchesValid = false;
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::addGeometryBuffer(GeometryBuffer& geometry_buffer)
 {
     d_buffers.push_back(&geometry_buffer);
+    d_batchesValid = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -58,13 +90,194 @@ void RenderQueue::removeGeometryBuffer(const GeometryBuffer& geometry_buffer)
     BufferList::iterator i = std::find(d_buffers.begin(), d_buffers.end(),
                                        &geometry_buffer);
     if (i != d_buffers.end())
+    {
         d_buffers.erase(i);
+        d_batchesValid = false;
+    }
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::reset()
 {
     d_buffers.clear();
+    d_batchesValid = false;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::setBatchingEnabled(bool enabled)
+{
+    if (d_batchingEnabled == enabled)
+        return;
+
+    d_batchingEnabled = enabled;
+    d_batchesValid = false;
+
+    if (!enabled)
+        destroyBatchBuffers();
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::updateBatches()
+{
+    d_batchesValid = false;
+    d_drawBuffers.clear();
+    d_batchStats = RenderQueueBatchStats();
+
+    if (!d_batchingEnabled)
+        return;
+
+    struct Batch
+    {
+        //! Index of the first and the last buffer in d_buffers.
+        size_t d_first;
+        size_t d_last;
+        size_t d_count;
+        //! Area covered by the vertices, unclipped.
+        Rectf d_bounds;
+        Rectf d_clipRegion;
+        bool d_clipped;
+        bool d_mergeable;
+    };
+
+    // Buffers of a batch are linked through their index in d_buffers
+    static const size_t npos = static_cast<size_t>(-1);
+    std::vector<size_t> nextInBatch(d_buffers.size(), npos);
+    std::vector<Batch> batches;
+    batches.reserve(d_buffers.size());
+
+    for (size_t i = 0; i < d_buffers.size(); ++i)
+    {
+        const GeometryBuffer* buffer = d_buffers[i];
+        if (!buffer->getVertexCount())
+            continue;
+
+        ++d_batchStats.d_bufferCount;
+
+        if (!buffer->isMergeable())
+        {
+            batches.push_back({ i, i, 1, Rectf(), Rectf(), false, false });
+            continue;
+        }
+
+        // Clipping that removes nothing doesn't prevent merging
+        const Rectf bounds = buffer->getTranslatedBounds();
+        const Rectf& clipRegion = buffer->getPreparedClippingRegion();
+        const bool clipped = buffer->isClippingActive() &&
+            bounds.getIntersection(clipRegion) != bounds;
+
+        // Search a batch that can take the buffer without changing the
+        // result of drawing overlapping geometry.
+        size_t target = npos;
+        const size_t stop = (batches.size() > s_batchLookback) ? batches.size() - s_batchLookback : 0;
+        for (size_t b = batches.size(); b-- > stop; )
+        {
+            const Batch& batch = batches[b];
+            if (batch.d_mergeable && batch.d_clipped == clipped &&
+                (!clipped || batch.d_clipRegion == clipRegion) &&
+                d_buffers[batch.d_first]->hasSameRenderState(*buffer))
+            {
+                target = b;
+                break;
+            }
+
+            if (!batch.d_mergeable || overlaps(batch.d_bounds, bounds))
+                break;
+        }
+
+        if (target == npos)
+        {
+            batches.push_back({ i, i, 1, bounds, clipped ? clipRegion : Rectf(), clipped, true });
+            continue;
+        }
+
+        Batch& batch = batches[target];
+        nextInBatch[batch.d_last] = i;
+        batch.d_last = i;
+        ++batch.d_count;
+        batch.d_bounds = Rectf(
+            glm::min(batch.d_bounds.d_min, bounds.d_min),
+            glm::max(batch.d_bounds.d_max, bounds.d_max));
+    }
+
+    // Fill the vertex streams, reusing the GeometryBuffers of the last update
+    Renderer* renderer = System::getSingleton().getRenderer();
+    size_t usedBatchBuffers = 0;
+    for (const Batch& batch : batches)
+    {
+        GeometryBuffer* first = d_buffers[batch.d_first];
+        if (batch.d_count == 1)
+        {
+            d_drawBuffers.push_back(first);
+            continue;
+        }
+
+        const int elementCount = first->getVertexAttributeElementCount();
+        auto it = std::find_if(d_batchBuffers.begin() + usedBatchBuffers, d_batchBuffers.end(),
+            [elementCount](const GeometryBuffer* buffer)
+        {
+            return buffer->getVertexAttributeElementCount() == elementCount;
+        });
+
+        GeometryBuffer* merged = nullptr;
+        if (it != d_batchBuffers.end())
+        {
+            merged = *it;
+            std::iter_swap(it, d_batchBuffers.begin() + usedBatchBuffers);
+        }
+        else if (elementCount == static_cast<int>(GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT) ||
+                 elementCount == static_cast<int>(GeometryBuffer::COLORED_VERTEX_FLOAT_COUNT))
+        {
+            merged = (elementCount == static_cast<int>(GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT)) ?
+                &renderer->createGeometryBufferTextured() : &renderer->createGeometryBufferColoured();
+            d_batchBuffers.push_back(merged);
+            std::iter_swap(d_batchBuffers.end() - 1, d_batchBuffers.begin() + usedBatchBuffers);
+        }
+
+        // Custom materials may not be reproducible with a default one
+        if (!merged || !merged->copyRenderState(*first))
+        {
+            for (size_t i = batch.d_first; i != npos; i = nextInBatch[i])
+                d_drawBuffers.push_back(d_buffers[i]);
+            continue;
+        }
+
+        ++usedBatchBuffers;
+
+        merged->reset();
+        merged->setClippingActive(batch.d_clipped);
+        if (batch.d_clipped)
+            merged->setClippingRegion(first->getClippingRegion());
+
+        for (size_t i = batch.d_first; i != npos; i = nextInBatch[i])
+            merged->appendTranslatedGeometry(*d_buffers[i]);
+
+        d_drawBuffers.push_back(merged);
+    }
+
+    // Release the buffers this update didn't need
+    while (d_batchBuffers.size() > usedBatchBuffers)
+    {
+        renderer->destroyGeometryBuffer(*d_batchBuffers.back());
+        d_batchBuffers.pop_back();
+    }
+
+    d_batchStats.d_drawCallCount = d_drawBuffers.size();
+    d_batchesValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::destroyBatchBuffers()
+{
+    d_drawBuffers.clear();
+    d_batchesValid = false;
+
+    if (d_batchBuffers.empty())
+        return;
+
+    if (System* system = System::getSingletonPtr())
+        system->getRenderer()->destroyGeometryBuffers(d_batchBuffers);
+
+    d_batchBuffers.clear();
 }
 
 //----------------------------------------------------------------------------//
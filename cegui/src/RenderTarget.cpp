@@ -45,6 +45,8 @@ namespace CEGUI
 const String RenderTarget::EventNamespace("RenderTarget");
 const String RenderTarget::EventAreaChanged("AreaChanged");
 
+const EventId RenderTarget::EventAreaChangedId(EventAreaChanged);
+
 //----------------------------------------------------------------------------//
 RenderTarget::RenderTarget():
     d_activationCounter(0),
@@ -147,7 +149,7 @@ void RenderTarget::setArea(const Rectf& area)
     d_matrixValid = false;
 
     RenderTargetEventArgs args(this);
-    fireEvent(RenderTarget::EventAreaChanged, args);
+    fireEvent(RenderTarget::EventAreaChangedId, args);
 }
 
 //----------------------------------------------------------------------------//
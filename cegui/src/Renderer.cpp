@@ -67,6 +67,16 @@ void Renderer::destroyGeometryBuffer(GeometryBuffer& buffer)
     d_geomeryBufferPool[buffer.getRenderMaterial()->getShaderWrapper()].push_back(&buffer);
 }
 
+//----------------------------------------------------------------------------//
+void Renderer::destroyGeometryBuffers(std::vector<GeometryBuffer*>& buffers)
+{
+    // Reverse order makes subsequent requests pop the same buffers in the same order
+    for (auto it = buffers.rbegin(); it != buffers.rend(); ++it)
+        destroyGeometryBuffer(**it);
+
+    buffers.clear();
+}
+
 //----------------------------------------------------------------------------//
 void Renderer::destroyAllGeometryBuffers()
 {
@@ -79,6 +89,40 @@ void Renderer::destroyAllGeometryBuffers()
     d_geometryBuffers.clear();
 }
 
+//----------------------------------------------------------------------------//
+void Renderer::clearGeometryBufferPool()
+{
+    for (auto& pair : d_geomeryBufferPool)
+        for (auto buffer : pair.second)
+            delete buffer;
+
+    d_geomeryBufferPool.clear();
+}
+
+//----------------------------------------------------------------------------//
+GeometryBufferPoolStats Renderer::getGeometryBufferPoolStats() const
+{
+    GeometryBufferPoolStats stats;
+    stats.d_hits = d_geometryBufferPoolHits;
+    stats.d_misses = d_geometryBufferPoolMisses;
+
+    for (const auto& pair : d_geomeryBufferPool)
+    {
+        stats.d_pooledBuffers += pair.second.size();
+        for (auto buffer : pair.second)
+            stats.d_pooledBytes += buffer->getVertexData().capacity() * sizeof(float);
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::resetGeometryBufferPoolStats()
+{
+    d_geometryBufferPoolHits = 0;
+    d_geometryBufferPoolMisses = 0;
+}
+
 //----------------------------------------------------------------------------//
 GeometryBuffer& Renderer::createGeometryBufferTextured()
 {
@@ -93,9 +137,11 @@ GeometryBuffer& Renderer::createGeometryBufferTextured()
         GeometryBuffer* buffer = it->second.back();
         it->second.pop_back();
         addGeometryBuffer(*buffer);
+        ++d_geometryBufferPoolHits;
         return *buffer;
     }
 
+    ++d_geometryBufferPoolMisses;
     return createGeometryBufferTextured(createRenderMaterial(DefaultShaderType::Textured));
 }
 
@@ -113,9 +159,11 @@ GeometryBuffer& Renderer::createGeometryBufferColoured()
         GeometryBuffer* buffer = it->second.back();
         it->second.pop_back();
         addGeometryBuffer(*buffer);
+        ++d_geometryBufferPoolHits;
         return *buffer;
     }
 
+    ++d_geometryBufferPoolMisses;
     return createGeometryBufferColoured(createRenderMaterial(DefaultShaderType::Solid));
 }
 
@@ -63,7 +63,7 @@ void DirectFBRenderTarget::setArea(const Rectf& area)
     d_area = area;
 
     RenderTargetEventArgs args(this);
-    fireEvent(EventAreaChanged, args);
+    fireEvent(EventAreaChangedId, args);
 }
 
 //----------------------------------------------------------------------------//
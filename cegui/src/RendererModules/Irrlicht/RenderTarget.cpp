@@ -72,7 +72,7 @@ void IrrlichtRenderTarget::setArea(const Rectf& area)
     d_matrixValid = false;
 
     RenderTargetEventArgs args(this);
-    T::fireEvent(RenderTarget::EventAreaChanged, args);
+    T::fireEvent(RenderTarget::EventAreaChangedId, args);
 }
 
 
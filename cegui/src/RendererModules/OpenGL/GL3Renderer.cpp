@@ -425,7 +425,7 @@ void OpenGL3Renderer::uploadBuffers(RenderingSurface& surface)
 
     for(auto &queue : surface.getRenderQueueList())
     {
-        addGeometry(queue.second.getBuffers());
+        addGeometry(queue.second.getDrawBuffers());
     }
 
 
@@ -67,7 +67,7 @@ void OpenGLESRenderTarget::setArea(const Rectf& area)
     d_matrixValid = false;
 
     RenderTargetEventArgs args(this);
-    T::fireEvent(RenderTarget::EventAreaChanged, args);
+    T::fireEvent(RenderTarget::EventAreaChangedId, args);
 }
 
 
@@ -28,6 +28,7 @@
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/Renderer.h"
+#include "CEGUI/FrameProfiler.h"
 #include <algorithm>
 
 namespace CEGUI
@@ -39,6 +40,9 @@ const String RenderingSurface::EventRenderQueueStarted("RenderQueueStarted");
 // Event that signals the end of rendering for a queue.
 const String RenderingSurface::EventRenderQueueEnded("RenderQueueEnded");
 
+const EventId RenderingSurface::EventRenderQueueStartedId(EventRenderQueueStarted);
+const EventId RenderingSurface::EventRenderQueueEndedId(EventRenderQueueEnded);
+
 //----------------------------------------------------------------------------//
 RenderingSurface::RenderingSurface(RenderTarget& target)
     : d_target(&target)
@@ -56,14 +60,18 @@ RenderingSurface::~RenderingSurface()
 void RenderingSurface::addGeometryBuffers(const RenderQueueID queue,
     const std::vector<GeometryBuffer*>& geometry_buffers)
 {
-    d_queues[queue].addGeometryBuffers(geometry_buffers);
+    RenderQueue& renderQueue = d_queues[queue];
+    renderQueue.setBatchingEnabled(d_geometryBatchingEnabled);
+    renderQueue.addGeometryBuffers(geometry_buffers);
 }
 
 //----------------------------------------------------------------------------//
 void RenderingSurface::addGeometryBuffer(const RenderQueueID queue,
      GeometryBuffer& geometry_buffer)
 {
-    d_queues[queue].addGeometryBuffer(geometry_buffer);
+    RenderQueue& renderQueue = d_queues[queue];
+    renderQueue.setBatchingEnabled(d_geometryBatchingEnabled);
+    renderQueue.addGeometryBuffer(geometry_buffer);
 }
 
 //----------------------------------------------------------------------------//
@@ -89,7 +97,15 @@ void RenderingSurface::clearGeometry()
 //----------------------------------------------------------------------------//
 void RenderingSurface::draw(std::uint32_t drawMode)
 {
+    CEGUI_PROFILE_SCOPE("RenderingSurface::draw");
+
     d_target->activate();
+
+    // Merging happens before uploading, renderers upload the merged buffers
+    if (d_geometryBatchingEnabled)
+        for (auto& pair : d_queues)
+            pair.second.updateBatches();
+
     d_target->getOwner().uploadBuffers(*this);
     drawContent(drawMode);
     d_target->deactivate();
@@ -110,12 +126,12 @@ void RenderingSurface::drawContent(std::uint32_t drawModeMask)
 //----------------------------------------------------------------------------//
 void RenderingSurface::draw(const RenderQueue& queue, RenderQueueEventArgs& args, std::uint32_t drawModeMask)
 {
-    fireEvent(EventRenderQueueStarted, args, EventNamespace);
+    fireEvent(EventRenderQueueStartedId, args, EventNamespace);
 
     d_target->draw(queue, drawModeMask);
 
     args.handled = 0;
-    fireEvent(EventRenderQueueEnded, args, EventNamespace);
+    fireEvent(EventRenderQueueEndedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -128,6 +144,7 @@ bool RenderingSurface::isInvalidated() const
 RenderingWindow& RenderingSurface::createRenderingWindow(TextureTarget& target)
 {
     RenderingWindow* w = new RenderingWindow(target, *this);
+    w->setGeometryBatchingEnabled(d_geometryBatchingEnabled);
     attachWindow(*w);
     return *w;
 }
@@ -171,4 +188,29 @@ void RenderingSurface::attachWindow(RenderingWindow& w)
     invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void RenderingSurface::setGeometryBatchingEnabled(bool enabled)
+{
+    d_geometryBatchingEnabled = enabled;
+
+    for (auto& pair : d_queues)
+        pair.second.setBatchingEnabled(enabled);
+
+    for (auto wnd : d_windows)
+        wnd->setGeometryBatchingEnabled(enabled);
+}
+
+//----------------------------------------------------------------------------//
+RenderQueueBatchStats RenderingSurface::getGeometryBatchStats() const
+{
+    RenderQueueBatchStats stats;
+    for (const auto& pair : d_queues)
+    {
+        stats.d_bufferCount += pair.second.getBatchStats().d_bufferCount;
+        stats.d_drawCallCount += pair.second.getBatchStats().d_drawCallCount;
+    }
+
+    return stats;
+}
+
 }
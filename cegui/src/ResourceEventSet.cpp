@@ -35,4 +35,8 @@ const String ResourceEventSet::EventResourceCreated("ResourceCreated");
 const String ResourceEventSet::EventResourceDestroyed("ResourceDestroyed");
 const String ResourceEventSet::EventResourceReplaced("ResourceReplaced");
 
+const EventId ResourceEventSet::EventResourceCreatedId(EventResourceCreated);
+const EventId ResourceEventSet::EventResourceDestroyedId(EventResourceDestroyed);
+const EventId ResourceEventSet::EventResourceReplacedId(EventResourceReplaced);
+
 }
\ No newline at end of file
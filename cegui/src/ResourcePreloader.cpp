@@ -0,0 +1,486 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Reads, parses and decodes resource files on worker threads
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ResourcePreloader.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include <chrono>
+#include <cstring>
+
+namespace CEGUI
+{
+typedef std::chrono::steady_clock PreloadClock;
+
+//----------------------------------------------------------------------------//
+static double secondsSince(PreloadClock::time_point start)
+{
+    return std::chrono::duration<double>(PreloadClock::now() - start).count();
+}
+
+//----------------------------------------------------------------------------//
+/*!
+    Stores the elements reported by the XMLParser in an XMLDocument.
+*/
+class XMLDocumentRecorder : public XMLHandler
+{
+public:
+    XMLDocumentRecorder(ResourcePreloader::XMLDocument& document,
+                        const String& schema_name) :
+        d_document(document),
+        d_schemaName(schema_name)
+    {}
+
+    const String& getSchemaName() const override { return d_schemaName; }
+    const String& getDefaultResourceGroup() const override
+    {
+        // only used for files the handler loads itself
+        static const String noResourceGroup;
+        return noResourceGroup;
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override
+    {
+        d_document.d_nodes.push_back({ Node::Type::ElementStart, element, attributes });
+    }
+
+    void elementEnd(const String& element) override
+    {
+        d_document.d_nodes.push_back({ Node::Type::ElementEnd, element, XMLAttributes() });
+    }
+
+    void text(const String& text) override
+    {
+        d_document.d_nodes.push_back({ Node::Type::Text, text, XMLAttributes() });
+    }
+
+private:
+    typedef ResourcePreloader::XMLDocument::Node Node;
+
+    ResourcePreloader::XMLDocument& d_document;
+    const String& d_schemaName;
+};
+
+//----------------------------------------------------------------------------//
+/*!
+    Texture the ImageCodec decodes an image into on a worker thread. Only
+    formats that every renderer supports are accepted, so that the codec
+    produces the same pixels as for the texture of the renderer.
+*/
+class DecodedImageTexture : public Texture
+{
+public:
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&) override { d_failed = true; }
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format) override
+    {
+        if (!isPixelFormatSupported(pixel_format))
+        {
+            d_failed = true;
+            return;
+        }
+
+        const size_t byteCount = static_cast<size_t>(buffer_size.d_width) *
+            static_cast<size_t>(buffer_size.d_height) *
+            (pixel_format == PixelFormat::Rgba ? 4 : 3);
+
+        const std::uint8_t* const bytes = static_cast<const std::uint8_t*>(buffer);
+        d_pixels.assign(bytes, bytes + byteCount);
+        d_size = buffer_size;
+        d_pixelFormat = pixel_format;
+        d_loaded = true;
+    }
+
+    void blitFromMemory(const void*, const Rectf&) override { d_failed = true; }
+    void blitToMemory(void*) override { d_failed = true; }
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const override
+    {
+        if (fmt == PixelFormat::Rgb || fmt == PixelFormat::Rgba)
+            return true;
+
+        // the renderer may have given another answer
+        d_failed = true;
+        return false;
+    }
+
+    bool isValid() const { return d_loaded && !d_failed; }
+
+    String d_name;
+    Sizef d_size;
+    glm::vec2 d_texelScaling;
+    std::vector<std::uint8_t> d_pixels;
+    PixelFormat d_pixelFormat = PixelFormat::Rgba;
+    bool d_loaded = false;
+    mutable bool d_failed = false;
+};
+
+//----------------------------------------------------------------------------//
+ResourcePreloader* ResourcePreloader::s_active = nullptr;
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::XMLDocument::replay(XMLHandler& handler) const
+{
+    for (const Node& node : d_nodes)
+    {
+        switch (node.d_type)
+        {
+        case Node::Type::ElementStart:
+            handler.elementStart(node.d_value, node.d_attributes);
+            break;
+        case Node::Type::ElementEnd:
+            handler.elementEnd(node.d_value);
+            break;
+        case Node::Type::Text:
+            handler.text(node.d_value);
+            break;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+ResourcePreloader::ResourcePreloader(size_t thread_count) :
+    d_previousActive(s_active)
+{
+    if (!thread_count)
+        thread_count = 1;
+
+    d_workers.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+        d_workers.emplace_back(&ResourcePreloader::workerMain, this);
+
+    s_active = this;
+}
+
+//----------------------------------------------------------------------------//
+ResourcePreloader::~ResourcePreloader()
+{
+    s_active = d_previousActive;
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+        d_jobs.clear();
+    }
+
+    d_jobAvailable.notify_all();
+
+    for (std::thread& worker : d_workers)
+        worker.join();
+
+    // data of files that were not used
+    ResourceProvider* const resourceProvider =
+        System::getSingleton().getResourceProvider();
+    for (const std::unique_ptr<File>& file : d_files)
+    {
+        if (file->d_data)
+            resourceProvider->unloadRawDataContainer(*file->d_data);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::queueXMLFile(const String& filename,
+    const String& resource_group, const String& schema_name, XMLCallback callback)
+{
+    std::unique_ptr<File> file(new File);
+    file->d_type = FileType::XML;
+    file->d_filename = filename;
+    file->d_resourceGroup = resource_group;
+    file->d_schemaName = schema_name;
+    file->d_callback = std::move(callback);
+    queueFile(std::move(file));
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::queueImageFile(const String& filename,
+                                       const String& resource_group)
+{
+    std::unique_ptr<File> file(new File);
+    file->d_type = FileType::Image;
+    file->d_filename = filename;
+    file->d_resourceGroup = resource_group;
+    queueFile(std::move(file));
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::queueDataFile(const String& filename,
+                                      const String& resource_group)
+{
+    std::unique_ptr<File> file(new File);
+    file->d_type = FileType::Data;
+    file->d_filename = filename;
+    file->d_resourceGroup = resource_group;
+    queueFile(std::move(file));
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::queueFile(std::unique_ptr<File> file)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+
+        // files referred to several times are prepared once
+        const String key(makeKey(file->d_type, file->d_filename, file->d_resourceGroup));
+        if (d_stopping || d_filesByKey.find(key) != d_filesByKey.end())
+            return;
+
+        d_filesByKey.emplace(key, file.get());
+        d_jobs.push_back(file.get());
+        d_files.push_back(std::move(file));
+    }
+
+    d_jobAvailable.notify_one();
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::wait()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_jobsDone.wait(lock, [this] { return d_jobs.empty() && !d_busyWorkers; });
+}
+
+//----------------------------------------------------------------------------//
+bool ResourcePreloader::parseXMLFile(XMLHandler& handler, const String& filename,
+                                     const String& resource_group)
+{
+    File* const file = findPreparedFile(FileType::XML, filename, resource_group);
+    if (!file)
+        return false;
+
+    const PreloadClock::time_point start = PreloadClock::now();
+    try
+    {
+        file->d_document.replay(handler);
+    }
+    catch (...)
+    {
+        file->d_finaliseTime += secondsSince(start);
+        throw;
+    }
+
+    file->d_finaliseTime += secondsSince(start);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Texture* ResourcePreloader::createTexture(const String& name,
+    const String& filename, const String& resource_group)
+{
+    File* const file = findPreparedFile(FileType::Image, filename, resource_group);
+    if (!file)
+        return nullptr;
+
+    const PreloadClock::time_point start = PreloadClock::now();
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    Texture& texture = renderer->createTexture(name);
+    try
+    {
+        texture.loadFromMemory(file->d_pixels.data(), file->d_imageSize,
+                               file->d_pixelFormat);
+    }
+    catch (...)
+    {
+        renderer->destroyTexture(texture);
+        file->d_finaliseTime += secondsSince(start);
+        throw;
+    }
+
+    file->d_finaliseTime += secondsSince(start);
+    return &texture;
+}
+
+//----------------------------------------------------------------------------//
+bool ResourcePreloader::loadRawDataContainer(const String& filename,
+    RawDataContainer& output, const String& resource_group)
+{
+    File* const file = findPreparedFile(FileType::Data, filename, resource_group);
+    if (!file || !file->d_data)
+        return false;
+
+    output.swap(*file->d_data);
+    file->d_data.reset();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+std::vector<ResourcePreloader::FileTiming> ResourcePreloader::getFileTimings() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    std::vector<FileTiming> timings;
+    timings.reserve(d_files.size());
+    for (const std::unique_ptr<File>& file : d_files)
+    {
+        timings.push_back({ file->d_filename, file->d_resourceGroup,
+                            file->d_prepareTime, file->d_finaliseTime,
+                            file->d_prepared });
+    }
+
+    return timings;
+}
+
+//----------------------------------------------------------------------------//
+ResourcePreloader::File* ResourcePreloader::findPreparedFile(FileType type,
+    const String& filename, const String& resource_group) const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    const auto it = d_filesByKey.find(makeKey(type, filename, resource_group));
+    if (it == d_filesByKey.end() || !it->second->d_prepared)
+        return nullptr;
+
+    return it->second;
+}
+
+//----------------------------------------------------------------------------//
+String ResourcePreloader::makeKey(FileType type, const String& filename,
+                                  const String& resource_group)
+{
+    static const char* const typeNames[] = { "xml\n", "image\n", "data\n" };
+
+    // resource group names and file names can't contain line breaks
+    return typeNames[static_cast<int>(type)] + resource_group + '\n' + filename;
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::workerMain()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+    {
+        d_jobAvailable.wait(lock, [this] { return d_stopping || !d_jobs.empty(); });
+        if (d_stopping)
+            break;
+
+        File* const file = d_jobs.front();
+        d_jobs.pop_front();
+        ++d_busyWorkers;
+        lock.unlock();
+
+        prepareFile(*file);
+
+        lock.lock();
+        --d_busyWorkers;
+        if (d_jobs.empty() && !d_busyWorkers)
+            d_jobsDone.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::prepareFile(File& file)
+{
+    const PreloadClock::time_point start = PreloadClock::now();
+    ResourceProvider* const resourceProvider =
+        System::getSingleton().getResourceProvider();
+
+    bool prepared = false;
+    std::unique_ptr<RawDataContainer> data(new RawDataContainer);
+    try
+    {
+        resourceProvider->loadRawDataContainer(file.d_filename, *data,
+                                               file.d_resourceGroup);
+
+        switch (file.d_type)
+        {
+        case FileType::XML:
+            prepareXMLFile(file, *data);
+            prepared = true;
+            break;
+        case FileType::Image:
+            prepareImageFile(file, *data);
+            prepared = !file.d_pixels.empty();
+            break;
+        case FileType::Data:
+            file.d_data = std::move(data);
+            prepared = true;
+            break;
+        }
+    }
+    catch (...)
+    {
+        // the file is loaded as usual, which reports the error
+        prepared = false;
+    }
+
+    if (data)
+        resourceProvider->unloadRawDataContainer(*data);
+
+    file.d_prepareTime = secondsSince(start);
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        file.d_prepared = prepared;
+    }
+
+    // queue the files the XML file refers to
+    if (prepared && file.d_callback)
+    {
+        try
+        {
+            file.d_callback(*this, file.d_document);
+        }
+        catch (...)
+        {
+            // the files are loaded as usual
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::prepareXMLFile(File& file, const RawDataContainer& data)
+{
+    XMLDocumentRecorder recorder(file.d_document, file.d_schemaName);
+    System::getSingleton().getXMLParser()->parseXML(recorder, data,
+                                                    file.d_schemaName, true);
+}
+
+//----------------------------------------------------------------------------//
+void ResourcePreloader::prepareImageFile(File& file, const RawDataContainer& data)
+{
+    DecodedImageTexture texture;
+    System::getSingleton().getImageCodec().load(data, &texture);
+
+    if (!texture.isValid())
+        return;
+
+    file.d_pixels.swap(texture.d_pixels);
+    file.d_imageSize = texture.d_size;
+    file.d_pixelFormat = texture.d_pixelFormat;
+}
+
+//----------------------------------------------------------------------------//
+
+}
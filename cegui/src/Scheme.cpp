@@ -36,6 +36,7 @@
 #include "CEGUI/FactoryModule.h"
 #include "CEGUI/DynamicModule.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/ResourcePreloader.h"
 
 #ifdef HAVE_CONFIG_H
 #   include "config.h"
@@ -106,6 +107,34 @@ void Scheme::loadResources(void)
 }
 
 
+/*************************************************************************
+    Queue the files of all resources for this scheme
+*************************************************************************/
+void Scheme::prepareResources(ResourcePreloader& preloader) const
+{
+    for (const LoadableUIElement& imageset : d_imagesets)
+        ImageManager::prepareImageset(preloader, imageset.filename, imageset.resourceGroup);
+
+    const ImageManager& imgr = ImageManager::getSingleton();
+    for (const LoadableUIElement& image : d_imagesetsFromImages)
+    {
+        // images that exist already are not loaded again
+        if (imgr.isDefined(image.name.empty() ? image.filename : image.name))
+            continue;
+
+        preloader.queueImageFile(image.filename, image.resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() : image.resourceGroup);
+    }
+
+    for (const LoadableUIElement& font : d_fontFiles)
+        FontManager::prepareFromFile(preloader, font.filename, font.resourceGroup);
+
+    for (const LoadableUIElement& looknfeel : d_looknfeels)
+        WidgetLookManager::prepareLookNFeelSpecificationFromFile(preloader,
+            looknfeel.filename, looknfeel.resourceGroup);
+}
+
+
 /*************************************************************************
     Unload all resources for this scheme
 *************************************************************************/
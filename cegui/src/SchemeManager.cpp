@@ -33,6 +33,8 @@
 #include "CEGUI/ResourceProvider.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/SharedStringStream.h"
+#include <exception>
+#include <memory>
 
 namespace CEGUI
 {
@@ -42,7 +44,8 @@ template<> SchemeManager* Singleton<SchemeManager>::ms_Singleton = nullptr;
 //----------------------------------------------------------------------------//
 SchemeManager::SchemeManager() :
     d_resourceType("Scheme"),
-    d_autoLoadResources(true)
+    d_autoLoadResources(true),
+    d_loadingThreadCount(0)
 {
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
 
@@ -99,6 +102,13 @@ Scheme& SchemeManager::createFromFile(const String& xml_filename,
     const String& resource_group,
     XmlResourceExistsAction resourceExistsAction)
 {
+    if (d_loadingThreadCount)
+    {
+        const std::vector<String> xml_filenames(1, xml_filename);
+        return *createFromFiles(xml_filenames, resource_group,
+                                resourceExistsAction).front();
+    }
+
     Scheme_xmlHandler xml_loader;
 
     xml_loader.handleFile(xml_filename, resource_group, resourceExistsAction);
@@ -107,6 +117,112 @@ Scheme& SchemeManager::createFromFile(const String& xml_filename,
 }
 
 
+std::vector<Scheme*> SchemeManager::createFromFiles(
+    const std::vector<String>& xml_filenames,
+    const String& resource_group,
+    XmlResourceExistsAction resourceExistsAction)
+{
+    std::vector<Scheme*> schemes;
+    schemes.reserve(xml_filenames.size());
+
+    if (!d_loadingThreadCount)
+    {
+        for (const String& xml_filename : xml_filenames)
+            schemes.push_back(&createFromFile(xml_filename, resource_group,
+                                              resourceExistsAction));
+        return schemes;
+    }
+
+    ResourcePreloader preloader(d_loadingThreadCount);
+
+    const String schemeGroup(resource_group.empty() ?
+        Scheme::getDefaultResourceGroup() : resource_group);
+    const String schemaName(Scheme_xmlHandler().getSchemaName());
+    for (const String& xml_filename : xml_filenames)
+        preloader.queueXMLFile(xml_filename, schemeGroup, schemaName);
+    preloader.wait();
+
+    // All scheme files are parsed before any resource is loaded, so that the
+    // resources of all schemes are prepared together. Should a scheme file
+    // fail to parse, the schemes before it are still created, as they are
+    // when the files are loaded one by one.
+    std::vector<std::unique_ptr<Scheme>> parsedSchemes;
+    std::exception_ptr parseError;
+    for (const String& xml_filename : xml_filenames)
+    {
+        try
+        {
+            Scheme_xmlHandler xml_loader;
+            xml_loader.handleFile(xml_filename, resource_group, resourceExistsAction);
+            parsedSchemes.emplace_back(&xml_loader.getObject());
+        }
+        catch (...)
+        {
+            parseError = std::current_exception();
+            break;
+        }
+    }
+
+    if (d_autoLoadResources)
+    {
+        for (const std::unique_ptr<Scheme>& scheme : parsedSchemes)
+        {
+            // existing schemes are returned without loading any resources
+            if (resourceExistsAction != XmlResourceExistsAction::Return ||
+                !isDefined(scheme->getName()))
+                scheme->prepareResources(preloader);
+        }
+
+        preloader.wait();
+    }
+
+    try
+    {
+        for (std::unique_ptr<Scheme>& scheme : parsedSchemes)
+        {
+            const String name(scheme->getName());
+            schemes.push_back(&doExistingObjectAction(name, scheme.release(),
+                                                      resourceExistsAction));
+        }
+    }
+    catch (...)
+    {
+        logResourceLoadTimings(preloader);
+        throw;
+    }
+
+    logResourceLoadTimings(preloader);
+
+    if (parseError)
+        std::rethrow_exception(parseError);
+
+    return schemes;
+}
+
+
+void SchemeManager::logResourceLoadTimings(const ResourcePreloader& preloader)
+{
+    d_resourceLoadTimings = preloader.getFileTimings();
+
+    Logger& logger(Logger::getSingleton());
+    if (!logger.isLoggingEnabled(LoggingLevel::Informative))
+        return;
+
+    for (const ResourcePreloader::FileTiming& timing : d_resourceLoadTimings)
+    {
+        std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+        sstream << "Prepared file '" << timing.d_filename << "' from resource group '"
+                << timing.d_resourceGroup << "' in "
+                << timing.d_prepareTime * 1000.0 << " ms, loaded it in "
+                << timing.d_finaliseTime * 1000.0 << " ms";
+        if (!timing.d_prepared)
+            sstream << " (not prepared, loaded as usual)";
+
+        logger.logEvent(sstream.str(), LoggingLevel::Informative);
+    }
+}
+
+
 Scheme& SchemeManager::createFromString(const String& source,
     XmlResourceExistsAction resourceExistsAction)
 {
@@ -184,7 +300,7 @@ void SchemeManager::destroyObject(
     d_registeredSchemes.erase(ob);
 
     // fire event signaling an object has been destroyed
-    fireEvent(EventResourceDestroyed, args, EventNamespace);
+    fireEvent(EventResourceDestroyedId, args, EventNamespace);
 }
 
 
@@ -244,11 +360,10 @@ void SchemeManager::createAll(const String& pattern,
     const String& resource_group)
 {
     std::vector<String> names;
-    const size_t num = System::getSingleton().getResourceProvider()->
+    System::getSingleton().getResourceProvider()->
         getResourceGroupFileNames(names, pattern, resource_group);
 
-    for (size_t i = 0; i < num; ++i)
-        createFromFile(names[i], resource_group);
+    createFromFiles(names, resource_group);
 }
 
 const SchemeManager::SchemeRegistry& SchemeManager::getRegisteredSchemes() const
@@ -31,6 +31,9 @@
 #include "CEGUI/DefaultLogger.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/FrameProfiler.h"
+#include "CEGUI/text/GlyphAtlasManager.h"
+#include "CEGUI/text/RenderedTextCache.h"
 #include "CEGUI/WindowFactoryManager.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/SchemeManager.h"
@@ -94,6 +97,9 @@ const IconvStringTranscoder System::d_stringTranscoder;
 const String System::EventDisplaySizeChanged( "DisplaySizeChanged" );
 const String System::EventTextParserChanged("TextParserChanged");
 
+const EventId System::EventDisplaySizeChangedId(EventDisplaySizeChanged);
+const EventId System::EventTextParserChangedId(EventTextParserChanged);
+
 // Holds name of default XMLParser
 String System::d_defaultXMLParserName(STRINGIZE(CEGUI_DEFAULT_XMLPARSER));
 // Holds name of default ImageCodec
@@ -404,6 +410,13 @@ const String& System::getVerboseVersion()
 //----------------------------------------------------------------------------//
 void System::renderAllGUIContexts()
 {
+    // Geometry of the previous frame no longer refers to evicted glyphs
+    GlyphAtlasManager::getSingleton().destroyEvictedImages();
+
+    // Glyphs rasterised in the background become visible at the frame boundary
+    if (FontManager::getSingleton().processPendingGlyphs())
+        invalidateAllCachedRendering();
+
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -417,10 +430,19 @@ void System::renderAllGUIContexts()
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    FrameProfiler::getSingleton().endFrame();
 }
 
 void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 {
+    // Geometry of the previous frame no longer refers to evicted glyphs
+    GlyphAtlasManager::getSingleton().destroyEvictedImages();
+
+    // Glyphs rasterised in the background become visible at the frame boundary
+    if (FontManager::getSingleton().processPendingGlyphs())
+        invalidateAllCachedRendering();
+
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -436,6 +458,8 @@ void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    FrameProfiler::getSingleton().endFrame();
 }
 
 /*************************************************************************
@@ -606,7 +630,7 @@ void System::notifyDisplaySizeChanged(const Sizef& new_size)
 
     // Fire event
     DisplayEventArgs args(new_size);
-    fireEvent(EventDisplaySizeChanged, args, EventNamespace);
+    fireEvent(EventDisplaySizeChangedId, args, EventNamespace);
 
     Logger::getSingleton().logEvent(
         "Display resize:"
@@ -685,7 +709,10 @@ void System::addStandardWindowFactories()
 void System::createSingletons()
 {
     // cause creation of other singleton objects
+    new FrameProfiler();
     new ImageManager();
+    new GlyphAtlasManager();
+    new RenderedTextCache();
     new FontManager();
     new WindowFactoryManager();
     new WindowManager();
@@ -708,9 +735,12 @@ void System::destroySingletons()
     delete AnimationManager::getSingletonPtr();
     delete RenderEffectManager::getSingletonPtr();
     delete FontManager::getSingletonPtr();
+    delete GlyphAtlasManager::getSingletonPtr();
+    delete RenderedTextCache::getSingletonPtr();
     delete ImageManager::getSingletonPtr();
     delete GlobalEventSet::getSingletonPtr();
     delete SVGDataManager::getSingletonPtr();
+    delete FrameProfiler::getSingletonPtr();
 }
 
 //----------------------------------------------------------------------------//
@@ -943,7 +973,7 @@ void System::setDefaultTextParser(TextParser* parser)
     d_defaultTextParser = parser ? parser : d_fallbackTextParser.get();
 
     EventArgs args;
-    fireEvent(EventTextParserChanged, args, EventNamespace);
+    fireEvent(EventTextParserChangedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
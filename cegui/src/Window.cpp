@@ -32,6 +32,7 @@
 #include "CEGUI/Renderer.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/WindowRendererManager.h"
@@ -41,6 +42,7 @@
 #include "CEGUI/Animation.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/falagard/WidgetLookFeel.h"
+#include "CEGUI/falagard/TextComponent.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
@@ -133,6 +135,52 @@ const String Window::EventCharacterKey("CharacterKey");
 const String Window::EventScroll("Scroll");
 const String Window::EventSemanticEvent("SemanticEvent");
 
+const EventId Window::EventUpdatedId(EventUpdated);
+const EventId Window::EventNameChangedId(EventNameChanged);
+const EventId Window::EventTextChangedId(EventTextChanged);
+const EventId Window::EventFontChangedId(EventFontChanged);
+const EventId Window::EventTooltipTypeChangedId(EventTooltipTypeChanged);
+const EventId Window::EventTooltipTextChangedId(EventTooltipTextChanged);
+const EventId Window::EventAlphaChangedId(EventAlphaChanged);
+const EventId Window::EventIDChangedId(EventIDChanged);
+const EventId Window::EventActivatedId(EventActivated);
+const EventId Window::EventDeactivatedId(EventDeactivated);
+const EventId Window::EventShownId(EventShown);
+const EventId Window::EventHiddenId(EventHidden);
+const EventId Window::EventEnabledId(EventEnabled);
+const EventId Window::EventDisabledId(EventDisabled);
+const EventId Window::EventClippedByParentChangedId(EventClippedByParentChanged);
+const EventId Window::EventDestroyedByParentChangedId(EventDestroyedByParentChanged);
+const EventId Window::EventInheritsAlphaChangedId(EventInheritsAlphaChanged);
+const EventId Window::EventAlwaysOnTopChangedId(EventAlwaysOnTopChanged);
+const EventId Window::EventInputCaptureGainedId(EventInputCaptureGained);
+const EventId Window::EventInputCaptureLostId(EventInputCaptureLost);
+const EventId Window::EventInvalidatedId(EventInvalidated);
+const EventId Window::EventRenderingStartedId(EventRenderingStarted);
+const EventId Window::EventRenderingEndedId(EventRenderingEnded);
+const EventId Window::EventDestructionStartedId(EventDestructionStarted);
+const EventId Window::EventDragDropItemEntersId(EventDragDropItemEnters);
+const EventId Window::EventDragDropItemLeavesId(EventDragDropItemLeaves);
+const EventId Window::EventDragDropItemDroppedId(EventDragDropItemDropped);
+const EventId Window::EventWindowRendererAttachedId(EventWindowRendererAttached);
+const EventId Window::EventWindowRendererDetachedId(EventWindowRendererDetached);
+const EventId Window::EventMarginChangedId(EventMarginChanged);
+const EventId Window::EventCursorEntersAreaId(EventCursorEntersArea);
+const EventId Window::EventCursorLeavesAreaId(EventCursorLeavesArea);
+const EventId Window::EventCursorEntersSurfaceId(EventCursorEntersSurface);
+const EventId Window::EventCursorLeavesSurfaceId(EventCursorLeavesSurface);
+const EventId Window::EventCursorMoveId(EventCursorMove);
+const EventId Window::EventMouseButtonDownId(EventMouseButtonDown);
+const EventId Window::EventMouseButtonUpId(EventMouseButtonUp);
+const EventId Window::EventClickId(EventClick);
+const EventId Window::EventDoubleClickId(EventDoubleClick);
+const EventId Window::EventTripleClickId(EventTripleClick);
+const EventId Window::EventKeyDownId(EventKeyDown);
+const EventId Window::EventKeyUpId(EventKeyUp);
+const EventId Window::EventCharacterKeyId(EventCharacterKey);
+const EventId Window::EventScrollId(EventScroll);
+const EventId Window::EventSemanticEventId(EventSemanticEvent);
+
 //----------------------------------------------------------------------------//
 // XML element and attribute names that relate to Window.
 const String Window::WindowXMLElementName("Window");
@@ -304,9 +352,7 @@ void Window::destroy()
     releaseRenderingWindow();
     invalidate();
 
-    for (auto buffer : d_geometryBuffers)
-        System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
-    d_geometryBuffers.clear();
+    System::getSingleton().getRenderer()->destroyGeometryBuffers(d_geometryBuffers);
 }
 
 //----------------------------------------------------------------------------//
@@ -1216,6 +1262,8 @@ void Window::invalidate(bool recursive)
 //----------------------------------------------------------------------------//
 void Window::invalidate_impl(bool recursive)
 {
+    CEGUI_PROFILE_COUNT(WindowInvalidations, 1);
+
     d_needsRedraw = true;
 
     if (auto rs = getTargetRenderingSurface())
@@ -1270,16 +1318,33 @@ void Window::drawSelf(const RenderingContext& ctx, std::uint32_t drawModeMask)
     ctx.surface->addGeometryBuffers(ctx.queue, d_geometryBuffers);
 }
 
+//----------------------------------------------------------------------------//
+TextComponentCache& Window::getTextComponentCache(const TextComponent& component) const
+{
+    auto& cache = d_textComponentCaches[&component];
+    if (!cache)
+        cache = std::make_unique<TextComponentCache>();
+    return *cache;
+}
+
+//----------------------------------------------------------------------------//
+void Window::clearTextComponentCaches()
+{
+    d_textComponentCaches.clear();
+}
+
 //----------------------------------------------------------------------------//
 void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMask*/)
 {
     if (!d_needsRedraw)
         return;
 
-    // dispose of already cached geometry.
-    for (auto buffer : d_geometryBuffers)
-        System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
-    d_geometryBuffers.clear();
+    CEGUI_PROFILE_SCOPE_DETAIL("Window::bufferGeometry", getType());
+    CEGUI_PROFILE_COUNT(WindowRedraws, 1);
+
+    // return already cached geometry to the pool, the buffers will be handed
+    // back to us in the same order when the geometry is re-created below.
+    System::getSingleton().getRenderer()->destroyGeometryBuffers(d_geometryBuffers);
 
     // signal rendering started
     WindowEventArgs args(this);
@@ -1287,9 +1352,14 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMas
 
     // re-populate geometry buffers
     if (d_windowRenderer)
+    {
+        CEGUI_PROFILE_SCOPE_DETAIL("WindowRenderer::createRenderGeometry", d_windowRenderer->getName());
         d_windowRenderer->createRenderGeometry();
+    }
     else
+    {
         populateGeometryBuffer();
+    }
 
     // NB: it is important to do this after rendering to buffers but before setting them up
     d_needsRedraw = false;
@@ -1429,6 +1499,8 @@ void Window::setDestroyedByParent(bool setting)
 //----------------------------------------------------------------------------//
 void Window::update(float elapsed)
 {
+    CEGUI_PROFILE_SCOPE_DETAIL("Window::update", getType());
+
     // perform update for 'this' Window
     updateSelf(elapsed);
 
@@ -1437,7 +1509,7 @@ void Window::update(float elapsed)
         static_cast<RenderingWindow*>(d_surface)->update(elapsed);
 
     UpdateEventArgs e(this,elapsed);
-    fireEvent(EventUpdated,e,EventNamespace);
+    fireEvent(EventUpdatedId,e,EventNamespace);
 
     // update child windows
     for (size_t i = 0; i < getChildCount(); ++i)
@@ -1557,9 +1629,14 @@ void Window::setLookNFeel(const String& look)
         prevLnf.cleanUpWidget(*this);
     }
 
+    // Entries are keyed by components of the previous look
+    d_textComponentCaches.clear();
+
     d_lookName = look;
-    Logger::getSingleton().logEvent("Assigning LookNFeel '" + look +
-        "' to window '" + d_name + "'.", LoggingLevel::Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingEnabled(LoggingLevel::Informative))
+        logger.logEvent("Assigning LookNFeel '" + look +
+            "' to window '" + d_name + "'.", LoggingLevel::Informative);
 
     // Get look and feel to initialise the widget as it needs.
     // Set init flag to prevent premature child layouting by LNF.
@@ -1591,8 +1668,10 @@ void Window::setName(const String& name)
     }
 
     // log this under informative level
-    Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
-        " as: " + name, LoggingLevel::Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingEnabled(LoggingLevel::Informative))
+        logger.logEvent("Renamed element at: " + getNamePath() +
+            " as: " + name, LoggingLevel::Informative);
 
     d_name = name;
 
@@ -1640,6 +1719,12 @@ void Window::setUserString(const String& name, const String& value)
     d_userStrings[name] = value;
 }
 
+//----------------------------------------------------------------------------//
+void Window::clearUserStrings()
+{
+    d_userStrings.clear();
+}
+
 //----------------------------------------------------------------------------//
 void Window::writeXMLToStream(XMLSerializer& xml_stream) const
 {
@@ -1831,7 +1916,7 @@ void Window::removeWindowFromDrawList(const Window& wnd)
 //----------------------------------------------------------------------------//
 void Window::onNameChanged(WindowEventArgs& e)
 {
-    fireEvent(EventNameChanged, e, EventNamespace);
+    fireEvent(EventNameChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1839,7 +1924,7 @@ void Window::onTextChanged(WindowEventArgs& e)
 {
     // TODO: invalidate only widgets that really render text?! Falagard and Window subclasses.
     invalidate();
-    fireEvent(EventTextChanged, e, EventNamespace);
+    fireEvent(EventTextChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1852,13 +1937,13 @@ void Window::onFontChanged(WindowEventArgs& e)
         performChildLayout(false, false);
 
     invalidate();
-    fireEvent(EventFontChanged, e, EventNamespace);
+    fireEvent(EventFontChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onTooltipTypeChanged(WindowEventArgs& e)
 {
-    fireEvent(EventTooltipTypeChanged, e, EventNamespace);
+    fireEvent(EventTooltipTypeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1876,7 +1961,7 @@ void Window::onTooltipTextChanged(WindowEventArgs& e)
         }
     }
 
-    fireEvent(EventTooltipTextChanged, e, EventNamespace);
+    fireEvent(EventTooltipTextChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1900,20 +1985,20 @@ void Window::onAlphaChanged(WindowEventArgs& e)
     if (d_guiContext)
         d_guiContext->markAsDirty();
 
-    fireEvent(EventAlphaChanged, e, EventNamespace);
+    fireEvent(EventAlphaChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onIDChanged(WindowEventArgs& e)
 {
-    fireEvent(EventIDChanged, e, EventNamespace);
+    fireEvent(EventIDChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onShown(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventShown, e, EventNamespace);
+    fireEvent(EventShownId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1922,7 +2007,7 @@ void Window::onHidden(WindowEventArgs& e)
     releaseInput();
     deactivate();
     invalidate();
-    fireEvent(EventHidden, e, EventNamespace);
+    fireEvent(EventHiddenId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1941,7 +2026,7 @@ void Window::onEnabled(WindowEventArgs& e)
     }
 
     invalidate();
-    fireEvent(EventEnabled, e, EventNamespace);
+    fireEvent(EventEnabledId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1962,7 +2047,7 @@ void Window::onDisabled(WindowEventArgs& e)
     if (isFocused() && !canFocus())
         deactivate();
     invalidate();
-    fireEvent(EventDisabled, e, EventNamespace);
+    fireEvent(EventDisabledId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1970,20 +2055,20 @@ void Window::onClippingChanged(WindowEventArgs& e)
 {
     invalidate();
     notifyClippingChanged();
-    fireEvent(EventClippedByParentChanged, e, EventNamespace);
+    fireEvent(EventClippedByParentChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onParentDestroyChanged(WindowEventArgs& e)
 {
-    fireEvent(EventDestroyedByParentChanged, e, EventNamespace);
+    fireEvent(EventDestroyedByParentChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onInheritsAlphaChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventInheritsAlphaChanged, e, EventNamespace);
+    fireEvent(EventInheritsAlphaChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1993,37 +2078,37 @@ void Window::onAlwaysOnTopChanged(WindowEventArgs& e)
     // to resubmit it's imagery to the Renderer.
     if (d_guiContext)
         d_guiContext->markAsDirty();
-    fireEvent(EventAlwaysOnTopChanged, e, EventNamespace);
+    fireEvent(EventAlwaysOnTopChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCaptureGained(WindowEventArgs& e)
 {
-    fireEvent(EventInputCaptureGained, e, EventNamespace);
+    fireEvent(EventInputCaptureGainedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCaptureLost(WindowEventArgs& e)
 {
-    fireEvent(EventInputCaptureLost, e, EventNamespace);
+    fireEvent(EventInputCaptureLostId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onInvalidated(WindowEventArgs& e)
 {
-    fireEvent(EventInvalidated, e, EventNamespace);
+    fireEvent(EventInvalidatedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onRenderingStarted(WindowEventArgs& e)
 {
-    fireEvent(EventRenderingStarted, e, EventNamespace);
+    fireEvent(EventRenderingStartedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onRenderingEnded(WindowEventArgs& e)
 {
-    fireEvent(EventRenderingEnded, e, EventNamespace);
+    fireEvent(EventRenderingEndedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2033,28 +2118,28 @@ void Window::onZChanged(WindowEventArgs& e)
     // to resubmit it's imagery to the Renderer.
     if (d_guiContext)
         d_guiContext->markAsDirty();
-    fireEvent(EventZOrderChanged, e, EventNamespace);
+    fireEvent(EventZOrderChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDestructionStarted(WindowEventArgs& e)
 {
     d_destructionStarted = true;
-    fireEvent(EventDestructionStarted, e, EventNamespace);
+    fireEvent(EventDestructionStartedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onActivated(ActivationEventArgs& e)
 {
     invalidate();
-    fireEvent(EventActivated, e, EventNamespace);
+    fireEvent(EventActivatedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDeactivated(ActivationEventArgs& e)
 {
     invalidate();
-    fireEvent(EventDeactivated, e, EventNamespace);
+    fireEvent(EventDeactivatedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2086,104 +2171,104 @@ void Window::onChildRemoved(ElementEventArgs& e)
 void Window::onCursorEntersArea(CursorInputEventArgs& e)
 {
     d_containsPointer = true;
-    fireEvent(EventCursorEntersArea, e, EventNamespace);
+    fireEvent(EventCursorEntersAreaId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCursorLeavesArea(CursorInputEventArgs& e)
 {
     d_containsPointer = false;
-    fireEvent(EventCursorLeavesArea, e, EventNamespace);
+    fireEvent(EventCursorLeavesAreaId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCursorEnters(CursorInputEventArgs& e)
 {
-    fireEvent(EventCursorEntersSurface, e, EventNamespace);
+    fireEvent(EventCursorEntersSurfaceId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCursorLeaves(CursorInputEventArgs& e)
 {
-    fireEvent(EventCursorLeavesSurface, e, EventNamespace);
+    fireEvent(EventCursorLeavesSurfaceId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCursorMove(CursorMoveEventArgs& e)
 {
-    fireEvent(EventCursorMove, e, EventNamespace);
+    fireEvent(EventCursorMoveId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onMouseButtonDown(MouseButtonEventArgs& e)
 {
-    fireEvent(EventMouseButtonDown, e, EventNamespace);
+    fireEvent(EventMouseButtonDownId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onMouseButtonUp(MouseButtonEventArgs& e)
 {
-    fireEvent(EventMouseButtonUp, e, EventNamespace);
+    fireEvent(EventMouseButtonUpId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onClick(MouseButtonEventArgs& e)
 {
-    fireEvent(EventClick, e, EventNamespace);
+    fireEvent(EventClickId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDoubleClick(MouseButtonEventArgs& e)
 {
-    fireEvent(EventDoubleClick, e, EventNamespace);
+    fireEvent(EventDoubleClickId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onTripleClick(MouseButtonEventArgs& e)
 {
-    fireEvent(EventTripleClick, e, EventNamespace);
+    fireEvent(EventTripleClickId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onScroll(ScrollEventArgs& e)
 {
-    fireEvent(EventScroll, e, EventNamespace);
+    fireEvent(EventScrollId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onKeyDown(KeyEventArgs& e)
 {
-    fireEvent(EventKeyDown, e, EventNamespace);
+    fireEvent(EventKeyDownId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onKeyUp(KeyEventArgs& e)
 {
-    fireEvent(EventKeyUp, e, EventNamespace);
+    fireEvent(EventKeyUpId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCharacter(TextEventArgs& e)
 {
-    fireEvent(EventCharacterKey, e, EventNamespace);
+    fireEvent(EventCharacterKeyId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDragDropItemEnters(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropItemEnters, e, EventNamespace);
+    fireEvent(EventDragDropItemEntersId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDragDropItemLeaves(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropItemLeaves, e, EventNamespace);
+    fireEvent(EventDragDropItemLeavesId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDragDropItemDropped(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropItemDropped, e, EventNamespace);
+    fireEvent(EventDragDropItemDroppedId, e, EventNamespace);
 
     // FIXME: this hack ensures that dragging can be cancelled by dropping on
     // the target that doesn't have a drop handler. Otherwise it could be tricky
@@ -2215,8 +2300,10 @@ void Window::setWindowRenderer(const String& name)
             "Attempt to assign a 'null' window renderer to window '" +
             d_name + "'.");
 
-    Logger::getSingleton().logEvent("Assigning the window renderer '" +
-        name + "' to the window '" + d_name + "'", LoggingLevel::Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingEnabled(LoggingLevel::Informative))
+        logger.logEvent("Assigning the window renderer '" +
+            name + "' to the window '" + d_name + "'", LoggingLevel::Informative);
 
     d_windowRenderer = wrm.createWindowRenderer(name);
     WindowEventArgs e(this);
@@ -2233,7 +2320,7 @@ void Window::onWindowRendererAttached(WindowEventArgs& e)
 
     d_windowRenderer->d_window = this;
     d_windowRenderer->onAttach();
-    fireEvent(EventWindowRendererAttached, e, EventNamespace);
+    fireEvent(EventWindowRendererAttachedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2241,7 +2328,7 @@ void Window::onWindowRendererDetached(WindowEventArgs& e)
 {
     d_windowRenderer->onDetach();
     d_windowRenderer->d_window = nullptr;
-    fireEvent(EventWindowRendererDetached, e, EventNamespace);
+    fireEvent(EventWindowRendererDetachedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2886,7 +2973,7 @@ void Window::setMargin(const UBox& margin)
 //----------------------------------------------------------------------------//
 void Window::onMarginChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMarginChanged, e, EventNamespace);
+    fireEvent(EventMarginChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -2912,26 +2999,30 @@ void Window::clonePropertiesTo(Window& target) const
          !propertyIt.isAtEnd();
          ++propertyIt)
     {
+        Property* const property = propertyIt.getCurrentValue();
+
         // we never copy stuff that doesn't get written into XML
-        if (isPropertyBannedFromXML(propertyIt.getCurrentValue()))
+        if (isPropertyBannedFromXML(property))
             continue;
 
-        // some cases when propertyValue is "" could lead to exception throws
-        const String propertyValue = propertyIt.getCurrentValue()->get(this);
-        if (propertyValue.empty())
+        const String& propertyName = propertyIt.getCurrentKey();
+        if (property == &d_lookNFeelProperty || property == &d_windowRendererProperty)
         {
-            // special case, this causes exception throw when no window renderer
-            // is assigned to the window
-            if (propertyIt.getCurrentKey() == "LookNFeel")
-                continue;
-
-            // special case, this causes exception throw because we are setting
-            // 'null' window renderer
-            if (propertyIt.getCurrentKey() == "WindowRenderer")
-                continue;
+            // special case, an empty value causes exception throws because
+            // we'd be setting a 'null' window renderer or look
+            const String propertyValue = property->get(this);
+            if (!propertyValue.empty())
+                target.setProperty(propertyName, propertyValue);
+
+            continue;
         }
 
-        target.setProperty(propertyIt.getCurrentKey(), propertyValue);
+        // copy the native value when the target shares the Property, e.g.
+        // when it is of the same type, this avoids the string round trip
+        if (target.getPropertyInstance(propertyName) == property)
+            property->copyValue(this, &target);
+        else
+            target.setProperty(propertyName, property->get(this));
     }
 }
 
@@ -3209,6 +3300,14 @@ bool Window::contentFits() const
     return Element::contentFits();
 }
 
+//----------------------------------------------------------------------------//
+bool Window::measureContent(float content_area_width, Sizef& content_size, bool& content_intact) const
+{
+    if (d_windowRenderer)
+        return d_windowRenderer->measureContent(content_area_width, content_size, content_intact);
+    return Element::measureContent(content_area_width, content_size, content_intact);
+}
+
 //----------------------------------------------------------------------------//
 void Window::setAutoWindow(bool is_auto)
 {
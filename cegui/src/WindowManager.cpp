@@ -32,11 +32,15 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/GUILayout_xmlHandler.h"
+#include "CEGUI/GUILayout_binaryHandler.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/RenderEffectManager.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/AnimationManager.h"
 #include <fstream>
 #include <algorithm>
 
@@ -60,6 +64,9 @@ const String WindowManager::GeneratedWindowNameBase("__cewin_uid_");
 const String WindowManager::EventNamespace("WindowManager");
 const String WindowManager::EventWindowCreated("WindowCreated");
 const String WindowManager::EventWindowDestroyed("WindowDestroyed");
+
+const EventId WindowManager::EventWindowCreatedId(EventWindowCreated);
+const EventId WindowManager::EventWindowDestroyedId(EventWindowDestroyed);
     
 
 /*************************************************************************
@@ -103,14 +110,69 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
     String finalName(name.empty() ? generateUniqueWindowName() : name);
 
+    Window* newWindow = nullptr;
+
+    // reuse a destroyed window of this type if there is one
+    if (!d_recyclePools.empty())
+    {
+        auto poolIt = d_recyclePools.find(type);
+        if (poolIt != d_recyclePools.end() && !poolIt->second.d_windows.empty())
+        {
+            RecyclePool& pool = poolIt->second;
+            newWindow = pool.d_windows.back();
+            pool.d_windows.pop_back();
+
+            // reset everything to the state of a fresh window of the type
+            resetRecycledWindow(*newWindow, *pool.d_prototype);
+            newWindow->setName(finalName);
+
+            Logger& logger(Logger::getSingleton());
+            if (logger.isLoggingEnabled(LoggingLevel::Informative))
+            {
+                String addressStr = SharedStringstream::GetPointerAddressAsString(newWindow);
+                logger.logEvent("Window '" + finalName +"' of type '" +
+                    type + "' has been reused. " + addressStr, LoggingLevel::Informative);
+            }
+        }
+    }
+
+    if (!newWindow)
+    {
+        newWindow = createUnregisteredWindow(type, finalName);
+
+        // remember the subscriptions of a fresh window, a recycled window
+        // drops all that were made later
+        if (d_recyclePools.find(type) != d_recyclePools.end())
+            collectConnections(*newWindow, String(), d_creationConnections[newWindow]);
+    }
+
+    // the address may still be registered for a window that was deleted
+    // without going through destroyWindow, the new window takes its slot
+    if (d_windowIndex.emplace(newWindow, d_windowRegistry.size()).second)
+        d_windowRegistry.push_back(newWindow);
+
+    // fire event to notify interested parites about the new window.
+    WindowEventArgs args(newWindow);
+    fireEvent(EventWindowCreatedId, args, EventNamespace);
+    
+	return newWindow;
+}
+
+//---------------------------------------------------------------------------//
+Window* WindowManager::createUnregisteredWindow(const String& type, const String& name)
+{
     WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
     WindowFactory* factory = wfMgr.getFactory(type);
 
-    Window* newWindow = factory->createWindow(finalName);
+    Window* newWindow = factory->createWindow(name);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(newWindow);
-    Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
-        type + "' has been created. " + addressStr, LoggingLevel::Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingEnabled(LoggingLevel::Informative))
+    {
+        String addressStr = SharedStringstream::GetPointerAddressAsString(newWindow);
+        logger.logEvent("Window '" + name +"' of type '" +
+            type + "' has been created. " + addressStr, LoggingLevel::Informative);
+    }
 
     // see if we need to assign a look to this window
     if (wfMgr.isFalagardMappedType(type))
@@ -125,13 +187,7 @@ Window* WindowManager::createWindow(const String& type, const String& name)
         initialiseRenderEffect(newWindow, fwm.d_effectName);
     }
 
-	d_windowRegistry.push_back(newWindow);
-
-    // fire event to notify interested parites about the new window.
-    WindowEventArgs args(newWindow);
-    fireEvent(EventWindowCreated, args, EventNamespace);
-    
-	return newWindow;
+    return newWindow;
 }
 
 //---------------------------------------------------------------------------//
@@ -188,15 +244,9 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
-	WindowVector::iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
-
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&window);
-
-	if (iter == d_windowRegistry.end())
+	if (!unregisterWindow(window))
     {
+        String addressStr = SharedStringstream::GetPointerAddressAsString(window);
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
             "Window that does not exist!  Address was: " + addressStr +
             ". WARNING: This could indicate a double-deletion issue!!",
@@ -204,21 +254,30 @@ void WindowManager::destroyWindow(Window* window)
         return;
     }
 
-    d_windowRegistry.erase(iter);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingEnabled(LoggingLevel::Informative))
+    {
+        String addressStr = SharedStringstream::GetPointerAddressAsString(window);
+        logger.logEvent("Window at '" + window->getNamePath() +
+            "' will be added to dead pool. " + addressStr, LoggingLevel::Informative);
+    }
 
-    Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
-        "' will be added to dead pool. " + addressStr, LoggingLevel::Informative);
+    // keep the window for reuse if its type has a recycle pool with room
+    if (!recycleWindow(window))
+    {
+        d_creationConnections.erase(window);
 
-    // do 'safe' part of cleanup
-    window->destroy();
+        // do 'safe' part of cleanup
+        window->destroy();
 
-    // add window to dead pool
-    d_deathrow.push_back(window);
+        // add window to dead pool
+        d_deathrow.push_back(window);
+    }
 
     // fire event to notify interested parites about window destruction.
     // TODO: Perhaps this should fire first, so window is still usable?
     WindowEventArgs args(window);
-    fireEvent(EventWindowDestroyed, args, EventNamespace);
+    fireEvent(EventWindowDestroyedId, args, EventNamespace);
 }
 
 
@@ -227,19 +286,224 @@ void WindowManager::destroyWindow(Window* window)
 *************************************************************************/
 void WindowManager::destroyAllWindows(void)
 {
+	// pooled windows go first, their auto windows are still registered
+	for (auto& pool : d_recyclePools)
+		destroyRecycledWindows(pool.first);
+
+	// destroy the top level windows first, they take their children along,
+	// so no auto window is destroyed while its parent is still alive
+	WindowVector roots;
+	for (Window* window : d_windowRegistry)
+		if (!window->getParent())
+			roots.push_back(window);
+
+	for (Window* window : roots)
+		if (isAlive(window))
+			destroyWindow(window);
+
+	// left are windows which parents don't destroy or which have parents
+	// that weren't created by the WindowManager
 	while (!d_windowRegistry.empty())
-		destroyWindow(*d_windowRegistry.begin());
+		destroyWindow(d_windowRegistry.back());
 }
 
 //----------------------------------------------------------------------------//
-bool WindowManager::isAlive(const Window* window) const
+bool WindowManager::unregisterWindow(const Window* window)
+{
+    const auto indexIt = d_windowIndex.find(window);
+    if (indexIt == d_windowIndex.end())
+        return false;
+
+    // move the last window into the slot of the removed one
+    const size_t index = indexIt->second;
+    d_windowIndex.erase(indexIt);
+    if (index + 1 != d_windowRegistry.size())
+    {
+        d_windowRegistry[index] = d_windowRegistry.back();
+        d_windowIndex[d_windowRegistry[index]] = index;
+    }
+    d_windowRegistry.pop_back();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+static void destroyNonAutoChildren(Window& window)
+{
+    size_t i = 0;
+    while (i < window.getChildCount())
+    {
+        Window* child = window.getChildAtIndex(i);
+        if (child->isAutoWindow())
+        {
+            destroyNonAutoChildren(*child);
+            ++i;
+            continue;
+        }
+
+        window.removeChild(child);
+        if (child->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+static bool isCreationConnection(const Event::Connection& connection,
+                                 const std::vector<Event::Connection>& creationConnections)
+{
+    return std::find(creationConnections.begin(), creationConnections.end(),
+                     connection) != creationConnections.end();
+}
+
+//----------------------------------------------------------------------------//
+bool WindowManager::recycleWindow(Window* window)
+{
+    if (d_recyclePools.empty() || window->isAutoWindow())
+        return false;
+
+    auto poolIt = d_recyclePools.find(window->getType());
+    if (poolIt == d_recyclePools.end() ||
+        poolIt->second.d_windows.size() >= poolIt->second.d_maxSize)
+        return false;
+
+    // the root of a GUIContext is destroyed as usual
+    if (!window->getParent() && window->getGUIContextPtr())
+        return false;
+
+    // windows created before the pool existed have no known subscriptions
+    auto creationIt = d_creationConnections.find(window);
+    if (creationIt == d_creationConnections.end())
+        return false;
+    const std::vector<Event::Connection>& creationConnections = creationIt->second;
+
+    // EventDestructionStarted is final, so a window whose destruction is
+    // awaited by someone must really be destroyed
+    std::vector<Event::Connection> connections;
+    collectConnections(*window, Window::EventDestructionStarted, connections);
+    for (const auto& connection : connections)
+        if (!isCreationConnection(connection, creationConnections))
+            return false;
+
+    RecyclePool& pool = poolIt->second;
+    if (!pool.d_prototype)
+        pool.d_prototype = createUnregisteredWindow(window->getType(), generateUniqueWindowName());
+
+    if (Window* parent = window->getParent())
+        parent->removeChild(window);
+
+    AnimationManager::getSingleton().destroyAnimationInstances(window);
+    destroyNonAutoChildren(*window);
+
+    // the next owner must not be called by subscribers of the previous one
+    connections.clear();
+    collectConnections(*window, String(), connections);
+    for (const auto& connection : connections)
+        if (!isCreationConnection(connection, creationConnections))
+            connection->disconnect();
+
+    pool.d_windows.push_back(window);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::collectConnections(const Window& window, const String& eventName,
+                                       std::vector<Event::Connection>& connections)
+{
+    for (auto it = window.getEventIterator(); !it.isAtEnd(); ++it)
+        if (eventName.empty() || it.getCurrentKey() == eventName)
+            it.getCurrentValue()->getConnections(connections);
+
+    for (size_t i = 0; i < window.getChildCount(); ++i)
+    {
+        const Window* child = window.getChildAtIndex(i);
+        if (child->isAutoWindow())
+            collectConnections(*child, eventName, connections);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::resetRecycledWindow(Window& window, const Window& prototype)
 {
-	WindowVector::const_iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
+    window.clearUserStrings();
+    prototype.clonePropertiesTo(window);
+    window.setUserData(nullptr);
 
-	return iter != d_windowRegistry.end();
+    // the auto windows have the same names as the ones of the prototype
+    for (size_t i = 0; i < prototype.getChildCount(); ++i)
+    {
+        const Window* prototypeChild = prototype.getChildAtIndex(i);
+        if (!prototypeChild->isAutoWindow())
+            continue;
+
+        if (Window* child = window.findChild(prototypeChild->getName()))
+            resetRecycledWindow(*child, *prototypeChild);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::destroyRecycledWindows(const String& type)
+{
+    auto poolIt = d_recyclePools.find(type);
+    if (poolIt == d_recyclePools.end())
+        return;
+
+    RecyclePool& pool = poolIt->second;
+    if (pool.d_prototype)
+        pool.d_windows.push_back(pool.d_prototype);
+    pool.d_prototype = nullptr;
+
+    // the windows are not registered anymore, so this really destroys them
+    while (!pool.d_windows.empty())
+    {
+        Window* window = pool.d_windows.back();
+        pool.d_windows.pop_back();
+        d_creationConnections.erase(window);
+        window->destroy();
+        d_deathrow.push_back(window);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::setRecyclePoolSize(const String& type, size_t size)
+{
+    if (!size)
+    {
+        destroyRecycledWindows(type);
+        d_recyclePools.erase(type);
+        return;
+    }
+
+    RecyclePool& pool = d_recyclePools[type];
+    pool.d_maxSize = size;
+
+    while (pool.d_windows.size() > size)
+    {
+        Window* window = pool.d_windows.back();
+        pool.d_windows.pop_back();
+        d_creationConnections.erase(window);
+        window->destroy();
+        d_deathrow.push_back(window);
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getRecyclePoolSize(const String& type) const
+{
+    auto poolIt = d_recyclePools.find(type);
+    return poolIt != d_recyclePools.end() ? poolIt->second.d_maxSize : 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getRecycledWindowCount(const String& type) const
+{
+    auto poolIt = d_recyclePools.find(type);
+    return poolIt != d_recyclePools.end() ? poolIt->second.d_windows.size() : 0;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowManager::isAlive(const Window* window) const
+{
+	return d_windowIndex.find(window) != d_windowIndex.end();
 }
 
 Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
@@ -324,6 +588,64 @@ Window* WindowManager::loadLayoutFromString(const String& source, PropertyCallba
     return handler.getLayoutRootWindow();
 }
 
+//----------------------------------------------------------------------------//
+Window* WindowManager::loadLayoutFromBinary(const String& filename, const String& resourceGroup, PropertyCallback* callback, void* userdata)
+{
+    if (filename.empty())
+    {
+        throw InvalidRequestException(
+            "Filename supplied for binary gui-layout loading must be valid.");
+    }
+
+    Logger::getSingleton().logEvent("---- Beginning loading of binary GUI layout from '" + filename + "' ----", LoggingLevel::Informative);
+
+    ResourceProvider* resourceProvider = System::getSingleton().getResourceProvider();
+    RawDataContainer source;
+    resourceProvider->loadRawDataContainer(filename, source,
+        resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup);
+
+    Window* root;
+    try
+    {
+        GUILayout_binaryHandler handler(callback, userdata);
+        root = handler.load(source);
+    }
+    catch (...)
+    {
+        resourceProvider->unloadRawDataContainer(source);
+        Logger::getSingleton().logEvent("WindowManager::loadLayoutFromBinary - loading of binary layout from file '" + filename +"' failed.", LoggingLevel::Error);
+        throw;
+    }
+
+    resourceProvider->unloadRawDataContainer(source);
+
+    Logger::getSingleton().logEvent("---- Successfully completed loading of binary GUI layout from '" + filename + "' ----", LoggingLevel::Standard);
+
+    return root;
+}
+
+//----------------------------------------------------------------------------//
+Window* WindowManager::loadLayoutFromBinaryContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
+{
+    Logger::getSingleton().logEvent("---- Beginning loading of binary GUI layout from a RawDataContainer ----", LoggingLevel::Informative);
+
+    Window* root;
+    try
+    {
+        GUILayout_binaryHandler handler(callback, userdata);
+        root = handler.load(source);
+    }
+    catch (...)
+    {
+        Logger::getSingleton().logEvent("WindowManager::loadLayoutFromBinaryContainer - loading of binary layout from a RawDataContainer failed.", LoggingLevel::Error);
+        throw;
+    }
+
+    Logger::getSingleton().logEvent("---- Successfully completed loading of binary GUI layout from a RawDataContainer ----", LoggingLevel::Standard);
+
+    return root;
+}
+
 bool WindowManager::isDeadPoolEmpty(void) const
 {
     return d_deathrow.empty();
@@ -384,6 +706,35 @@ void WindowManager::saveLayoutToFile(const Window& window,
     writeLayoutToStream(window, stream);
 }
 
+//----------------------------------------------------------------------------//
+void WindowManager::compileLayoutFromFile(const String& filename,
+                                          OutStream& out_stream,
+                                          const String& resourceGroup) const
+{
+    if (filename.empty())
+    {
+        throw InvalidRequestException(
+            "Filename supplied for gui-layout compiling must be valid.");
+    }
+
+    try
+    {
+        GUILayout_binaryHandler::compileFile(filename,
+            resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup, out_stream);
+    }
+    catch (...)
+    {
+        Logger::getSingleton().logEvent("WindowManager::compileLayoutFromFile - compiling of layout from file '" + filename +"' failed.", LoggingLevel::Error);
+        throw;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::writeBinaryLayoutToStream(const Window& window, OutStream& out_stream) const
+{
+    GUILayout_binaryHandler::compileString(getLayoutAsString(window), out_stream);
+}
+
 String WindowManager::generateUniqueWindowName()
 {
     const String ret = GeneratedWindowNameBase +
@@ -175,6 +175,13 @@ bool WindowRenderer::contentFits() const
     throw InvalidRequestException("This function isn't implemented for this type of window renderer.");
 }
 
+//----------------------------------------------------------------------------//
+bool WindowRenderer::measureContent(float /*content_area_width*/, Sizef& /*content_size*/,
+                                    bool& /*content_intact*/) const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of CEGUI namespace
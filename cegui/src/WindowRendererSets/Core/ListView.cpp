@@ -68,12 +68,23 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
 {
     Rectf items_area(getViewRenderArea());
     glm::vec2 item_pos(getItemRenderStartPosition(list_view, items_area));
+    item_pos.y += list_view->getItemsOffset();
 
     for (size_t i = 0; i < list_view->getItems().size(); ++i)
     {
         ListViewItemRenderingState* item = list_view->getItems().at(i);
         Sizef size(item->d_size);
 
+        // items are in display order: skip those scrolled above the view and
+        // stop at the first one below it.
+        if (item_pos.y > items_area.bottom())
+            break;
+        if (item_pos.y + size.d_height < items_area.top())
+        {
+            item_pos.y += size.d_height;
+            continue;
+        }
+
         size.d_width = std::max(items_area.getWidth(), size.d_width);
 
         Rectf item_rect;
@@ -101,8 +101,11 @@ namespace CEGUI
         // calculate position of area we have to render into
         Rectf itemsArea(getListRenderArea());
 
-        // set up initial positional details for items
-        itemPos.y = itemsArea.top() - vertScrollbar->getScrollPosition();
+        // set up initial positional details for items, starting at the
+        // first row that is in view
+        const float scrollPos = vertScrollbar->getScrollPosition();
+        const unsigned int firstRow = w->getRowAtOffset(scrollPos);
+        itemPos.y = itemsArea.top() - scrollPos + w->getRowOffset(firstRow);
         itemPos.z = 0.0f;
 
         const float alpha = w->getEffectiveAlpha();
@@ -112,8 +115,8 @@ namespace CEGUI
             w->isActive() ? ActiveSelectionColourPropertyName : InactiveSelectionColourPropertyName,
             ListboxItem::DefaultSelectionColour);
 
-        // loop through the items
-        for (unsigned int i = 0; i < w->getRowCount(); ++i)
+        // loop through the items, until a row is below the view
+        for (unsigned int i = firstRow; i < w->getRowCount() && itemPos.y < itemsArea.bottom(); ++i)
         {
             // set initial x position for this row.
             itemPos.x = itemsArea.left() - horzScrollbar->getScrollPosition();
@@ -222,7 +222,8 @@ void FalagardStaticText::adjustSizeToContent()
     getVertScrollbarWithoutUpdate()->hide();
     if (d_wordWrap)
     {
-        const Sizef& contentMaxSize = d_renderedText.getExtents();
+        updateMeasuredText();
+        const Sizef contentMaxSize = d_unwrappedTextExtent;
         USize sizeFunc(
             d_window->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent(),
             d_window->getElementHeightLowerBoundAsFuncOfHeightOfAreaReservedForContent());
@@ -258,7 +259,16 @@ bool FalagardStaticText::isSizeAdjustedToContentKeepingAspectRatio() const
 //----------------------------------------------------------------------------//
 bool FalagardStaticText::contentFitsForSpecifiedWindowSize(const Sizef& window_size) const
 {
-    return d_window->contentFitsForSpecifiedElementSize_tryByResizing(window_size);
+    const Sizef areaSize(getTextComponentAreaForScrollbars(false, false).getPixelRect(
+        *d_window, Rectf(glm::vec2(0.f, 0.f), window_size)).getSize());
+
+    Sizef contentSize;
+    bool intact;
+    measureContent(areaSize.d_width, contentSize, intact);
+
+    return intact &&
+        contentSize.d_width <= areaSize.d_width &&
+        contentSize.d_height <= areaSize.d_height;
 }
 
 //----------------------------------------------------------------------------//
@@ -271,15 +281,45 @@ bool FalagardStaticText::contentFits() const
         return false;
 
     const Rectf area(getTextRenderArea());
-    return !d_renderedText.isFittingIntoAreaWidth() &&
+    return d_renderedText.isFittingIntoAreaWidth() &&
       contentSize.d_width <= area.getWidth() &&
       contentSize.d_height <= area.getHeight();
 }
 
+//------------------------------------------------------------------------//
+bool FalagardStaticText::measureContent(float content_area_width, Sizef& content_size,
+                                        bool& content_intact) const
+{
+    updateMeasuredText();
+    d_measuredText.updateFormatting(std::max(0.f, content_area_width));
+    content_size = d_measuredText.getExtents();
+    content_intact = d_measuredText.isFittingIntoAreaWidth();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void FalagardStaticText::updateMeasuredText() const
+{
+    if (d_measuredTextValid)
+        return;
+
+    updateFormatting();
+    d_measuredText = d_renderedText.clone();
+
+    // Lines are only broken at explicit line breaks without word wrapping
+    d_measuredText.setWordWrapEnabled(false);
+    d_measuredText.updateFormatting(0.f);
+    d_unwrappedTextExtent = d_measuredText.getExtents();
+    d_measuredText.setWordWrapEnabled(d_wordWrap);
+
+    d_measuredTextValid = true;
+}
+
 //------------------------------------------------------------------------//
 void FalagardStaticText::invalidateFormatting()
 {
     d_formatValid = false;
+    d_measuredTextValid = false;
     d_window->invalidate();
 }
 
@@ -682,9 +722,13 @@ Rectf FalagardStaticText::getTextRenderAreaWithoutUpdate() const
 //----------------------------------------------------------------------------//
 const ComponentArea& FalagardStaticText::getTextComponentAreaWithoutUpdate() const
 {
-    const bool v_visible = getVertScrollbarWithoutUpdate()->isVisible();
-    const bool h_visible = getHorzScrollbarWithoutUpdate()->isVisible();
+    return getTextComponentAreaForScrollbars(getVertScrollbarWithoutUpdate()->isVisible(),
+                                             getHorzScrollbarWithoutUpdate()->isVisible());
+}
 
+//----------------------------------------------------------------------------//
+const ComponentArea& FalagardStaticText::getTextComponentAreaForScrollbars(bool v_visible, bool h_visible) const
+{
     // get WidgetLookFeel for the assigned look.
     const WidgetLookFeel& wlf = getLookNFeel();
 
@@ -742,7 +786,7 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(
     UDim height_sequence(sizeFunc.d_height.d_scale*getVerticalAdvance() + sizeFunc.d_height.d_offset,
                          sizeFunc.d_height.d_scale*(getLineHeight()+epsilon) + sizeFunc.d_height.d_offset);
     float max_num_of_lines(std::max(
-      static_cast<float>(d_renderedText.getParagraphCount() - 1),
+      static_cast<float>(std::max<size_t>(d_renderedText.getParagraphCount(), 1) - 1),
       (windowMaxWidth / d_window->getAspectRatio() - height_sequence_precise.d_offset)
         / height_sequence_precise.d_scale));
     window_size = d_window->getSizeAdjustedToContent_bisection(
@@ -777,19 +821,17 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(
        "d_numOfTextLinesToShow.isAuto()" is false, which means we know
        exactly how many text lines we want to reserve space for, regardless of
        word-wrapping.
-    2) Adjust the window width by try-and-error, using bisection.
+    2) Set the window width to that of the text without word-wrapping, as
+       measured by "measureContent". The width is limited by the maximal size
+       of the window, in which case the text is wrapped at that width.
 ------------------------------------------------------------------------------*/
 void FalagardStaticText::adjustSizeToContent_wordWrap_notKeepingAspectRatio(
     USize& sizeFunc, float contentMaxWidth, float windowMaxWidth, float epsilon)
 {
-    float height(d_window->isHeightAdjustedToContent()  ?
-      sizeFunc.d_height.d_scale*(getContentSize().d_height+epsilon) + sizeFunc.d_height.d_offset  :
-      d_window->getPixelSize().d_height);
-    UDim height_as_u_dim(d_window->isHeightAdjustedToContent()  ?  UDim(0.f, height) : d_window->getHeight());
-    float window_width(d_window->getSizeAdjustedToContent_bisection(
-                         USize(UDim(1.f, 0.f), UDim(0.f, height)), -1.f, windowMaxWidth)
-                       .d_width);
-    d_window->setSize(USize(UDim(0.f, window_width), height_as_u_dim), false);
+    const UDim height_as_u_dim(d_window->isHeightAdjustedToContent()  ?
+      UDim(0.f, sizeFunc.d_height.d_scale*(getContentSize().d_height+epsilon) + sizeFunc.d_height.d_offset)  :
+      d_window->getHeight());
+    d_window->setSize(USize(UDim(0.f, std::ceil(windowMaxWidth)), height_as_u_dim), false);
 
      /* It's possible that due to a too low height we're unable to make the
         whole text fit without the need for a vertical scrollbar. In that case,
@@ -73,6 +73,17 @@ void FalagardTreeView::renderTreeItem(TreeView* tree_view, const Rectf& items_ar
     float expander_margin = tree_view->getSubtreeExpanderMargin();
     for (TreeViewItemRenderingState* const item : item_to_render->d_renderedChildren)
     {
+        // nothing below this point is visible; the callers stop as well
+        if (item_pos.y > items_area.bottom())
+            return;
+
+        // skip whole subtrees scrolled above the view
+        if (item_pos.y + item->d_subtreeHeight < items_area.top())
+        {
+            item_pos.y += item->d_subtreeHeight;
+            continue;
+        }
+
         Sizef size = item->d_size;
 
         // center the expander compared to the item's height
@@ -29,6 +29,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/ResourcePreloader.h"
 #include <cstring>
 
 namespace CEGUI
@@ -55,6 +56,22 @@ namespace CEGUI
 
     void XMLParser::parseXMLFile(XMLHandler& handler, const String& filename, const String& schemaName, const String& resourceGroup, bool allowXmlValidation)
     {
+        // Use the elements parsed on a worker thread, if the file was prepared
+        if (ResourcePreloader* preloader = ResourcePreloader::getActive())
+        {
+            try
+            {
+                if (preloader->parseXMLFile(handler, filename, resourceGroup))
+                    return;
+            }
+            catch (const Exception&)
+            {
+                Logger::getSingleton().logEvent("The last thrown exception was related to XML file '" +
+                                                filename + "' from resource group '" + resourceGroup + "'.", LoggingLevel::Error);
+                throw;
+            }
+        }
+
         // Acquire resource using CEGUI ResourceProvider
         RawDataContainer rawXMLData;
         System::getSingleton().getResourceProvider()->loadRawDataContainer(filename, rawXMLData, resourceGroup);
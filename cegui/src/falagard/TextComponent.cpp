@@ -70,10 +70,10 @@ void TextComponent::setFontPropertySource(const String& property)
 void TextComponent::addImageRenderGeometryToWindow_impl(Window& srcWindow, Rectf& destRect,
     const ColourRect* modColours, const Rectf* clipper) const
 {
-    updateRenderedText(srcWindow, destRect.getSize());
+    RenderedText& renderedText = updateRenderedText(srcWindow, destRect.getSize());
 
     // Get total formatted height.
-    const float textHeight = d_renderedText.getExtents().d_height;
+    const float textHeight = renderedText.getExtents().d_height;
 
     // Handle dest area adjustments for vertical formatting.
     // Default is VerticalTextFormatting::TopAligned, for which we take no action.
@@ -93,7 +93,7 @@ void TextComponent::addImageRenderGeometryToWindow_impl(Window& srcWindow, Rectf
     initColoursRect(srcWindow, modColours, finalColours);
 
     // add geometry for text to the target window.
-    d_renderedText.createRenderGeometry(srcWindow.getGeometryBuffers(), destRect.getPosition(), &finalColours, clipper);
+    renderedText.createRenderGeometry(srcWindow.getGeometryBuffers(), destRect.getPosition(), &finalColours, clipper);
 }
 
 //----------------------------------------------------------------------------//
@@ -174,8 +174,7 @@ void TextComponent::writeXMLToStream(XMLSerializer& xml_stream) const
 //----------------------------------------------------------------------------//
 const Sizef& TextComponent::getTextExtent(const Window& window) const
 {
-    updateRenderedText(window, d_area.getPixelRect(window).getSize());
-    return d_renderedText.getExtents();
+    return updateRenderedText(window, d_area.getPixelRect(window).getSize()).getExtents();
 }
 
 //----------------------------------------------------------------------------//
@@ -185,6 +184,8 @@ bool TextComponent::handleFontRenderSizeChange(Window& window, const Font* font)
 
     if (font == getFontObject(window))
     {
+        // The glyphs of the same Font object changed, lay the text out again
+        window.getTextComponentCache(*this).d_font = nullptr;
         window.invalidate();
         return true;
     }
@@ -211,7 +212,7 @@ TextParser* TextComponent::getTextParser(const Window& window) const
 }
 
 //------------------------------------------------------------------------//
-void TextComponent::updateRenderedText(const Window& srcWindow, const Sizef& size) const
+RenderedText& TextComponent::updateRenderedText(const Window& srcWindow, const Sizef& size) const
 {
     Font* font = getFontObject(srcWindow);
     if (!font)
@@ -222,14 +223,17 @@ void TextComponent::updateRenderedText(const Window& srcWindow, const Sizef& siz
     String text = getEffectiveText(srcWindow);
     TextParser* parser = getTextParser(srcWindow);
     auto bidiDir = d_paragraphDir.get(srcWindow);
-    if (d_lastFont != font || d_lastParser != parser || d_lastBidiDir != bidiDir || d_lastText != text)
+
+    TextComponentCache& cache = srcWindow.getTextComponentCache(*this);
+    RenderedText& renderedText = cache.d_renderedText;
+    if (cache.d_font != font || cache.d_parser != parser || cache.d_bidiDir != bidiDir || cache.d_text != text)
     {
-        d_renderedText.renderText(text, parser, font, bidiDir);
+        renderedText.renderText(text, parser, font, bidiDir);
 
-        d_lastFont = font;
-        d_lastParser = parser;
-        d_lastBidiDir = bidiDir;
-        d_lastText = std::move(text);
+        cache.d_font = font;
+        cache.d_parser = parser;
+        cache.d_bidiDir = bidiDir;
+        cache.d_text = std::move(text);
     }
 
     bool wordWrap = false;
@@ -242,10 +246,12 @@ void TextComponent::updateRenderedText(const Window& srcWindow, const Sizef& siz
             wordWrap = srcWindow.getProperty<bool>(d_wordWrapProperty);
     }
 
-    d_renderedText.setHorizontalFormatting(hfmt);
-    d_renderedText.setWordWrapEnabled(wordWrap);
-    d_renderedText.updateDynamicObjectExtents(&srcWindow);
-    d_renderedText.updateFormatting(size.d_width);
+    renderedText.setHorizontalFormatting(hfmt);
+    renderedText.setWordWrapEnabled(wordWrap);
+    renderedText.updateDynamicObjectExtents(&srcWindow);
+    renderedText.updateFormatting(size.d_width);
+
+    return renderedText;
 }
 
 }
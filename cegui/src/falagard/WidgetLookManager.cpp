@@ -30,7 +30,10 @@
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/ResourcePreloader.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
 
 namespace CEGUI
 {
@@ -41,6 +44,22 @@ namespace CEGUI
     String WidgetLookManager::d_defaultResourceGroup;
     ////////////////////////////////////////////////////////////////////////////////
 
+    // Windows keep the text laid out by TextComponents keyed by the component,
+    // drop it for the windows using a look whose components are destroyed. An
+    // empty name drops it for all windows.
+    static void dropTextComponentCaches(const String& look)
+    {
+        WindowManager* wmgr = WindowManager::getSingletonPtr();
+        if (!wmgr)
+            return;
+
+        for (WindowManager::WindowIterator it = wmgr->getIterator(); !it.isAtEnd(); ++it)
+        {
+            if (look.empty() || (*it)->getLookNFeel() == look)
+                (*it)->clearTextComponentCaches();
+        }
+    }
+
     WidgetLookManager::WidgetLookManager()
     {
         String addressStr = SharedStringstream::GetPointerAddressAsString(this);
@@ -117,6 +136,14 @@ namespace CEGUI
         }
     }
     
+    void WidgetLookManager::prepareLookNFeelSpecificationFromFile(ResourcePreloader& preloader,
+        const String& filename, const String& resourceGroup)
+    {
+        preloader.queueXMLFile(filename,
+            resourceGroup.empty() ? d_defaultResourceGroup : resourceGroup,
+            FalagardSchemaName);
+    }
+
     void WidgetLookManager::parseLookNFeelSpecificationFromString(const String& source)
     {
         // create handler object
@@ -158,6 +185,7 @@ namespace CEGUI
         WidgetLookList::iterator wlf = d_widgetLooks.find(widget);
         if (wlf != d_widgetLooks.end())
         {
+            dropTextComponentCaches(widget);
             d_widgetLooks.erase(wlf);
         }
         else
@@ -170,6 +198,7 @@ namespace CEGUI
 
     void WidgetLookManager::eraseAllWidgetLooks()
     {
+        dropTextComponentCaches(String());
         d_widgetLooks.clear();
     }
 
@@ -179,6 +208,7 @@ namespace CEGUI
         {
             Logger::getSingleton().logEvent(
                 "WidgetLookManager::addWidgetLook - Widget look and feel '" + look.getName() + "' already exists.  Replacing previous definition.");
+            dropTextComponentCaches(look.getName());
         }
 
         d_widgetLooks.emplace(look.getName(), std::move(look));
@@ -136,6 +136,7 @@ void SVGData::loadFromFile(const String& file_name,
 void SVGData::addShape(SVGBasicShape* svg_shape)
 {
     d_svgBasicShapes.push_back(svg_shape);
+    d_geometryCache.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -145,6 +146,7 @@ void SVGData::destroyShapes()
         delete shape;
 
     d_svgBasicShapes.clear();
+    d_geometryCache.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -112,6 +112,22 @@ bool SVGDataManager::isSVGDataDefined(const String& name) const
     return d_svgDataMap.find(name) != d_svgDataMap.end();
 }
 
+//----------------------------------------------------------------------------//
+SVGGeometryCacheStats SVGDataManager::getGeometryCacheStats() const
+{
+    SVGGeometryCacheStats total;
+    for (const auto& entry : d_svgDataMap)
+    {
+        const SVGGeometryCacheStats stats = entry.second->getGeometryCache().getStats();
+        total.d_hits += stats.d_hits;
+        total.d_misses += stats.d_misses;
+        total.d_entryCount += stats.d_entryCount;
+        total.d_memoryUsage += stats.d_memoryUsage;
+    }
+
+    return total;
+}
+
 
 //----------------------------------------------------------------------------//
 void SVGDataManager::logSVGDataCreation(SVGData* svgData)
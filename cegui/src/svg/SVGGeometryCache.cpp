@@ -0,0 +1,212 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Caches the tesselated geometry of SVGData
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/svg/SVGGeometryCache.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/svg/SVGTesselator.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+void SVGGeometryCache::createRenderGeometry(std::vector<GeometryBuffer*>& out,
+    const std::vector<SVGBasicShape*>& shapes,
+    const SVGImage::SVGImageRenderSettings& render_settings)
+{
+    if (!d_maxEntryCount)
+    {
+        for (const SVGBasicShape* shape : shapes)
+            shape->createRenderGeometry(out, render_settings);
+        return;
+    }
+
+    const Entry& entry = getEntry(shapes, render_settings);
+
+    Renderer* renderer = System::getSingleton().getRenderer();
+    for (const Batch& batch : entry.d_batches)
+    {
+        GeometryBuffer& buffer = renderer->createGeometryBufferColoured();
+        buffer.appendGeometry(batch.d_vertexData.data(), batch.d_vertexData.size());
+        buffer.setStencilRenderingActive(batch.d_fillRule);
+        buffer.setStencilPostRenderingVertexCount(batch.d_postStencilVertexCount);
+        SVGTesselator::setupGeometryBufferSettings(&buffer, render_settings, batch.d_transform);
+        out.push_back(&buffer);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SVGGeometryCache::clear()
+{
+    d_entries.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SVGGeometryCache::setMaxEntryCount(size_t count)
+{
+    d_maxEntryCount = count;
+
+    while (d_entries.size() > d_maxEntryCount)
+    {
+        const auto oldest = std::min_element(d_entries.begin(), d_entries.end(),
+            [](const Entry& a, const Entry& b) { return a.d_lastUse < b.d_lastUse; });
+        d_entries.erase(oldest);
+    }
+}
+
+//----------------------------------------------------------------------------//
+SVGGeometryCacheStats SVGGeometryCache::getStats() const
+{
+    SVGGeometryCacheStats stats;
+    stats.d_hits = d_hits;
+    stats.d_misses = d_misses;
+    stats.d_entryCount = d_entries.size();
+
+    for (const Entry& entry : d_entries)
+    {
+        stats.d_memoryUsage += sizeof(Entry) + entry.d_batches.capacity() * sizeof(Batch);
+        for (const Batch& batch : entry.d_batches)
+            stats.d_memoryUsage += batch.d_vertexData.capacity() * sizeof(float);
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void SVGGeometryCache::resetStats()
+{
+    d_hits = 0;
+    d_misses = 0;
+}
+
+//----------------------------------------------------------------------------//
+int SVGGeometryCache::getScaleBucket(float scale)
+{
+    // Degenerate scales can't be drawn anyway, keep them out of the log
+    scale = std::max(scale, 1e-6f);
+    return static_cast<int>(std::lround(std::log2(scale) * ScaleBucketsPerOctave));
+}
+
+//----------------------------------------------------------------------------//
+float SVGGeometryCache::getBucketScale(int bucket)
+{
+    return std::exp2(static_cast<float>(bucket) / ScaleBucketsPerOctave);
+}
+
+//----------------------------------------------------------------------------//
+const SVGGeometryCache::Entry& SVGGeometryCache::getEntry(
+    const std::vector<SVGBasicShape*>& shapes,
+    const SVGImage::SVGImageRenderSettings& render_settings)
+{
+    const glm::ivec2 bucket(getScaleBucket(render_settings.d_scaleFactor.x),
+                            getScaleBucket(render_settings.d_scaleFactor.y));
+
+    for (Entry& entry : d_entries)
+    {
+        if (entry.d_scaleBucket == bucket && entry.d_antiAliasing == render_settings.d_antiAliasing)
+        {
+            ++d_hits;
+            entry.d_lastUse = ++d_useCounter;
+            return entry;
+        }
+    }
+
+    ++d_misses;
+
+    Entry entry;
+    entry.d_scaleBucket = bucket;
+    entry.d_antiAliasing = render_settings.d_antiAliasing;
+    entry.d_lastUse = ++d_useCounter;
+    tesselate(entry, shapes, render_settings);
+
+    // Replace the least recently used entry if the cache is full
+    if (d_entries.size() >= d_maxEntryCount)
+    {
+        auto oldest = std::min_element(d_entries.begin(), d_entries.end(),
+            [](const Entry& a, const Entry& b) { return a.d_lastUse < b.d_lastUse; });
+        *oldest = std::move(entry);
+        return *oldest;
+    }
+
+    d_entries.push_back(std::move(entry));
+    return d_entries.back();
+}
+
+//----------------------------------------------------------------------------//
+void SVGGeometryCache::tesselate(Entry& entry, const std::vector<SVGBasicShape*>& shapes,
+    const SVGImage::SVGImageRenderSettings& render_settings)
+{
+    SVGImage::SVGImageRenderSettings bucket_settings(render_settings);
+    bucket_settings.d_scaleFactor = glm::vec2(getBucketScale(entry.d_scaleBucket.x),
+                                              getBucketScale(entry.d_scaleBucket.y));
+
+    std::vector<GeometryBuffer*> buffers;
+    for (const SVGBasicShape* shape : shapes)
+        shape->createRenderGeometry(buffers, bucket_settings);
+
+    for (const GeometryBuffer* buffer : buffers)
+    {
+        const std::vector<float>& vertex_data = buffer->getVertexData();
+        if (vertex_data.empty())
+            continue;
+
+        // Stencil filling works on the buffer as a whole, such buffers stay separate
+        if (buffer->getPolygonFillRule() != PolygonFillRule::NoFilling)
+        {
+            entry.d_batches.push_back({ vertex_data, buffer->getCustomTransform(),
+                buffer->getPolygonFillRule(), buffer->getStencilPostRenderingVertexCount() });
+            continue;
+        }
+
+        if (entry.d_batches.empty() || entry.d_batches.back().d_fillRule != PolygonFillRule::NoFilling)
+            entry.d_batches.push_back({ std::vector<float>(), glm::mat4(1.0f), PolygonFillRule::NoFilling, 0 });
+
+        // Apply the shape's transformation so that the shapes can share a buffer
+        std::vector<float>& merged = entry.d_batches.back().d_vertexData;
+        const size_t first = merged.size();
+        merged.insert(merged.end(), vertex_data.begin(), vertex_data.end());
+
+        const glm::mat4& transform = buffer->getCustomTransform();
+        const size_t stride = static_cast<size_t>(buffer->getVertexAttributeElementCount());
+        for (size_t i = first; i < merged.size(); i += stride)
+        {
+            const glm::vec4 position = transform * glm::vec4(merged[i], merged[i + 1], merged[i + 2], 1.0f);
+            merged[i] = position.x;
+            merged[i + 1] = position.y;
+            merged[i + 2] = position.z;
+        }
+    }
+
+    for (Batch& batch : entry.d_batches)
+        batch.d_vertexData.shrink_to_fit();
+
+    System::getSingleton().getRenderer()->destroyGeometryBuffers(buffers);
+}
+
+//----------------------------------------------------------------------------//
+}
@@ -26,9 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/svg/SVGImage.h"
 #include "CEGUI/GeometryBuffer.h"
-#include "CEGUI/svg/SVGTesselator.h"
 #include "CEGUI/svg/SVGData.h"
-#include "CEGUI/svg/SVGBasicShape.h"
 #include "CEGUI/svg/SVGDataManager.h"
 #include "CEGUI/XMLAttributes.h"
 
@@ -121,9 +119,7 @@ void SVGImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
         renderSettings.d_destArea.getHeight() / d_imageArea.getHeight());
     const SVGImageRenderSettings svgSettings(renderSettings, scaleImgToDest, d_useGeometryAntialiasing);
 
-    // TODO: can use single buffer or at least combine something?
-    for (const SVGBasicShape* currentShape : d_svgData->getShapes())
-        currentShape->createRenderGeometry(out, svgSettings);
+    d_svgData->getGeometryCache().createRenderGeometry(out, d_svgData->getShapes(), svgSettings);
 }
 
 //----------------------------------------------------------------------------//
@@ -138,6 +134,15 @@ void SVGImage::setUseGeometryAntialiasing(bool use_geometry_antialiasing)
     d_useGeometryAntialiasing = use_geometry_antialiasing;
 }
 
+//----------------------------------------------------------------------------//
+void SVGImage::assign(const Image& image)
+{
+    Image::assign(image);
+    const SVGImage& svgImage = static_cast<const SVGImage&>(image);
+    d_svgData = svgImage.d_svgData;
+    d_useGeometryAntialiasing = svgImage.d_useGeometryAntialiasing;
+}
+
 //----------------------------------------------------------------------------//
 }
 
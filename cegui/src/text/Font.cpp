@@ -27,6 +27,7 @@
 #include "CEGUI/text/Font.h"
 #include "CEGUI/text/Font_xmlHandler.h"
 #include "CEGUI/text/FontGlyph.h"
+#include "CEGUI/text/RenderedTextCache.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Renderer.h"
@@ -38,6 +39,8 @@ namespace CEGUI
 String Font::d_defaultResourceGroup;
 const String Font::EventNamespace("Font");
 const String Font::EventRenderSizeChanged("RenderSizeChanged");
+
+const EventId Font::EventRenderSizeChangedId(EventRenderSizeChanged);
 const char32_t Font::UnicodeReplacementCharacter = 0xFFFD;
 
 //----------------------------------------------------------------------------//
@@ -58,6 +61,13 @@ Font::Font(const String& name, const String& type_name, const String& filename,
                                  d_horzScaling, d_vertScaling);
 }
 
+//----------------------------------------------------------------------------//
+Font::~Font()
+{
+    if (auto cache = RenderedTextCache::getSingletonPtr())
+        cache->invalidateFont(this);
+}
+
 //----------------------------------------------------------------------------//
 float Font::convertPointsToPixels(float pointSize, int dotsPerInch)
 {
@@ -285,7 +295,11 @@ void Font::writeXMLToStream(XMLSerializer& xml_stream) const
 //----------------------------------------------------------------------------//
 void Font::onRenderSizeChanged(FontEventArgs& e)
 {
-    fireEvent(EventRenderSizeChanged, e, EventNamespace);
+    // Cached layouts hold glyph metrics of the old size
+    if (auto cache = RenderedTextCache::getSingletonPtr())
+        cache->invalidateFont(this);
+
+    fireEvent(EventRenderSizeChangedId, e, EventNamespace);
 }
 
 }
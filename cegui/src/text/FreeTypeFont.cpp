@@ -28,11 +28,13 @@
  ***************************************************************************/
 #include "CEGUI/text/FreeTypeFont.h"
 #include "CEGUI/text/Font_xmlHandler.h"
+#include "CEGUI/text/FreeTypeGlyphRasteriser.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Renderer.h"
 #include "CEGUI/ResourceProvider.h"
+#include "CEGUI/ResourcePreloader.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/XMLSerializer.h"
@@ -87,15 +89,20 @@ FreeTypeFont::FreeTypeFont(
     d_specificLineSpacing(specific_line_spacing),
     d_size(size),
     d_sizeUnit(sizeUnit),
-    d_antiAliased(anti_aliased)
+    d_antiAliased(anti_aliased),
+    d_asyncThreadCount(std::max(1u, std::min(4u, std::thread::hardware_concurrency() / 2)))
 {
     addFreeTypeFontProperties();
 
     if (!s_fontUsageCount++)
         FT_Init_FreeType(&s_freetypeLibHandle);
 
-    System::getSingleton().getResourceProvider()->loadRawDataContainer(
-        d_filename, d_fontData, d_resourceGroup.empty() ? getDefaultResourceGroup() : d_resourceGroup);
+    // use the file read on a worker thread, if it was prepared
+    const String& fontGroup = d_resourceGroup.empty() ? getDefaultResourceGroup() : d_resourceGroup;
+    ResourcePreloader* const preloader = ResourcePreloader::getActive();
+    if (!preloader || !preloader->loadRawDataContainer(d_filename, d_fontData, fontGroup))
+        System::getSingleton().getResourceProvider()->loadRawDataContainer(
+            d_filename, d_fontData, fontGroup);
 
     // create face using input font
     FT_Error error = FT_New_Memory_Face(s_freetypeLibHandle, d_fontData.getDataPtr(),
@@ -127,6 +134,9 @@ FreeTypeFont::~FreeTypeFont()
 {
     free();
 
+    // Workers use the font data, so stop them before it is unloaded
+    d_rasteriser.reset();
+
     FT_Stroker_Done(d_stroker);
     d_stroker = nullptr;
 
@@ -158,6 +168,18 @@ void FreeTypeFont::addFreeTypeFontProperties()
         "Value is either true or false.",
         &FreeTypeFont::setAntiAliased, &FreeTypeFont::isAntiAliased, false
     );
+
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, bool,
+        "SharedGlyphAtlas", "This is a flag indicating whether the glyphs are stored in the "
+        "glyph atlas shared by all fonts. Value is either true or false.",
+        &FreeTypeFont::setUseSharedGlyphAtlas, &FreeTypeFont::isUsingSharedGlyphAtlas, false
+    );
+
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, bool,
+        "AsyncRasterisation", "This is a flag indicating whether glyphs are rendered on worker "
+        "threads. Value is either true or false.",
+        &FreeTypeFont::setAsyncRasterisationEnabled, &FreeTypeFont::isAsyncRasterisationEnabled, false
+    );
 }
 
 //----------------------------------------------------------------------------//
@@ -241,8 +263,26 @@ size_t FreeTypeFont::findTextureLineWithFittingSpot(uint32_t glyphWidth, uint32_
 
 //----------------------------------------------------------------------------//
 BitmapImage* FreeTypeFont::rasterise(const String& name, const FT_Bitmap& ft_bitmap, int32_t glyphLeft,
-    int32_t glyphTop, uint32_t glyphWidth, uint32_t glyphHeight)
+    int32_t glyphTop, uint32_t glyphWidth, uint32_t glyphHeight, std::uint64_t key)
 {
+    return addGlyphImage(name, createGlyphTextureData(ft_bitmap), glyphLeft, glyphTop,
+        glyphWidth, glyphHeight, key);
+}
+
+//----------------------------------------------------------------------------//
+BitmapImage* FreeTypeFont::addGlyphImage(const String& name, const std::vector<argb_t>& pixels,
+    int32_t glyphLeft, int32_t glyphTop, uint32_t glyphWidth, uint32_t glyphHeight, std::uint64_t key)
+{
+    // This is the right bearing for bitmap glyphs, not d_fontFace->glyph->metrics.horiBearingX
+    const glm::vec2 offset(glyphLeft, -1.f * glyphTop);
+
+    if (d_useSharedGlyphAtlas)
+    {
+        return GlyphAtlasManager::getSingleton().addGlyph(*this, key, name,
+            Sizef(static_cast<float>(glyphWidth), static_cast<float>(glyphHeight)),
+            pixels, offset, d_nativeResolution);
+    }
+
     if (d_glyphTextures.empty())
         createGlyphAtlasTexture();
 
@@ -254,30 +294,25 @@ BitmapImage* FreeTypeFont::rasterise(const String& name, const FT_Bitmap& ft_bit
     if (fittingLineIndex >= d_textureGlyphLines.size())
     {
         createTextureSpaceForGlyphRasterisation(d_glyphTextures.back(), glyphWidth, glyphHeight);
-        return rasterise(name, ft_bitmap, glyphLeft, glyphTop, glyphWidth, glyphHeight);
+        return addGlyphImage(name, pixels, glyphLeft, glyphTop, glyphWidth, glyphHeight, key);
     }
 
     const TextureGlyphLine& glyphTexLine = d_textureGlyphLines[fittingLineIndex];
 
-    // Create the data containing the pixels of the glyph
-    std::vector<argb_t> subTextureData = createGlyphTextureData(ft_bitmap);
-
     // Update the cached texture data in memory
     size_t bufferDataGlyphPos = (glyphTexLine.d_lastYPos * d_lastTextureSize) + glyphTexLine.d_lastXPos;
     updateTextureBufferSubImage(d_lastTextureBuffer.data() + bufferDataGlyphPos,
-        glyphWidth, glyphHeight, subTextureData);
+        glyphWidth, glyphHeight, pixels);
 
     // Update the sub-image in the texture on the GPU
     const Rectf imageArea(
         glm::vec2(glyphTexLine.d_lastXPos, glyphTexLine.d_lastYPos),
         Sizef(static_cast<float>(glyphWidth), static_cast<float>(glyphHeight)));
-    d_glyphTextures.back()->blitFromMemory(subTextureData.data(), imageArea);
+    d_glyphTextures.back()->blitFromMemory(pixels.data(), imageArea);
 
     // Advance to next position, add padding
     glyphTexLine.d_lastXPos += glyphWidth + s_glyphPadding;
 
-    // This is the right bearing for bitmap glyphs, not d_fontFace->glyph->metrics.horiBearingX
-    const glm::vec2 offset(glyphLeft, -1.f * glyphTop);
     return new BitmapImage(name, d_glyphTextures.back(), imageArea, offset, AutoScaledMode::Disabled, d_nativeResolution);
 }
 
@@ -384,10 +419,18 @@ void FreeTypeFont::free()
     if (!d_fontFace)
         return;
 
+    if (d_rasteriser)
+        d_rasteriser->cancelAll();
+
+    if (d_useSharedGlyphAtlas)
+        GlyphAtlasManager::getSingleton().removeClientGlyphs(*this);
+
     d_outlines.clear();
 
-    for (const auto& glyph : d_glyphs)
-        delete glyph.getImage();
+    // Pending glyphs only reference the placeholder image
+    for (size_t i = 0; i < d_glyphs.size(); ++i)
+        if (!d_glyphPending[i])
+            delete d_glyphs[i].getImage();
 
     for (size_t i = 0; i < d_glyphTextures.size(); i++)
         System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
@@ -398,6 +441,8 @@ void FreeTypeFont::free()
     d_codePointToGlyphMap.clear();
     d_indexToGlyphMap.clear();
     d_glyphLoadStatus.clear();
+    d_glyphPending.clear();
+    d_pendingGlyphCount = 0;
     d_glyphs.clear();
 }
 
@@ -469,6 +514,9 @@ void FreeTypeFont::updateFont()
         tryToCreateFontWithClosestFontHeight(errorResult, fontSize);
     }
 
+    if (d_rasteriser)
+        d_rasteriser->setParameters(d_fontFace->size->metrics.y_ppem, getGlyphLoadFlags());
+
     bool initStrikeout = false;
     if (d_fontFace->face_flags & FT_FACE_FLAG_SCALABLE)
     {
@@ -522,6 +570,7 @@ void FreeTypeFont::updateFont()
     }
 
     d_glyphLoadStatus.resize(d_glyphs.size(), false);
+    d_glyphPending.resize(d_glyphs.size(), false);
 
     d_replacementGlyphIdx = getGlyphIndexForCodepoint(UnicodeReplacementCharacter);
 }
@@ -553,7 +602,8 @@ Image* FreeTypeFont::renderOutline(uint32_t index, FT_Fixed thickness)
         it = d_outlines.emplace(thickness, std::vector<std::unique_ptr<BitmapImage>>(d_glyphs.size())).first;
 
     const String name(std::to_string(d_glyphs[index].getCodePoint()) + "_ol_" + std::to_string(thickness));
-    it->second[index].reset(rasterise(name, bitmapGlyph->bitmap, bitmapGlyph->left, bitmapGlyph->top, bitmapGlyph->bitmap.width, bitmapGlyph->bitmap.rows));
+    const std::uint64_t key = (static_cast<std::uint64_t>(thickness) << 32) | index;
+    it->second[index].reset(rasterise(name, bitmapGlyph->bitmap, bitmapGlyph->left, bitmapGlyph->top, bitmapGlyph->bitmap.width, bitmapGlyph->bitmap.rows, key));
 
     FT_Done_Glyph(ftGlyph);
 
@@ -637,6 +687,202 @@ void FreeTypeFont::setAntiAliased(bool antiAliased)
     onRenderSizeChanged(args);
 }
 
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setUseSharedGlyphAtlas(bool use)
+{
+    if (use == d_useSharedGlyphAtlas)
+        return;
+
+    // Glyphs must be released from the storage they were added to
+    free();
+    d_useSharedGlyphAtlas = use;
+    updateFont();
+
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::notifyGlyphEvicted(BitmapImage* image, std::uint64_t key)
+{
+    const auto index = static_cast<uint32_t>(key & 0xFFFFFFFF);
+    const auto thickness = static_cast<FT_Fixed>(key >> 32);
+
+    if (thickness)
+    {
+        // The outline will be rendered again by the next getOutline call
+        auto it = d_outlines.find(thickness);
+        if (it != d_outlines.end() && index < it->second.size() && it->second[index].get() == image)
+            it->second[index].release();
+    }
+    else if (index < d_glyphs.size() && d_glyphs[index].getImage() == image)
+    {
+        // Unload it so that loadGlyph renders it again
+        d_glyphs[index].setImage(nullptr);
+        d_glyphLoadStatus[index] = false;
+
+        // The image may have been the placeholder of pending glyphs
+        if (d_pendingGlyphCount)
+        {
+            for (size_t i = 0; i < d_glyphs.size(); ++i)
+                if (d_glyphPending[i] && d_glyphs[i].getImage() == image)
+                    d_glyphs[i].setImage(nullptr);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setAsyncRasterisationEnabled(bool enabled)
+{
+    if (enabled == isAsyncRasterisationEnabled())
+        return;
+
+    if (enabled)
+    {
+        d_rasteriser.reset(new FreeTypeGlyphRasteriser(d_fontData, d_asyncThreadCount));
+        d_rasteriser->setParameters(d_fontFace->size->metrics.y_ppem, getGlyphLoadFlags());
+        return;
+    }
+
+    d_rasteriser.reset();
+
+    if (!d_pendingGlyphCount)
+        return;
+
+    // Unload the pending glyphs, they will be rendered synchronously when needed
+    for (size_t i = 0; i < d_glyphs.size(); ++i)
+    {
+        if (d_glyphPending[i])
+        {
+            d_glyphPending[i] = false;
+            d_glyphLoadStatus[i] = false;
+            d_glyphs[i].setImage(nullptr);
+        }
+    }
+
+    d_pendingGlyphCount = 0;
+    System::getSingleton().invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setAsyncRasterisationThreadCount(size_t count)
+{
+    if (count == d_asyncThreadCount)
+        return;
+
+    d_asyncThreadCount = count;
+
+    // Restart the workers with the new count
+    if (isAsyncRasterisationEnabled())
+    {
+        setAsyncRasterisationEnabled(false);
+        setAsyncRasterisationEnabled(true);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::preloadGlyphs(char32_t first, char32_t last)
+{
+    if (last < first)
+        return;
+
+    std::vector<uint32_t> indices;
+
+    // Walk whichever is shorter, the range or the glyph map
+    if (static_cast<size_t>(last - first) < d_codePointToGlyphMap.size())
+    {
+        for (char32_t codePoint = first; ; ++codePoint)
+        {
+            auto it = d_codePointToGlyphMap.find(codePoint);
+            if (it != d_codePointToGlyphMap.end())
+                indices.push_back(it->second);
+            if (codePoint == last)
+                break;
+        }
+    }
+    else
+    {
+        for (const auto& pair : d_codePointToGlyphMap)
+            if (pair.first >= first && pair.first <= last)
+                indices.push_back(pair.second);
+    }
+
+    for (const uint32_t index : indices)
+    {
+        if (d_glyphLoadStatus[index])
+            continue;
+
+        // Metrics are taken from the worker result too, so nothing is loaded here
+        if (d_rasteriser)
+            queueGlyph(index);
+        else
+            loadGlyph(index);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::queueGlyph(uint32_t index)
+{
+    if (!d_glyphPending[index])
+    {
+        d_glyphPending[index] = true;
+        ++d_pendingGlyphCount;
+        d_rasteriser->queue(index, d_glyphs[index].getGlyphIndex());
+    }
+
+    if (d_glyphLoadStatus[index])
+        d_glyphs[index].setImage(getPlaceholderImage());
+}
+
+//----------------------------------------------------------------------------//
+Image* FreeTypeFont::getPlaceholderImage()
+{
+    if (!d_placeholderCodePoint)
+        return nullptr;
+
+    const uint32_t index = getGlyphIndexForCodepoint(d_placeholderCodePoint);
+    if (index >= d_glyphs.size() || d_glyphPending[index])
+        return nullptr;
+
+    const FreeTypeFontGlyph* glyph = loadGlyph(index);
+    return glyph ? glyph->getImage() : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeFont::processPendingGlyphs()
+{
+    if (!d_rasteriser || !d_pendingGlyphCount)
+        return false;
+
+    auto results = d_rasteriser->takeResults();
+    for (auto& result : results)
+    {
+        const uint32_t index = result.d_index;
+        if (index >= d_glyphs.size() || !d_glyphPending[index])
+            continue;
+
+        d_glyphPending[index] = false;
+        --d_pendingGlyphCount;
+
+        auto& glyph = d_glyphs[index];
+
+        // Preloaded glyphs get their metrics here
+        if (!d_glyphLoadStatus[index])
+        {
+            d_glyphLoadStatus[index] = true;
+            glyph.setAdvance(result.d_advance);
+            glyph.setLsbDelta(result.d_lsbDelta);
+            glyph.setRsbDelta(result.d_rsbDelta);
+        }
+
+        glyph.setImage(result.d_failed ? nullptr :
+            addGlyphImage(std::to_string(glyph.getCodePoint()), result.d_pixels, result.d_left,
+                result.d_top, result.d_width, result.d_height, index));
+    }
+
+    return !results.empty();
+}
+
 //----------------------------------------------------------------------------//
 FT_Int32 FreeTypeFont::getGlyphLoadFlags() const
 {
@@ -679,11 +925,50 @@ FreeTypeFontGlyph* FreeTypeFont::loadGlyph(uint32_t index)
     auto glyph = &d_glyphs[index];
 
     if (d_glyphLoadStatus[index])
+    {
+        if (d_useSharedGlyphAtlas && glyph->getImage() && !d_glyphPending[index])
+            GlyphAtlasManager::getSingleton().touchGlyph(
+                static_cast<const BitmapImage*>(glyph->getImage()));
         return glyph;
+    }
+
+    // The placeholder itself must be available immediately
+    if (!d_rasteriser || (d_placeholderCodePoint && index == getGlyphIndexForCodepoint(d_placeholderCodePoint)))
+        return renderGlyph(index);
+
+    // Mark as loaded immediately to avoid retrying on error
+    d_glyphLoadStatus[index] = true;
+
+    FT_Set_Transform(d_fontFace, nullptr, nullptr);
+
+    // Only the metrics are needed for layout, the bitmap is rendered by the workers
+    if (FT_Load_Glyph(d_fontFace, glyph->getGlyphIndex(), getGlyphLoadFlags()))
+        return nullptr;
+
+    glyph->setAdvance(d_fontFace->glyph->advance.x * static_cast<float>(s_26dot6_toFloat));
+    glyph->setLsbDelta(d_fontFace->glyph->lsb_delta);
+    glyph->setRsbDelta(d_fontFace->glyph->rsb_delta);
+
+    queueGlyph(index);
+
+    return glyph;
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeFontGlyph* FreeTypeFont::renderGlyph(uint32_t index)
+{
+    auto glyph = &d_glyphs[index];
 
     // Mark as loaded immediately to avoid retrying on error
     d_glyphLoadStatus[index] = true;
 
+    // A preloaded glyph may be needed before the workers get to it
+    if (d_glyphPending[index])
+    {
+        d_glyphPending[index] = false;
+        --d_pendingGlyphCount;
+    }
+
     FT_Set_Transform(d_fontFace, nullptr, nullptr);
 
     // Non-zero result is an error
@@ -693,7 +978,7 @@ FreeTypeFontGlyph* FreeTypeFont::loadGlyph(uint32_t index)
     // NB: FontGlyph doesn't own an image (see PixmapFont), so we have to delete an image manually in free()
     const String name(std::to_string(glyph->getCodePoint()));
     const auto& ft_bitmap = d_fontFace->glyph->bitmap;
-    auto image = rasterise(name, ft_bitmap, d_fontFace->glyph->bitmap_left, d_fontFace->glyph->bitmap_top, ft_bitmap.width, ft_bitmap.rows);
+    auto image = rasterise(name, ft_bitmap, d_fontFace->glyph->bitmap_left, d_fontFace->glyph->bitmap_top, ft_bitmap.width, ft_bitmap.rows, index);
     glyph->setImage(image);
     glyph->setAdvance(d_fontFace->glyph->advance.x * static_cast<float>(s_26dot6_toFloat));
     glyph->setLsbDelta(d_fontFace->glyph->lsb_delta);
@@ -721,7 +1006,11 @@ Image* FreeTypeFont::getOutline(uint32_t index, float thickness)
     //!!!TODO TEXT: need to make distinction between not yet rendered and failed outline to avoid repeated recreation on failure!
     auto it = d_outlines.find(outlineThickness);
     if (it != d_outlines.cend() && it->second[index])
+    {
+        if (d_useSharedGlyphAtlas)
+            GlyphAtlasManager::getSingleton().touchGlyph(it->second[index].get());
         return it->second[index].get();
+    }
 
     return renderOutline(index, outlineThickness);
 }
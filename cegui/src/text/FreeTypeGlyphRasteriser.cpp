@@ -0,0 +1,186 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Renders FreeType glyph bitmaps on worker threads
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/text/FreeTypeGlyphRasteriser.h"
+#include "CEGUI/text/FreeTypeFont.h"
+#include "CEGUI/DataContainer.h"
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Conversion constant
+static constexpr float s_26dot6_toFloat = 1.0f / 64.f;
+
+//----------------------------------------------------------------------------//
+FreeTypeGlyphRasteriser::FreeTypeGlyphRasteriser(const RawDataContainer& font_data,
+    size_t thread_count) :
+    d_fontData(font_data.getDataPtr()),
+    d_fontDataSize(font_data.getSize())
+{
+    if (!thread_count)
+        thread_count = 1;
+
+    d_workers.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+        d_workers.emplace_back(&FreeTypeGlyphRasteriser::workerMain, this);
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeGlyphRasteriser::~FreeTypeGlyphRasteriser()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+        d_jobs.clear();
+    }
+
+    d_jobAvailable.notify_all();
+
+    for (auto& worker : d_workers)
+        worker.join();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphRasteriser::setParameters(FT_UInt pixel_height, FT_Int32 load_flags)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+
+    if (d_pixelHeight == pixel_height && d_loadFlags == load_flags)
+        return;
+
+    d_pixelHeight = pixel_height;
+    d_loadFlags = load_flags;
+    ++d_generation;
+    d_jobs.clear();
+    d_results.clear();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphRasteriser::queue(std::uint32_t index, FT_UInt ft_glyph_index)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_jobs.push_back({ index, ft_glyph_index, d_pixelHeight, d_loadFlags, d_generation });
+    }
+
+    d_jobAvailable.notify_one();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphRasteriser::cancelAll()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    ++d_generation;
+    d_jobs.clear();
+    d_results.clear();
+}
+
+//----------------------------------------------------------------------------//
+std::vector<FreeTypeGlyphRasteriser::Result> FreeTypeGlyphRasteriser::takeResults()
+{
+    std::vector<Result> results;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    std::swap(results, d_results);
+    return results;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeGlyphRasteriser::workerMain()
+{
+    // FreeType objects may not be used from several threads at once
+    FT_Library library = nullptr;
+    FT_Face face = nullptr;
+    if (FT_Init_FreeType(&library) == 0)
+    {
+        if (FT_New_Memory_Face(library, d_fontData,
+                static_cast<FT_Long>(d_fontDataSize), 0, &face) != 0)
+            face = nullptr;
+    }
+
+    FT_UInt facePixelHeight = 0;
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+    {
+        d_jobAvailable.wait(lock, [this] { return d_stopping || !d_jobs.empty(); });
+        if (d_stopping)
+            break;
+
+        const Job job = d_jobs.front();
+        d_jobs.pop_front();
+        lock.unlock();
+
+        Result result;
+        result.d_index = job.d_index;
+
+        if (face && facePixelHeight != job.d_pixelHeight)
+        {
+            if (FT_Set_Pixel_Sizes(face, 0, job.d_pixelHeight) == 0)
+                facePixelHeight = job.d_pixelHeight;
+        }
+
+        result.d_failed = !face || facePixelHeight != job.d_pixelHeight ||
+            !renderGlyph(face, job, result);
+
+        lock.lock();
+        if (job.d_generation == d_generation)
+            d_results.push_back(std::move(result));
+    }
+
+    lock.unlock();
+
+    if (face)
+        FT_Done_Face(face);
+    if (library)
+        FT_Done_FreeType(library);
+}
+
+//----------------------------------------------------------------------------//
+bool FreeTypeGlyphRasteriser::renderGlyph(FT_Face face, const Job& job, Result& result) const
+{
+    if (FT_Load_Glyph(face, job.d_ftGlyphIndex, job.d_loadFlags | FT_LOAD_RENDER))
+        return false;
+
+    const FT_GlyphSlot slot = face->glyph;
+
+    // Check here, exceptions can't be thrown (and logged) from a worker
+    if (slot->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY && slot->bitmap.pixel_mode != FT_PIXEL_MODE_MONO)
+        return false;
+
+    result.d_pixels = FreeTypeFont::createGlyphTextureData(slot->bitmap);
+
+    result.d_width = static_cast<std::uint32_t>(slot->bitmap.width);
+    result.d_height = static_cast<std::uint32_t>(slot->bitmap.rows);
+    result.d_left = slot->bitmap_left;
+    result.d_top = slot->bitmap_top;
+    result.d_advance = slot->advance.x * s_26dot6_toFloat;
+    result.d_lsbDelta = slot->lsb_delta;
+    result.d_rsbDelta = slot->rsb_delta;
+    return true;
+}
+
+}
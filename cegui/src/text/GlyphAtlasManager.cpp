@@ -0,0 +1,430 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Implements a glyph atlas that can be shared by multiple fonts
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/text/GlyphAtlasManager.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Exceptions.h"
+#include <algorithm>
+#include <limits>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Singleton instance pointer
+template<> GlyphAtlasManager* Singleton<GlyphAtlasManager>::ms_Singleton = nullptr;
+
+//----------------------------------------------------------------------------//
+// Space left between glyphs so that filtering doesn't pick up the neighbours
+static const std::uint32_t s_glyphPadding = 1;
+
+//----------------------------------------------------------------------------//
+static void throwGlyphTooLarge(std::uint32_t width, std::uint32_t height,
+    std::uint32_t page_size)
+{
+    throw InvalidRequestException("Can not add a glyph of size " +
+        std::to_string(width) + "x" + std::to_string(height) +
+        " to a glyph atlas page of size " + std::to_string(page_size) + ".");
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlasManager::GlyphAtlasManager() :
+    d_pageSize(1024),
+    d_maxPageCount(8),
+    d_useClock(0),
+    d_usedPixels(0),
+    d_evictedGlyphs(0),
+    d_evictedPages(0),
+    d_createdPageCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlasManager::~GlyphAtlasManager()
+{
+    destroyEvictedImages();
+
+    Renderer* renderer = System::getSingleton().getRenderer();
+    for (auto& page : d_pages)
+        renderer->destroyTexture(*page.d_texture);
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlasManager& GlyphAtlasManager::getSingleton()
+{
+    return Singleton<GlyphAtlasManager>::getSingleton();
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlasManager* GlyphAtlasManager::getSingletonPtr()
+{
+    return Singleton<GlyphAtlasManager>::getSingletonPtr();
+}
+
+//----------------------------------------------------------------------------//
+BitmapImage* GlyphAtlasManager::addGlyph(GlyphAtlasClient& client,
+    std::uint64_t key, const String& name, const Sizef& size,
+    const std::vector<argb_t>& pixels, const glm::vec2& offset,
+    const Sizef& native_res)
+{
+    const auto glyphWidth = static_cast<std::uint32_t>(size.d_width);
+    const auto glyphHeight = static_cast<std::uint32_t>(size.d_height);
+    const std::uint32_t width = glyphWidth + s_glyphPadding;
+    const std::uint32_t height = glyphHeight + s_glyphPadding;
+
+    std::uint32_t x = 0;
+    std::uint32_t y = 0;
+    size_t nodeIndex = 0;
+    size_t pageIndex = 0;
+
+    // Existing pages may have been created with a different size
+    for (; pageIndex < d_pages.size(); ++pageIndex)
+        if (findPosition(d_pages[pageIndex], width, height, x, y, nodeIndex))
+            break;
+
+    if (pageIndex == d_pages.size())
+    {
+        // Don't evict anything for a glyph that can't fit in any new page
+        const std::uint32_t newPageSize = getNewPageSize();
+        if (width > newPageSize || height > newPageSize)
+            throwGlyphTooLarge(glyphWidth, glyphHeight, newPageSize);
+
+        pageIndex = (d_pages.size() < std::max<size_t>(d_maxPageCount, 1)) ?
+            createPage() : evictColdestPage();
+
+        if (!findPosition(d_pages[pageIndex], width, height, x, y, nodeIndex))
+            throwGlyphTooLarge(glyphWidth, glyphHeight, d_pages[pageIndex].d_size);
+    }
+
+    Page& page = d_pages[pageIndex];
+    addSkylineLevel(page, nodeIndex, x, y, width, height);
+
+    const Rectf imageArea(glm::vec2(x, y),
+        Sizef(static_cast<float>(glyphWidth), static_cast<float>(glyphHeight)));
+    if (glyphWidth && glyphHeight)
+        page.d_texture->blitFromMemory(pixels.data(), imageArea);
+
+    auto image = new BitmapImage(name, page.d_texture, imageArea, offset,
+        AutoScaledMode::Disabled, native_res);
+
+    const size_t area = static_cast<size_t>(width) * height;
+    d_glyphs[image] = { &client, key, pageIndex, area };
+    d_usedPixels += area;
+    ++page.d_glyphCount;
+    page.d_lastUse = ++d_useClock;
+
+    return image;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::removeGlyph(const BitmapImage* image)
+{
+    auto it = d_glyphs.find(image);
+    if (it == d_glyphs.end())
+        return;
+
+    const GlyphEntry entry = it->second;
+    d_glyphs.erase(it);
+    releaseEntry(entry);
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::removeClientGlyphs(const GlyphAtlasClient& client)
+{
+    for (auto it = d_glyphs.begin(); it != d_glyphs.end(); )
+    {
+        if (it->second.d_client == &client)
+        {
+            const GlyphEntry entry = it->second;
+            it = d_glyphs.erase(it);
+            releaseEntry(entry);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::touchGlyph(const BitmapImage* image)
+{
+    auto it = d_glyphs.find(image);
+    if (it != d_glyphs.end())
+        d_pages[it->second.d_page].d_lastUse = ++d_useClock;
+}
+
+//----------------------------------------------------------------------------//
+bool GlyphAtlasManager::isGlyphInAtlas(const BitmapImage* image) const
+{
+    return d_glyphs.find(image) != d_glyphs.end();
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::evictAllGlyphs()
+{
+    // Detach the entries first, clients may call removeGlyph from the callback
+    std::vector<std::pair<BitmapImage*, GlyphEntry>> evicted;
+    for (const auto& glyph : d_glyphs)
+        evicted.emplace_back(const_cast<BitmapImage*>(glyph.first), glyph.second);
+
+    d_glyphs.clear();
+    d_usedPixels = 0;
+    d_evictedGlyphs += evicted.size();
+    d_evictedPages += d_pages.size();
+
+    // Geometry drawn before the next frame may still use the textures
+    for (auto& page : d_pages)
+        d_evictedTextures.push_back(page.d_texture);
+    d_pages.clear();
+
+    notifyGlyphsEvicted(evicted);
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::destroyEvictedImages()
+{
+    for (BitmapImage* image : d_evictedImages)
+        delete image;
+
+    d_evictedImages.clear();
+
+    if (d_evictedTextures.empty())
+        return;
+
+    Renderer* renderer = System::getSingleton().getRenderer();
+    for (Texture* texture : d_evictedTextures)
+        renderer->destroyTexture(*texture);
+
+    d_evictedTextures.clear();
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlasStats GlyphAtlasManager::getStats() const
+{
+    GlyphAtlasStats stats;
+    stats.d_pageCount = d_pages.size();
+    stats.d_glyphCount = d_glyphs.size();
+    stats.d_usedPixels = d_usedPixels;
+    stats.d_evictedGlyphs = d_evictedGlyphs;
+    stats.d_evictedPages = d_evictedPages;
+
+    for (const auto& page : d_pages)
+        stats.d_totalPixels += static_cast<size_t>(page.d_size) * page.d_size;
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::resetStats()
+{
+    d_evictedGlyphs = 0;
+    d_evictedPages = 0;
+}
+
+//----------------------------------------------------------------------------//
+bool GlyphAtlasManager::findPosition(const Page& page, std::uint32_t width,
+    std::uint32_t height, std::uint32_t& x, std::uint32_t& y, size_t& node_index)
+{
+    std::uint32_t bestBottom = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t bestWidth = std::numeric_limits<std::uint32_t>::max();
+    bool found = false;
+
+    const auto& skyline = page.d_skyline;
+    for (size_t i = 0; i < skyline.size(); ++i)
+    {
+        // Nodes are sorted by x and cover the whole page width
+        if (skyline[i].d_x + width > page.d_size)
+            break;
+
+        // The rectangle rests on the highest node it spans
+        std::uint32_t top = 0;
+        std::uint32_t widthLeft = width;
+        for (size_t j = i; widthLeft > 0; ++j)
+        {
+            top = std::max(top, skyline[j].d_y);
+            widthLeft -= std::min(widthLeft, skyline[j].d_width);
+        }
+
+        if (top + height > page.d_size)
+            continue;
+
+        // Bottom-left: lowest resulting top edge, then the tightest node
+        const std::uint32_t bottom = top + height;
+        if (bottom < bestBottom || (bottom == bestBottom && skyline[i].d_width < bestWidth))
+        {
+            bestBottom = bottom;
+            bestWidth = skyline[i].d_width;
+            x = skyline[i].d_x;
+            y = top;
+            node_index = i;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::addSkylineLevel(Page& page, size_t node_index,
+    std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height)
+{
+    auto& skyline = page.d_skyline;
+    skyline.insert(skyline.begin() + node_index, SkylineNode{ x, y + height, width });
+
+    // Cut the nodes now covered by the new one
+    const std::uint32_t right = x + width;
+    const size_t next = node_index + 1;
+    while (next < skyline.size() && skyline[next].d_x < right)
+    {
+        const std::uint32_t shrink = right - skyline[next].d_x;
+        if (skyline[next].d_width <= shrink)
+        {
+            skyline.erase(skyline.begin() + next);
+        }
+        else
+        {
+            skyline[next].d_x += shrink;
+            skyline[next].d_width -= shrink;
+            break;
+        }
+    }
+
+    // Merge neighbours at the same level
+    for (size_t i = 0; i + 1 < skyline.size(); )
+    {
+        if (skyline[i].d_y == skyline[i + 1].d_y)
+        {
+            skyline[i].d_width += skyline[i + 1].d_width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t GlyphAtlasManager::getNewPageSize() const
+{
+    const auto maxTextureSize =
+        System::getSingleton().getRenderer()->getMaxTextureSize();
+    return std::min(d_pageSize, static_cast<std::uint32_t>(maxTextureSize));
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlasManager::createPage()
+{
+    Renderer* renderer = System::getSingleton().getRenderer();
+    const std::uint32_t size = getNewPageSize();
+
+    const String name("GlyphAtlasPage_" + std::to_string(d_createdPageCount++));
+    const Sizef textureSize(static_cast<float>(size), static_cast<float>(size));
+
+    Page page;
+    page.d_texture = &renderer->createTexture(name, textureSize);
+    page.d_size = size;
+    resetPage(page);
+
+    d_pages.push_back(page);
+    return d_pages.size() - 1;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::resetPage(Page& page)
+{
+    page.d_skyline.assign(1, SkylineNode{ 0, 0, page.d_size });
+    page.d_glyphCount = 0;
+    page.d_lastUse = 0;
+
+    // Clear the texture so that the padding around new glyphs stays transparent
+    // TODO: clear with GPU clear op instead of loading from memory!
+    const std::vector<argb_t> clearData(static_cast<size_t>(page.d_size) * page.d_size, 0);
+    page.d_texture->blitFromMemory(clearData.data(),
+        Rectf(glm::vec2(0.f, 0.f), page.d_texture->getSize()));
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlasManager::evictColdestPage()
+{
+    size_t coldest = 0;
+    for (size_t i = 1; i < d_pages.size(); ++i)
+        if (d_pages[i].d_lastUse < d_pages[coldest].d_lastUse)
+            coldest = i;
+
+    // Detach the entries first, clients may call removeGlyph from the callback
+    std::vector<std::pair<BitmapImage*, GlyphEntry>> evicted;
+    for (auto it = d_glyphs.begin(); it != d_glyphs.end(); )
+    {
+        if (it->second.d_page == coldest)
+        {
+            evicted.emplace_back(const_cast<BitmapImage*>(it->first), it->second);
+            d_usedPixels -= it->second.d_area;
+            it = d_glyphs.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    resetPage(d_pages[coldest]);
+    d_evictedGlyphs += evicted.size();
+    ++d_evictedPages;
+
+    notifyGlyphsEvicted(evicted);
+
+    return coldest;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::notifyGlyphsEvicted(
+    const std::vector<std::pair<BitmapImage*, GlyphEntry>>& evicted)
+{
+    for (auto& glyph : evicted)
+    {
+        glyph.second.d_client->notifyGlyphEvicted(glyph.first, glyph.second.d_key);
+        d_evictedImages.push_back(glyph.first);
+    }
+
+    // Cached text geometry may still reference the evicted glyphs
+    System::getSingleton().invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlasManager::releaseEntry(const GlyphEntry& entry)
+{
+    d_usedPixels -= entry.d_area;
+
+    Page& page = d_pages[entry.d_page];
+    if (--page.d_glyphCount == 0)
+        resetPage(page);
+}
+
+}
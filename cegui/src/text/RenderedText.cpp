@@ -27,6 +27,7 @@
 #include "CEGUI/text/RenderedText.h"
 #include "CEGUI/text/RenderedTextParagraph.h"
 #include "CEGUI/text/RenderedTextStyle.h"
+#include "CEGUI/text/RenderedTextCache.h"
 #include "CEGUI/text/TextParser.h"
 #include "CEGUI/text/TextUtils.h"
 #ifdef CEGUI_BIDI_SUPPORT
@@ -35,11 +36,12 @@
 #ifdef CEGUI_USE_RAQM
 #include "CEGUI/text/FreeTypeFont.h"
 #include <raqm.h>
-#include <algorithm>
 #else
 #include "CEGUI/text/Font.h"
 #include "CEGUI/text/FontGlyph.h"
 #endif
+#include <algorithm>
+#include <iterator>
 
 namespace CEGUI
 {
@@ -267,17 +269,94 @@ static bool layoutParagraphWithRaqm(RenderedTextParagraph& out, const std::u32st
 }
 #endif
 
+//----------------------------------------------------------------------------//
+static void layoutParagraphs(std::vector<RenderedTextParagraph>& out, const std::u32string& text,
+    const std::vector<size_t>& originalIndices, size_t sourceLength, DefaultParagraphDirection dir,
+    const std::vector<uint16_t>& elementIndices, const std::vector<RenderedTextElementPtr>& elements,
+    DefaultParagraphDirection& lastBidiDir, bool endsText)
+{
+#ifdef CEGUI_USE_RAQM
+    raqm_t* rq = nullptr;
+#endif
+
+    const size_t textLength = text.size();
+    size_t start = 0;
+    do
+    {
+        size_t end = text.find_first_of(TextUtils::UTF32_NEWLINE_CHARACTERS, start);
+        if (end == std::u32string::npos)
+            end = textLength;
+
+        // Always create a paragraph (new line), even if it is empty
+        out.emplace_back(static_cast<uint32_t>(start), static_cast<uint32_t>(end));
+        auto& p = out.back();
+
+        if (end > start)
+        {
+            // Create and setup a sequence of CEGUI glyphs for this paragraph
+#ifdef CEGUI_USE_RAQM
+            if (!layoutParagraphWithRaqm(p, text, start, end, dir, elementIndices, elements, rq))
+#endif
+                layoutParagraph(p, text, start, end, dir, elementIndices, elements);
+
+            // Inherit explicit direction from the previous text for direction neutral paragraphs
+            if (p.getBidiDirection() == DefaultParagraphDirection::Automatic)
+                p.setBidiDirection(lastBidiDir);
+            else
+                lastBidiDir = p.getBidiDirection();
+
+            p.setupGlyphs(text, elementIndices, elements);
+        }
+
+        p.remapSourceIndices(originalIndices, sourceLength);
+
+        if (end == textLength)
+            break;
+
+        // \r\n (CRLF) should be treated as a single newline according to Unicode spec
+        if (end < textLength - 1 && text[end] == '\r' && text[end + 1] == '\n')
+            ++end;
+
+        start = end + 1;
+
+        // The text after the last newline belongs to the next paragraph, unless there is none
+        if (start == textLength && !endsText)
+            break;
+    }
+    while (true);
+
+#if defined(CEGUI_USE_RAQM)
+    if (rq)
+        raqm_destroy(rq);
+#endif
+}
+
 //----------------------------------------------------------------------------//
 bool RenderedText::renderText(const String& text, TextParser* parser,
     Font* defaultFont, DefaultParagraphDirection defaultParagraphDir)
 {
     d_paragraphs.clear();
     d_elements.clear();
+    d_paragraphHeights.clear();
     d_defaultFont = defaultFont;
+    d_defaultParagraphDir = defaultParagraphDir;
+    d_parsed = (parser != nullptr);
+    d_allParagraphsDirty = true;
 
     if (text.empty())
         return true;
 
+    // Identical text may already be laid out for another window
+    RenderedTextCache* cache = RenderedTextCache::getSingletonPtr();
+    if (cache && cache->find(text, parser, defaultFont, defaultParagraphDir, d_paragraphs, d_elements))
+    {
+        setHorizontalFormatting(d_horzFormatting);
+        setLastJustifiedLineFormatting(d_lastJustifiedLineFormatting);
+        setWordWrapEnabled(d_wordWrap);
+        updateParagraphHeights();
+        return true;
+    }
+
     // Parse a string and obtain UTF-32 text with embedded object placeholders but without tags
     std::u32string utf32Text;
     std::vector<size_t> originalIndices;
@@ -297,10 +376,8 @@ bool RenderedText::renderText(const String& text, TextParser* parser,
     if (utf32Text.empty())
         return true;
 
-    const size_t utf32TextLength = utf32Text.size();
-
     // There are characters without associated text style. Add a default one.
-    if (elementIndices.size() < utf32TextLength)
+    if (elementIndices.size() < utf32Text.size())
         d_elements.emplace_back(new RenderedTextStyle());
 
     // Characters without an explicit font must use a default font
@@ -315,63 +392,151 @@ bool RenderedText::renderText(const String& text, TextParser* parser,
         element->setFont(defaultFont);
     }
 
-#ifdef CEGUI_USE_RAQM
-    raqm_t* rq = nullptr;
-#endif
-
     // Perform layouting per paragraph
-    size_t start = 0;
     DefaultParagraphDirection lastBidiDir = DefaultParagraphDirection::LeftToRight;
-    do
-    {
-        size_t end = utf32Text.find_first_of(TextUtils::UTF32_NEWLINE_CHARACTERS, start);
-        if (end == std::u32string::npos)
-            end = utf32TextLength;
+    layoutParagraphs(d_paragraphs, utf32Text, originalIndices, text.size(), defaultParagraphDir,
+        elementIndices, d_elements, lastBidiDir, true);
 
-        // Always create a paragraph (new line), even if it is empty
-        d_paragraphs.emplace_back(static_cast<uint32_t>(start), static_cast<uint32_t>(end));
-        auto& p = d_paragraphs.back();
+    if (cache)
+        cache->add(text, parser, defaultFont, defaultParagraphDir, d_paragraphs, d_elements);
 
-        if (end > start)
-        {
-            // Create and setup a sequence of CEGUI glyphs for this paragraph
-#ifdef CEGUI_USE_RAQM
-            if (!layoutParagraphWithRaqm(p, utf32Text, start, end, defaultParagraphDir, elementIndices, d_elements, rq))
-#endif
-                layoutParagraph(p, utf32Text, start, end, defaultParagraphDir, elementIndices, d_elements);
+    // Push default formatting to paragraphs
+    // NB: there should not be early exit when unchanged, paragraphs will handle this
+    setHorizontalFormatting(d_horzFormatting);
+    setLastJustifiedLineFormatting(d_lastJustifiedLineFormatting);
+    setWordWrapEnabled(d_wordWrap);
 
-            // Inherit explicit direction from the previous text for direction neutral paragraphs
-            if (p.getBidiDirection() == DefaultParagraphDirection::Automatic)
-                p.setBidiDirection(lastBidiDir);
-            else
-                lastBidiDir = p.getBidiDirection();
+    updateParagraphHeights();
 
-            p.setupGlyphs(utf32Text, elementIndices, d_elements);
-        }
-
-        p.remapSourceIndices(originalIndices, text.size());
+    return true;
+}
 
-        if (end == utf32TextLength)
+//----------------------------------------------------------------------------//
+bool RenderedText::replaceText(const String& text, size_t start, size_t oldLength, size_t newLength,
+    TextParser* parser, Font* defaultFont, DefaultParagraphDirection defaultParagraphDir)
+{
+    // Tags may change the styles of any part of the text, so parsed text is always rendered anew
+    const size_t oldTextLength = endTextIndex();
+    if (parser || d_parsed || d_paragraphs.empty() || text.empty() || defaultFont != d_defaultFont ||
+            defaultParagraphDir != d_defaultParagraphDir || start + oldLength > oldTextLength ||
+            text.size() + oldLength != oldTextLength + newLength)
+        return renderText(text, parser, defaultFont, defaultParagraphDir);
+
+    // Find the paragraphs touched by the edit. Removing a newline joins the next paragraph.
+    float offsetY;
+    size_t first = findParagraphIndex(start, offsetY);
+    size_t last = findParagraphIndex(start + oldLength, offsetY);
+
+    // A CR at a boundary may form a CRLF pair with the text on the other side of it
+    const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(newLength) - static_cast<std::ptrdiff_t>(oldLength);
+    size_t regionStart;
+    size_t regionEnd;
+    while (true)
+    {
+        regionStart = d_paragraphs[first].getSourceStartIndex();
+        regionEnd = (last + 1 < d_paragraphs.size()) ?
+            d_paragraphs[last + 1].getSourceStartIndex() + diff : text.size();
+
+        if (first > 0 && text[regionStart - 1] == '\r')
+            --first;
+        else if (last + 1 < d_paragraphs.size() && text[regionEnd - 1] == '\r')
+            ++last;
+        else
             break;
+    }
 
-        // \r\n (CRLF) should be treated as a single newline according to Unicode spec
-        if (end < utf32TextLength - 1 && utf32Text[end] == '\r' && utf32Text[end + 1] == '\n')
-            ++end;
+    // Convert the affected part of the text, it is rendered verbatim
+    std::vector<size_t> originalIndices;
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_32)
+    const std::u32string utf32Text =
+        String::convertUtf8ToUtf32(text.c_str() + regionStart, regionEnd - regionStart, &originalIndices);
+#else
+    const std::u32string utf32Text = text.getString().substr(regionStart, regionEnd - regionStart);
+#endif
 
-        start = end + 1;
+    // Neutral paragraphs inherit the direction of the preceding text
+    auto getInheritedBidiDir = [this](size_t paragraphIndex)
+    {
+        while (paragraphIndex-- > 0)
+            if (d_paragraphs[paragraphIndex].getBidiDirection() != DefaultParagraphDirection::Automatic)
+                return d_paragraphs[paragraphIndex].getBidiDirection();
+        return DefaultParagraphDirection::LeftToRight;
+    };
+
+    const bool isLastParagraphReplaced = (last + 1 == d_paragraphs.size());
+    DefaultParagraphDirection lastBidiDir = getInheritedBidiDir(first);
+    std::vector<RenderedTextParagraph> paragraphs;
+    layoutParagraphs(paragraphs, utf32Text, originalIndices, regionEnd - regionStart, defaultParagraphDir,
+        std::vector<uint16_t>(), d_elements, lastBidiDir, isLastParagraphReplaced);
+
+    // A direction change would propagate to the following neutral paragraphs
+    if (!isLastParagraphReplaced && lastBidiDir != getInheritedBidiDir(last + 1))
+        return renderText(text, parser, defaultFont, defaultParagraphDir);
+
+    for (auto& p : paragraphs)
+    {
+        p.shiftSourceIndices(static_cast<std::ptrdiff_t>(regionStart));
+        p.setHorizontalFormatting(d_horzFormatting, false);
+        p.setLastJustifiedLineFormatting(d_lastJustifiedLineFormatting, false);
+        p.setWordWrapEnabled(d_wordWrap, false);
     }
-    while (true);
 
-    // Push default formatting to paragraphs
-    // NB: there should not be early exit when unchanged, paragraphs will handle this
-    setHorizontalFormatting(d_horzFormatting);
-    setLastJustifiedLineFormatting(d_lastJustifiedLineFormatting);
-    setWordWrapEnabled(d_wordWrap);
+    for (size_t i = last + 1; i < d_paragraphs.size(); ++i)
+        d_paragraphs[i].shiftSourceIndices(diff);
 
-#if defined(CEGUI_USE_RAQM)
-    if (rq)
-        raqm_destroy(rq);
-#endif
+    // Formatted paragraphs being removed no longer contribute to the extents
+    const size_t oldCount = last + 1 - first;
+    const size_t newCount = paragraphs.size();
+    if (!d_allParagraphsDirty)
+    {
+        const float extentsRight = d_extentsLeft + d_extents.d_width;
+        for (size_t i = first; i <= last; ++i)
+        {
+            const auto& p = d_paragraphs[i];
+            if (p.areLinesDirty())
+                continue;
+
+            if (!p.isFittingIntoAreaWidth())
+                --d_overflowingParagraphCount;
+
+            Rectf bounds;
+            p.accumulateExtents(bounds);
+            if ((bounds.left() <= d_extentsLeft && d_extentsLeft < 0.f) ||
+                    (bounds.right() >= extentsRight && extentsRight > 0.f))
+                d_extentsWidthDirty = true;
+        }
+
+        if (d_dirtyParagraphsStart >= d_dirtyParagraphsEnd)
+        {
+            d_dirtyParagraphsStart = first;
+            d_dirtyParagraphsEnd = first + newCount;
+        }
+        else
+        {
+            if (d_dirtyParagraphsEnd > last)
+                d_dirtyParagraphsEnd = d_dirtyParagraphsEnd + newCount - oldCount;
+            d_dirtyParagraphsStart = std::min(d_dirtyParagraphsStart, first);
+            d_dirtyParagraphsEnd = std::max(d_dirtyParagraphsEnd, first + newCount);
+        }
+    }
+
+    const size_t commonCount = std::min(oldCount, newCount);
+    std::move(paragraphs.begin(), paragraphs.begin() + commonCount, d_paragraphs.begin() + first);
+    if (newCount > oldCount)
+        d_paragraphs.insert(d_paragraphs.begin() + first + commonCount,
+            std::make_move_iterator(paragraphs.begin() + commonCount), std::make_move_iterator(paragraphs.end()));
+    else
+        d_paragraphs.erase(d_paragraphs.begin() + first + commonCount, d_paragraphs.begin() + last + 1);
+
+    if (newCount == oldCount)
+    {
+        for (size_t i = first; i <= last; ++i)
+            d_paragraphHeights.set(i, d_paragraphs[i].getHeight());
+    }
+    else
+    {
+        updateParagraphHeights();
+    }
 
     return true;
 }
@@ -389,6 +554,8 @@ void RenderedText::updateDynamicObjectExtents(const Window* hostWindow)
         if (diff.d_height)
             for (auto& p : d_paragraphs)
                 p.onElementHeightChanged(i, diff.d_height);
+        if (diff.d_width || diff.d_height)
+            d_allParagraphsDirty = true;
     }
 }
 
@@ -398,32 +565,89 @@ bool RenderedText::updateFormatting(float areaWidth)
     if (areaWidth < 0.f)
         return false;
 
-    const bool areaWidthChanged = (d_areaWidth != areaWidth);
-    d_areaWidth = areaWidth;
+    if (d_areaWidth != areaWidth)
+    {
+        d_areaWidth = areaWidth;
+        for (auto& p : d_paragraphs)
+            p.onAreaWidthChanged();
+        d_allParagraphsDirty = true;
+    }
 
     const float defaultFontHeight = d_defaultFont ? d_defaultFont->getFontHeight() : 0.f;
 
-    Rectf extents;
-    bool fitsIntoAreaWidth = true;
-    for (auto& p : d_paragraphs)
+    if (d_allParagraphsDirty)
     {
-        if (areaWidthChanged)
-            p.onAreaWidthChanged();
+        Rectf extents;
+        d_overflowingParagraphCount = 0;
+        for (auto& p : d_paragraphs)
+        {
+            p.updateLines(d_elements, areaWidth);
+            p.updateLineHeights(d_elements, defaultFontHeight);
+            p.updateHorizontalFormatting(areaWidth);
+
+            p.accumulateExtents(extents);
 
-        p.updateLines(d_elements, areaWidth);
-        p.updateLineHeights(d_elements, defaultFontHeight);
-        p.updateHorizontalFormatting(areaWidth);
+            if (!p.isFittingIntoAreaWidth())
+                ++d_overflowingParagraphCount;
+        }
+
+        d_extents = extents.getSize();
+        d_extentsLeft = extents.left();
+        updateParagraphHeights();
+    }
+    else if (d_dirtyParagraphsStart < d_dirtyParagraphsEnd)
+    {
+        // Only paragraphs laid out by replaceText need formatting, the rest is unchanged
+        Rectf changedExtents;
+        const size_t dirtyEnd = std::min(d_dirtyParagraphsEnd, d_paragraphs.size());
+        for (size_t i = d_dirtyParagraphsStart; i < dirtyEnd; ++i)
+        {
+            auto& p = d_paragraphs[i];
+            if (!p.areLinesDirty())
+                continue;
+
+            p.updateLines(d_elements, areaWidth);
+            p.updateLineHeights(d_elements, defaultFontHeight);
+            p.updateHorizontalFormatting(areaWidth);
 
-        p.accumulateExtents(extents);
+            p.accumulateExtents(changedExtents);
+            d_paragraphHeights.set(i, p.getHeight());
+
+            if (!p.isFittingIntoAreaWidth())
+                ++d_overflowingParagraphCount;
+        }
+
+        // The width must be found anew if the paragraphs at the edge got narrower
+        float left = d_extentsLeft;
+        float right = d_extentsLeft + d_extents.d_width;
+        if (d_extentsWidthDirty && (changedExtents.left() > left || changedExtents.right() < right))
+        {
+            Rectf extents;
+            for (const auto& p : d_paragraphs)
+                p.accumulateExtents(extents);
+            left = extents.left();
+            right = extents.right();
+        }
+        else
+        {
+            left = std::min(left, changedExtents.left());
+            right = std::max(right, changedExtents.right());
+        }
 
-        fitsIntoAreaWidth &= p.isFittingIntoAreaWidth();
+        d_extentsLeft = left;
+        d_extents.d_width = right - left;
+        d_extents.d_height = d_paragraphHeights.getTotal();
     }
 
-    d_extents = extents.getSize();
     if (d_paragraphs.empty())
         d_extents.d_height = defaultFontHeight;
 
-    return fitsIntoAreaWidth;
+    d_allParagraphsDirty = false;
+    d_extentsWidthDirty = false;
+    d_dirtyParagraphsStart = 0;
+    d_dirtyParagraphsEnd = 0;
+
+    return !d_overflowingParagraphCount;
 }
 
 //----------------------------------------------------------------------------//
@@ -432,8 +656,22 @@ void RenderedText::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     const SelectionInfo* selection) const
 {
     glm::vec2 penPosition = position;
-    for (const auto& p : d_paragraphs)
-        p.createRenderGeometry(out, penPosition, modColours, clipRect, selection, d_elements);
+
+    // Skip to the first visible paragraph
+    size_t i = 0;
+    if (clipRect && !d_paragraphHeights.empty())
+    {
+        i = std::min(d_paragraphHeights.lowerBound(clipRect->top() - position.y), d_paragraphs.size());
+        penPosition.y += d_paragraphHeights.getPrefixSum(i);
+    }
+
+    for (; i < d_paragraphs.size(); ++i)
+    {
+        if (clipRect && penPosition.y >= clipRect->bottom())
+            break;
+
+        d_paragraphs[i].createRenderGeometry(out, penPosition, modColours, clipRect, selection, d_elements);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -443,7 +681,10 @@ RenderedText RenderedText::clone() const
     for (const auto& component : d_elements)
         copy.d_elements.push_back(component->clone());
     copy.d_paragraphs = d_paragraphs;
+    copy.d_paragraphHeights = d_paragraphHeights;
     copy.d_defaultFont = d_defaultFont;
+    copy.d_defaultParagraphDir = d_defaultParagraphDir;
+    copy.d_parsed = d_parsed;
     copy.d_areaWidth = d_areaWidth;
     copy.d_horzFormatting = d_horzFormatting;
     copy.d_lastJustifiedLineFormatting = d_lastJustifiedLineFormatting;
@@ -455,6 +696,7 @@ RenderedText RenderedText::clone() const
 void RenderedText::setHorizontalFormatting(HorizontalTextFormatting fmt)
 {
     d_horzFormatting = fmt;
+    d_allParagraphsDirty = true;
 
     for (auto& p : d_paragraphs)
         if (p.isHorzFormattingDefault())
@@ -465,6 +707,7 @@ void RenderedText::setHorizontalFormatting(HorizontalTextFormatting fmt)
 void RenderedText::setLastJustifiedLineFormatting(HorizontalTextFormatting fmt)
 {
     d_lastJustifiedLineFormatting = fmt;
+    d_allParagraphsDirty = true;
 
     for (auto& p : d_paragraphs)
         if (p.isLastJustifiedLineFormattingDefault())
@@ -475,6 +718,7 @@ void RenderedText::setLastJustifiedLineFormatting(HorizontalTextFormatting fmt)
 void RenderedText::setWordWrapEnabled(bool wrap)
 {
     d_wordWrap = wrap;
+    d_allParagraphsDirty = true;
 
     for (auto& p : d_paragraphs)
         if (p.isWordWrapDefault())
@@ -508,29 +752,20 @@ size_t RenderedText::getTextIndexAtPoint(const glm::vec2& pt, float* outRelPos)
     if (pt.y > d_extents.d_height)
         return npos;
 
-    glm::vec2 localPt = pt;
-    for (size_t i = 0; i < d_paragraphs.size(); ++i)
-    {
-        const auto& p = d_paragraphs[i];
-
-        // Find the paragraph at the given height range
-        const float paragraphHeight = p.getHeight();
-        if (localPt.y > paragraphHeight)
-        {
-            localPt.y -= paragraphHeight;
-            continue;
-        }
+    // Find the paragraph at the given height range
+    const size_t i = d_paragraphHeights.lowerBound(pt.y);
+    if (i >= d_paragraphs.size())
+        return npos;
 
-        const auto idx = p.getTextIndexAtPoint(localPt, d_areaWidth, outRelPos);
+    const auto& p = d_paragraphs[i];
+    const glm::vec2 localPt(pt.x, pt.y - d_paragraphHeights.getPrefixSum(i));
+    const auto idx = p.getTextIndexAtPoint(localPt, d_areaWidth, outRelPos);
 
-        // No text at point means the end of the paragraph
-        if (idx == RenderedTextParagraph::npos)
-            return d_paragraphs[i].getSourceEndIndex();
+    // No text at point means the end of the paragraph
+    if (idx == RenderedTextParagraph::npos)
+        return p.getSourceEndIndex();
 
-        return idx;
-    }
-
-    return npos;
+    return idx;
 }
 
 //----------------------------------------------------------------------------//
@@ -724,17 +959,27 @@ size_t RenderedText::findParagraphIndex(size_t textIndex, float& offsetY) const
 {
     offsetY = 0.f;
 
-    const auto paragraphCount = d_paragraphs.size();
-    for (size_t i = 0; i < paragraphCount; ++i)
-    {
-        const auto& p = d_paragraphs[i];
-        if (i + 1 == paragraphCount || d_paragraphs[i + 1].getSourceStartIndex() > textIndex)
-            return i;
+    if (d_paragraphs.empty())
+        return 0;
 
-        offsetY += p.getHeight();
-    }
+    // The last paragraph starting at or before the index
+    const auto it = std::upper_bound(d_paragraphs.cbegin() + 1, d_paragraphs.cend(), textIndex,
+        [](size_t idx, const RenderedTextParagraph& p) { return idx < p.getSourceStartIndex(); });
+    const size_t i = static_cast<size_t>(std::distance(d_paragraphs.cbegin(), it)) - 1;
+
+    offsetY = d_paragraphHeights.getPrefixSum(i);
+    return i;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedText::updateParagraphHeights()
+{
+    std::vector<float> heights;
+    heights.reserve(d_paragraphs.size());
+    for (const auto& p : d_paragraphs)
+        heights.push_back(p.getHeight());
 
-    return paragraphCount;
+    d_paragraphHeights.assign(heights.cbegin(), heights.cend());
 }
 
 }
@@ -0,0 +1,220 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    LRU cache of laid out text shared by all RenderedText objects
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/text/RenderedTextCache.h"
+#include "CEGUI/text/RenderedTextStyle.h"
+#include <algorithm>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Singleton instance pointer
+template<> RenderedTextCache* Singleton<RenderedTextCache>::ms_Singleton = nullptr;
+
+//----------------------------------------------------------------------------//
+RenderedTextCache::RenderedTextCache() = default;
+
+//----------------------------------------------------------------------------//
+RenderedTextCache::~RenderedTextCache() = default;
+
+//----------------------------------------------------------------------------//
+RenderedTextCache& RenderedTextCache::getSingleton()
+{
+    return Singleton<RenderedTextCache>::getSingleton();
+}
+
+//----------------------------------------------------------------------------//
+RenderedTextCache* RenderedTextCache::getSingletonPtr()
+{
+    return Singleton<RenderedTextCache>::getSingletonPtr();
+}
+
+//----------------------------------------------------------------------------//
+size_t RenderedTextCache::KeyHasher::operator()(const Key& key) const
+{
+    size_t hash = std::hash<String>()(key.d_text);
+    hash ^= std::hash<const void*>()(key.d_parser) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<const void*>()(key.d_defaultFont) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<size_t>(key.d_dir) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderedTextCache::find(const String& text, const TextParser* parser,
+    const Font* defaultFont, DefaultParagraphDirection dir,
+    std::vector<RenderedTextParagraph>& paragraphs, std::vector<RenderedTextElementPtr>& elements)
+{
+    if (!d_enabled)
+        return false;
+
+    auto it = d_index.find(Key{ text, parser, defaultFont, dir });
+    if (it == d_index.end())
+    {
+        ++d_misses;
+        return false;
+    }
+
+    ++d_hits;
+
+    // Move to the front of the LRU order
+    d_entries.splice(d_entries.begin(), d_entries, it->second);
+
+    const Entry& entry = *it->second;
+    paragraphs = entry.d_paragraphs;
+    elements.clear();
+    elements.reserve(entry.d_elements.size());
+    for (const auto& element : entry.d_elements)
+        elements.push_back(element->clone());
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::add(const String& text, const TextParser* parser,
+    const Font* defaultFont, DefaultParagraphDirection dir,
+    const std::vector<RenderedTextParagraph>& paragraphs,
+    const std::vector<RenderedTextElementPtr>& elements)
+{
+    if (!d_enabled)
+        return;
+
+    Key key{ text, parser, defaultFont, dir };
+    if (d_index.find(key) != d_index.end())
+        return;
+
+    size_t memoryUsage = sizeof(Entry) + 4 * sizeof(void*) +
+        2 * text.size() * sizeof(String::value_type) +
+        paragraphs.size() * sizeof(RenderedTextParagraph) +
+        elements.size() * (sizeof(RenderedTextStyle) + sizeof(RenderedTextElementPtr));
+    for (const auto& paragraph : paragraphs)
+        memoryUsage += paragraph.glyphs().size() * sizeof(RenderedGlyph);
+
+    if (memoryUsage > d_memoryBudget)
+        return;
+
+    Entry entry{ std::move(key), paragraphs, {}, {}, memoryUsage };
+
+    // Embedded objects may reference images and windows, which can go away
+    entry.d_elements.reserve(elements.size());
+    for (const auto& element : elements)
+    {
+        if (!dynamic_cast<const RenderedTextStyle*>(element.get()))
+            return;
+
+        entry.d_elements.push_back(element->clone());
+
+        const Font* font = element->getFont();
+        if (std::find(entry.d_fonts.begin(), entry.d_fonts.end(), font) == entry.d_fonts.end())
+            entry.d_fonts.push_back(font);
+    }
+
+    d_entries.push_front(std::move(entry));
+    d_index.emplace(d_entries.front().d_key, d_entries.begin());
+    d_memoryUsage += memoryUsage;
+
+    trim();
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::invalidateFont(const Font* font)
+{
+    for (auto it = d_entries.begin(); it != d_entries.end(); )
+    {
+        auto next = std::next(it);
+
+        const auto& fonts = it->d_fonts;
+        if (it->d_key.d_defaultFont == font ||
+            std::find(fonts.begin(), fonts.end(), font) != fonts.end())
+        {
+            removeEntry(it);
+        }
+
+        it = next;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::clear()
+{
+    d_index.clear();
+    d_entries.clear();
+    d_memoryUsage = 0;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::setEnabled(bool enabled)
+{
+    d_enabled = enabled;
+    if (!enabled)
+        clear();
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::setMemoryBudget(size_t bytes)
+{
+    d_memoryBudget = bytes;
+    trim();
+}
+
+//----------------------------------------------------------------------------//
+RenderedTextCacheStats RenderedTextCache::getStats() const
+{
+    RenderedTextCacheStats stats;
+    stats.d_entryCount = d_entries.size();
+    stats.d_memoryUsage = d_memoryUsage;
+    stats.d_hits = d_hits;
+    stats.d_misses = d_misses;
+    stats.d_evictions = d_evictions;
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::resetStats()
+{
+    d_hits = 0;
+    d_misses = 0;
+    d_evictions = 0;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::removeEntry(EntryList::iterator it)
+{
+    d_memoryUsage -= it->d_memoryUsage;
+    d_index.erase(it->d_key);
+    d_entries.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+void RenderedTextCache::trim()
+{
+    while (d_memoryUsage > d_memoryBudget && !d_entries.empty())
+    {
+        removeEntry(std::prev(d_entries.end()));
+        ++d_evictions;
+    }
+}
+
+}
@@ -82,25 +82,29 @@ void RenderedTextParagraph::setupGlyphs(const std::u32string& text,
 //----------------------------------------------------------------------------//
 void RenderedTextParagraph::remapSourceIndices(const std::vector<size_t>& originalIndices, size_t sourceLength)
 {
-    if (originalIndices.empty())
-        return;
+    if (!originalIndices.empty())
+    {
+        const auto mapSize = originalIndices.size();
 
-    const auto mapSize = originalIndices.size();
+        for (auto& glyph : d_glyphs)
+        {
+            const auto utf32Index = glyph.sourceIndex;
+            glyph.sourceIndex = static_cast<uint32_t>(originalIndices[utf32Index]);
 
-    for (auto& glyph : d_glyphs)
-    {
-        const auto utf32Index = glyph.sourceIndex;
-        glyph.sourceIndex = static_cast<uint32_t>(originalIndices[utf32Index]);
+            // Cache source length to detect being in the middle of multibyte glyph
+            const auto nextIndex = (utf32Index + 1 < mapSize) ? originalIndices[utf32Index + 1] : sourceLength;
+            glyph.sourceLength = static_cast<uint8_t>(nextIndex - glyph.sourceIndex);
+        }
 
-        // Cache source length to detect being in the middle of multibyte glyph
-        const auto nextIndex = (utf32Index + 1 < mapSize) ? originalIndices[utf32Index + 1] : sourceLength;
-        glyph.sourceLength = static_cast<uint8_t>(nextIndex - glyph.sourceIndex);
+        d_sourceStartIndex = static_cast<uint32_t>(
+            (d_sourceStartIndex < mapSize) ? originalIndices[d_sourceStartIndex] : sourceLength);
+        d_sourceEndIndex = static_cast<uint32_t>(
+            (d_sourceEndIndex < mapSize) ? originalIndices[d_sourceEndIndex] : sourceLength);
     }
 
-    d_sourceStartIndex = static_cast<uint32_t>(
-        (d_sourceStartIndex < mapSize) ? originalIndices[d_sourceStartIndex] : sourceLength);
-    d_sourceEndIndex = static_cast<uint32_t>(
-        (d_sourceEndIndex < mapSize) ? originalIndices[d_sourceEndIndex] : sourceLength);
+    // Edits in preceding paragraphs must only move the paragraph, not every glyph in it
+    for (auto& glyph : d_glyphs)
+        glyph.sourceIndex -= d_sourceStartIndex;
 }
 
 //----------------------------------------------------------------------------//
@@ -111,6 +115,16 @@ void RenderedTextParagraph::createRenderGeometry(std::vector<GeometryBuffer*>& o
     if (d_linesDirty)
         return;
 
+    // Glyphs store source indices relative to the paragraph
+    SelectionInfo localSelection;
+    if (selection)
+    {
+        localSelection = *selection;
+        localSelection.start = (selection->start > d_sourceStartIndex) ? selection->start - d_sourceStartIndex : 0;
+        localSelection.end = (selection->end > d_sourceStartIndex) ? selection->end - d_sourceStartIndex : 0;
+        selection = &localSelection;
+    }
+
     // Advance the pen to the start of the next paragraph
     auto initialPenPos = penPosition;
     penPosition.y += d_height;
@@ -828,7 +842,7 @@ bool RenderedTextParagraph::getGlyphBounds(Rectf& out, bool* outRtl, size_t glyp
 //----------------------------------------------------------------------------//
 size_t RenderedTextParagraph::getTextIndex(size_t glyphIndex) const
 {
-    return (glyphIndex < d_glyphs.size()) ? d_glyphs[glyphIndex].sourceIndex : npos;
+    return (glyphIndex < d_glyphs.size()) ? d_sourceStartIndex + d_glyphs[glyphIndex].sourceIndex : npos;
 }
 
 //----------------------------------------------------------------------------//
@@ -844,23 +858,26 @@ size_t RenderedTextParagraph::getTextIndex(size_t lineIndex, float offsetX, floa
     if (idx >= d_glyphs.size())
         return d_sourceEndIndex;
 
-    return d_glyphs[std::min(static_cast<uint32_t>(idx), d_lines[lineIndex].glyphEndIdx - 1)].sourceIndex;
+    return d_sourceStartIndex + d_glyphs[std::min(static_cast<uint32_t>(idx), d_lines[lineIndex].glyphEndIdx - 1)].sourceIndex;
 }
 
 //----------------------------------------------------------------------------//
 size_t RenderedTextParagraph::getNearestGlyphIndex(size_t textIndex) const
 {
+    // Indices before the paragraph are nearest to its first glyph
+    const size_t relIndex = (textIndex > d_sourceStartIndex) ? textIndex - d_sourceStartIndex : 0;
+
     size_t nearestIdx = npos;
     size_t nearestSrcIdx = npos;
     for (size_t i = 0; i < d_glyphs.size(); ++i)
     {
         // Check if the glyph represents this very textIndex
         const auto srcIndex = d_glyphs[i].sourceIndex;
-        if (srcIndex <= textIndex && textIndex < srcIndex + d_glyphs[i].sourceLength)
+        if (srcIndex <= relIndex && relIndex < srcIndex + d_glyphs[i].sourceLength)
             return i;
 
         // Track the nearest existing glyph that goes after the requested position
-        if (textIndex < srcIndex && srcIndex < nearestSrcIdx)
+        if (relIndex < srcIndex && srcIndex < nearestSrcIdx)
         {
             nearestIdx = i;
             nearestSrcIdx = srcIndex;
@@ -968,7 +985,7 @@ size_t RenderedTextParagraph::getLineStartTextIndex(size_t lineIndex) const
     if (d_glyphs.empty())
         return d_sourceStartIndex;
 
-    return d_glyphs[d_lines[lineIndex].glyphStartIdx].sourceIndex;
+    return d_sourceStartIndex + d_glyphs[d_lines[lineIndex].glyphStartIdx].sourceIndex;
 }
 
 //----------------------------------------------------------------------------//
@@ -980,14 +997,14 @@ size_t RenderedTextParagraph::getLineEndTextIndex(size_t lineIndex) const
     if (lineIndex + 1 == d_lines.size())
         return d_sourceEndIndex;
 
-    return d_glyphs[d_lines[lineIndex].glyphEndIdx - 1].sourceIndex;
+    return d_sourceStartIndex + d_glyphs[d_lines[lineIndex].glyphEndIdx - 1].sourceIndex;
 }
 
 //----------------------------------------------------------------------------//
 size_t RenderedTextParagraph::nextTextIndex(size_t textIndex) const
 {
     const auto idx = getNearestGlyphIndex(textIndex);
-    return (idx + 1 < d_glyphs.size() && idx != npos) ? d_glyphs[idx + 1].sourceIndex : d_sourceEndIndex;
+    return (idx + 1 < d_glyphs.size() && idx != npos) ? d_sourceStartIndex + d_glyphs[idx + 1].sourceIndex : d_sourceEndIndex;
 }
 
 //----------------------------------------------------------------------------//
@@ -997,12 +1014,12 @@ size_t RenderedTextParagraph::prevTextIndex(size_t textIndex) const
     {
         // Handle paragraph ending (newline) which has no glyph
         const auto idx = getNearestGlyphIndex(d_sourceEndIndex - 1);
-        return (idx == npos) ? d_sourceEndIndex : d_glyphs[idx].sourceIndex;
+        return (idx == npos) ? d_sourceEndIndex : d_sourceStartIndex + d_glyphs[idx].sourceIndex;
     }
     else
     {
         const auto idx = getNearestGlyphIndex(textIndex);
-        return (idx == npos) ? d_sourceEndIndex : idx ? d_glyphs[idx - 1].sourceIndex : d_sourceStartIndex;
+        return (idx == npos) ? d_sourceEndIndex : idx ? d_sourceStartIndex + d_glyphs[idx - 1].sourceIndex : d_sourceStartIndex;
     }
 }
 
@@ -32,6 +32,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/Renderer.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/BitmapImage.h"
 #include "CEGUI/Vertex.h"
 
 namespace CEGUI
@@ -83,6 +84,35 @@ void RenderedTextStyle::createRenderGeometry(std::vector<GeometryBuffer*>& out,
         &System::getSingleton().getRenderer()->createGeometryBufferColoured() :
         nullptr;
 
+    // Quads of bitmap glyphs are collected and generated in one pass
+    std::vector<const BitmapImage*> batchImages;
+    std::vector<Rectf> batchAreas;
+    batchImages.reserve(count);
+    batchAreas.reserve(count);
+
+    const auto flushGlyphQuads = [&](const ImageRenderSettings& settings)
+    {
+        BitmapImage::createRenderGeometryBatch(out, batchImages.data(), batchAreas.data(),
+            batchImages.size(), settings, canCombineFromIdx);
+        batchImages.clear();
+        batchAreas.clear();
+    };
+
+    const auto addGlyphQuad = [&](const Image& image, const Rectf& destArea, ImageRenderSettings& settings)
+    {
+        if (auto bitmapImage = dynamic_cast<const BitmapImage*>(&image))
+        {
+            batchImages.push_back(bitmapImage);
+            batchAreas.push_back(destArea);
+            return;
+        }
+
+        // Keep the order of geometry
+        flushGlyphQuads(settings);
+        settings.d_destArea = destArea;
+        image.createRenderGeometry(out, settings, canCombineFromIdx);
+    };
+
     // Render the outline
     if (d_outlineSize > 0.f)
     {
@@ -95,8 +125,8 @@ void RenderedTextStyle::createRenderGeometry(std::vector<GeometryBuffer*>& out,
             // for each glyph: outline->getOrCreateImage(glyphIdx)!
             if (auto image = d_font->getOutline(glyph->fontGlyphIndex, d_outlineSize))
             {
-                outlineSettings.d_destArea.set(pos + glyph->offset * scale + image->getRenderedOffset() * scaleDiff, image->getRenderedSize() * scale);
-                image->createRenderGeometry(out, outlineSettings, canCombineFromIdx);
+                const Rectf destArea(pos + glyph->offset * scale + image->getRenderedOffset() * scaleDiff, image->getRenderedSize() * scale);
+                addGlyphQuad(*image, destArea, outlineSettings);
             }
 
             pos.x += glyph->advance;
@@ -104,6 +134,8 @@ void RenderedTextStyle::createRenderGeometry(std::vector<GeometryBuffer*>& out,
                 pos.x += justifySpaceSize;
         }
 
+        flushGlyphQuads(outlineSettings);
+
         if (effectBuffer)
             drawEffects(effectBuffer, penPosition.x, pos.x, pos.y, scale, d_outlineColours, clipRect, true);
     }
@@ -125,18 +157,20 @@ void RenderedTextStyle::createRenderGeometry(std::vector<GeometryBuffer*>& out,
         const bool newSelected = selection && glyph->sourceIndex >= selection->start && glyph->sourceIndex < selection->end;
         if (selected != newSelected)
         {
+            flushGlyphQuads(settings);
             drawEffects(effectBuffer, effectStart, pos.x, pos.y, scale, settings.d_multiplyColours, clipRect, false);
             effectStart = pos.x;
             selected = newSelected;
             settings.d_multiplyColours = selected ? selectedColour : normalColour;
         }
 
-        if (const FontGlyph* fontGlyph = d_font->getGlyph(glyph->fontGlyphIndex))
+        // Loading re-creates glyphs evicted from a shared atlas and marks them as used
+        if (const FontGlyph* fontGlyph = d_font->loadGlyph(glyph->fontGlyphIndex))
         {
             if (auto image = fontGlyph->getImage())
             {
-                settings.d_destArea.set(pos + glyph->offset * scale + image->getRenderedOffset() * scaleDiff, image->getRenderedSize() * scale);
-                image->createRenderGeometry(out, settings, canCombineFromIdx);
+                const Rectf destArea(pos + glyph->offset * scale + image->getRenderedOffset() * scaleDiff, image->getRenderedSize() * scale);
+                addGlyphQuad(*image, destArea, settings);
             }
         }
 
@@ -145,6 +179,8 @@ void RenderedTextStyle::createRenderGeometry(std::vector<GeometryBuffer*>& out,
             pos.x += justifySpaceSize;
     }
 
+    flushGlyphQuads(settings);
+
     if (effectBuffer)
     {
         drawEffects(effectBuffer, effectStart, pos.x, pos.y, scale, settings.d_multiplyColours, clipRect, false);
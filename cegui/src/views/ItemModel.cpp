@@ -38,6 +38,13 @@ const String ItemModel::EventChildrenRemoved("ChildrenRemoved");
 const String ItemModel::EventChildrenDataWillChange;
 const String ItemModel::EventChildrenDataChanged("ChildrenDataChanged");
 
+const EventId ItemModel::EventChildrenWillBeAddedId(EventChildrenWillBeAdded);
+const EventId ItemModel::EventChildrenAddedId(EventChildrenAdded);
+const EventId ItemModel::EventChildrenWillBeRemovedId(EventChildrenWillBeRemoved);
+const EventId ItemModel::EventChildrenRemovedId(EventChildrenRemoved);
+const EventId ItemModel::EventChildrenDataWillChangeId(EventChildrenDataWillChange);
+const EventId ItemModel::EventChildrenDataChangedId(EventChildrenDataChanged);
+
 //----------------------------------------------------------------------------//
 std::ostream& operator<< (std::ostream& os, const ModelIndex& arg)
 {
@@ -68,42 +75,42 @@ ItemModel::~ItemModel()
 void ItemModel::notifyChildrenWillBeAdded(ModelIndex parent_index, size_t start_id, size_t count)
 {
     ModelEventArgs args(this, parent_index, start_id, count);
-    fireEvent(EventChildrenWillBeAdded, args);
+    fireEvent(EventChildrenWillBeAddedId, args);
 }
 
 //----------------------------------------------------------------------------//
 void ItemModel::notifyChildrenAdded(ModelIndex parent_index, size_t start_id, size_t count)
 {
     ModelEventArgs args(this, parent_index, start_id, count);
-    fireEvent(EventChildrenAdded, args);
+    fireEvent(EventChildrenAddedId, args);
 }
 
 //----------------------------------------------------------------------------//
 void ItemModel::notifyChildrenWillBeRemoved(ModelIndex parent_index, size_t start_id, size_t count)
 {
     ModelEventArgs args(this, parent_index, start_id, count);
-    fireEvent(EventChildrenWillBeRemoved, args);
+    fireEvent(EventChildrenWillBeRemovedId, args);
 }
 
 //----------------------------------------------------------------------------//
 void ItemModel::notifyChildrenRemoved(ModelIndex parent_index, size_t start_id, size_t count)
 {
     ModelEventArgs args(this, parent_index, start_id, count);
-    fireEvent(EventChildrenRemoved, args);
+    fireEvent(EventChildrenRemovedId, args);
 }
 
 //----------------------------------------------------------------------------//
 void ItemModel::notifyChildrenDataWillChange(ModelIndex parent_index, size_t start_id, size_t count)
 {
     ModelEventArgs args(this, parent_index, start_id, count);
-    fireEvent(EventChildrenDataWillChange, args);
+    fireEvent(EventChildrenDataWillChangeId, args);
 }
 
 //----------------------------------------------------------------------------//
 void ItemModel::notifyChildrenDataChanged(ModelIndex parent_index, size_t start_id, size_t count)
 {
     ModelEventArgs args(this, parent_index, start_id, count);
-    fireEvent(EventChildrenDataChanged, args);
+    fireEvent(EventChildrenDataChangedId, args);
 }
 
 //----------------------------------------------------------------------------//
@@ -123,6 +123,13 @@ const String ItemView::EventMultiselectModeChanged("MultiselectModeChanged");
 const String ItemView::EventSortModeChanged("SortModeChanged");
 const String ItemView::EventViewContentsChanged("ViewContentsChanged");
 
+const EventId ItemView::EventVertScrollbarDisplayModeChangedId(EventVertScrollbarDisplayModeChanged);
+const EventId ItemView::EventHorzScrollbarDisplayModeChangedId(EventHorzScrollbarDisplayModeChanged);
+const EventId ItemView::EventSelectionChangedId(EventSelectionChanged);
+const EventId ItemView::EventMultiselectModeChangedId(EventMultiselectModeChanged);
+const EventId ItemView::EventSortModeChangedId(EventSortModeChanged);
+const EventId ItemView::EventViewContentsChangedId(EventViewContentsChanged);
+
 //----------------------------------------------------------------------------//
 ItemView::ItemView(const String& type, const String& name) :
     Window(type, name),
@@ -273,6 +280,7 @@ void ItemView::setModel(ItemModel* item_model)
 
     connectToModelEvents(d_itemModel);
     d_indexSelectionStates.clear();
+    d_selectedModelData.clear();
     d_needsFullRender = true;
 
     ItemViewEventArgs args(this);
@@ -318,6 +326,7 @@ bool ItemView::onChildrenAdded(const EventArgs& args)
 {
     const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
 
+    bool indices_changed = false;
     for (SelectionStatesVector::iterator itor = d_indexSelectionStates.begin();
         itor != d_indexSelectionStates.end(); ++itor)
     {
@@ -328,9 +337,18 @@ bool ItemView::onChildrenAdded(const EventArgs& args)
         {
             state.d_childId += model_args.d_count;
             state.d_selectedIndex = d_itemModel->makeIndex(state.d_childId, state.d_parentIndex);
+            indices_changed = true;
         }
     }
 
+    // the model data of the moved indices might have changed as well
+    if (indices_changed)
+    {
+        d_selectedModelData.clear();
+        for (const ModelIndexSelectionState& state : d_indexSelectionStates)
+            d_selectedModelData.insert(state.d_selectedIndex.d_modelData);
+    }
+
     invalidateView(false);
     WindowEventArgs evt_args(this);
     onViewContentsChanged(evt_args);
@@ -356,6 +374,7 @@ bool ItemView::onChildrenWillBeRemoved(const EventArgs& args)
             if (d_itemModel->areIndicesEqual(d_lastSelectedIndex, state.d_selectedIndex))
                 d_lastSelectedIndex = ModelIndex(nullptr);
 
+            d_selectedModelData.erase(state.d_selectedIndex.d_modelData);
             itor = d_indexSelectionStates.erase(itor);
         }
         else
@@ -396,7 +415,7 @@ bool ItemView::onChildrenDataChanged(const EventArgs&)
 void ItemView::onSelectionChanged(ItemViewEventArgs& args)
 {
     invalidateView(false);
-    fireEvent(EventSelectionChanged, args);
+    fireEvent(EventSelectionChangedId, args);
 }
 
 //----------------------------------------------------------------------------//
@@ -575,12 +594,18 @@ void ItemView::setIsDirty(bool value)
 int ItemView::getSelectedIndexPosition(const ModelIndex& index) const
 {
     if (d_itemModel == nullptr)
-        return false;
+        return -1;
+
+    const bool identified = d_itemModel->areIndicesIdentifiedByModelData();
+    if (identified && d_selectedModelData.find(index.d_modelData) == d_selectedModelData.end())
+        return -1;
 
     for (size_t i = 0; i < d_indexSelectionStates.size(); ++i)
     {
-        if (d_itemModel->areIndicesEqual(index, d_indexSelectionStates.at(i).d_selectedIndex))
-            return static_cast<uint32_t>(i);
+        const ModelIndex& selected_index = d_indexSelectionStates[i].d_selectedIndex;
+        if (identified ? selected_index.d_modelData == index.d_modelData
+                       : d_itemModel->areIndicesEqual(index, selected_index))
+            return static_cast<int>(i);
     }
 
     return -1;
@@ -589,7 +614,82 @@ int ItemView::getSelectedIndexPosition(const ModelIndex& index) const
 //----------------------------------------------------------------------------//
 bool ItemView::isIndexSelected(const ModelIndex& index) const
 {
-    return getSelectedIndexPosition(index) != -1;
+    if (d_itemModel == nullptr)
+        return false;
+
+    // models without identity need the linear scan with areIndicesEqual
+    if (!d_itemModel->areIndicesIdentifiedByModelData())
+        return getSelectedIndexPosition(index) != -1;
+
+    return d_selectedModelData.find(index.d_modelData) != d_selectedModelData.end();
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::addSelectionState(const ModelIndex& parent_index, size_t child_id)
+{
+    ModelIndexSelectionState selection_state;
+    selection_state.d_selectedIndex = d_itemModel->makeIndex(child_id, parent_index);
+
+    // ignore already selected indices
+    if (isIndexSelected(selection_state.d_selectedIndex))
+        return false;
+
+    d_selectedModelData.insert(selection_state.d_selectedIndex.d_modelData);
+
+    selection_state.d_childId = child_id;
+    selection_state.d_parentIndex = parent_index;
+
+    d_indexSelectionStates.push_back(selection_state);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::removeSelectionState(size_t position)
+{
+    d_selectedModelData.erase(d_indexSelectionStates[position].d_selectedIndex.d_modelData);
+    d_indexSelectionStates.erase(d_indexSelectionStates.begin() + position);
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::selectRange(const ModelIndex& parent_index, size_t start_child_id,
+                           size_t end_child_id)
+{
+    if (d_itemModel == nullptr || start_child_id > end_child_id ||
+        end_child_id >= d_itemModel->getChildCount(parent_index))
+        return false;
+
+    if (!d_isMultiSelectEnabled && start_child_id != end_child_id)
+        return false;
+
+    if (!d_isMultiSelectEnabled)
+        return setSelectedIndex(d_itemModel->makeIndex(start_child_id, parent_index));
+
+    bool changed = false;
+    for (size_t id = start_child_id; id <= end_child_id; ++id)
+        changed |= addSelectionState(parent_index, id);
+
+    if (!changed)
+        return false;
+
+    d_lastSelectedIndex = d_itemModel->makeIndex(end_child_id, parent_index);
+
+    ItemViewEventArgs args(this, d_lastSelectedIndex);
+    onSelectionChanged(args);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::selectAll()
+{
+    if (d_itemModel == nullptr)
+        return false;
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    const size_t child_count = d_itemModel->getChildCount(root_index);
+    if (child_count == 0)
+        return false;
+
+    return selectRange(root_index, 0, child_count - 1);
 }
 
 //----------------------------------------------------------------------------//
@@ -676,7 +776,7 @@ void ItemView::updateScrollbar(Scrollbar* scrollbar, float available_area,
 void ItemView::setVertScrollbarDisplayMode(ScrollbarDisplayMode mode)
 {
     updateScrollbarDisplayMode(d_vertScrollbarDisplayMode, mode,
-        EventVertScrollbarDisplayModeChanged);
+        EventVertScrollbarDisplayModeChangedId);
 }
 
 //----------------------------------------------------------------------------//
@@ -689,7 +789,7 @@ ScrollbarDisplayMode ItemView::getVertScrollbarDisplayMode() const
 void ItemView::setHorzScrollbarDisplayMode(ScrollbarDisplayMode mode)
 {
     updateScrollbarDisplayMode(d_horzScrollbarDisplayMode, mode,
-        EventHorzScrollbarDisplayModeChanged);
+        EventHorzScrollbarDisplayModeChangedId);
 }
 
 //----------------------------------------------------------------------------//
@@ -712,7 +812,7 @@ ItemViewWindowRenderer* ItemView::getViewRenderer()
 
 //----------------------------------------------------------------------------//
 void ItemView::updateScrollbarDisplayMode(ScrollbarDisplayMode& target_mode,
-    ScrollbarDisplayMode new_mode, String change_event)
+    ScrollbarDisplayMode new_mode, EventId change_event)
 {
     if (target_mode == new_mode)
         return;
@@ -775,7 +875,7 @@ void ItemView::setMultiSelectEnabled(bool enabled)
 //----------------------------------------------------------------------------//
 void ItemView::onMultiselectModeChanged(WindowEventArgs& args)
 {
-    fireEvent(EventMultiselectModeChanged, args, EventNamespace);
+    fireEvent(EventMultiselectModeChangedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -825,7 +925,7 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
     {
         if (!should_select)
         {
-            d_indexSelectionStates.erase(d_indexSelectionStates.begin() + index_position);
+            removeSelectionState(static_cast<size_t>(index_position));
 
             ItemViewEventArgs args(this, index);
             onSelectionChanged(args);
@@ -839,7 +939,7 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
     }
 
     if (!is_cumulative)
-        d_indexSelectionStates.clear();
+        clearSelections();
 
     ModelIndex parent_index = d_itemModel->getParentIndex(index);
     size_t end_child_id = d_itemModel->getChildId(index);
@@ -850,19 +950,7 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
     }
 
     for (size_t id = start_child_id; id <= end_child_id; ++id)
-    {
-        ModelIndexSelectionState selection_state;
-        selection_state.d_selectedIndex = d_itemModel->makeIndex(id, parent_index);
-
-        // ignore already selected indices
-        if (getSelectedIndexPosition(selection_state.d_selectedIndex) != -1)
-            continue;
-
-        selection_state.d_childId = id;
-        selection_state.d_parentIndex = parent_index;
-
-        d_indexSelectionStates.push_back(selection_state);
-    }
+        addSelectionState(parent_index, id);
 
     d_lastSelectedIndex = index;
 
@@ -896,19 +984,20 @@ void ItemView::onSortModeChanged(WindowEventArgs& args)
 {
     invalidateView(false);
     //TODO: make all events be triggered on view's event namespace.
-    fireEvent(EventSortModeChanged, args);
+    fireEvent(EventSortModeChangedId, args);
 }
 
 //----------------------------------------------------------------------------//
 void ItemView::onViewContentsChanged(WindowEventArgs& args)
 {
-    fireEvent(EventViewContentsChanged, args, EventNamespace);
+    fireEvent(EventViewContentsChangedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void ItemView::clearSelections()
 {
     d_indexSelectionStates.clear();
+    d_selectedModelData.clear();
 }
 
 //----------------------------------------------------------------------------//
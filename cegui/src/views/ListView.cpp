@@ -29,27 +29,13 @@
 #include "CEGUI/views/ListView.h"
 #include "CEGUI/falagard/XMLEnumHelper.h"
 #include "CEGUI/widgets/Scrollbar.h"
-#include <algorithm> // sort
+#include "CEGUI/text/Font.h"
+#include <algorithm> // sort, upper_bound
+#include <numeric> // iota
 
 namespace CEGUI
 {
 
-//----------------------------------------------------------------------------//
-static bool listViewItemPointerLess(
-    const ListViewItemRenderingState* item1,
-    const ListViewItemRenderingState* item2)
-{
-    return *item1 < *item2;
-}
-
-//----------------------------------------------------------------------------//
-static bool listViewItemPointerGreater(
-    const ListViewItemRenderingState* item1,
-    const ListViewItemRenderingState* item2)
-{
-    return *item1 > *item2;
-}
-
 //----------------------------------------------------------------------------//
 const String ListView::EventNamespace("ListView");
 const String ListView::WidgetTypeName("CEGUI/ListView");
@@ -93,6 +79,19 @@ ListView::ListView(const String& type, const String& name) :
         "WordWrap", "Property to enable/disable text word wrapping. Value is bool.",
         &ListView::setWordWrapEnabled, &ListView::isWordWrapEnabled,
         false);
+
+    CEGUI_DEFINE_PROPERTY(ListView, bool,
+        "Virtualization", "Property to enable/disable laying out only the "
+        "visible rows of the list. Value is bool.",
+        &ListView::setVirtualizationEnabled, &ListView::isVirtualizationEnabled,
+        false);
+
+    CEGUI_DEFINE_PROPERTY(ListView, std::uint32_t,
+        "VirtualizationMargin", "Property to get/set the number of rows laid out "
+        "above and below the visible area when virtualization is enabled. "
+        "Value is an unsigned integer.",
+        &ListView::setVirtualizationMargin, &ListView::getVirtualizationMargin,
+        8);
 }
 
 //----------------------------------------------------------------------------//
@@ -122,6 +121,38 @@ void ListView::setWordWrapEnabled(bool wrap)
     d_needsFullRender = true;
 }
 
+//----------------------------------------------------------------------------//
+void ListView::setVirtualizationEnabled(bool enabled)
+{
+    if (enabled == d_virtualizationEnabled)
+        return;
+
+    d_virtualizationEnabled = enabled;
+
+    // every row is laid out again by the next prepareForRender; until then the
+    // view holds no rows, so nothing can index the cleared items.
+    d_items.clear();
+    d_sortedItems.clear();
+    d_rowHeights.clear();
+    d_displayOrder.clear();
+    d_displayPositions.clear();
+    d_firstItemRow = 0;
+    updateRowOffsets(0);
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::setVirtualizationMargin(std::uint32_t rows)
+{
+    if (rows == d_virtualizationMargin)
+        return;
+
+    d_virtualizationMargin = rows;
+    if (d_virtualizationEnabled)
+        invalidateView(false);
+}
+
 //----------------------------------------------------------------------------//
 void ListView::prepareForRender()
 {
@@ -129,6 +160,13 @@ void ListView::prepareForRender()
     if (d_itemModel == nullptr || !isDirty())
         return;
 
+    if (d_virtualizationEnabled)
+    {
+        prepareVirtualizedItems();
+        d_needsFullRender = false;
+        return;
+    }
+
     if (d_needsFullRender)
     {
         d_renderedMaxWidth = d_renderedTotalHeight = 0;
@@ -137,6 +175,7 @@ void ListView::prepareForRender()
 
     ModelIndex root_index = d_itemModel->getRootIndex();
     size_t child_count = d_itemModel->getChildCount(root_index);
+    d_rowHeights.resize(child_count);
 
     for (size_t child = 0; child < child_count; ++child)
     {
@@ -146,6 +185,7 @@ void ListView::prepareForRender()
         {
             ListViewItemRenderingState state = ListViewItemRenderingState(this);
             updateItem(state, index, d_renderedMaxWidth, d_renderedTotalHeight);
+            d_rowHeights[child] = state.d_size.d_height;
             d_items.push_back(std::move(state));
         }
         else
@@ -154,13 +194,79 @@ void ListView::prepareForRender()
             d_renderedTotalHeight -= item.d_size.d_height;
 
             updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+            d_rowHeights[child] = item.d_size.d_height;
         }
     }
 
     updateScrollbars();
     setIsDirty(false);
-    resortListView();
     d_needsFullRender = false;
+    resortListView();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::prepareVirtualizedItems()
+{
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+
+    if (d_needsFullRender)
+    {
+        d_renderedMaxWidth = 0;
+        d_rowHeights.assign(d_itemModel->getChildCount(root_index),
+            getEstimatedRowHeight());
+        resortListView();
+        updateScrollbars();
+    }
+
+    d_items.clear();
+    d_sortedItems.clear();
+
+    const size_t row_count = d_displayOrder.size();
+    const float view_top = getVertScrollbar()->getScrollPosition();
+    const float view_bottom =
+        view_top + getViewRenderer()->getViewRenderArea().getHeight();
+
+    size_t first_row = getRowAtOffset(view_top);
+    first_row = first_row > d_virtualizationMargin ?
+        std::min(first_row - d_virtualizationMargin, row_count) : 0;
+
+    // rows above first_row keep their heights, so the offset of first_row is
+    // valid; only rows that get laid out can change the offsets after them.
+    float total_height = d_rowOffsets[first_row];
+    size_t changed_row = row_count;
+    size_t rows_below_view = 0;
+
+    for (size_t row = first_row; row < row_count; ++row)
+    {
+        if (total_height > view_bottom && ++rows_below_view > d_virtualizationMargin)
+            break;
+
+        const size_t child = d_displayOrder[row];
+        ListViewItemRenderingState item(this);
+        updateItem(item, d_itemModel->makeIndex(child, root_index),
+            d_renderedMaxWidth, total_height);
+
+        if (item.d_size.d_height != d_rowHeights[child])
+        {
+            d_rowHeights[child] = item.d_size.d_height;
+            changed_row = std::min(changed_row, row);
+        }
+
+        d_items.push_back(std::move(item));
+    }
+
+    d_firstItemRow = first_row;
+    for (auto& item : d_items)
+        d_sortedItems.push_back(&item);
+
+    if (changed_row < row_count)
+        updateRowOffsets(changed_row);
+
+    // clear the flag first: should the scrollbar update move the scroll
+    // position, the view gets invalidated again and the visible rows are laid
+    // out anew on the next pass.
+    setIsDirty(false);
+    updateScrollbars();
 }
 
 //----------------------------------------------------------------------------//
@@ -176,21 +282,49 @@ ModelIndex ListView::indexAtLocal(const glm::vec2& localPos)
     if (!render_area.isPointInRectf(localPos))
         return ModelIndex();
 
-    float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
-    //TODO: start only on the visible area
-    for (size_t index = 0; index < d_sortedItems.size(); ++index)
-    {
-        ListViewItemRenderingState* item = d_sortedItems.at(index);
-        Sizef size = item->d_size;
-        float next_height = cur_height + size.d_height;
+    const size_t row = getRowAtOffset(localPos.y - render_area.d_min.y +
+        getVertScrollbar()->getScrollPosition());
+    if (row >= d_displayOrder.size())
+        return ModelIndex();
 
-        if (localPos.y >= cur_height && localPos.y <= next_height)
-            return item->d_index;
+    return d_itemModel->makeIndex(d_displayOrder[row], d_itemModel->getRootIndex());
+}
 
-        cur_height = next_height;
-    }
+//----------------------------------------------------------------------------//
+size_t ListView::getRowAtOffset(float y) const
+{
+    const size_t row_count = d_displayOrder.size();
+    if (row_count == 0 || y < 0.0f)
+        return row_count;
+
+    const auto itor = std::upper_bound(d_rowOffsets.begin(), d_rowOffsets.end(), y);
+
+    // the bottom edge of the last row still belongs to it
+    if (itor == d_rowOffsets.end())
+        return y == d_rowOffsets.back() ? row_count - 1 : row_count;
+
+    return static_cast<size_t>(itor - d_rowOffsets.begin()) - 1;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateRowOffsets(size_t first_row)
+{
+    const size_t row_count = d_displayOrder.size();
+    d_rowOffsets.resize(row_count + 1);
+    if (first_row == 0)
+        d_rowOffsets[0] = 0.0f;
+
+    for (size_t row = first_row; row < row_count; ++row)
+        d_rowOffsets[row + 1] = d_rowOffsets[row] + d_rowHeights[d_displayOrder[row]];
+
+    d_renderedTotalHeight = d_rowOffsets.back();
+}
 
-    return ModelIndex();
+//----------------------------------------------------------------------------//
+float ListView::getEstimatedRowHeight() const
+{
+    const Font* font = getEffectiveFont();
+    return font ? font->getLineSpacing() : 0.0f;
 }
 
 //----------------------------------------------------------------------------//
@@ -199,19 +333,52 @@ const std::vector<ListViewItemRenderingState*>& ListView::getItems() const
     return d_sortedItems;
 }
 
+//----------------------------------------------------------------------------//
+float ListView::getItemsOffset() const
+{
+    return d_firstItemRow < d_rowOffsets.size() ? d_rowOffsets[d_firstItemRow] : 0.0f;
+}
+
 //----------------------------------------------------------------------------//
 void ListView::resortListView()
 {
-    d_sortedItems.clear();
+    const size_t row_count = d_rowHeights.size();
+    d_displayOrder.resize(row_count);
+    std::iota(d_displayOrder.begin(), d_displayOrder.end(), 0);
 
-    for (auto& item : d_items)
-        d_sortedItems.push_back(&item);
+    if (d_sortMode != ViewSortMode::NoSorting && d_itemModel != nullptr)
+    {
+        const ModelIndex root_index = d_itemModel->getRootIndex();
+        const int order = d_sortMode == ViewSortMode::Ascending ? 1 : -1;
+
+        std::sort(d_displayOrder.begin(), d_displayOrder.end(),
+            [this, &root_index, order](size_t child1, size_t child2)
+            {
+                return order * d_itemModel->compareIndices(
+                    d_itemModel->makeIndex(child1, root_index),
+                    d_itemModel->makeIndex(child2, root_index)) < 0;
+            });
+    }
 
-    if (d_sortMode == ViewSortMode::NoSorting)
-        return;
+    d_displayPositions.resize(row_count);
+    for (size_t row = 0; row < row_count; ++row)
+        d_displayPositions[d_displayOrder[row]] = row;
 
-    sort(d_sortedItems.begin(), d_sortedItems.end(),
-        d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    d_sortedItems.clear();
+    if (d_virtualizationEnabled)
+    {
+        // materialized rows belong to the old order; they are laid out again
+        // on the next prepareForRender.
+        d_items.clear();
+    }
+    else if (!d_needsFullRender)
+    {
+        for (size_t child : d_displayOrder)
+            d_sortedItems.push_back(&d_items.at(child));
+    }
+    d_firstItemRow = 0;
+
+    updateRowOffsets(0);
 }
 
 //----------------------------------------------------------------------------//
@@ -260,19 +427,37 @@ bool ListView::onChildrenAdded(const EventArgs& args)
     if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
-    std::vector<ListViewItemRenderingState> items;
-    for (size_t i = 0; i < margs.d_count; ++i)
+    // a pending full render lays out every row from scratch
+    if (d_needsFullRender)
     {
-        ListViewItemRenderingState item(this);
-
-        updateItem(item,
-            d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex),
-            d_renderedMaxWidth, d_renderedTotalHeight);
+        invalidateView(false);
+        return true;
+    }
 
-        items.push_back(std::move(item));
+    if (d_virtualizationEnabled)
+    {
+        d_rowHeights.insert(d_rowHeights.begin() + margs.d_startId,
+            margs.d_count, getEstimatedRowHeight());
     }
+    else
+    {
+        std::vector<ListViewItemRenderingState> items;
+        std::vector<float> heights;
+        for (size_t i = 0; i < margs.d_count; ++i)
+        {
+            ListViewItemRenderingState item(this);
 
-    d_items.insert(d_items.begin() + margs.d_startId, std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+            updateItem(item,
+                d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex),
+                d_renderedMaxWidth, d_renderedTotalHeight);
+
+            heights.push_back(item.d_size.d_height);
+            items.push_back(std::move(item));
+        }
+
+        d_items.insert(d_items.begin() + margs.d_startId, std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+        d_rowHeights.insert(d_rowHeights.begin() + margs.d_startId, heights.begin(), heights.end());
+    }
 
     //TODO: insert in the right place directly!
     resortListView();
@@ -289,12 +474,25 @@ bool ListView::onChildrenRemoved(const EventArgs& args)
     if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
-    auto begin = d_items.begin() + margs.d_startId;
-    auto end = begin + margs.d_count;
-    for (auto itor = begin; itor < end; ++itor)
-        d_renderedTotalHeight -= (*itor).d_size.d_height;
+    // a pending full render lays out every row from scratch
+    if (d_needsFullRender)
+    {
+        invalidateView(false);
+        return true;
+    }
+
+    if (!d_virtualizationEnabled)
+    {
+        auto begin = d_items.begin() + margs.d_startId;
+        auto end = begin + margs.d_count;
+        for (auto itor = begin; itor < end; ++itor)
+            d_renderedTotalHeight -= (*itor).d_size.d_height;
+
+        d_items.erase(begin, end);
+    }
 
-    d_items.erase(begin, end);
+    auto heights_begin = d_rowHeights.begin() + margs.d_startId;
+    d_rowHeights.erase(heights_begin, heights_begin + margs.d_count);
 
     resortListView();
     invalidateView(false);
@@ -305,18 +503,24 @@ bool ListView::onChildrenRemoved(const EventArgs& args)
 Rectf ListView::getIndexRect(const ModelIndex& index)
 {
     int child_id = d_itemModel->getChildId(index);
-    if (child_id == -1)
+    if (child_id == -1 || static_cast<size_t>(child_id) >= d_displayPositions.size())
     {
         return Rectf(0, 0, 0, 0);
     }
 
-    glm::vec2 pos(0, 0);
+    const size_t row = d_displayPositions[static_cast<size_t>(child_id)];
 
-    for (size_t i = 0; i < static_cast<size_t>(child_id); ++i)
+    // rows that are not laid out have no known width
+    float width = 0.0f;
+    if (!d_virtualizationEnabled)
     {
-        pos.y += d_items.at(i).d_size.d_height;
+        if (static_cast<size_t>(child_id) < d_items.size())
+            width = d_items[static_cast<size_t>(child_id)].d_size.d_width;
     }
+    else if (row >= d_firstItemRow && row - d_firstItemRow < d_sortedItems.size())
+        width = d_sortedItems[row - d_firstItemRow]->d_size.d_width;
 
-    return Rectf(pos, d_items.at(static_cast<size_t>(child_id)).d_size);
+    return Rectf(glm::vec2(0, d_rowOffsets[row]),
+        Sizef(width, d_rowOffsets[row + 1] - d_rowOffsets[row]));
 }
 }
@@ -63,6 +63,9 @@ const String TreeView::WidgetTypeName("CEGUI/TreeView");
 const String TreeView::EventSubtreeExpanded("SubtreeExpanded");
 const String TreeView::EventSubtreeCollapsed("SubtreeCollapsed");
 
+const EventId TreeView::EventSubtreeExpandedId(EventSubtreeExpanded);
+const EventId TreeView::EventSubtreeCollapsedId(EventSubtreeCollapsed);
+
 //----------------------------------------------------------------------------//
 TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_view) :
     d_totalChildCount(0),
@@ -71,27 +74,53 @@ TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_v
     d_childId(0),
     d_subtreeIsExpanded(false),
     d_nestedLevel(0),
+    d_rowHeight(0),
+    d_subtreeHeight(0),
+    d_renderedIndex(0),
     d_attachedTreeView(attached_tree_view)
 {
 }
 
 //----------------------------------------------------------------------------//
 void TreeViewItemRenderingState::sortChildren()
+{
+    for (auto& item : d_children)
+        item.sortChildren();
+
+    updateRenderedChildren();
+}
+
+//----------------------------------------------------------------------------//
+void TreeViewItemRenderingState::updateRenderedChildren()
 {
     d_renderedChildren.clear();
 
     for (auto& item : d_children)
-    {
         d_renderedChildren.push_back(&item);
-        item.sortChildren();
+
+    if (d_attachedTreeView->getSortMode() != ViewSortMode::NoSorting)
+    {
+        sort(d_renderedChildren.begin(), d_renderedChildren.end(),
+            d_attachedTreeView->getSortMode() == ViewSortMode::Ascending
+            ? &treeViewItemPointerLess : &treeViewItemPointerGreater);
     }
 
-    if (d_attachedTreeView->getSortMode() == ViewSortMode::NoSorting)
-        return;
+    for (size_t i = 0; i < d_renderedChildren.size(); ++i)
+        d_renderedChildren[i]->d_renderedIndex = i;
 
-    sort(d_renderedChildren.begin(), d_renderedChildren.end(),
-        d_attachedTreeView->getSortMode() == ViewSortMode::Ascending
-        ? &treeViewItemPointerLess : &treeViewItemPointerGreater);
+    updateChildrenHeights();
+}
+
+//----------------------------------------------------------------------------//
+void TreeViewItemRenderingState::updateChildrenHeights()
+{
+    std::vector<float> heights;
+    heights.reserve(d_renderedChildren.size());
+    for (const TreeViewItemRenderingState* item : d_renderedChildren)
+        heights.push_back(item->d_subtreeHeight);
+
+    d_childrenHeights.assign(heights.begin(), heights.end());
+    d_subtreeHeight = d_rowHeight + d_childrenHeights.getTotal();
 }
 
 //----------------------------------------------------------------------------//
@@ -120,7 +149,8 @@ bool TreeViewItemRenderingState::operator>(const TreeViewItemRenderingState& oth
 TreeView::TreeView(const String& type, const String& name) :
     ItemView(type, name),
     d_rootItemState(this),
-    d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin)
+    d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin),
+    d_incrementalLayout(false)
 {
     addTreeViewProperties();
 }
@@ -135,6 +165,13 @@ void TreeView::addTreeViewProperties()
         &TreeView::setSubtreeExpanderMargin, &TreeView::getSubtreeExpanderMargin,
         DefaultSubtreeExpanderMargin
         )
+
+    CEGUI_DEFINE_PROPERTY(TreeView, bool,
+        "IncrementalLayout", "Property to enable/disable laying out only the "
+        "items affected by a change. Value is either \"true\" or \"false\".",
+        &TreeView::setIncrementalLayoutEnabled, &TreeView::isIncrementalLayoutEnabled,
+        false
+        )
 }
 
 //----------------------------------------------------------------------------//
@@ -160,6 +197,12 @@ void TreeView::setSubtreeExpanderMargin(float value)
     d_subtreeExpanderMargin = value;
 }
 
+//----------------------------------------------------------------------------//
+void TreeView::setIncrementalLayoutEnabled(bool enabled)
+{
+    d_incrementalLayout = enabled;
+}
+
 //----------------------------------------------------------------------------//
 void TreeView::prepareForRender()
 {
@@ -188,6 +231,7 @@ void TreeView::prepareForRender()
             d_renderedMaxWidth, d_renderedTotalHeight);
     }
 
+    d_renderedTotalHeight = d_rootItemState.d_subtreeHeight;
     updateScrollbars();
     setIsDirty(false);
     d_needsFullRender = false;
@@ -228,17 +272,20 @@ void TreeView::computeRenderedChildrenForItem(TreeViewItemRenderingState &item,
     size_t child_count = d_itemModel->getChildCount(index);
     item.d_totalChildCount = child_count;
 
-    if (!item.d_subtreeIsExpanded)
-        return;
-
-    for (size_t child = 0; child < child_count; ++child)
+    // collapsed subtrees are never materialized
+    if (item.d_subtreeIsExpanded)
     {
-        item.d_children.push_back(
-            computeRenderingStateForIndex(index, child, item.d_nestedLevel + 1,
-            rendered_max_width, rendered_total_height));
+        item.d_children.reserve(child_count);
+        for (size_t child = 0; child < child_count; ++child)
+        {
+            item.d_children.push_back(
+                computeRenderingStateForIndex(index, child, item.d_nestedLevel + 1,
+                rendered_max_width, rendered_total_height));
+        }
     }
 
-    item.sortChildren();
+    // the children sorted their own subtrees when they were computed
+    item.updateRenderedChildren();
 }
 
 //----------------------------------------------------------------------------//
@@ -257,6 +304,8 @@ void TreeView::updateRenderingStateForItem(TreeViewItemRenderingState& item,
         child.d_nestedLevel = item.d_nestedLevel + 1;
         updateRenderingStateForItem(child, rendered_max_width, rendered_total_height);
     }
+
+    item.updateChildrenHeights();
 }
 
 //----------------------------------------------------------------------------//
@@ -275,6 +324,10 @@ void TreeView::fillRenderingState(TreeViewItemRenderingState& item,
         item.d_renderedText.updateDynamicObjectExtents(this);
         item.d_renderedText.updateFormatting(getPixelSize().d_width);
         item.d_size = item.d_renderedText.getExtents();
+
+        // rows are at least as tall as the subtree expander
+        item.d_rowHeight = std::max(item.d_size.d_height,
+            getViewRenderer()->getSubtreeExpanderSize().d_height);
     }
 
     const float indent = getViewRenderer()->getSubtreeExpanderXIndent(item.d_nestedLevel) +
@@ -304,48 +357,34 @@ ModelIndex TreeView::indexAtWithAction(const glm::vec2& localPos, TreeViewItemAc
     if (!render_area.isPointInRectf(localPos))
         return ModelIndex();
 
-    float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
-    bool handled = false;
-    return indexAtRecursive(d_rootItemState, cur_height, localPos, handled, action);
-}
-
-//----------------------------------------------------------------------------//
-ModelIndex TreeView::indexAtRecursive(TreeViewItemRenderingState& item,
-    float& cur_height, const glm::vec2& window_position, bool& handled,
-    TreeViewItemAction action)
-{
-    float next_height = cur_height + item.d_size.d_height;
-
-    if (window_position.y >= cur_height &&
-        window_position.y <= next_height)
+    // descend from the root, locating the child containing the offset in
+    // each level through its prefix sums of subtree heights.
+    float offset = localPos.y - render_area.d_min.y + getVertScrollbar()->getScrollPosition();
+    TreeViewItemRenderingState* item = &d_rootItemState;
+    while (item == &d_rootItemState || offset > item->d_rowHeight)
     {
-        handled = true;
+        offset -= item->d_rowHeight;
 
-        float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
-        float base_x = getViewRenderer()->getSubtreeExpanderXIndent(item.d_nestedLevel);
-        base_x -= getHorzScrollbar()->getScrollPosition();
-        if (window_position.x >= base_x &&
-            window_position.x <= base_x + expander_width)
-        {
-            (this->*action)(item, true);
+        const size_t child = item->d_childrenHeights.lowerBound(offset);
+        if (child >= item->d_renderedChildren.size())
             return ModelIndex();
-        }
 
-        (this->*action)(item, false);
-        return ModelIndex(d_itemModel->makeIndex(item.d_childId, item.d_parentIndex));
+        offset -= item->d_childrenHeights.getPrefixSum(child);
+        item = item->d_renderedChildren[child];
     }
 
-    cur_height = next_height;
-
-    for (size_t i = 0; i < item.d_renderedChildren.size(); ++i)
+    float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
+    float base_x = getViewRenderer()->getSubtreeExpanderXIndent(item->d_nestedLevel);
+    base_x -= getHorzScrollbar()->getScrollPosition();
+    if (localPos.x >= base_x &&
+        localPos.x <= base_x + expander_width)
     {
-        ModelIndex index = indexAtRecursive(*item.d_renderedChildren.at(i),
-            cur_height, window_position, handled, action);
-        if (handled)
-            return index;
+        (this->*action)(*item, true);
+        return ModelIndex();
     }
 
-    return ModelIndex();
+    (this->*action)(*item, false);
+    return ModelIndex(d_itemModel->makeIndex(item->d_childId, item->d_parentIndex));
 }
 
 //----------------------------------------------------------------------------//
@@ -378,6 +417,7 @@ void TreeView::toggleSubtree(TreeViewItemRenderingState& item)
         onSubtreeCollapsed(args);
     }
 
+    updateAncestorHeights(getIndexForItem(item));
     updateScrollbars();
     // we need just a simple invalidation. No need to redo the render state
     // as we modified it ourself directly.
@@ -390,11 +430,11 @@ void TreeView::clearItemRenderedChildren(TreeViewItemRenderingState& item, float
     for (auto& child : item.d_children)
     {
         clearItemRenderedChildren(child, renderedTotalHeight);
-        d_renderedTotalHeight -= item.d_size.d_height;
+        renderedTotalHeight -= child.d_size.d_height;
     }
 
     item.d_children.clear();
-    item.sortChildren();
+    item.updateRenderedChildren();
 }
 
 //----------------------------------------------------------------------------//
@@ -436,8 +476,14 @@ bool TreeView::onChildrenRemoved(const EventArgs& args)
 
     item->d_children.erase(begin, end);
 
-    item->sortChildren();
-    invalidateView(false);
+    item->updateRenderedChildren();
+    updateAncestorHeights(margs.d_parentIndex);
+
+    if (d_incrementalLayout)
+        updateViewExtents();
+    else
+        invalidateView(false);
+
     return true;
 }
 
@@ -472,25 +518,111 @@ bool TreeView::onChildrenAdded(const EventArgs& args)
         item->d_children.begin() + margs.d_startId,
         std::make_move_iterator(states.begin()), std::make_move_iterator(states.end()));
 
-    item->sortChildren();
-    invalidateView(false);
+    item->updateRenderedChildren();
+    updateAncestorHeights(margs.d_parentIndex);
+
+    if (d_incrementalLayout)
+        updateViewExtents();
+    else
+        invalidateView(false);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::onChildrenDataChanged(const EventArgs& args)
+{
+    if (!d_incrementalLayout)
+        return ItemView::onChildrenDataChanged(args);
+
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+    TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
+
+    if (item == nullptr || !item->d_subtreeIsExpanded)
+        return true;
+
+    const size_t end = std::min(margs.d_startId + margs.d_count, item->d_children.size());
+    for (size_t id = margs.d_startId; id < end; ++id)
+    {
+        fillRenderingState(item->d_children[id],
+            d_itemModel->makeIndex(id, margs.d_parentIndex),
+            d_renderedMaxWidth, d_renderedTotalHeight);
+        item->d_children[id].updateChildrenHeights();
+    }
+
+    // the changed data might affect the sort order as well
+    item->updateRenderedChildren();
+    updateAncestorHeights(margs.d_parentIndex);
+    updateViewExtents();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::onScrollPositionChanged(const EventArgs& args)
+{
+    if (!d_incrementalLayout)
+        return ItemView::onScrollPositionChanged(args);
+
+    // scrolling only moves the items; no need to lay them out again
+    invalidate(false);
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void TreeView::onSelectionChanged(ItemViewEventArgs& args)
+{
+    if (!d_incrementalLayout)
+    {
+        ItemView::onSelectionChanged(args);
+        return;
+    }
+
+    updateSelectionStates(d_rootItemState);
+    invalidate(false);
+    fireEvent(EventSelectionChangedId, args);
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateSelectionStates(TreeViewItemRenderingState& item)
+{
+    for (auto& child : item.d_children)
+    {
+        child.d_isSelected = isIndexSelected(
+            d_itemModel->makeIndex(child.d_childId, child.d_parentIndex));
+        updateSelectionStates(child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateViewExtents()
+{
+    updateScrollbars();
+    resizeToContent();
+    invalidate(false);
+}
+
 //----------------------------------------------------------------------------//
 void TreeView::onSubtreeExpanded(ItemViewEventArgs& args)
 {
-    fireEvent(EventSubtreeExpanded, args, EventNamespace);
+    fireEvent(EventSubtreeExpandedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void TreeView::onSubtreeCollapsed(ItemViewEventArgs& args)
 {
-    fireEvent(EventSubtreeCollapsed, args, EventNamespace);
+    fireEvent(EventSubtreeCollapsedId, args, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 TreeViewItemRenderingState* TreeView::getTreeViewItemForIndex(const ModelIndex& index)
+{
+    std::vector<TreeViewItemRenderingState*> path;
+    return getTreeViewItemPath(index, path) ? path.back() : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::getTreeViewItemPath(const ModelIndex& index,
+    std::vector<TreeViewItemRenderingState*>& path)
 {
     std::vector<int> ids_stack;
     ModelIndex root_index = d_itemModel->getRootIndex();
@@ -510,18 +642,49 @@ TreeViewItemRenderingState* TreeView::getTreeViewItemForIndex(const ModelIndex&
         !d_itemModel->areIndicesEqual(temp_index, root_index));
 
     TreeViewItemRenderingState* item = &d_rootItemState;
+    path.push_back(item);
     while(!ids_stack.empty())
     {
         int child_id = ids_stack.back();
         ids_stack.pop_back();
 
         if (static_cast<size_t>(child_id) >= item->d_children.size())
-            return nullptr;
+            return false;
 
         item = &item->d_children.at(child_id);
+        path.push_back(item);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+ModelIndex TreeView::getIndexForItem(const TreeViewItemRenderingState& item) const
+{
+    if (&item == &d_rootItemState)
+        return d_itemModel->getRootIndex();
+
+    return d_itemModel->makeIndex(item.d_childId, item.d_parentIndex);
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateAncestorHeights(const ModelIndex& index)
+{
+    std::vector<TreeViewItemRenderingState*> path;
+    if (getTreeViewItemPath(index, path))
+    {
+        // only the entries along the path change: O(depth * log(width))
+        for (size_t i = path.size() - 1; i > 0; --i)
+        {
+            TreeViewItemRenderingState& parent = *path[i - 1];
+            const TreeViewItemRenderingState& child = *path[i];
+
+            parent.d_childrenHeights.set(child.d_renderedIndex, child.d_subtreeHeight);
+            parent.d_subtreeHeight = parent.d_rowHeight + parent.d_childrenHeights.getTotal();
+        }
     }
 
-    return item;
+    d_renderedTotalHeight = d_rootItemState.d_subtreeHeight;
 }
 
 //----------------------------------------------------------------------------//
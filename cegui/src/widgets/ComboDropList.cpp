@@ -35,6 +35,8 @@ const String ComboDropList::EventNamespace("ComboDropList");
 const String ComboDropList::WidgetTypeName("CEGUI/ComboDropList");
 const String ComboDropList::EventListSelectionAccepted("ListSelectionAccepted");
 
+const EventId ComboDropList::EventListSelectionAcceptedId(EventListSelectionAccepted);
+
 //----------------------------------------------------------------------------//
 ComboDropList::ComboDropList(const String& type, const String& name)
     : ListWidget(type, name)
@@ -70,7 +72,7 @@ void ComboDropList::resizeToContent(bool fit_width, bool fit_height)
 //----------------------------------------------------------------------------//
 void ComboDropList::onListSelectionAccepted(WindowEventArgs& e)
 {
-	fireEvent(EventListSelectionAccepted, e, EventNamespace);
+	fireEvent(EventListSelectionAcceptedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -62,6 +62,23 @@ const String Combobox::EventDropListDisplayed("DropListDisplayed");
 const String Combobox::EventDropListRemoved("DropListRemoved");
 const String Combobox::EventListSelectionAccepted("ListSelectionAccepted");
 
+const EventId Combobox::EventReadOnlyModeChangedId(EventReadOnlyModeChanged);
+const EventId Combobox::EventValidationStringChangedId(EventValidationStringChanged);
+const EventId Combobox::EventMaximumTextLengthChangedId(EventMaximumTextLengthChanged);
+const EventId Combobox::EventTextValidityChangedId(EventTextValidityChanged);
+const EventId Combobox::EventCaretMovedId(EventCaretMoved);
+const EventId Combobox::EventTextSelectionChangedId(EventTextSelectionChanged);
+const EventId Combobox::EventEditboxFullId(EventEditboxFull);
+const EventId Combobox::EventTextAcceptedId(EventTextAccepted);
+const EventId Combobox::EventListContentsChangedId(EventListContentsChanged);
+const EventId Combobox::EventListSelectionChangedId(EventListSelectionChanged);
+const EventId Combobox::EventSortModeChangedId(EventSortModeChanged);
+const EventId Combobox::EventVertScrollbarModeChangedId(EventVertScrollbarModeChanged);
+const EventId Combobox::EventHorzScrollbarModeChangedId(EventHorzScrollbarModeChanged);
+const EventId Combobox::EventDropListDisplayedId(EventDropListDisplayed);
+const EventId Combobox::EventDropListRemovedId(EventDropListRemoved);
+const EventId Combobox::EventListSelectionAcceptedId(EventListSelectionAccepted);
+
 //----------------------------------------------------------------------------//
 Combobox::Combobox(const String& type, const String& name)
     : Window(type, name)
@@ -362,80 +379,80 @@ void Combobox::setItemSelectState(size_t item_index, bool state)
 //----------------------------------------------------------------------------//
 void Combobox::onReadOnlyChanged(WindowEventArgs& e)
 {
-	fireEvent(EventReadOnlyModeChanged, e, EventNamespace);
+	fireEvent(EventReadOnlyModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onValidationStringChanged(WindowEventArgs& e)
 {
-	fireEvent(EventValidationStringChanged, e, EventNamespace);
+	fireEvent(EventValidationStringChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onMaximumTextLengthChanged(WindowEventArgs& e)
 {
-	fireEvent(EventMaximumTextLengthChanged, e, EventNamespace);
+	fireEvent(EventMaximumTextLengthChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onTextValidityChanged(RegexMatchStateEventArgs& e)
 {
-	fireEvent(EventTextValidityChanged, e, EventNamespace);
+	fireEvent(EventTextValidityChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onCaretMoved(WindowEventArgs& e)
 {
-	fireEvent(EventCaretMoved, e, EventNamespace);
+	fireEvent(EventCaretMovedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onTextSelectionChanged(WindowEventArgs& e)
 {
-	fireEvent(EventTextSelectionChanged, e, EventNamespace);
+	fireEvent(EventTextSelectionChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onEditboxFullEvent(WindowEventArgs& e)
 {
-	fireEvent(EventEditboxFull, e, EventNamespace);
+	fireEvent(EventEditboxFullId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onTextAcceptedEvent(WindowEventArgs& e)
 {
     selectListItemWithEditboxText();
-	fireEvent(EventTextAccepted, e, EventNamespace);
+	fireEvent(EventTextAcceptedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onListContentsChanged(WindowEventArgs& e)
 {
-	fireEvent(EventListContentsChanged, e, EventNamespace);
+	fireEvent(EventListContentsChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onListSelectionChanged(WindowEventArgs& e)
 {
-	fireEvent(EventListSelectionChanged, e, EventNamespace);
+	fireEvent(EventListSelectionChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onSortModeChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSortModeChanged, e, EventNamespace);
+	fireEvent(EventSortModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onVertScrollbarModeChanged(WindowEventArgs& e)
 {
-	fireEvent(EventVertScrollbarModeChanged, e, EventNamespace);
+	fireEvent(EventVertScrollbarModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onHorzScrollbarModeChanged(WindowEventArgs& e)
 {
-	fireEvent(EventHorzScrollbarModeChanged, e, EventNamespace);
+	fireEvent(EventHorzScrollbarModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -443,7 +460,7 @@ void Combobox::onDropListDisplayed(WindowEventArgs& e)
 {
     getGUIContext().updateWindowContainingCursor();
     getPushButton()->setPushedState(true);
-	fireEvent(EventDropListDisplayed, e, EventNamespace);
+	fireEvent(EventDropListDisplayedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -451,13 +468,13 @@ void Combobox::onDroplistRemoved(WindowEventArgs& e)
 {
     getGUIContext().updateWindowContainingCursor();
     getPushButton()->setPushedState(false);
-	fireEvent(EventDropListRemoved, e, EventNamespace);
+	fireEvent(EventDropListRemovedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Combobox::onListSelectionAccepted(WindowEventArgs& e)
 {
-	fireEvent(EventListSelectionAccepted, e, EventNamespace);
+	fireEvent(EventListSelectionAcceptedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
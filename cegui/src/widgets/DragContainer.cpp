@@ -47,6 +47,15 @@ const String DragContainer::EventDragCursorChanged("DragCursorChanged");
 const String DragContainer::EventDragThresholdChanged("DragThresholdChanged");
 const String DragContainer::EventDragDropTargetChanged("DragDropTargetChanged");
 
+const EventId DragContainer::EventDragStartedId(EventDragStarted);
+const EventId DragContainer::EventDragEndedId(EventDragEnded);
+const EventId DragContainer::EventDragPositionChangedId(EventDragPositionChanged);
+const EventId DragContainer::EventDragEnabledChangedId(EventDragEnabledChanged);
+const EventId DragContainer::EventDragAlphaChangedId(EventDragAlphaChanged);
+const EventId DragContainer::EventDragCursorChangedId(EventDragCursorChanged);
+const EventId DragContainer::EventDragThresholdChangedId(EventDragThresholdChanged);
+const EventId DragContainer::EventDragDropTargetChangedId(EventDragDropTargetChanged);
+
 //////////////////////////////////////////////////////////////////////////
 
 DragContainer::DragContainer(const String& type, const String& name) :
@@ -375,7 +384,7 @@ void DragContainer::onDragStarted(CursorInputEventArgs& e)
 
     d_dragging = true;
 
-    fireEvent(EventDragStarted, e, EventNamespace);
+    fireEvent(EventDragStartedId, e, EventNamespace);
 
     // Handle possible endDragging() caused by event handlers
     if (!d_dragging)
@@ -391,13 +400,13 @@ void DragContainer::onDragStarted(CursorInputEventArgs& e)
 //----------------------------------------------------------------------------//
 void DragContainer::onDragEnded(WindowEventArgs& e)
 {
-    fireEvent(EventDragEnded, e, EventNamespace);
+    fireEvent(EventDragEndedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void DragContainer::onDragPositionChanged(CursorMoveEventArgs& e)
 {
-    fireEvent(EventDragPositionChanged, e, EventNamespace);
+    fireEvent(EventDragPositionChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -451,7 +460,7 @@ void DragContainer::updateDropTarget()
 //----------------------------------------------------------------------------//
 void DragContainer::onDragEnabledChanged(WindowEventArgs& e)
 {
-    fireEvent(EventDragEnabledChanged, e, EventNamespace);
+    fireEvent(EventDragEnabledChangedId, e, EventNamespace);
 
     // abort current drag operation if dragging gets disabled part way through
     if (!d_draggingEnabled)
@@ -461,7 +470,7 @@ void DragContainer::onDragEnabledChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void DragContainer::onDragAlphaChanged(WindowEventArgs& e)
 {
-    fireEvent(EventDragAlphaChanged, e, EventNamespace);
+    fireEvent(EventDragAlphaChangedId, e, EventNamespace);
 
     if (d_dragging)
     {
@@ -473,7 +482,7 @@ void DragContainer::onDragAlphaChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void DragContainer::onDragCursorChanged(WindowEventArgs& e)
 {
-    fireEvent(EventDragCursorChanged, e, EventNamespace);
+    fireEvent(EventDragCursorChangedId, e, EventNamespace);
 
     updateActiveCursorImage();
 }
@@ -481,13 +490,13 @@ void DragContainer::onDragCursorChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void DragContainer::onDragThresholdChanged(WindowEventArgs& e)
 {
-    fireEvent(EventDragThresholdChanged, e, EventNamespace);
+    fireEvent(EventDragThresholdChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void DragContainer::onDragDropTargetChanged(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropTargetChanged, e, EventNamespace);
+    fireEvent(EventDragDropTargetChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
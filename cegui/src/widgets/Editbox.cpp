@@ -37,6 +37,8 @@ const String Editbox::EventNamespace("Editbox");
 const String Editbox::WidgetTypeName("CEGUI/Editbox");
 const String Editbox::EventTextAccepted("TextAccepted");
 
+const EventId Editbox::EventTextAcceptedId(EventTextAccepted);
+
 //----------------------------------------------------------------------------//
 EditboxWindowRenderer::EditboxWindowRenderer(const String& name) :
     WindowRenderer(name, Editbox::EventNamespace)
@@ -159,7 +161,7 @@ void Editbox::processKeyDownEvent(KeyEventArgs& e)
 //----------------------------------------------------------------------------//
 void Editbox::onTextAcceptedEvent(WindowEventArgs& e)
 {
-    fireEvent(EventTextAccepted, e, EventNamespace);
+    fireEvent(EventTextAcceptedId, e, EventNamespace);
 }
 
 }
@@ -41,6 +41,7 @@
 #   include "CEGUI/StdRegexMatcher.h"
 #endif
 #include <string.h>
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -57,6 +58,17 @@ const String EditboxBase::EventEditboxFull("EditboxFull");
 const String EditboxBase::EventValidationStringChanged("ValidationStringChanged");
 const String EditboxBase::EventTextValidityChanged("TextValidityChanged");
 
+const EventId EditboxBase::EventReadOnlyModeChangedId(EventReadOnlyModeChanged);
+const EventId EditboxBase::EventTextMaskingEnabledChangedId(EventTextMaskingEnabledChanged);
+const EventId EditboxBase::EventTextMaskingCodepointChangedId(EventTextMaskingCodepointChanged);
+const EventId EditboxBase::EventMaximumTextLengthChangedId(EventMaximumTextLengthChanged);
+const EventId EditboxBase::EventDefaultParagraphDirectionChangedId(EventDefaultParagraphDirectionChanged);
+const EventId EditboxBase::EventCaretMovedId(EventCaretMoved);
+const EventId EditboxBase::EventTextSelectionChangedId(EventTextSelectionChanged);
+const EventId EditboxBase::EventEditboxFullId(EventEditboxFull);
+const EventId EditboxBase::EventValidationStringChangedId(EventValidationStringChanged);
+const EventId EditboxBase::EventTextValidityChangedId(EventTextValidityChanged);
+
 //----------------------------------------------------------------------------//
 static RegexMatcher* createRegexMatcher()
 {
@@ -103,12 +115,18 @@ void EditboxBase::updateRenderedText()
             const String maskedText(getText().size(), static_cast<char32_t>(d_textMaskingCodepoint));
             d_renderedText.renderText(maskedText, nullptr, getEffectiveFont(), d_defaultParagraphDirection);
         }
+        else if (d_renderedTextEdited)
+        {
+            d_renderedText.replaceText(getText(), d_textEditStart, d_textEditOldLength, d_textEditNewLength,
+                nullptr, getEffectiveFont(), d_defaultParagraphDirection);
+        }
         else
         {
             d_renderedText.renderText(getText(), nullptr, getEffectiveFont(), d_defaultParagraphDirection);
         }
 
         d_renderedTextDirty = false;
+        d_renderedTextEdited = false;
         d_formattingDirty = true;
     }
 
@@ -168,7 +186,8 @@ void EditboxBase::setTextMaskingEnabled(bool setting)
 
     d_textMaskingEnabled = setting;
 
-    d_renderedTextDirty = false;
+    d_renderedTextDirty = true;
+    d_renderedTextEdited = false;
     invalidate();
 
     WindowEventArgs args(this);
@@ -185,7 +204,8 @@ void EditboxBase::setTextMaskingCodepoint(std::uint32_t codePoint)
 
     if (d_textMaskingEnabled)
     {
-        d_renderedTextDirty = false;
+        d_renderedTextDirty = true;
+        d_renderedTextEdited = false;
         invalidate();
     }
 
@@ -240,9 +260,10 @@ void EditboxBase::setDefaultParagraphDirection(DefaultParagraphDirection default
 
     d_defaultParagraphDirection = defaultParagraphDirection;
     d_renderedTextDirty = true;
+    d_renderedTextEdited = false;
 
     WindowEventArgs eventArgs(this);
-    fireEvent(EventDefaultParagraphDirectionChanged, eventArgs, EventNamespace);
+    fireEvent(EventDefaultParagraphDirectionChangedId, eventArgs, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -434,7 +455,7 @@ bool EditboxBase::insertString(String&& strToInsert)
     undoInsert.d_startIdx = insertPos;
     undoInsert.d_text = std::move(strToInsert);
 
-    setText(tmp);
+    setEditedText(tmp, insertPos, selLength, undoInsert.d_text.size());
 
     d_undoHandler->addUndoHistory(undoInsert);
     if (selLength)
@@ -478,11 +499,37 @@ void EditboxBase::deleteRange(size_t start, size_t length)
     clearSelection();
     ensureCaretIsVisible();
 
-    setText(tmp);
+    setEditedText(tmp, start, std::min(length, text.size() - start), 0);
 
     d_undoHandler->addUndoHistory(undoDelete);
 }
 
+//----------------------------------------------------------------------------//
+void EditboxBase::setEditedText(const String& text, size_t start, size_t oldLength, size_t newLength)
+{
+    const bool canEditRenderedText = !d_renderedTextDirty || d_renderedTextEdited;
+    if (!d_renderedTextDirty)
+    {
+        d_textEditStart = start;
+        d_textEditOldLength = oldLength;
+        d_textEditNewLength = newLength;
+    }
+    else if (d_renderedTextEdited)
+    {
+        // Merge with the previous edit into one range covering both
+        const size_t mergedStart = std::min(d_textEditStart, start);
+        const size_t mergedEnd = std::max(d_textEditStart + d_textEditNewLength, start + oldLength);
+        d_textEditOldLength = mergedEnd - mergedStart - d_textEditNewLength + d_textEditOldLength;
+        d_textEditNewLength = mergedEnd - mergedStart - oldLength + newLength;
+        d_textEditStart = mergedStart;
+    }
+
+    setText(text);
+
+    // onTextChanged marks the rendered text dirty, applying the edit is enough to update it
+    d_renderedTextEdited = canEditRenderedText && d_renderedTextDirty;
+}
+
 //----------------------------------------------------------------------------//
 void EditboxBase::handleCaretMovement(size_t newIndex, bool select)
 {
@@ -784,6 +831,7 @@ void EditboxBase::onFontChanged(WindowEventArgs& e)
     if (d_renderedText.getDefaultFont() != getEffectiveFont())
     {
         d_renderedTextDirty = true;
+        d_renderedTextEdited = false;
         invalidate();
     }
 }
@@ -801,6 +849,7 @@ void EditboxBase::onTextChanged(WindowEventArgs& e)
         setCaretIndex(textLen);
 
     d_renderedTextDirty = true;
+    d_renderedTextEdited = false;
     invalidate();
 
     ++e.handled;
@@ -814,7 +863,7 @@ void EditboxBase::onCharacter(TextEventArgs& e)
     // events, we want such propagation to cease with us regardless of whether
     // we actually handle the event.
 
-    fireEvent(EventCharacterKey, e, Window::EventNamespace);
+    fireEvent(EventCharacterKeyId, e, Window::EventNamespace);
 
     if (e.handled || !hasInputFocus() || !getEffectiveFont()->isCodepointAvailable(e.d_character))
         return;
@@ -837,57 +886,57 @@ void EditboxBase::handleSelectAll()
 void EditboxBase::onReadOnlyChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventReadOnlyModeChanged, e, EventNamespace);
+    fireEvent(EventReadOnlyModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onTextMaskingEnabledChanged(WindowEventArgs& e)
 {
-    fireEvent(EventTextMaskingEnabledChanged , e, EventNamespace);
+    fireEvent(EventTextMaskingEnabledChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onTextMaskingCodepointChanged(WindowEventArgs& e)
 {
-    fireEvent(EventTextMaskingCodepointChanged , e, EventNamespace);
+    fireEvent(EventTextMaskingCodepointChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onMaximumTextLengthChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMaximumTextLengthChanged , e, EventNamespace);
+    fireEvent(EventMaximumTextLengthChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onCaretMoved(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventCaretMoved, e, EventNamespace);
+    fireEvent(EventCaretMovedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onTextSelectionChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventTextSelectionChanged , e, EventNamespace);
+    fireEvent(EventTextSelectionChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onEditboxFullEvent(WindowEventArgs& e)
 {
-    fireEvent(EventEditboxFull, e, EventNamespace);
+    fireEvent(EventEditboxFullId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onValidationStringChanged(WindowEventArgs& e)
 {
-    fireEvent(EventValidationStringChanged, e, EventNamespace);
+    fireEvent(EventValidationStringChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void EditboxBase::onTextValidityChanged(RegexMatchStateEventArgs& e)
 {
-    fireEvent(EventTextValidityChanged, e, EventNamespace);
+    fireEvent(EventTextValidityChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -943,6 +992,7 @@ bool EditboxBase::handleFontRenderSizeChange(const Font& font)
     if (getEffectiveFont() == &font)
     {
         d_renderedTextDirty = true;
+        d_renderedTextEdited = false;
         invalidate();
         return true;
     }
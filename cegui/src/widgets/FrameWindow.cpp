@@ -40,6 +40,11 @@ const String FrameWindow::EventRollupToggled("RollupToggled");
 const String FrameWindow::EventCloseClicked("CloseClicked");
 const String FrameWindow::EventDragSizingStarted("DragSizingStarted");
 const String FrameWindow::EventDragSizingEnded("DragSizingEnded");
+
+const EventId FrameWindow::EventRollupToggledId(EventRollupToggled);
+const EventId FrameWindow::EventCloseClickedId(EventCloseClicked);
+const EventId FrameWindow::EventDragSizingStartedId(EventDragSizingStarted);
+const EventId FrameWindow::EventDragSizingEndedId(EventDragSizingEnded);
 const String FrameWindow::TitlebarName( "__auto_titlebar__" );
 const String FrameWindow::CloseButtonName( "__auto_closebutton__" );
 
@@ -379,13 +384,13 @@ void FrameWindow::onRollupToggled(WindowEventArgs& e)
     // TODO: need to check necessity of auto-sizing disabling
     notifyScreenAreaChanged(false);
 
-    fireEvent(EventRollupToggled, e, EventNamespace);
+    fireEvent(EventRollupToggledId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void FrameWindow::onCloseClicked(WindowEventArgs& e)
 {
-    fireEvent(EventCloseClicked, e, EventNamespace);
+    fireEvent(EventCloseClickedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -543,13 +548,13 @@ PushButton* FrameWindow::getCloseButton() const
 //----------------------------------------------------------------------------//
 void FrameWindow::onDragSizingStarted(WindowEventArgs& e)
 {
-    fireEvent(EventDragSizingStarted, e, EventNamespace);
+    fireEvent(EventDragSizingStartedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void FrameWindow::onDragSizingEnded(WindowEventArgs& e)
 {
-    fireEvent(EventDragSizingEnded, e, EventNamespace);
+    fireEvent(EventDragSizingEndedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -35,6 +35,8 @@ namespace CEGUI
 const String ItemEntry::WidgetTypeName("CEGUI/ItemEntry");
 const String ItemEntry::EventSelectionChanged("SelectionChanged");
 
+const EventId ItemEntry::EventSelectionChangedId(EventSelectionChanged);
+
 //----------------------------------------------------------------------------//
 ItemEntryWindowRenderer::ItemEntryWindowRenderer(const String& name) :
     WindowRenderer(name, "ItemEntry")
@@ -90,7 +92,7 @@ void ItemEntry::setSelectable(bool setting)
 void ItemEntry::onSelectionChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventSelectionChanged, e, EventNamespace);
+    fireEvent(EventSelectionChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -79,6 +79,10 @@ const String ItemListBase::EventListContentsChanged( "ListContentsChanged" );
 const String ItemListBase::EventSortEnabledChanged("SortEnabledChanged");
 const String ItemListBase::EventSortModeChanged("SortModeChanged");
 
+const EventId ItemListBase::EventListContentsChangedId(EventListContentsChanged);
+const EventId ItemListBase::EventSortEnabledChangedId(EventSortEnabledChanged);
+const EventId ItemListBase::EventSortModeChangedId(EventSortModeChanged);
+
 /*************************************************************************
 	Constructor for ItemListBase base class.
 *************************************************************************/
@@ -343,7 +347,7 @@ void ItemListBase::onListContentsChanged(WindowEventArgs& e)
 
         d_resort = false;
 
-	    fireEvent(EventListContentsChanged, e, EventNamespace);
+	    fireEvent(EventListContentsChangedId, e, EventNamespace);
 	}
 }
 
@@ -621,7 +625,7 @@ void ItemListBase::setSortCallback(SortCallback cb)
 ************************************************************************/
 void ItemListBase::onSortEnabledChanged(WindowEventArgs& e)
 {
-    fireEvent(EventSortEnabledChanged, e);
+    fireEvent(EventSortEnabledChangedId, e);
 }
 
 /************************************************************************
@@ -629,7 +633,7 @@ void ItemListBase::onSortEnabledChanged(WindowEventArgs& e)
 ************************************************************************/
 void ItemListBase::onSortModeChanged(WindowEventArgs& e)
 {
-    fireEvent(EventSortModeChanged, e);
+    fireEvent(EventSortModeChangedId, e);
 }
 
 /************************************************************************
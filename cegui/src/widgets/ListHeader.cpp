@@ -61,6 +61,19 @@ const String ListHeader::EventDragMoveSettingChanged( "DragMoveSettingChanged" )
 const String ListHeader::EventDragSizeSettingChanged( "DragSizeSettingChanged" );
 const String ListHeader::EventSegmentRenderOffsetChanged( "SegmentRenderOffsetChanged" );
 
+const EventId ListHeader::EventSortColumnChangedId(EventSortColumnChanged);
+const EventId ListHeader::EventSortDirectionChangedId(EventSortDirectionChanged);
+const EventId ListHeader::EventSegmentSizedId(EventSegmentSized);
+const EventId ListHeader::EventSegmentClickedId(EventSegmentClicked);
+const EventId ListHeader::EventSplitterDoubleClickedId(EventSplitterDoubleClicked);
+const EventId ListHeader::EventSegmentSequenceChangedId(EventSegmentSequenceChanged);
+const EventId ListHeader::EventSegmentAddedId(EventSegmentAdded);
+const EventId ListHeader::EventSegmentRemovedId(EventSegmentRemoved);
+const EventId ListHeader::EventSortSettingChangedId(EventSortSettingChanged);
+const EventId ListHeader::EventDragMoveSettingChangedId(EventDragMoveSettingChanged);
+const EventId ListHeader::EventDragSizeSettingChangedId(EventDragSizeSettingChanged);
+const EventId ListHeader::EventSegmentRenderOffsetChangedId(EventSegmentRenderOffsetChanged);
+
 // values
 const float	ListHeader::ScrollSpeed	= 8.0f;
 const float	ListHeader::MinimumSegmentPixelWidth	= 20.0f;
@@ -779,7 +792,7 @@ bool ListHeader::validateWindowRenderer(const WindowRenderer* renderer) const
 *************************************************************************/
 void ListHeader::onSortColumnChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSortColumnChanged, e, EventNamespace);
+	fireEvent(EventSortColumnChangedId, e, EventNamespace);
 }
 
 
@@ -788,7 +801,7 @@ void ListHeader::onSortColumnChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSortDirectionChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSortDirectionChanged, e, EventNamespace);
+	fireEvent(EventSortDirectionChangedId, e, EventNamespace);
 }
 
 
@@ -798,7 +811,7 @@ void ListHeader::onSortDirectionChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSegmentSized(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentSized, e, EventNamespace);
+	fireEvent(EventSegmentSizedId, e, EventNamespace);
 }
 
 
@@ -808,7 +821,7 @@ void ListHeader::onSegmentSized(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSegmentClicked(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentClicked, e, EventNamespace);
+	fireEvent(EventSegmentClickedId, e, EventNamespace);
 }
 
 
@@ -818,7 +831,7 @@ void ListHeader::onSegmentClicked(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSplitterDoubleClicked(WindowEventArgs& e)
 {
-	fireEvent(EventSplitterDoubleClicked, e, EventNamespace);
+	fireEvent(EventSplitterDoubleClickedId, e, EventNamespace);
 }
 
 
@@ -827,7 +840,7 @@ void ListHeader::onSplitterDoubleClicked(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSegmentSequenceChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentSequenceChanged, e, EventNamespace);
+	fireEvent(EventSegmentSequenceChangedId, e, EventNamespace);
 }
 
 
@@ -836,7 +849,7 @@ void ListHeader::onSegmentSequenceChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSegmentAdded(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentAdded, e, EventNamespace);
+	fireEvent(EventSegmentAddedId, e, EventNamespace);
 }
 
 
@@ -845,7 +858,7 @@ void ListHeader::onSegmentAdded(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSegmentRemoved(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentRemoved, e, EventNamespace);
+	fireEvent(EventSegmentRemovedId, e, EventNamespace);
 }
 
 
@@ -855,7 +868,7 @@ void ListHeader::onSegmentRemoved(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSortSettingChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSortSettingChanged, e, EventNamespace);
+	fireEvent(EventSortSettingChangedId, e, EventNamespace);
 }
 
 
@@ -865,7 +878,7 @@ void ListHeader::onSortSettingChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onDragMoveSettingChanged(WindowEventArgs& e)
 {
-	fireEvent(EventDragMoveSettingChanged, e, EventNamespace);
+	fireEvent(EventDragMoveSettingChangedId, e, EventNamespace);
 }
 
 
@@ -875,7 +888,7 @@ void ListHeader::onDragMoveSettingChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onDragSizeSettingChanged(WindowEventArgs& e)
 {
-	fireEvent(EventDragSizeSettingChanged, e, EventNamespace);
+	fireEvent(EventDragSizeSettingChangedId, e, EventNamespace);
 }
 
 
@@ -885,7 +898,7 @@ void ListHeader::onDragSizeSettingChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeader::onSegmentOffsetChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentRenderOffsetChanged, e, EventNamespace);
+	fireEvent(EventSegmentRenderOffsetChangedId, e, EventNamespace);
 }
 
 
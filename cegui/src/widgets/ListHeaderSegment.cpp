@@ -51,6 +51,17 @@ const String ListHeaderSegment::EventSegmentDragPositionChanged( "SegmentDragPos
 const String ListHeaderSegment::EventSegmentSized( "SegmentSized" );
 const String ListHeaderSegment::EventClickableSettingChanged( "ClickableSettingChanged" );
 
+const EventId ListHeaderSegment::EventSegmentClickedId(EventSegmentClicked);
+const EventId ListHeaderSegment::EventSplitterDoubleClickedId(EventSplitterDoubleClicked);
+const EventId ListHeaderSegment::EventSizingSettingChangedId(EventSizingSettingChanged);
+const EventId ListHeaderSegment::EventSortDirectionChangedId(EventSortDirectionChanged);
+const EventId ListHeaderSegment::EventMovableSettingChangedId(EventMovableSettingChanged);
+const EventId ListHeaderSegment::EventSegmentDragStartId(EventSegmentDragStart);
+const EventId ListHeaderSegment::EventSegmentDragStopId(EventSegmentDragStop);
+const EventId ListHeaderSegment::EventSegmentDragPositionChangedId(EventSegmentDragPositionChanged);
+const EventId ListHeaderSegment::EventSegmentSizedId(EventSegmentSized);
+const EventId ListHeaderSegment::EventClickableSettingChangedId(EventClickableSettingChanged);
+
 // Defaults
 const float	ListHeaderSegment::DefaultSizingArea	= 8.0f;
 const float	ListHeaderSegment::SegmentMoveThreshold	= 12.0f;
@@ -161,7 +172,7 @@ void ListHeaderSegment::setClickable(bool setting)
 *************************************************************************/
 void ListHeaderSegment::onSegmentClicked(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentClicked, e, EventNamespace);
+	fireEvent(EventSegmentClickedId, e, EventNamespace);
 }
 
 
@@ -170,7 +181,7 @@ void ListHeaderSegment::onSegmentClicked(WindowEventArgs& e)
 *************************************************************************/
 void ListHeaderSegment::onSplitterDoubleClicked(WindowEventArgs& e)
 {
-	fireEvent(EventSplitterDoubleClicked, e, EventNamespace);
+	fireEvent(EventSplitterDoubleClickedId, e, EventNamespace);
 }
 
 
@@ -179,7 +190,7 @@ void ListHeaderSegment::onSplitterDoubleClicked(WindowEventArgs& e)
 *************************************************************************/
 void ListHeaderSegment::onSizingSettingChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSizingSettingChanged, e, EventNamespace);
+	fireEvent(EventSizingSettingChangedId, e, EventNamespace);
 }
 
 
@@ -189,7 +200,7 @@ void ListHeaderSegment::onSizingSettingChanged(WindowEventArgs& e)
 void ListHeaderSegment::onSortDirectionChanged(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventSortDirectionChanged, e, EventNamespace);
+	fireEvent(EventSortDirectionChangedId, e, EventNamespace);
 }
 
 
@@ -198,7 +209,7 @@ void ListHeaderSegment::onSortDirectionChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeaderSegment::onMovableSettingChanged(WindowEventArgs& e)
 {
-	fireEvent(EventMovableSettingChanged, e, EventNamespace);
+	fireEvent(EventMovableSettingChangedId, e, EventNamespace);
 }
 
 
@@ -207,7 +218,7 @@ void ListHeaderSegment::onMovableSettingChanged(WindowEventArgs& e)
 *************************************************************************/
 void ListHeaderSegment::onSegmentDragStart(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentDragStart, e, EventNamespace);
+	fireEvent(EventSegmentDragStartId, e, EventNamespace);
 }
 
 
@@ -217,7 +228,7 @@ void ListHeaderSegment::onSegmentDragStart(WindowEventArgs& e)
 *************************************************************************/
 void ListHeaderSegment::onSegmentDragStop(WindowEventArgs& e)
 {
-	fireEvent(EventSegmentDragStop, e, EventNamespace);
+	fireEvent(EventSegmentDragStopId, e, EventNamespace);
 }
 
 
@@ -227,7 +238,7 @@ void ListHeaderSegment::onSegmentDragStop(WindowEventArgs& e)
 void ListHeaderSegment::onSegmentDragPositionChanged(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventSegmentDragPositionChanged, e, EventNamespace);
+	fireEvent(EventSegmentDragPositionChangedId, e, EventNamespace);
 }
 
 
@@ -237,7 +248,7 @@ void ListHeaderSegment::onSegmentDragPositionChanged(WindowEventArgs& e)
 void ListHeaderSegment::onSegmentSized(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventSegmentSized, e, EventNamespace);
+	fireEvent(EventSegmentSizedId, e, EventNamespace);
 }
 
 
@@ -246,7 +257,7 @@ void ListHeaderSegment::onSegmentSized(WindowEventArgs& e)
 *************************************************************************/
 void ListHeaderSegment::onClickableSettingChanged(WindowEventArgs& e)
 {
-	fireEvent(EventClickableSettingChanged, e, EventNamespace);
+	fireEvent(EventClickableSettingChangedId, e, EventNamespace);
 }
 
 /*************************************************************************
@@ -203,16 +203,8 @@ bool ListWidget::isItemInList(const StandardItem* item)
 //----------------------------------------------------------------------------//
 bool ListWidget::isItemSelected(const StandardItem* item)
 {
-    for (SelectionStatesVector::const_iterator itor = getIndexSelectionStates().begin();
-        itor != getIndexSelectionStates().end(); ++itor)
-    {
-        if (item == d_itemModel.getItemForIndex(itor->d_selectedIndex))
-        {
-            return true;
-        }
-    }
-
-    return false;
+    // the model data of the indices of d_itemModel are the items themselves
+    return item != nullptr && d_selectedModelData.find(item) != d_selectedModelData.end();
 }
 
 //----------------------------------------------------------------------------//
@@ -36,6 +36,9 @@ const String MenuBase::EventNamespace("MenuBase");
 const String MenuBase::EventPopupOpened("PopupOpened");
 const String MenuBase::EventPopupClosed("PopupClosed");
 
+const EventId MenuBase::EventPopupOpenedId(EventPopupOpened);
+const EventId MenuBase::EventPopupClosedId(EventPopupClosed);
+
 //----------------------------------------------------------------------------//
 MenuBase::MenuBase(const String& type, const String& name)
     : ItemListBase(type, name)
@@ -69,13 +72,13 @@ void MenuBase::changePopupMenuItem(MenuItem* item)
 //----------------------------------------------------------------------------//
 void MenuBase::onPopupOpened(WindowEventArgs& e)
 {
-    fireEvent(EventPopupOpened, e, EventNamespace);
+    fireEvent(EventPopupOpenedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void MenuBase::onPopupClosed(WindowEventArgs& e)
 {
-    fireEvent(EventPopupClosed, e, EventNamespace);
+    fireEvent(EventPopupClosedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -38,6 +38,8 @@ const String MenuItem::WidgetTypeName("CEGUI/MenuItem");
 const String MenuItem::EventNamespace("MenuItem");
 const String MenuItem::EventClicked("Clicked");
 
+const EventId MenuItem::EventClickedId(EventClicked);
+
 // Implementation details for popup clipping computations
 namespace
 {
@@ -404,7 +406,7 @@ void MenuItem::closeAllMenuItemPopups()
 //----------------------------------------------------------------------------//
 void MenuItem::onClicked(WindowEventArgs& e)
 {
-    fireEvent(EventClicked, e, EventNamespace);
+    fireEvent(EventClickedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
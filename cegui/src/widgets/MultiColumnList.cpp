@@ -64,6 +64,18 @@ const String MultiColumnList::EventSortDirectionChanged( "SortDirectionChanged"
 const String MultiColumnList::EventListColumnSized( "ListColumnSized" );
 const String MultiColumnList::EventListColumnMoved( "ListColumnMoved" );
 
+const EventId MultiColumnList::EventSelectionModeChangedId(EventSelectionModeChanged);
+const EventId MultiColumnList::EventNominatedSelectColumnChangedId(EventNominatedSelectColumnChanged);
+const EventId MultiColumnList::EventNominatedSelectRowChangedId(EventNominatedSelectRowChanged);
+const EventId MultiColumnList::EventVertScrollbarModeChangedId(EventVertScrollbarModeChanged);
+const EventId MultiColumnList::EventHorzScrollbarModeChangedId(EventHorzScrollbarModeChanged);
+const EventId MultiColumnList::EventSelectionChangedId(EventSelectionChanged);
+const EventId MultiColumnList::EventListContentsChangedId(EventListContentsChanged);
+const EventId MultiColumnList::EventSortColumnChangedId(EventSortColumnChanged);
+const EventId MultiColumnList::EventSortDirectionChangedId(EventSortDirectionChanged);
+const EventId MultiColumnList::EventListColumnSizedId(EventListColumnSized);
+const EventId MultiColumnList::EventListColumnMovedId(EventListColumnMoved);
+
 /*************************************************************************
     Child Widget name suffix constants
 *************************************************************************/
@@ -83,6 +95,10 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(nullptr),
     d_columnCount(0),
+    d_rowHeightsValid(true),
+    d_itemGridRefsValid(true),
+    d_updateDepth(0),
+    d_contentsChangedInUpdate(false),
     d_autoSizeColumnUsesHeader(false)
 {
 	// add properties
@@ -234,13 +250,13 @@ ListHeaderSegment& MultiColumnList::getHeaderSegmentForColumn(unsigned int col_i
 *************************************************************************/
 unsigned int MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 {
-	for (unsigned int i = 0; i < getRowCount(); ++i)
-	{
-		if (isListboxItemInRow(item, i))
-		{
-			return i;
-		}
+	validateItemGridRefs();
 
+	const auto it = d_itemGridRefs.find(item);
+
+	if (it != d_itemGridRefs.end())
+	{
+		return it->second.row;
 	}
 
 	// item is not attached to the list box, throw...
@@ -254,13 +270,13 @@ unsigned int MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 *************************************************************************/
 unsigned int MultiColumnList::getItemColumnIndex(const ListboxItem* item) const
 {
-	for (unsigned int i = 0; i < getColumnCount(); ++i)
-	{
-		if (isListboxItemInColumn(item, i))
-		{
-			return i;
-		}
+	validateItemGridRefs();
+
+	const auto it = d_itemGridRefs.find(item);
 
+	if (it != d_itemGridRefs.end())
+	{
+		return it->second.column;
 	}
 
 	// item is not attached to the list box, throw...
@@ -361,20 +377,9 @@ bool MultiColumnList::isListboxItemInRow(const ListboxItem* item, unsigned int r
 *************************************************************************/
 bool MultiColumnList::isListboxItemInList(const ListboxItem* item) const
 {
-	for (unsigned int i = 0; i < getRowCount(); ++i)
-	{
-		for (unsigned int j = 0; j < getColumnCount(); ++j)
-		{
-			if (d_grid[i][j] == item)
-			{
-				return true;
-			}
+	validateItemGridRefs();
 
-		}
-
-	}
-
-	return false;
+	return d_itemGridRefs.find(item) != d_itemGridRefs.end();
 }
 
 
@@ -654,8 +659,7 @@ void MultiColumnList::resetList(void)
 {
 	if (resetList_impl())
 	{
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyListContentsChanged();
 	}
 
 }
@@ -747,6 +751,9 @@ void MultiColumnList::insertColumn(const String& text, unsigned int col_id, cons
             static_cast<ListboxItem*>(nullptr));
 	}
 
+	// the items after the new column moved.
+	d_itemGridRefsValid = false;
+
 	// update stored nominated selection column if that has changed.
 	if ((d_nominatedSelectCol >= position) && (getColumnCount() > 1))
 	{
@@ -754,8 +761,7 @@ void MultiColumnList::insertColumn(const String& text, unsigned int col_id, cons
 	}
 
 	// signal a change to the list contents
-	WindowEventArgs args(this);
-	onListContentsChanged(args);
+	notifyListContentsChanged();
 }
 
 
@@ -799,9 +805,12 @@ void MultiColumnList::removeColumn(unsigned int col_idx)
 		getListHeader()->removeColumn(col_idx);
         --d_columnCount;
 
+		// the removed items may have been the highest in their rows.
+		updateRowHeights();
+		d_itemGridRefsValid = false;
+
 		// signal a change to the list contents
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyListContentsChanged();
 	}
 
 }
@@ -867,11 +876,14 @@ unsigned int MultiColumnList::addRow(ListboxItem* item, unsigned int col_id, uns
 		row[col_idx] = item;
 	}
 
+	updateRowHeight(row);
+
 	unsigned int pos;
 
-	// if sorting is enabled, insert at an appropriate position
+	// if sorting is enabled, insert at an appropriate position (while a batch
+	// of changes is active the list is sorted when the batch ends instead).
     const ListHeaderSegment::SortDirection dir = getSortDirection();
-	if (dir != ListHeaderSegment::SortDirection::NoSorting)
+	if (dir != ListHeaderSegment::SortDirection::NoSorting && !isUpdating())
 	{
         // calculate where the row should be inserted
         ListItemGrid::iterator ins_pos = dir == ListHeaderSegment::SortDirection::Descending ?
@@ -889,9 +901,26 @@ unsigned int MultiColumnList::addRow(ListboxItem* item, unsigned int col_id, uns
 		d_grid.push_back(row);
 	}
 
+	// the cached data only needs extending when the row was appended.
+	if (pos + 1 == getRowCount())
+	{
+		if (d_rowHeightsValid)
+		{
+			d_rowHeights.push_back(row.d_height);
+		}
+
+		if (item && d_itemGridRefsValid)
+		{
+			d_itemGridRefs.emplace(item, MCLGridRef(pos, col_idx));
+		}
+	}
+	else
+	{
+		invalidateRowCaches();
+	}
+
 	// signal a change to the list contents
-	WindowEventArgs args(this);
-	onListContentsChanged(args);
+	notifyListContentsChanged();
 
 	return pos;
 }
@@ -932,12 +961,23 @@ unsigned int MultiColumnList::insertRow(ListboxItem* item, unsigned int col_id,
 
 		d_grid.insert(d_grid.begin() + row_idx, row);
 
+		if (row_idx + 1 == getRowCount())
+		{
+			if (d_rowHeightsValid)
+			{
+				d_rowHeights.push_back(row.d_height);
+			}
+		}
+		else
+		{
+			invalidateRowCaches();
+		}
+
 		// set the initial item in the new row
 		setItem(item, col_id, row_idx);
 
 		// signal a change to the list contents
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyListContentsChanged();
 
 		return row_idx;
 	}
@@ -972,6 +1012,7 @@ void MultiColumnList::removeRow(unsigned int row_idx)
 
 		// erase the row from the grid.
 		d_grid.erase(d_grid.begin() + row_idx);
+		invalidateRowCaches();
 
 		// if we have erased the selection row, reset that to 0
 		if (d_nominatedSelectRow == row_idx)
@@ -980,8 +1021,7 @@ void MultiColumnList::removeRow(unsigned int row_idx)
 		}
 
 		// signal a change to the list contents
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyListContentsChanged();
 	}
 
 }
@@ -1019,10 +1059,30 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 
 	d_grid[position.row][position.column] = item;
 
+	ListRow& row = d_grid[position.row];
+	updateRowHeight(row);
+
+	if (d_rowHeightsValid)
+	{
+		d_rowHeights.set(position.row, row.d_height);
+	}
+
+	// a replaced item, or an item also set elsewhere, needs the positions
+	// to be rebuilt; a new item in an empty slot can just be added.
+	if (d_itemGridRefsValid)
+	{
+		if (oldItem || (item && d_itemGridRefs.find(item) != d_itemGridRefs.end()))
+		{
+			d_itemGridRefsValid = false;
+		}
+		else if (item)
+		{
+			d_itemGridRefs.emplace(item, position);
+		}
+	}
 
 	// signal a change to the list contents
-	WindowEventArgs args(this);
-	onListContentsChanged(args);
+	notifyListContentsChanged();
 }
 
 
@@ -1318,6 +1378,7 @@ void MultiColumnList::setItemSelectState(const MCLGridRef& grid_ref, bool state)
 *************************************************************************/
 void MultiColumnList::handleUpdatedItemData(void)
 {
+    updateRowHeights();
     resortList();
 	configureScrollbars();
 	invalidate();
@@ -1455,14 +1516,33 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
-	float height = 0.0f;
+	validateRowHeights();
+
+	return d_rowHeights.getTotal();
+}
 
-	for (unsigned int i = 0; i < getRowCount(); ++i)
-	{
-		height += getHighestRowItemHeight(i);
-	}
 
-	return height;
+/*************************************************************************
+	Return the distance from the top of the first row to the top of the
+	given row.
+*************************************************************************/
+float MultiColumnList::getRowOffset(unsigned int row_idx) const
+{
+	validateRowHeights();
+
+	return d_rowHeights.getPrefixSum(std::min<size_t>(row_idx, d_rowHeights.size()));
+}
+
+
+/*************************************************************************
+	Return the index of the row at the given distance from the top of the
+	first row.
+*************************************************************************/
+unsigned int MultiColumnList::getRowAtOffset(float offset) const
+{
+	validateRowHeights();
+
+	return static_cast<unsigned int>(d_rowHeights.upperBound(offset));
 }
 
 
@@ -1520,31 +1600,7 @@ float MultiColumnList::getHighestRowItemHeight(unsigned int row_idx) const
 	}
 	else
 	{
-		float height = 0.0f;
-
-		// check each item in the column
-		for (unsigned int i = 0; i < getColumnCount(); ++i)
-		{
-			ListboxItem* item = d_grid[row_idx][i];
-
-			// if the slot has an item in it
-			if (item)
-			{
-				Sizef sz(item->getPixelSize());
-
-				// see if this item is higher than the previous highest
-				if (sz.d_height > height)
-				{
-					// update current highest
-					height = sz.d_height;
-				}
-
-			}
-
-		}
-
-		// return the hightest item.
-		return height;
+		return d_grid[row_idx].d_height;
 	}
 
 }
@@ -1589,32 +1645,28 @@ ListboxItem* MultiColumnList::getItemAtPoint(const glm::vec2& localPos) const
     const ListHeader* header = getListHeader();
     const Rectf listArea(getListRenderArea());
 
-    float y = listArea.d_min.y - getVertScrollbar()->getScrollPosition();
+    const float y = localPos.y - listArea.d_min.y + getVertScrollbar()->getScrollPosition();
     float x = listArea.d_min.x - getHorzScrollbar()->getScrollPosition();
-    
-    if(y > localPos.y)
+
+    if (y < 0.0f)
         return nullptr;
 
-    for (unsigned int i = 0; i < getRowCount(); ++i)
+    // locate the row
+    const unsigned int row = getRowAtOffset(y);
+    if (row >= getRowCount())
+        return nullptr;
+
+    // scan across to find column that was clicked
+    for (unsigned int j = 0; j < getColumnCount(); ++j)
     {
-        y += getHighestRowItemHeight(i);
+        const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
+        x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
 
-        // have we located the row?
-        if (localPos.y < y)
+        // was this the column?
+        if (localPos.x < x)
         {
-            // scan across to find column that was clicked
-            for (unsigned int j = 0; j < getColumnCount(); ++j)
-            {
-                const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
-                x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
-
-                // was this the column?
-                if (localPos.x < x)
-                {
-                    // return contents of grid element that was clicked.
-                    return d_grid[i][j];
-                }
-            }
+            // return contents of grid element that was clicked.
+            return d_grid[row][j];
         }
     }
 
@@ -1768,6 +1820,8 @@ void MultiColumnList::moveColumn_impl(unsigned int col_idx, unsigned int positio
 			d_grid[i].d_items.insert(d_grid[i].d_items.begin() + position, item);
 		}
 
+		d_itemGridRefsValid = false;
+
 	}
 
 }
@@ -1778,7 +1832,7 @@ void MultiColumnList::moveColumn_impl(unsigned int col_idx, unsigned int positio
 *************************************************************************/
 void MultiColumnList::onSelectionModeChanged(WindowEventArgs& e)
 {
-	fireEvent(EventSelectionModeChanged, e, EventNamespace);
+	fireEvent(EventSelectionModeChangedId, e, EventNamespace);
 }
 
 
@@ -1787,7 +1841,7 @@ void MultiColumnList::onSelectionModeChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onNominatedSelectColumnChanged(WindowEventArgs& e)
 {
-	fireEvent(EventNominatedSelectColumnChanged, e, EventNamespace);
+	fireEvent(EventNominatedSelectColumnChangedId, e, EventNamespace);
 }
 
 
@@ -1796,7 +1850,7 @@ void MultiColumnList::onNominatedSelectColumnChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onNominatedSelectRowChanged(WindowEventArgs& e)
 {
-	fireEvent(EventNominatedSelectRowChanged, e, EventNamespace);
+	fireEvent(EventNominatedSelectRowChangedId, e, EventNamespace);
 }
 
 
@@ -1805,7 +1859,7 @@ void MultiColumnList::onNominatedSelectRowChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onVertScrollbarModeChanged(WindowEventArgs& e)
 {
-	fireEvent(EventVertScrollbarModeChanged, e, EventNamespace);
+	fireEvent(EventVertScrollbarModeChangedId, e, EventNamespace);
 }
 
 
@@ -1814,7 +1868,7 @@ void MultiColumnList::onVertScrollbarModeChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onHorzScrollbarModeChanged(WindowEventArgs& e)
 {
-	fireEvent(EventHorzScrollbarModeChanged, e, EventNamespace);
+	fireEvent(EventHorzScrollbarModeChangedId, e, EventNamespace);
 }
 
 
@@ -1824,7 +1878,7 @@ void MultiColumnList::onHorzScrollbarModeChanged(WindowEventArgs& e)
 void MultiColumnList::onSelectionChanged(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventSelectionChanged, e, EventNamespace);
+	fireEvent(EventSelectionChangedId, e, EventNamespace);
 }
 
 
@@ -1835,7 +1889,7 @@ void MultiColumnList::onListContentsChanged(WindowEventArgs& e)
 {
 	configureScrollbars();
 	invalidate();
-	fireEvent(EventListContentsChanged, e, EventNamespace);
+	fireEvent(EventListContentsChangedId, e, EventNamespace);
 }
 
 
@@ -1845,7 +1899,7 @@ void MultiColumnList::onListContentsChanged(WindowEventArgs& e)
 void MultiColumnList::onSortColumnChanged(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventSortColumnChanged, e, EventNamespace);
+	fireEvent(EventSortColumnChangedId, e, EventNamespace);
 }
 
 
@@ -1855,7 +1909,7 @@ void MultiColumnList::onSortColumnChanged(WindowEventArgs& e)
 void MultiColumnList::onSortDirectionChanged(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventSortDirectionChanged, e, EventNamespace);
+	fireEvent(EventSortDirectionChangedId, e, EventNamespace);
 }
 
 
@@ -1866,14 +1920,14 @@ void MultiColumnList::onListColumnSized(WindowEventArgs& e)
 {
 	configureScrollbars();
 	invalidate();
-	fireEvent(EventListColumnSized, e, EventNamespace);
+	fireEvent(EventListColumnSizedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void MultiColumnList::onListColumnMoved(WindowEventArgs& e)
 {
 	invalidate();
-	fireEvent(EventListColumnMoved, e, EventNamespace);
+	fireEvent(EventListColumnMovedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -1886,6 +1940,12 @@ bool MultiColumnList::handleFontRenderSizeChange(const Font& font)
             if (auto item = d_grid[i][j])
                 handled |= item->handleFontRenderSizeChange(&font);
 
+    if (handled)
+    {
+        updateRowHeights();
+        configureScrollbars();
+    }
+
     for (unsigned int col = 0; col < getColumnCount(); ++col)
     {
         if (getHeaderSegmentForColumn(col).getFont() == &font)
@@ -1909,6 +1969,10 @@ void MultiColumnList::onFontChanged(WindowEventArgs& e)
     for (unsigned int col = 0; col < getColumnCount(); ++col)
         getHeaderSegmentForColumn(col).setFont(d_font);
 
+    // Items without a font of their own use ours
+    updateRowHeights();
+    configureScrollbars();
+
     // Call base class handler
     Window::onFontChanged(e);
 }
@@ -2308,6 +2372,10 @@ bool MultiColumnList::resetList_impl(void)
 
 		// clear all items from the grid.
 		d_grid.clear();
+		d_rowHeights.clear();
+		d_rowHeightsValid = true;
+		d_itemGridRefs.clear();
+		d_itemGridRefsValid = true;
 
 		// reset other affected fields
 		d_nominatedSelectRow = 0;
@@ -2520,17 +2588,13 @@ void MultiColumnList::ensureRowIsVisible(unsigned int row_idx)
     }
     else
     {
-        float bottom;
-        float top = 0.0f;
         float listHeight = getListRenderArea().getHeight();
 
         // get distance to top of item
-        unsigned int row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
+        float top = getRowOffset(row_idx);
 
         // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        float bottom = top + getHighestRowItemHeight(row_idx);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2678,17 +2742,152 @@ void MultiColumnList::resortList()
     // re-sort list according to direction
     ListHeaderSegment::SortDirection dir = getSortDirection();
 
+    // a stable sort keeps equal rows in the order they were added, as
+    // adding them to the sorted list one by one does.
     if (dir == ListHeaderSegment::SortDirection::Descending)
     {
-        std::sort(d_grid.begin(), d_grid.end(), pred_descend);
+        std::stable_sort(d_grid.begin(), d_grid.end(), pred_descend);
+        invalidateRowCaches();
     }
     else if (dir == ListHeaderSegment::SortDirection::Ascending)
     {
-        std::sort(d_grid.begin(), d_grid.end());
+        std::stable_sort(d_grid.begin(), d_grid.end());
+        invalidateRowCaches();
     }
     // else no (or invalid) direction, so do not sort.
 }
 
+/*************************************************************************
+    Start a batch of changes to the list content
+*************************************************************************/
+void MultiColumnList::beginUpdate()
+{
+    ++d_updateDepth;
+}
+
+/*************************************************************************
+    End a batch of changes to the list content
+*************************************************************************/
+void MultiColumnList::endUpdate()
+{
+    if (d_updateDepth == 0)
+    {
+        throw InvalidRequestException(
+            "endUpdate was called without a matching call to beginUpdate.");
+    }
+
+    if (--d_updateDepth == 0 && d_contentsChangedInUpdate)
+    {
+        d_contentsChangedInUpdate = false;
+
+        // rows added during the batch were appended
+        resortList();
+
+        WindowEventArgs args(this);
+        onListContentsChanged(args);
+    }
+}
+
+/*************************************************************************
+    Fire the list contents changed notification, unless a batch of
+    changes is active.
+*************************************************************************/
+void MultiColumnList::notifyListContentsChanged()
+{
+    if (isUpdating())
+    {
+        d_contentsChangedInUpdate = true;
+    }
+    else
+    {
+        WindowEventArgs args(this);
+        onListContentsChanged(args);
+    }
+}
+
+/*************************************************************************
+    Update the cached height of a row
+*************************************************************************/
+void MultiColumnList::updateRowHeight(ListRow& row) const
+{
+    float height = 0.0f;
+
+    for (const ListboxItem* item : row.d_items)
+    {
+        if (item)
+        {
+            height = std::max(height, item->getPixelSize().d_height);
+        }
+    }
+
+    row.d_height = height;
+}
+
+/*************************************************************************
+    Update the cached heights of all rows
+*************************************************************************/
+void MultiColumnList::updateRowHeights()
+{
+    for (ListRow& row : d_grid)
+    {
+        updateRowHeight(row);
+    }
+
+    d_rowHeightsValid = false;
+}
+
+/*************************************************************************
+    Mark the cached row offsets and item positions as invalid
+*************************************************************************/
+void MultiColumnList::invalidateRowCaches()
+{
+    d_rowHeightsValid = false;
+    d_itemGridRefsValid = false;
+}
+
+/*************************************************************************
+    Rebuild the cached row offsets if required
+*************************************************************************/
+void MultiColumnList::validateRowHeights() const
+{
+    if (d_rowHeightsValid)
+        return;
+
+    std::vector<float> heights;
+    heights.reserve(d_grid.size());
+    for (const ListRow& row : d_grid)
+    {
+        heights.push_back(row.d_height);
+    }
+
+    d_rowHeights.assign(heights.begin(), heights.end());
+    d_rowHeightsValid = true;
+}
+
+/*************************************************************************
+    Rebuild the cached item positions if required
+*************************************************************************/
+void MultiColumnList::validateItemGridRefs() const
+{
+    if (d_itemGridRefsValid)
+        return;
+
+    d_itemGridRefs.clear();
+    for (unsigned int i = 0; i < getRowCount(); ++i)
+    {
+        for (unsigned int j = 0; j < getColumnCount(); ++j)
+        {
+            // keep the first position of an item set more than once
+            if (const ListboxItem* item = d_grid[i][j])
+            {
+                d_itemGridRefs.emplace(item, MCLGridRef(i, j));
+            }
+        }
+    }
+
+    d_itemGridRefsValid = true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 /*************************************************************************
 	Operators for MCLGridRef
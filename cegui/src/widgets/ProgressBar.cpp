@@ -40,6 +40,9 @@ const String ProgressBar::EventNamespace("ProgressBar");
 const String ProgressBar::EventProgressChanged( "ProgressChanged" );
 const String ProgressBar::EventProgressDone( "ProgressDone" );
 
+const EventId ProgressBar::EventProgressChangedId(EventProgressChanged);
+const EventId ProgressBar::EventProgressDoneId(EventProgressDone);
+
 
 /*************************************************************************
 	Constructor for ProgressBar class
@@ -94,7 +97,7 @@ void ProgressBar::onProgressChanged(WindowEventArgs& e)
 {
 	invalidate();
 
-	fireEvent(EventProgressChanged, e, EventNamespace);
+	fireEvent(EventProgressChangedId, e, EventNamespace);
 }
 
 
@@ -103,7 +106,7 @@ void ProgressBar::onProgressChanged(WindowEventArgs& e)
 *************************************************************************/
 void ProgressBar::onProgressDone(WindowEventArgs& e)
 {
-	fireEvent(EventProgressDone, e, EventNamespace);
+	fireEvent(EventProgressDoneId, e, EventNamespace);
 }
 
 /*************************************************************************
@@ -36,10 +36,12 @@ const String PushButton::EventNamespace("PushButton");
 const String PushButton::WidgetTypeName("CEGUI/PushButton");
 const String PushButton::EventClicked("Clicked");
 
+const EventId PushButton::EventClickedId(EventClicked);
+
 //----------------------------------------------------------------------------//
 void PushButton::onClicked(WindowEventArgs& e)
 {
-	fireEvent(EventClicked, e, EventNamespace);
+	fireEvent(EventClickedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
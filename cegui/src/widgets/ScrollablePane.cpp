@@ -38,6 +38,11 @@ const String ScrollablePane::EventContentPaneChanged("ContentPaneChanged");
 const String ScrollablePane::EventVertScrollbarModeChanged("VertScrollbarModeChanged");
 const String ScrollablePane::EventHorzScrollbarModeChanged("HorzScrollbarModeChanged");
 const String ScrollablePane::EventContentPaneScrolled("ContentPaneScrolled");
+
+const EventId ScrollablePane::EventContentPaneChangedId(EventContentPaneChanged);
+const EventId ScrollablePane::EventVertScrollbarModeChangedId(EventVertScrollbarModeChanged);
+const EventId ScrollablePane::EventHorzScrollbarModeChangedId(EventHorzScrollbarModeChanged);
+const EventId ScrollablePane::EventContentPaneScrolledId(EventContentPaneScrolled);
 const String ScrollablePane::VertScrollbarName( "__auto_vscrollbar__" );
 const String ScrollablePane::HorzScrollbarName( "__auto_hscrollbar__" );
 const String ScrollablePane::ScrolledContainerName( "__auto_container__" );
@@ -392,26 +397,26 @@ bool ScrollablePane::validateWindowRenderer(const WindowRenderer* renderer) cons
 //----------------------------------------------------------------------------//
 void ScrollablePane::onContentPaneChanged(WindowEventArgs& e)
 {
-    fireEvent(EventContentPaneChanged, e, EventNamespace);
+    fireEvent(EventContentPaneChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void ScrollablePane::onVerticalScrollbarModeChanged(WindowEventArgs& e)
 {
-    fireEvent(EventVertScrollbarModeChanged, e, EventNamespace);
+    fireEvent(EventVertScrollbarModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void ScrollablePane::onHorizontalScrollbarModeChanged(WindowEventArgs& e)
 {
-    fireEvent(EventHorzScrollbarModeChanged, e, EventNamespace);
+    fireEvent(EventHorzScrollbarModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void ScrollablePane::onContentPaneScrolled(WindowEventArgs& e)
 {
     updateContainerPosition();
-    fireEvent(EventContentPaneScrolled, e, EventNamespace);
+    fireEvent(EventContentPaneScrolledId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -480,7 +485,7 @@ bool ScrollablePane::handleAutoSizePaneChanged(const EventArgs&)
 
     // forward event to client.
     WindowEventArgs args(this);
-    fireEvent(EventIsSizeAdjustedToContentChanged, args, EventNamespace);
+    fireEvent(EventIsSizeAdjustedToContentChangedId, args, EventNamespace);
     return args.handled > 0;
 }
 
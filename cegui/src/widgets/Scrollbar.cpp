@@ -42,6 +42,11 @@ const String Scrollbar::EventThumbTrackStarted("ThumbTrackStarted");
 const String Scrollbar::EventThumbTrackEnded("ThumbTrackEnded");
 const String Scrollbar::EventScrollConfigChanged("ScrollConfigChanged");
 
+const EventId Scrollbar::EventScrollPositionChangedId(EventScrollPositionChanged);
+const EventId Scrollbar::EventThumbTrackStartedId(EventThumbTrackStarted);
+const EventId Scrollbar::EventThumbTrackEndedId(EventThumbTrackEnded);
+const EventId Scrollbar::EventScrollConfigChangedId(EventScrollConfigChanged);
+
 //----------------------------------------------------------------------------//
 const String Scrollbar::ThumbName("__auto_thumb__");
 const String Scrollbar::IncreaseButtonName("__auto_incbtn__");
@@ -205,26 +210,26 @@ bool Scrollbar::validateWindowRenderer(const WindowRenderer* renderer) const
 //----------------------------------------------------------------------------//
 void Scrollbar::onScrollPositionChanged(WindowEventArgs& e)
 {
-    fireEvent(EventScrollPositionChanged, e, EventNamespace);
+    fireEvent(EventScrollPositionChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Scrollbar::onThumbTrackStarted(WindowEventArgs& e)
 {
-    fireEvent(EventThumbTrackStarted, e, EventNamespace);
+    fireEvent(EventThumbTrackStartedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Scrollbar::onThumbTrackEnded(WindowEventArgs& e)
 {
-    fireEvent(EventThumbTrackEnded, e, EventNamespace);
+    fireEvent(EventThumbTrackEndedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Scrollbar::onScrollConfigChanged(WindowEventArgs& e)
 {
     performChildLayout(false, false);
-    fireEvent(EventScrollConfigChanged, e, EventNamespace);
+    fireEvent(EventScrollConfigChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
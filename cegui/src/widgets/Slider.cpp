@@ -42,6 +42,13 @@ const String Slider::EventMaximumValueChanged("MaximumValueChanged");
 const String Slider::EventStepChanged("StepChanged");
 const String Slider::EventThumbTrackStarted("ThumbTrackStarted");
 const String Slider::EventThumbTrackEnded("ThumbTrackEnded");
+
+const EventId Slider::EventValueChangedId(EventValueChanged);
+const EventId Slider::EventMinimumValueChangedId(EventMinimumValueChanged);
+const EventId Slider::EventMaximumValueChangedId(EventMaximumValueChanged);
+const EventId Slider::EventStepChangedId(EventStepChanged);
+const EventId Slider::EventThumbTrackStartedId(EventThumbTrackStarted);
+const EventId Slider::EventThumbTrackEndedId(EventThumbTrackEnded);
 /*************************************************************************
     Child Widget name constants
 *************************************************************************/
@@ -170,13 +177,13 @@ bool Slider::isVertical() const
 //----------------------------------------------------------------------------//
 void Slider::onValueChanged(WindowEventArgs& e)
 {
-	fireEvent(EventValueChanged, e, EventNamespace);
+	fireEvent(EventValueChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Slider::onMinimumValueChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMinimumValueChanged, e, EventNamespace);
+    fireEvent(EventMinimumValueChangedId, e, EventNamespace);
 
     if (d_currentValue < d_minValue)
         setCurrentValue(d_minValue);
@@ -185,7 +192,7 @@ void Slider::onMinimumValueChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Slider::onMaximumValueChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMaximumValueChanged, e, EventNamespace);
+    fireEvent(EventMaximumValueChangedId, e, EventNamespace);
 
     if (d_currentValue > d_maxValue)
         setCurrentValue(d_maxValue);
@@ -194,19 +201,19 @@ void Slider::onMaximumValueChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Slider::onStepChanged(WindowEventArgs& e)
 {
-    fireEvent(EventStepChanged, e, EventNamespace);
+    fireEvent(EventStepChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Slider::onThumbTrackStarted(WindowEventArgs& e)
 {
-	fireEvent(EventThumbTrackStarted, e, EventNamespace);
+	fireEvent(EventThumbTrackStartedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Slider::onThumbTrackEnded(WindowEventArgs& e)
 {
-	fireEvent(EventThumbTrackEnded, e, EventNamespace);
+	fireEvent(EventThumbTrackEndedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
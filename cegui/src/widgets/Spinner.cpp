@@ -43,6 +43,12 @@ const String Spinner::EventMinimumValueChanged("MinimumValueChanged");
 const String Spinner::EventMaximumValueChanged("MaximumValueChanged");
 const String Spinner::EventStepChanged("StepChanged");
 const String Spinner::EventTextInputModeChanged("TextInputModeChanged");
+
+const EventId Spinner::EventValueChangedId(EventValueChanged);
+const EventId Spinner::EventMinimumValueChangedId(EventMinimumValueChanged);
+const EventId Spinner::EventMaximumValueChangedId(EventMaximumValueChanged);
+const EventId Spinner::EventStepChangedId(EventStepChanged);
+const EventId Spinner::EventTextInputModeChangedId(EventTextInputModeChanged);
 // Validator strings
 const String Spinner::FloatValidator("-?\\d*\\.?\\d*");
 const String Spinner::IntegerValidator("-?\\d*");
@@ -352,13 +358,13 @@ void Spinner::onValueChanged(WindowEventArgs& e)
         setText(editbox->getText());
     }
 
-    fireEvent(EventValueChanged, e, EventNamespace);
+    fireEvent(EventValueChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Spinner::onMinimumValueChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMinimumValueChanged, e, EventNamespace);
+    fireEvent(EventMinimumValueChangedId, e, EventNamespace);
 
     if (d_currentValue < d_minValue)
         setCurrentValue(d_minValue);
@@ -367,7 +373,7 @@ void Spinner::onMinimumValueChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Spinner::onMaximumValueChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMaximumValueChanged, e, EventNamespace);
+    fireEvent(EventMaximumValueChangedId, e, EventNamespace);
 
     if (d_currentValue > d_maxValue)
         setCurrentValue(d_maxValue);
@@ -376,14 +382,14 @@ void Spinner::onMaximumValueChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Spinner::onStepChanged(WindowEventArgs& e)
 {
-    fireEvent(EventStepChanged, e, EventNamespace);
+    fireEvent(EventStepChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
 void Spinner::onTextInputModeChanged(WindowEventArgs& e)
 {
     updateEditboxText();
-    fireEvent(EventTextInputModeChanged, e, EventNamespace);
+    fireEvent(EventTextInputModeChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -37,6 +37,10 @@ const String TabButton::EventClicked( "Clicked" );
 const String TabButton::EventDragged( "Dragged" );
 const String TabButton::EventScrolled( "Scrolled" );
 
+const EventId TabButton::EventClickedId(EventClicked);
+const EventId TabButton::EventDraggedId(EventDragged);
+const EventId TabButton::EventScrolledId(EventScrolled);
+
 //----------------------------------------------------------------------------//
 TabButton::TabButton(const String& type, const String& name) :
 	ButtonBase(type, name),
@@ -71,7 +75,7 @@ void TabButton::setTargetWindow(Window* wnd)
 *************************************************************************/
 void TabButton::onClicked(WindowEventArgs& e)
 {
-	fireEvent(EventClicked, e, EventNamespace);
+	fireEvent(EventClickedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -84,7 +88,7 @@ void TabButton::onMouseButtonDown(MouseButtonEventArgs& e)
         {
             ++e.handled;
             d_dragging = true;
-            fireEvent(EventDragged, e, EventNamespace);
+            fireEvent(EventDraggedId, e, EventNamespace);
         }
     }
 
@@ -122,7 +126,7 @@ void TabButton::onCursorMove(CursorMoveEventArgs& e)
 {
     if (d_dragging)
     {
-        fireEvent(EventDragged, e, EventNamespace);
+        fireEvent(EventDraggedId, e, EventNamespace);
         ++e.handled;
     }
 
@@ -54,6 +54,8 @@ TabControlWindowRenderer::TabControlWindowRenderer(const String& name) :
 // event names
 const String TabControl::EventSelectionChanged( "SelectionChanged" );
 
+const EventId TabControl::EventSelectionChangedId(EventSelectionChanged);
+
 /*************************************************************************
     Child Widget name constants
 *************************************************************************/
@@ -497,7 +499,7 @@ Selection changed event
 void TabControl::onSelectionChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventSelectionChanged, e, EventNamespace);
+    fireEvent(EventSelectionChangedId, e, EventNamespace);
 }
 /*************************************************************************
 Font changed event
@@ -43,6 +43,10 @@ const String Thumb::EventThumbPositionChanged( "ThumbPositionChanged" );
 const String Thumb::EventThumbTrackStarted( "ThumbTrackStarted" );
 const String Thumb::EventThumbTrackEnded( "ThumbTrackEnded" );
 
+const EventId Thumb::EventThumbPositionChangedId(EventThumbPositionChanged);
+const EventId Thumb::EventThumbTrackStartedId(EventThumbTrackStarted);
+const EventId Thumb::EventThumbTrackEndedId(EventThumbTrackEnded);
+
 
 /*************************************************************************
 	Constructor for Thumb objects
@@ -152,7 +156,7 @@ void Thumb::setHorzRange(const glm::vec2& range)
 *************************************************************************/
 void Thumb::onThumbPositionChanged(WindowEventArgs& e)
 {
-	fireEvent(EventThumbPositionChanged, e, EventNamespace);
+	fireEvent(EventThumbPositionChangedId, e, EventNamespace);
 }
 
 
@@ -161,7 +165,7 @@ void Thumb::onThumbPositionChanged(WindowEventArgs& e)
 *************************************************************************/
 void Thumb::onThumbTrackStarted(WindowEventArgs& e)
 {
-	fireEvent(EventThumbTrackStarted, e, EventNamespace);
+	fireEvent(EventThumbTrackStartedId, e, EventNamespace);
 }
 
 
@@ -170,7 +174,7 @@ void Thumb::onThumbTrackStarted(WindowEventArgs& e)
 *************************************************************************/
 void Thumb::onThumbTrackEnded(WindowEventArgs& e)
 {
-	fireEvent(EventThumbTrackEnded, e, EventNamespace);
+	fireEvent(EventThumbTrackEndedId, e, EventNamespace);
 }
 
 
@@ -34,6 +34,8 @@ const String ToggleButton::WidgetTypeName("CEGUI/ToggleButton");
 const String ToggleButton::EventNamespace("ToggleButton");
 const String ToggleButton::EventSelectStateChanged("SelectStateChanged");
 
+const EventId ToggleButton::EventSelectStateChangedId(EventSelectStateChanged);
+
 //----------------------------------------------------------------------------//
 ToggleButton::ToggleButton(const String& type, const String& name) :
     ButtonBase(type, name),
@@ -71,7 +73,7 @@ void ToggleButton::setSelected(bool select)
 //----------------------------------------------------------------------------//
 void ToggleButton::onSelectStateChange(WindowEventArgs& e)
 {
-    fireEvent(EventSelectStateChanged, e, EventNamespace);
+    fireEvent(EventSelectStateChangedId, e, EventNamespace);
 }
 
 //----------------------------------------------------------------------------//
@@ -33,6 +33,7 @@
 #include <sstream>
 
 static const CEGUI::String EVENT_NAME("ExplicitlyAddedTestEvent");
+static const CEGUI::String EVENT_NAMESPACE("Namespace");
 
 class EventSetPerformanceTest : public PerformanceTest
 {
@@ -54,6 +55,47 @@ public:
     CEGUI::EventSet& d_eventSet;
 };
 
+class EventIdPerformanceTest : public PerformanceTest
+{
+public:
+    EventIdPerformanceTest(CEGUI::String test_name, CEGUI::EventSet& set)
+        : PerformanceTest(test_name), d_eventSet(set), d_eventId(EVENT_NAME)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::EventArgs args;
+        for (unsigned int i = 0; i < 1000000; ++i)
+        {
+            d_eventSet.fireEvent(d_eventId, args, EVENT_NAMESPACE);
+        }
+    }
+
+    CEGUI::EventSet& d_eventSet;
+    CEGUI::EventId d_eventId;
+};
+
+class NamespacedEventSetPerformanceTest : public EventSetPerformanceTest
+{
+public:
+    using EventSetPerformanceTest::EventSetPerformanceTest;
+
+    virtual void doTest()
+    {
+        CEGUI::EventArgs args;
+        for (unsigned int i = 0; i < 1000000; ++i)
+        {
+            d_eventSet.fireEvent(EVENT_NAME, args, EVENT_NAMESPACE);
+        }
+    }
+};
+
+static bool globalEventHandler(const CEGUI::EventArgs&)
+{
+    return false;
+}
+
 BOOST_AUTO_TEST_SUITE(EventSetPerformance)
 
 BOOST_AUTO_TEST_CASE(OneEventTest)
@@ -95,4 +137,36 @@ BOOST_AUTO_TEST_CASE(TenThousandEventsTest)
     EventSetPerformanceTest test("1000000x event lookup (10000 events)", set);
     test.execute();
 }
+
+BOOST_AUTO_TEST_CASE(OneHundredEventsByIdTest)
+{
+    CEGUI::EventSet set;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        std::stringstream s;
+        s << "Event" << i;
+        set.addEvent(s.str());
+    }
+    set.addEvent(EVENT_NAME);
+
+    EventIdPerformanceTest test("1000000x event lookup by id (101 events)", set);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(GlobalSubscriptionTest)
+{
+    // A global subscription to some other event must not slow down firing this one
+    CEGUI::Event::ScopedConnection connection(CEGUI::GlobalEventSet::getSingleton().subscribeEvent(
+        "Namespace/OtherTestEvent", &globalEventHandler));
+
+    CEGUI::EventSet set;
+    set.addEvent(EVENT_NAME);
+
+    NamespacedEventSetPerformanceTest byName("1000000x namespaced event firing (global subscriptions)", set);
+    byName.execute();
+
+    EventIdPerformanceTest byId("1000000x namespaced event firing by id (global subscriptions)", set);
+    byId.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,10 @@
 
 #include "CEGUI/views/StandardItemModel.h"
 #include "CEGUI/views/ListView.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/Window.h"
 
 #include <iostream>
@@ -95,6 +99,128 @@ public:
     StandardItemModel d_model;
 };
 
+/*!
+\brief
+    Renders, scrolls, hit-tests and sorts a virtualized ListView over a model
+    with one million rows.
+*/
+class VirtualizedListViewPerformanceTest : public WindowPerformanceTest<ListView>
+{
+public:
+    static const size_t ROW_COUNT = 1000000;
+    static const size_t SCROLL_STEPS = 200;
+
+    VirtualizedListViewPerformanceTest(String windowType, String renderer)
+        : WindowPerformanceTest<ListView>(windowType, renderer)
+    {
+        d_testName = windowType + " (virtualized, 1M rows)";
+        d_window->setSize(USize(cegui_absdim(400), cegui_absdim(600)));
+        d_window->setFont("DejaVuSans-12");
+        d_window->setVirtualizationEnabled(true);
+
+        // the list must be attached to a context for drawing to reach a surface
+        System& system = System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_window);
+
+        // fill the model before attaching it, so only the view is measured
+        for (size_t i = 0; i < ROW_COUNT; ++i)
+            d_model.addItem(PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(ROW_COUNT - i)));
+    }
+
+    ~VirtualizedListViewPerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    void doTest() override
+    {
+        d_window->setModel(&d_model);
+        render();
+
+        Scrollbar* vert_scrollbar = d_window->getVertScrollbar();
+        const glm::vec2 hit_position(d_window->getUnclippedInnerRect().get().getPosition() +
+            glm::vec2(10.0f, 10.0f));
+
+        for (size_t step = 0; step <= SCROLL_STEPS; ++step)
+        {
+            vert_scrollbar->setScrollPosition(
+                vert_scrollbar->getDocumentSize() * step / SCROLL_STEPS);
+            render();
+
+            d_window->indexAt(hit_position);
+        }
+
+        d_window->setSortMode(ViewSortMode::Ascending);
+        vert_scrollbar->setScrollPosition(0);
+        render();
+    }
+
+    StandardItemModel d_model;
+    GUIContext* d_context;
+};
+
+/*!
+\brief
+    Selects all rows of a virtualized ListView with 50000 rows, then scrolls
+    and renders it.
+*/
+class SelectAllListViewPerformanceTest : public WindowPerformanceTest<ListView>
+{
+public:
+    static const size_t ROW_COUNT = 50000;
+    static const size_t SCROLL_STEPS = 200;
+
+    SelectAllListViewPerformanceTest(String windowType, String renderer)
+        : WindowPerformanceTest<ListView>(windowType, renderer)
+    {
+        d_testName = windowType + " (50k rows, all selected)";
+        d_window->setSize(USize(cegui_absdim(400), cegui_absdim(600)));
+        d_window->setFont("DejaVuSans-12");
+        d_window->setMultiSelectEnabled(true);
+        d_window->setVirtualizationEnabled(true);
+
+        // the list must be attached to a context for drawing to reach a surface
+        System& system = System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_window);
+
+        for (size_t i = 0; i < ROW_COUNT; ++i)
+            d_model.addItem(PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(i)));
+        d_window->setModel(&d_model);
+        render();
+    }
+
+    ~SelectAllListViewPerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    void doTest() override
+    {
+        d_window->selectAll();
+        render();
+
+        Scrollbar* vert_scrollbar = d_window->getVertScrollbar();
+        for (size_t step = 0; step <= SCROLL_STEPS; ++step)
+        {
+            vert_scrollbar->setScrollPosition(
+                vert_scrollbar->getDocumentSize() * step / SCROLL_STEPS);
+            render();
+        }
+
+        d_window->clearSelections();
+        render();
+    }
+
+    StandardItemModel d_model;
+    GUIContext* d_context;
+};
+
 BOOST_AUTO_TEST_SUITE(ListViewPerformance)
 
 BOOST_AUTO_TEST_CASE(Test)
@@ -103,4 +229,16 @@ BOOST_AUTO_TEST_CASE(Test)
     listview_test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(Virtualized)
+{
+    VirtualizedListViewPerformanceTest listview_test("TaharezLook/ListView", "Core/ListView");
+    listview_test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(SelectAll)
+{
+    SelectAllListViewPerformanceTest listview_test("TaharezLook/ListView", "Core/ListView");
+    listview_test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
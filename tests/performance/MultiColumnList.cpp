@@ -0,0 +1,129 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+using namespace CEGUI;
+
+/*!
+\brief
+    Fills a sorted MultiColumnList with ten thousand rows, then scrolls,
+    renders and hit-tests it.
+*/
+class MultiColumnListPerformanceTest : public WindowPerformanceTest<MultiColumnList>
+{
+public:
+    static const unsigned int ROW_COUNT = 10000;
+    static const unsigned int SCROLL_STEPS = 200;
+
+    MultiColumnListPerformanceTest(String windowType, String renderer, bool batched)
+        : WindowPerformanceTest<MultiColumnList>(windowType, renderer),
+        d_batched(batched)
+    {
+        d_testName = windowType + (batched ? " (10000 rows, batched)" : " (10000 rows)");
+        d_window->setSize(USize(cegui_absdim(400), cegui_absdim(600)));
+        d_window->setFont("DejaVuSans-12");
+        d_window->addColumn("Name", 0, cegui_reldim(0.5f));
+        d_window->addColumn("Value", 1, cegui_reldim(0.5f));
+        d_window->setSortColumn(0);
+        d_window->setSortDirection(ListHeaderSegment::SortDirection::Ascending);
+
+        // the list must be attached to a context for drawing to reach a surface
+        System& system = System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_window);
+    }
+
+    ~MultiColumnListPerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    void doTest() override
+    {
+        if (d_batched)
+            d_window->beginUpdate();
+
+        for (unsigned int i = 0; i < ROW_COUNT; ++i)
+        {
+            const String value(PropertyHelper<std::uint32_t>::toString(ROW_COUNT - i));
+            const unsigned int row = d_window->addRow(new ListboxTextItem(value), 0);
+            d_window->setItem(new ListboxTextItem(value), 1, row);
+        }
+
+        if (d_batched)
+            d_window->endUpdate();
+
+        render();
+
+        Scrollbar* vert_scrollbar = d_window->getVertScrollbar();
+        const glm::vec2 hit_position(d_window->getUnclippedInnerRect().get().getPosition() +
+            glm::vec2(10.0f, 30.0f));
+
+        for (unsigned int step = 0; step <= SCROLL_STEPS; ++step)
+        {
+            vert_scrollbar->setScrollPosition(
+                vert_scrollbar->getDocumentSize() * step / SCROLL_STEPS);
+            render();
+
+            d_context->injectMousePosition(hit_position.x, hit_position.y);
+            d_context->injectMouseButtonDown(MouseButton::Left);
+            d_context->injectMouseButtonUp(MouseButton::Left);
+        }
+
+        d_window->resetList();
+        render();
+    }
+
+    GUIContext* d_context;
+    bool d_batched;
+};
+
+BOOST_AUTO_TEST_SUITE(MultiColumnListPerformance)
+
+BOOST_AUTO_TEST_CASE(Test)
+{
+    MultiColumnListPerformanceTest mcl_test("TaharezLook/MultiColumnList", "Core/MultiColumnList", false);
+    mcl_test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Batched)
+{
+    MultiColumnListPerformanceTest mcl_test("TaharezLook/MultiColumnList", "Core/MultiColumnList", true);
+    mcl_test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
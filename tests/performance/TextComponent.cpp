@@ -0,0 +1,98 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+
+/*!
+\brief
+    Redraws buttons that share one WidgetLookFeel, and thus its TextComponents,
+    but all show a different caption.
+*/
+class SharedLookButtonsPerformanceTest : public PerformanceTest
+{
+public:
+    SharedLookButtonsPerformanceTest(size_t button_count, size_t redraw_count, CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_redrawCount(redraw_count)
+    {
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 1024), CEGUI::UDim(0, 768)));
+        d_context->setRootWindow(d_root);
+
+        for (size_t i = 0; i < button_count; ++i)
+        {
+            CEGUI::Window* button = d_root->createChild("TaharezLook/Button");
+            button->setPosition(CEGUI::UVector2(CEGUI::UDim(0, (i % 10) * 100.f), CEGUI::UDim(0, (i / 10) * 30.f)));
+            button->setSize(CEGUI::USize(CEGUI::UDim(0, 96), CEGUI::UDim(0, 26)));
+            button->setText("Button " + CEGUI::PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(i)));
+            d_buttons.push_back(button);
+        }
+    }
+
+    ~SharedLookButtonsPerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    void doTest() override
+    {
+        for (size_t i = 0; i < d_redrawCount; ++i)
+        {
+            for (auto button : d_buttons)
+                button->invalidate();
+
+            d_root->draw();
+        }
+    }
+
+    CEGUI::GUIContext* d_context;
+    CEGUI::Window* d_root;
+    std::vector<CEGUI::Window*> d_buttons;
+    size_t d_redrawCount;
+};
+
+BOOST_AUTO_TEST_SUITE(TextComponentPerformance)
+
+BOOST_AUTO_TEST_CASE(SharedLookButtons)
+{
+    SharedLookButtonsPerformanceTest test(200, 100,
+        "100x 200 buttons with different captions redrawn (one shared look)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
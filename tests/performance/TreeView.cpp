@@ -30,6 +30,9 @@
 
 #include "CEGUI/views/StandardItemModel.h"
 #include "CEGUI/views/TreeView.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/Window.h"
 
 #include <iostream>
@@ -83,6 +86,94 @@ public:
     StandardItemModel d_model;
 };
 
+/*!
+\brief
+    Expands, collapses, hit-tests and selects items of a file-browser-like
+    tree with incremental layout enabled.
+*/
+class IncrementalTreePerformanceTest : public WindowPerformanceTest<TreeView>
+{
+public:
+    static const size_t FOLDER_COUNT = 500;
+    static const size_t SUBFOLDER_COUNT = 50;
+    static const size_t FILE_COUNT = 10;
+
+    IncrementalTreePerformanceTest(String windowType, String renderer)
+        : WindowPerformanceTest<TreeView>(windowType, renderer)
+    {
+        d_testName = windowType + " (incremental)";
+        d_window->setSize(USize(cegui_absdim(400), cegui_absdim(600)));
+        d_window->setFont("DejaVuSans-12");
+        d_window->setIncrementalLayoutEnabled(true);
+
+        // the tree must be attached to a context for drawing to reach a surface
+        System& system = System::getSingleton();
+        d_context = &system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_window);
+
+        // fill the model before attaching it, so only the view is measured
+        for (size_t folder = 0; folder < FOLDER_COUNT; ++folder)
+        {
+            StandardItem* folder_item = new StandardItem(
+                PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(folder)));
+            d_model.addItem(folder_item);
+
+            for (size_t subfolder = 0; subfolder < SUBFOLDER_COUNT; ++subfolder)
+            {
+                StandardItem* subfolder_item = new StandardItem(
+                    PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(subfolder)));
+                folder_item->addItem(subfolder_item);
+
+                for (size_t file = 0; file < FILE_COUNT; ++file)
+                    subfolder_item->addItem(new StandardItem(
+                        PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(file))));
+            }
+        }
+    }
+
+    ~IncrementalTreePerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    void doTest() override
+    {
+        d_window->setModel(&d_model);
+        d_window->draw();
+
+        const ModelIndex root = d_model.getRootIndex();
+        const glm::vec2 hit_position(d_window->getUnclippedInnerRect().get().getPosition() +
+            glm::vec2(100.0f, 100.0f));
+
+        // open every other folder and one of its subfolders, then close them
+        for (size_t pass = 0; pass < 2; ++pass)
+        {
+            for (size_t folder = pass; folder < FOLDER_COUNT; folder += 2)
+            {
+                const ModelIndex folder_index = d_model.makeIndex(folder, root);
+                d_window->toggleSubtree(*d_window->getTreeViewItemForIndex(folder_index));
+
+                const ModelIndex subfolder_index = d_model.makeIndex(folder % SUBFOLDER_COUNT, folder_index);
+                d_window->toggleSubtree(*d_window->getTreeViewItemForIndex(subfolder_index));
+
+                d_window->setSelectedIndex(d_window->indexAt(hit_position));
+                d_window->draw();
+            }
+
+            for (size_t folder = pass; folder < FOLDER_COUNT; folder += 2)
+            {
+                d_window->toggleSubtree(*d_window->getTreeViewItemForIndex(
+                    d_model.makeIndex(folder, root)));
+                d_window->draw();
+            }
+        }
+    }
+
+    StandardItemModel d_model;
+    GUIContext* d_context;
+};
+
 BOOST_AUTO_TEST_SUITE(TreeViewPerformance)
 
 BOOST_AUTO_TEST_CASE(Test)
@@ -92,4 +183,11 @@ BOOST_AUTO_TEST_CASE(Test)
     treeview_performance_test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(Incremental)
+{
+    IncrementalTreePerformanceTest treeview_performance_test(
+        "TaharezLook/TreeView", "Core/TreeView");
+    treeview_performance_test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -64,6 +64,125 @@ public:
     void (CEGUI::Window::* d_function)();
 };
 
+//! Creates many windows and destroys them in creation order.
+class CreateDestroyWindowsPerformanceTest : public PerformanceTest
+{
+public:
+    CreateDestroyWindowsPerformanceTest() :
+        PerformanceTest("20000 windows created and destroyed")
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        std::vector<CEGUI::Window*> windows;
+        for (unsigned int i = 0; i < 20000; ++i)
+            windows.push_back(wmgr.createWindow("DefaultWindow"));
+
+        for (CEGUI::Window* window : windows)
+            wmgr.destroyWindow(window);
+
+        wmgr.cleanDeadPool();
+    }
+};
+
+//! Repeatedly makes and destroys a small widget subtree, like a list row.
+class TemplateWindowsPerformanceTest : public PerformanceTest
+{
+public:
+    TemplateWindowsPerformanceTest(bool clone, bool recycle, CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_clone(clone),
+        d_recycle(recycle)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        if (d_recycle)
+        {
+            wmgr.setRecyclePoolSize(RowType, 16);
+            wmgr.setRecyclePoolSize(ButtonType, 16);
+        }
+
+        CEGUI::Window* prototype = createRow();
+        for (unsigned int i = 0; i < 2000; ++i)
+        {
+            CEGUI::Window* row =
+                d_clone ? prototype->clone() : createRow();
+            wmgr.destroyWindow(row);
+        }
+        wmgr.destroyWindow(prototype);
+
+        wmgr.setRecyclePoolSize(RowType, 0);
+        wmgr.setRecyclePoolSize(ButtonType, 0);
+        wmgr.cleanDeadPool();
+    }
+
+    static CEGUI::Window* createRow()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        CEGUI::Window* row = wmgr.createWindow(RowType);
+        row->setText("Row");
+        row->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(0, 30)));
+
+        CEGUI::Window* button = wmgr.createWindow(ButtonType, "Button");
+        button->setText("Open");
+        button->setPosition(CEGUI::UVector2(CEGUI::UDim(1, -80), CEGUI::UDim(0, 0)));
+        row->addChild(button);
+
+        return row;
+    }
+
+    static const CEGUI::String RowType;
+    static const CEGUI::String ButtonType;
+
+    bool d_clone;
+    bool d_recycle;
+};
+
+const CEGUI::String TemplateWindowsPerformanceTest::RowType("TaharezLook/StaticText");
+const CEGUI::String TemplateWindowsPerformanceTest::ButtonType("TaharezLook/Button");
+
+//! Sets the text of word wrapped labels whose width is adjusted to the text.
+class AutoSizedLabelsPerformanceTest : public PerformanceTest
+{
+public:
+    AutoSizedLabelsPerformanceTest() :
+        PerformanceTest("1000 word wrapped labels sized to their text")
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+        root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            CEGUI::Window* label = wmgr.createWindow("TaharezLook/StaticText");
+            label->setFont("DejaVuSans-12");
+            label->setProperty("WordWrap", "true");
+            label->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 80)));
+            label->setProperty("AdjustWidthToContent", "true");
+            root->addChild(label);
+
+            label->setText("Lorem ipsum dolor sit amet, consectetur adipiscing elit, "
+                           "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.");
+        }
+
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+    }
+};
+
 BOOST_AUTO_TEST_SUITE(WindowPerformance)
 
 BOOST_AUTO_TEST_CASE(MoveToBack)
@@ -80,4 +199,44 @@ BOOST_AUTO_TEST_CASE(MoveToFront)
     test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(CreateAndDestroy)
+{
+    CreateDestroyWindowsPerformanceTest test;
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CreateTemplateWindows)
+{
+    TemplateWindowsPerformanceTest test(false, false,
+        "2000x row with a button created and destroyed");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CloneTemplateWindows)
+{
+    TemplateWindowsPerformanceTest test(true, false,
+        "2000x row with a button cloned and destroyed");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CloneRecycledTemplateWindows)
+{
+    TemplateWindowsPerformanceTest test(true, true,
+        "2000x row with a button cloned and destroyed with recycle pools");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(RecycleTemplateWindows)
+{
+    TemplateWindowsPerformanceTest test(false, true,
+        "2000x row with a button created and destroyed with recycle pools");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(AutoSizedLabels)
+{
+    AutoSizedLabelsPerformanceTest test;
+    test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
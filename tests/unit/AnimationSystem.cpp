@@ -29,6 +29,9 @@
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/KeyFrame.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -179,4 +182,50 @@ BOOST_AUTO_TEST_CASE(ZeroDurationReplayModes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(AbsoluteApplication)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(d_zeroToOne);
+    d_zeroToOne->setReplayMode(CEGUI::Animation::ReplayMode::PlayOnce);
+    instance->setTargetWindow(window);
+
+    instance->start(false);
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+
+    // key frame values changed whilst running have to be picked up
+    d_zeroToOne->getAffectorAtIndex(0)->getKeyFrameAtPosition(1.0f)->setValue("0.5");
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(RelativeApplication)
+{
+    CEGUI::Animation* grow = CEGUI::AnimationManager::getSingleton().createAnimation("Grow");
+    grow->setDuration(1.0f);
+    CEGUI::Affector* affector = grow->createAffector("Size", "USize");
+    affector->setApplicationMethod(CEGUI::Affector::ApplicationMethod::ApplyRelative);
+    affector->createKeyFrame(0.0f, "{{0,0},{0,0}}");
+    affector->createKeyFrame(1.0f, "{{0,100},{0,50}}");
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    window->setSize(CEGUI::USize(cegui_absdim(10.0f), cegui_absdim(20.0f)));
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(grow);
+    instance->setTargetWindow(window);
+    instance->start(false);
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getSize().d_width.d_offset, 60.0f, 0.0001f);
+    BOOST_CHECK_CLOSE(window->getSize().d_height.d_offset, 45.0f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(grow);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
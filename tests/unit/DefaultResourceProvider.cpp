@@ -0,0 +1,139 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+
+#if !defined(__WIN32__) && !defined(_WIN32) && !defined(__ANDROID__)
+
+//! Restores the mapping settings of the DefaultResourceProvider.
+class MappingSettingsScope
+{
+public:
+    MappingSettingsScope() :
+        d_provider(*static_cast<CEGUI::DefaultResourceProvider*>(
+            CEGUI::System::getSingleton().getResourceProvider())),
+        d_threshold(d_provider.getMemoryMappingThreshold()),
+        d_shared(d_provider.isSharedMappingsEnabled())
+    {}
+
+    ~MappingSettingsScope()
+    {
+        d_provider.setMemoryMappingThreshold(d_threshold);
+        d_provider.setSharedMappingsEnabled(d_shared);
+    }
+
+    CEGUI::DefaultResourceProvider& d_provider;
+
+private:
+    size_t d_threshold;
+    bool d_shared;
+};
+
+BOOST_AUTO_TEST_SUITE(DefaultResourceProvider)
+
+BOOST_AUTO_TEST_CASE(MappedFileMatchesReadFile)
+{
+    MappingSettingsScope settings;
+    CEGUI::DefaultResourceProvider& provider = settings.d_provider;
+    const CEGUI::DefaultResourceProvider::MappingStatistics before =
+        provider.getMappingStatistics();
+
+    provider.setMemoryMappingThreshold(0);
+    CEGUI::RawDataContainer read;
+    provider.loadRawDataContainer("DejaVuSans.ttf", read, "fonts");
+    BOOST_CHECK(!read.isDataShared());
+
+    provider.setMemoryMappingThreshold(64 * 1024);
+    CEGUI::RawDataContainer mapped;
+    provider.loadRawDataContainer("DejaVuSans.ttf", mapped, "fonts");
+    BOOST_CHECK(mapped.isDataShared());
+
+    BOOST_REQUIRE_EQUAL(mapped.getSize(), read.getSize());
+    BOOST_CHECK(std::memcmp(mapped.getDataPtr(), read.getDataPtr(), read.getSize()) == 0);
+
+    const CEGUI::DefaultResourceProvider::MappingStatistics during =
+        provider.getMappingStatistics();
+    BOOST_CHECK_EQUAL(during.d_mappingCount, before.d_mappingCount + 1);
+    BOOST_CHECK_EQUAL(during.d_mappedBytes, before.d_mappedBytes + mapped.getSize());
+    BOOST_CHECK_LE(during.d_residentBytes, during.d_mappedBytes);
+
+    provider.unloadRawDataContainer(mapped);
+    provider.unloadRawDataContainer(read);
+    BOOST_CHECK(mapped.getDataPtr() == nullptr);
+    BOOST_CHECK_EQUAL(provider.getMappingStatistics().d_mappingCount, before.d_mappingCount);
+}
+
+BOOST_AUTO_TEST_CASE(SmallFilesAreRead)
+{
+    MappingSettingsScope settings;
+    CEGUI::DefaultResourceProvider& provider = settings.d_provider;
+    provider.setMemoryMappingThreshold(64 * 1024);
+
+    CEGUI::RawDataContainer data;
+    provider.loadRawDataContainer("DejaVuSans-10.font", data, "fonts");
+    BOOST_CHECK(!data.isDataShared());
+    provider.unloadRawDataContainer(data);
+}
+
+BOOST_AUTO_TEST_CASE(SharedMappings)
+{
+    MappingSettingsScope settings;
+    CEGUI::DefaultResourceProvider& provider = settings.d_provider;
+    provider.setMemoryMappingThreshold(64 * 1024);
+    const size_t mappingCount = provider.getMappingStatistics().d_mappingCount;
+
+    CEGUI::RawDataContainer first;
+    CEGUI::RawDataContainer second;
+    provider.setSharedMappingsEnabled(false);
+    provider.loadRawDataContainer("DejaVuSerif.ttf", first, "fonts");
+    provider.loadRawDataContainer("DejaVuSerif.ttf", second, "fonts");
+    BOOST_CHECK(first.getDataPtr() != second.getDataPtr());
+    BOOST_CHECK_EQUAL(provider.getMappingStatistics().d_mappingCount, mappingCount + 2);
+    provider.unloadRawDataContainer(second);
+
+    provider.setSharedMappingsEnabled(true);
+    provider.loadRawDataContainer("DejaVuSerif.ttf", second, "fonts");
+    BOOST_CHECK(first.getDataPtr() == second.getDataPtr());
+    BOOST_CHECK_EQUAL(provider.getMappingStatistics().d_mappingCount, mappingCount + 1);
+
+    // the mapping is kept until the last container using it is unloaded
+    provider.unloadRawDataContainer(first);
+    BOOST_CHECK_EQUAL(second.getDataPtr()[0], 0);
+    BOOST_CHECK_EQUAL(provider.getMappingStatistics().d_mappingCount, mappingCount + 1);
+    provider.unloadRawDataContainer(second);
+    BOOST_CHECK_EQUAL(provider.getMappingStatistics().d_mappingCount, mappingCount);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
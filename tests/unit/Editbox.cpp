@@ -0,0 +1,101 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/widgets/Editbox.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Clipboard.h"
+#include "CEGUI/text/RenderedText.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! Provides an Editbox and helpers to edit it the way typing does.
+struct EditboxFixture
+{
+    EditboxFixture()
+    {
+        d_editbox = static_cast<CEGUI::Editbox*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Editbox"));
+        d_editbox->setFont("DejaVuSans-12");
+    }
+
+    ~EditboxFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_editbox);
+    }
+
+    //! Appends \a text as an edit of the rendered text.
+    void append(const CEGUI::String& text)
+    {
+        d_editbox->setCaretIndex(d_editbox->getText().size());
+
+        CEGUI::Clipboard clipboard;
+        clipboard.setText(text);
+        d_editbox->performPaste(clipboard);
+    }
+
+    //! Checks that the editbox renders \a text, or as many mask code points if masked.
+    void checkRenderedText(const CEGUI::String& text)
+    {
+        const CEGUI::String shown = d_editbox->isTextMaskingEnabled() ?
+            CEGUI::String(text.size(), static_cast<char32_t>(d_editbox->getTextMaskingCodepoint())) : text;
+
+        CEGUI::RenderedText expected;
+        expected.renderText(shown, nullptr, d_editbox->getEffectiveFont(),
+            d_editbox->getDefaultParagraphDirection());
+        expected.updateFormatting(d_editbox->getPixelSize().d_width);
+
+        const CEGUI::RenderedText& rendered = d_editbox->getRenderedText();
+        BOOST_CHECK_EQUAL(rendered.endTextIndex(), expected.endTextIndex());
+        BOOST_CHECK_CLOSE(rendered.getExtents().d_width, expected.getExtents().d_width, 0.01f);
+    }
+
+    CEGUI::Editbox* d_editbox;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Editbox, EditboxFixture)
+
+BOOST_AUTO_TEST_CASE(TextMaskingChangesRenderAfterEdits)
+{
+    d_editbox->setText("abc");
+    checkRenderedText("abc");
+
+    // An edit pending when masking is toggled must not be applied to the old rendering
+    append("def");
+    d_editbox->setTextMaskingEnabled(true);
+    append("gh");
+    checkRenderedText("abcdefgh");
+
+    d_editbox->setTextMaskingCodepoint('#');
+    append("i");
+    checkRenderedText("abcdefghi");
+
+    d_editbox->setTextMaskingEnabled(false);
+    checkRenderedText("abcdefghi");
+    append("j");
+    checkRenderedText("abcdefghij");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,6 +27,7 @@
 
 #include "CEGUI/Element.h"
 #include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/timer.hpp>
@@ -320,4 +321,73 @@ BOOST_AUTO_TEST_CASE(PixelAlignment)
     delete root;
 }
 
+BOOST_AUTO_TEST_CASE(UnchangedAreaFiresNoEvents)
+{
+    CEGUI::Element* root = new CEGUI::Element();
+    root->setArea(CEGUI::UVector2(0.1f * CEGUI::UDim::percent(), 0.0f * CEGUI::UDim::px()),
+                  CEGUI::USize(0.2f * CEGUI::UDim::percent(), 100.0f * CEGUI::UDim::px()));
+
+    unsigned int events = 0;
+    root->subscribeEvent(CEGUI::Element::EventSized, [&events]() { ++events; });
+    root->subscribeEvent(CEGUI::Element::EventMoved, [&events]() { ++events; });
+
+    root->setArea(root->getPosition(), root->getSize());
+    root->setArea(CEGUI::UVector2(0.1f * CEGUI::UDim::percent(), 0.0f * CEGUI::UDim::px()),
+                  CEGUI::USize(0.2f * CEGUI::UDim::percent(), 100.0f * CEGUI::UDim::px()));
+    root->setPosition(root->getPosition());
+    BOOST_CHECK_EQUAL(events, 0u);
+
+    delete root;
+}
+
+BOOST_AUTO_TEST_CASE(LayoutTransaction)
+{
+    CEGUI::Element* root = new CEGUI::Element();
+    root->setSize(CEGUI::USize(100.0f * CEGUI::UDim::px(), 100.0f * CEGUI::UDim::px()));
+    CEGUI::Element* child = new CEGUI::Element();
+    child->setSize(CEGUI::USize(50.0f * CEGUI::UDim::percent(), 50.0f * CEGUI::UDim::percent()));
+    root->addChild(child);
+
+    unsigned int rootSized = 0;
+    unsigned int rootMoved = 0;
+    unsigned int childSized = 0;
+    root->subscribeEvent(CEGUI::Element::EventSized, [&rootSized]() { ++rootSized; });
+    root->subscribeEvent(CEGUI::Element::EventMoved, [&rootMoved]() { ++rootMoved; });
+    child->subscribeEvent(CEGUI::Element::EventSized, [&childSized]() { ++childSized; });
+
+    CEGUI::Element::beginLayoutTransaction();
+    CEGUI::Element::beginLayoutTransaction();
+    BOOST_CHECK(CEGUI::Element::isLayoutTransactionActive());
+
+    child->setSize(CEGUI::USize(25.0f * CEGUI::UDim::percent(), 25.0f * CEGUI::UDim::percent()));
+    root->setSize(CEGUI::USize(300.0f * CEGUI::UDim::px(), 300.0f * CEGUI::UDim::px()));
+    root->setSize(CEGUI::USize(200.0f * CEGUI::UDim::px(), 200.0f * CEGUI::UDim::px()));
+    root->setPosition(CEGUI::UVector2(10.0f * CEGUI::UDim::px(), 10.0f * CEGUI::UDim::px()));
+
+    // Nothing is laid out before the outermost transaction ends
+    CEGUI::Element::endLayoutTransaction();
+    BOOST_CHECK_EQUAL(root->getPixelSize(), CEGUI::Sizef(100.0f, 100.0f));
+    BOOST_CHECK_EQUAL(rootSized + rootMoved + childSized, 0u);
+
+    CEGUI::Element::endLayoutTransaction();
+    BOOST_CHECK(!CEGUI::Element::isLayoutTransactionActive());
+    BOOST_CHECK_EQUAL(root->getPixelSize(), CEGUI::Sizef(200.0f, 200.0f));
+    BOOST_CHECK_EQUAL(child->getPixelSize(), CEGUI::Sizef(50.0f, 50.0f));
+    BOOST_CHECK_EQUAL(child->getUnclippedOuterRect().get(), CEGUI::Rectf(10.0f, 10.0f, 60.0f, 60.0f));
+    BOOST_CHECK_EQUAL(rootSized, 1u);
+    BOOST_CHECK_EQUAL(rootMoved, 1u);
+    BOOST_CHECK_EQUAL(childSized, 1u);
+
+    // Destroyed elements are dropped from the pending layout
+    CEGUI::Element::beginLayoutTransaction();
+    child->setSize(CEGUI::USize(10.0f * CEGUI::UDim::px(), 10.0f * CEGUI::UDim::px()));
+    root->removeChild(child);
+    delete child;
+    CEGUI::Element::endLayoutTransaction();
+
+    BOOST_CHECK_THROW(CEGUI::Element::endLayoutTransaction(), CEGUI::InvalidRequestException);
+
+    delete root;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,7 @@
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/Window.h"
 
 #include <functional>
 
@@ -453,4 +454,73 @@ BOOST_AUTO_TEST_CASE(Subscribing)
     }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(FiringByEventId)
+{
+    CEGUI::EventSet set;
+    TestEventArgs args;
+
+    const CEGUI::String eventName("EventIdTestEvent");
+    BOOST_CHECK(!CEGUI::EventId::find(eventName).isValid());
+
+    CEGUI::Event::ScopedConnection connection = set.subscribeEvent(eventName, &freeFunctionSubscriber);
+    const CEGUI::EventId id = CEGUI::EventId::find(eventName);
+    BOOST_REQUIRE(id.isValid());
+    BOOST_CHECK(id == CEGUI::EventId(eventName));
+    BOOST_CHECK_EQUAL(id.getName(), eventName);
+
+    args.d_targetValue = 50;
+    set.fireEvent(id, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 50);
+
+    set.removeEvent(eventName);
+    args.d_targetValue = 51;
+    set.fireEvent(id, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 50);
+}
+
+BOOST_AUTO_TEST_CASE(EventNameIds)
+{
+    // The ids of the event names are interned at static initialisation
+    BOOST_CHECK(CEGUI::Window::EventTextChangedId.isValid());
+    BOOST_CHECK(CEGUI::Window::EventTextChangedId == CEGUI::EventId::find(CEGUI::Window::EventTextChanged));
+
+    CEGUI::EventSet set;
+    set.addEvent("IdTestEventB");
+    set.addEvent("IdTestEventA");
+    BOOST_CHECK(set.isEventPresent("IdTestEventA"));
+    BOOST_CHECK(!set.isEventPresent("IdTestEventC"));
+
+    // Events are iterated in the order of their ids, keyed by their names
+    CEGUI::EventSet::EventIterator it = set.getEventIterator();
+    BOOST_REQUIRE(!it.isAtEnd());
+    BOOST_CHECK_EQUAL(it.getCurrentKey(), "IdTestEventB");
+    ++it;
+    BOOST_REQUIRE(!it.isAtEnd());
+    BOOST_CHECK_EQUAL(it.getCurrentKey(), "IdTestEventA");
+    BOOST_CHECK(it.getCurrentValue().get() == set.getEventObject("IdTestEventA"));
+    ++it;
+    BOOST_CHECK(it.isAtEnd());
+}
+
+BOOST_AUTO_TEST_CASE(FiringGlobalEvents)
+{
+    CEGUI::EventSet set;
+    TestEventArgs args;
+
+    CEGUI::Event::ScopedConnection connection = CEGUI::GlobalEventSet::getSingleton().subscribeEvent(
+        "TestNamespace/GlobalTestEvent", &freeFunctionSubscriber);
+
+    // Only the namespace the global event was subscribed for is notified
+    args.d_targetValue = 60;
+    set.fireEvent("GlobalTestEvent", args, "OtherNamespace");
+    BOOST_CHECK(g_GlobalEventValue != 60);
+    set.fireEvent("GlobalTestEvent", args, "TestNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 60);
+
+    args.d_targetValue = 61;
+    set.fireEvent(CEGUI::EventId("GlobalTestEvent"), args, "TestNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 61);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/FrameProfiler.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+struct FrameProfilerFixture
+{
+    FrameProfilerFixture() :
+        d_profiler(CEGUI::FrameProfiler::getSingleton())
+    {
+        d_profiler.clear();
+        d_profiler.setEnabled(true);
+    }
+
+    ~FrameProfilerFixture()
+    {
+        d_profiler.setEnabled(false);
+        d_profiler.setHistorySize(120);
+        d_profiler.setMaxSamplesPerFrame(65536);
+        d_profiler.clear();
+    }
+
+    CEGUI::FrameProfiler& d_profiler;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FrameProfiler, FrameProfilerFixture)
+
+BOOST_AUTO_TEST_CASE(RecordsNestedScopes)
+{
+    {
+        CEGUI::ProfileScope outer("Outer");
+        {
+            CEGUI::ProfileScope inner("Inner", "Detail");
+        }
+        d_profiler.addCount(CEGUI::ProfilerCounter::Vertices, 6);
+    }
+    d_profiler.endFrame();
+
+    BOOST_REQUIRE_EQUAL(d_profiler.getFrameCount(), 1u);
+    const CEGUI::ProfilerFrame& frame = d_profiler.getLastFrame();
+    BOOST_REQUIRE_EQUAL(frame.d_samples.size(), 2u);
+    BOOST_CHECK_EQUAL(frame.d_samples[0].d_depth, 0u);
+    BOOST_CHECK_EQUAL(frame.d_samples[1].d_depth, 1u);
+    BOOST_CHECK(frame.d_samples[1].d_detail == "Detail");
+    BOOST_CHECK(frame.d_samples[0].d_duration >= frame.d_samples[1].d_duration);
+    BOOST_CHECK_EQUAL(frame.getCounter(CEGUI::ProfilerCounter::Vertices), 6u);
+    BOOST_CHECK_EQUAL(frame.getTotalTime("Inner", "Other"), 0u);
+    BOOST_CHECK_EQUAL(frame.getTotalTime("Inner", "Detail"), frame.d_samples[1].d_duration);
+}
+
+BOOST_AUTO_TEST_CASE(DisabledProfilerRecordsNothing)
+{
+    d_profiler.setEnabled(false);
+    {
+        CEGUI::ProfileScope scope("Scope");
+    }
+    d_profiler.endFrame();
+
+    BOOST_CHECK_EQUAL(d_profiler.getFrameCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(KeepsMostRecentFrames)
+{
+    d_profiler.setHistorySize(3);
+    for (int i = 0; i < 5; ++i)
+        d_profiler.endFrame();
+
+    BOOST_REQUIRE_EQUAL(d_profiler.getFrameCount(), 3u);
+    BOOST_CHECK_EQUAL(d_profiler.getFrame(0).d_number + 2, d_profiler.getLastFrame().d_number);
+
+    const std::uint64_t last = d_profiler.getLastFrame().d_number;
+    d_profiler.setHistorySize(2);
+    BOOST_REQUIRE_EQUAL(d_profiler.getFrameCount(), 2u);
+    BOOST_CHECK_EQUAL(d_profiler.getLastFrame().d_number, last);
+    BOOST_CHECK_THROW(d_profiler.getFrame(2), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(DropsSamplesOverLimit)
+{
+    d_profiler.setMaxSamplesPerFrame(2);
+    for (int i = 0; i < 5; ++i)
+        CEGUI::ProfileScope scope("Scope");
+    d_profiler.endFrame();
+
+    BOOST_CHECK_EQUAL(d_profiler.getLastFrame().d_samples.size(), 2u);
+    BOOST_CHECK_EQUAL(d_profiler.getLastFrame().d_droppedSamples, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(WritesChromeTrace)
+{
+    {
+        CEGUI::ProfileScope scope("Scope", "Quote \" and \\");
+    }
+    d_profiler.endFrame();
+
+    std::ostringstream trace;
+    d_profiler.writeChromeTrace(trace);
+    const std::string json = trace.str();
+
+    BOOST_CHECK_EQUAL(json.find("{\"traceEvents\":["), 0u);
+    BOOST_CHECK(json.find("\"name\":\"Scope\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"detail\":\"Quote \\\" and \\\\\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"WindowRedraws\":0") != std::string::npos);
+}
+
+#ifdef CEGUI_USE_FRAME_PROFILER
+BOOST_AUTO_TEST_CASE(InstrumentsRendering)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(system.getRenderer()->getDefaultRenderTarget());
+    CEGUI::Window* root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("CEGUI/PushButton");
+    button->setSize(CEGUI::USize(CEGUI::UDim(0.f, 100.f), CEGUI::UDim(0.f, 30.f)));
+    root->addChild(button);
+    context.setRootWindow(root);
+
+    d_profiler.clear();
+    button->invalidate();
+    system.renderAllGUIContexts();
+
+    const CEGUI::ProfilerFrame& frame = d_profiler.getLastFrame();
+    BOOST_CHECK_EQUAL(frame.getCounter(CEGUI::ProfilerCounter::WindowInvalidations), 1u);
+    BOOST_CHECK_EQUAL(frame.getCounter(CEGUI::ProfilerCounter::WindowRedraws), 1u);
+    BOOST_CHECK(frame.getTotalTime("GUIContext::draw") > 0);
+    BOOST_CHECK(frame.getTotalTime("Window::bufferGeometry", "CEGUI/PushButton") > 0);
+
+    context.setRootWindow(nullptr);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+    system.destroyGUIContext(context);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
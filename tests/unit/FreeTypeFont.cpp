@@ -0,0 +1,174 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/text/FreeTypeFont.h"
+#include "CEGUI/text/FontGlyph.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Image.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <thread>
+
+/*!
+    Creates a FreeTypeFont of its own with asynchronous rasterisation enabled,
+    so that glyphs loaded by other tests don't interfere.
+*/
+struct AsyncRasterisationFixture
+{
+    AsyncRasterisationFixture() :
+        d_font(static_cast<CEGUI::FreeTypeFont&>(
+            CEGUI::FontManager::getSingleton().createFreeTypeFont(
+                "AsyncRasterisationTest", 12.0f, CEGUI::FontSizeUnit::Pixels,
+                true, "DejaVuSans.ttf", "fonts")))
+    {
+        d_font.setAsyncRasterisationEnabled(true);
+    }
+
+    ~AsyncRasterisationFixture()
+    {
+        CEGUI::FontManager::getSingleton().destroy(d_font);
+    }
+
+    CEGUI::FontGlyph* loadGlyph(char32_t code_point)
+    {
+        return d_font.loadGlyph(d_font.getGlyphIndexForCodepoint(code_point));
+    }
+
+    const CEGUI::FontGlyph* getGlyph(char32_t code_point) const
+    {
+        return d_font.getGlyph(d_font.getGlyphIndexForCodepoint(code_point));
+    }
+
+    //! Processes the finished glyphs, like System does each frame, until none is pending.
+    bool waitForPendingGlyphs()
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (d_font.getPendingGlyphCount())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            if (!d_font.processPendingGlyphs())
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    CEGUI::FreeTypeFont& d_font;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FreeTypeFont, AsyncRasterisationFixture)
+
+BOOST_AUTO_TEST_CASE(GlyphsAreHandedBackByProcessPendingGlyphs)
+{
+    const CEGUI::FontGlyph* glyph = loadGlyph('A');
+
+    // The metrics are needed for layout right away, the bitmap comes later
+    BOOST_REQUIRE(glyph);
+    BOOST_CHECK_GT(glyph->getAdvance(), 0.0f);
+    BOOST_CHECK(!glyph->getImage());
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 1u);
+
+    // Workers never touch the glyph, however long they had
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    BOOST_CHECK(!glyph->getImage());
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 1u);
+
+    BOOST_REQUIRE(waitForPendingGlyphs());
+    BOOST_CHECK(glyph->getImage());
+    BOOST_CHECK(!d_font.processPendingGlyphs());
+}
+
+BOOST_AUTO_TEST_CASE(PlaceholderIsDrawnUntilReady)
+{
+    d_font.setPlaceholderCodePoint('?');
+
+    // The placeholder is always rendered synchronously
+    const CEGUI::FontGlyph* placeholder = loadGlyph('?');
+    BOOST_REQUIRE(placeholder && placeholder->getImage());
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 0u);
+
+    const CEGUI::FontGlyph* glyph = loadGlyph('B');
+    BOOST_REQUIRE(glyph);
+    BOOST_CHECK(glyph->getImage() == placeholder->getImage());
+
+    BOOST_REQUIRE(waitForPendingGlyphs());
+    BOOST_CHECK(glyph->getImage());
+    BOOST_CHECK(glyph->getImage() != placeholder->getImage());
+}
+
+BOOST_AUTO_TEST_CASE(PreloadedGlyphsGetMetricsFromWorkers)
+{
+    d_font.preloadGlyphs('0', '9');
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 10u);
+
+    BOOST_REQUIRE(waitForPendingGlyphs());
+    for (char32_t codePoint = '0'; codePoint <= '9'; ++codePoint)
+    {
+        const CEGUI::FontGlyph* glyph = getGlyph(codePoint);
+        BOOST_REQUIRE(glyph);
+        BOOST_CHECK_GT(glyph->getAdvance(), 0.0f);
+        BOOST_CHECK(glyph->getImage());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SizeChangeDropsPendingGlyphs)
+{
+    loadGlyph('H');
+    BOOST_REQUIRE(waitForPendingGlyphs());
+    const float smallHeight = getGlyph('H')->getImage()->getRenderedSize().d_height;
+
+    loadGlyph('B');
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 1u);
+
+    // Results rendered at the previous size must not show up
+    d_font.setSize(24.0f);
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 0u);
+    BOOST_CHECK(!d_font.processPendingGlyphs());
+
+    loadGlyph('H');
+    BOOST_REQUIRE(waitForPendingGlyphs());
+    BOOST_CHECK_GT(getGlyph('H')->getImage()->getRenderedSize().d_height, smallHeight);
+}
+
+BOOST_AUTO_TEST_CASE(DisablingRendersPendingGlyphsSynchronously)
+{
+    const CEGUI::FontGlyph* glyph = loadGlyph('A');
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 1u);
+
+    d_font.setAsyncRasterisationEnabled(false);
+    BOOST_CHECK_EQUAL(d_font.getPendingGlyphCount(), 0u);
+
+    glyph = loadGlyph('A');
+    BOOST_REQUIRE(glyph);
+    BOOST_CHECK(glyph->getImage());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
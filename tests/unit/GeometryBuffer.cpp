@@ -0,0 +1,217 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+//! Restores the use of the SIMD quad kernels.
+class SIMDQuadKernelScope
+{
+public:
+    SIMDQuadKernelScope() : d_enabled(CEGUI::GeometryBuffer::isSIMDQuadKernelEnabled()) {}
+    ~SIMDQuadKernelScope() { CEGUI::GeometryBuffer::setSIMDQuadKernelEnabled(d_enabled); }
+
+private:
+    bool d_enabled;
+};
+
+static const CEGUI::Rectf ClipRect(0.0f, 0.0f, 100.0f, 100.0f);
+
+//! Quads inside, partly outside, fully outside and empty, relative to ClipRect.
+static const CEGUI::Rectf DestRects[] =
+{
+    CEGUI::Rectf(10.0f, 10.0f, 50.0f, 40.0f),
+    CEGUI::Rectf(-20.0f, 5.0f, 30.0f, 25.0f),
+    CEGUI::Rectf(90.0f, 80.5f, 130.0f, 120.0f),
+    CEGUI::Rectf(200.0f, 200.0f, 220.0f, 220.0f),
+    CEGUI::Rectf(30.0f, 30.0f, 30.0f, 60.0f),
+    CEGUI::Rectf(40.0f, 40.0f, 60.0f, 40.0f),
+    CEGUI::Rectf(60.0f, 70.0f, 50.0f, 80.0f),
+    CEGUI::Rectf(0.0f, 0.0f, 100.0f, 100.0f),
+    CEGUI::Rectf(-10.0f, -10.0f, 110.0f, 110.0f)
+};
+static const size_t QuadCount = sizeof(DestRects) / sizeof(DestRects[0]);
+
+static std::vector<CEGUI::Rectf> makeTexRects()
+{
+    std::vector<CEGUI::Rectf> texRects;
+    for (size_t i = 0; i < QuadCount; ++i)
+        texRects.push_back(CEGUI::Rectf(0.05f * i, 0.1f, 0.5f + 0.05f * i, 0.9f));
+    texRects[1] = CEGUI::Rectf(0.0f, 0.0f, 1.0f, 1.0f);
+    return texRects;
+}
+
+static std::vector<CEGUI::ColourRect> makeColours()
+{
+    std::vector<CEGUI::ColourRect> colours;
+    for (size_t i = 0; i < QuadCount; ++i)
+        colours.push_back(CEGUI::ColourRect(
+            CEGUI::Colour(0.1f * i, 0.2f, 0.3f, 1.0f), CEGUI::Colour(0.4f, 0.1f * i, 0.6f, 0.9f),
+            CEGUI::Colour(0.7f, 0.8f, 0.1f * i, 0.8f), CEGUI::Colour(1.0f, 0.5f, 0.25f, 0.1f * i)));
+    return colours;
+}
+
+//! Writes the quads with the SIMD kernels enabled or disabled.
+static std::vector<float> writeTexturedQuads(bool simd, const CEGUI::Rectf* clip,
+                                             size_t colour_count, size_t& written)
+{
+    CEGUI::GeometryBuffer::setSIMDQuadKernelEnabled(simd);
+    const std::vector<CEGUI::Rectf> texRects = makeTexRects();
+    const std::vector<CEGUI::ColourRect> colours = makeColours();
+
+    std::vector<float> out(QuadCount * 6 * CEGUI::GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT);
+    written = CEGUI::GeometryBuffer::writeTexturedQuads(out.data(), DestRects, texRects.data(),
+        QuadCount, colours.data(), colour_count, clip);
+    out.resize(written * 6 * CEGUI::GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT);
+    return out;
+}
+
+static std::vector<float> writeSolidRects(bool simd, const CEGUI::Rectf* clip,
+                                          size_t colour_count, size_t& written)
+{
+    CEGUI::GeometryBuffer::setSIMDQuadKernelEnabled(simd);
+    const std::vector<CEGUI::ColourRect> colours = makeColours();
+
+    std::vector<float> out(QuadCount * 6 * CEGUI::GeometryBuffer::COLORED_VERTEX_FLOAT_COUNT);
+    written = CEGUI::GeometryBuffer::writeSolidRects(out.data(), DestRects, QuadCount,
+        colours.data(), colour_count, clip);
+    out.resize(written * 6 * CEGUI::GeometryBuffer::COLORED_VERTEX_FLOAT_COUNT);
+    return out;
+}
+
+static void checkVerticesMatch(const std::vector<float>& simd, const std::vector<float>& scalar)
+{
+    BOOST_REQUIRE_EQUAL(simd.size(), scalar.size());
+    for (size_t i = 0; i < simd.size(); ++i)
+        BOOST_CHECK_SMALL(simd[i] - scalar[i], 1e-5f);
+}
+
+BOOST_AUTO_TEST_SUITE(GeometryBuffer)
+
+BOOST_AUTO_TEST_CASE(TexturedQuadKernelsMatch)
+{
+    SIMDQuadKernelScope scope;
+    if (!CEGUI::GeometryBuffer::isSIMDQuadKernelAvailable())
+        BOOST_TEST_MESSAGE("No SIMD quad kernel, comparing the portable code with itself.");
+
+    for (size_t colourCount : { size_t(1), QuadCount })
+    {
+        size_t simdWritten, scalarWritten;
+
+        // the empty quads are skipped
+        checkVerticesMatch(writeTexturedQuads(true, nullptr, colourCount, simdWritten),
+                           writeTexturedQuads(false, nullptr, colourCount, scalarWritten));
+        BOOST_CHECK_EQUAL(simdWritten, 6u);
+        BOOST_CHECK_EQUAL(scalarWritten, 6u);
+
+        // the quads outside of the clip rect are skipped as well
+        const std::vector<float> simd = writeTexturedQuads(true, &ClipRect, colourCount, simdWritten);
+        const std::vector<float> scalar = writeTexturedQuads(false, &ClipRect, colourCount, scalarWritten);
+        checkVerticesMatch(simd, scalar);
+        BOOST_CHECK_EQUAL(simdWritten, 5u);
+        BOOST_CHECK_EQUAL(scalarWritten, 5u);
+
+        // the second quad is clipped at the left, which moves its texture
+        // coordinates by 20 / 50 of the texture width
+        const float* topLeft = &scalar[6 * CEGUI::GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT];
+        BOOST_CHECK_EQUAL(topLeft[0], 0.0f);
+        BOOST_CHECK_EQUAL(topLeft[1], 5.0f);
+        BOOST_CHECK_CLOSE(topLeft[7], 0.4f, 1e-3f);
+        BOOST_CHECK_EQUAL(topLeft[8], 0.0f);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SolidRectKernelsMatch)
+{
+    SIMDQuadKernelScope scope;
+
+    for (size_t colourCount : { size_t(1), QuadCount })
+    {
+        size_t simdWritten, scalarWritten;
+        checkVerticesMatch(writeSolidRects(true, nullptr, colourCount, simdWritten),
+                           writeSolidRects(false, nullptr, colourCount, scalarWritten));
+        BOOST_CHECK_EQUAL(simdWritten, scalarWritten);
+
+        checkVerticesMatch(writeSolidRects(true, &ClipRect, colourCount, simdWritten),
+                           writeSolidRects(false, &ClipRect, colourCount, scalarWritten));
+        BOOST_CHECK_EQUAL(simdWritten, 5u);
+        BOOST_CHECK_EQUAL(scalarWritten, 5u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BitmapImageBatchMatchesSingleImages)
+{
+    SIMDQuadKernelScope scope;
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+
+    std::vector<const CEGUI::BitmapImage*> images;
+    for (const char* name : { "TaharezLook/ButtonLeftNormal", "TaharezLook/ButtonMiddleNormal",
+                              "TaharezLook/CheckboxNormal" })
+        images.push_back(static_cast<const CEGUI::BitmapImage*>(&imgr.get(name)));
+    while (images.size() < QuadCount)
+        images.push_back(images[images.size() % 3]);
+
+    const CEGUI::ImageRenderSettings settings(CEGUI::Rectf(), &ClipRect,
+        CEGUI::ColourRect(CEGUI::Colour(1.0f, 0.5f, 0.25f, 1.0f)), 0.75f);
+
+    for (bool simd : { true, false })
+    {
+        CEGUI::GeometryBuffer::setSIMDQuadKernelEnabled(simd);
+
+        std::vector<CEGUI::GeometryBuffer*> batched;
+        CEGUI::BitmapImage::createRenderGeometryBatch(batched, images.data(), DestRects,
+            QuadCount, settings, 0);
+
+        std::vector<CEGUI::GeometryBuffer*> single;
+        for (size_t i = 0; i < QuadCount; ++i)
+        {
+            CEGUI::ImageRenderSettings imageSettings(settings);
+            imageSettings.d_destArea = DestRects[i];
+            images[i]->createRenderGeometry(single, imageSettings, 0);
+        }
+
+        BOOST_REQUIRE(!batched.empty());
+        BOOST_REQUIRE_EQUAL(batched.size(), single.size());
+        for (size_t i = 0; i < batched.size(); ++i)
+            checkVerticesMatch(batched[i]->getVertexData(), single[i]->getVertexData());
+
+        renderer->destroyGeometryBuffers(batched);
+        renderer->destroyGeometryBuffers(single);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,236 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/text/GlyphAtlasManager.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+//! Records the keys of the glyphs evicted from the atlas.
+class RecordingGlyphAtlasClient : public CEGUI::GlyphAtlasClient
+{
+public:
+    void notifyGlyphEvicted(CEGUI::BitmapImage*, std::uint64_t key) override
+    {
+        d_evictedKeys.push_back(key);
+    }
+
+    std::vector<std::uint64_t> d_evictedKeys;
+};
+
+/*!
+    Starts from an empty atlas with small pages and restores the settings
+    afterwards. Glyphs added through addGlyph are released on destruction.
+*/
+struct GlyphAtlasFixture
+{
+    GlyphAtlasFixture() :
+        d_atlas(CEGUI::GlyphAtlasManager::getSingleton()),
+        d_pageSize(d_atlas.getPageSize()),
+        d_maxPageCount(d_atlas.getMaxPageCount())
+    {
+        d_atlas.evictAllGlyphs();
+        d_atlas.destroyEvictedImages();
+        d_atlas.setPageSize(64);
+        d_atlas.setMaxPageCount(2);
+        d_atlas.resetStats();
+    }
+
+    ~GlyphAtlasFixture()
+    {
+        for (CEGUI::BitmapImage* image : d_images)
+        {
+            // Evicted images are destroyed by the atlas
+            if (d_atlas.isGlyphInAtlas(image))
+            {
+                d_atlas.removeGlyph(image);
+                delete image;
+            }
+        }
+
+        d_atlas.setPageSize(d_pageSize);
+        d_atlas.setMaxPageCount(d_maxPageCount);
+        d_atlas.evictAllGlyphs();
+        d_atlas.destroyEvictedImages();
+        d_atlas.resetStats();
+    }
+
+    CEGUI::BitmapImage* addGlyph(std::uint64_t key, float width, float height)
+    {
+        const CEGUI::Sizef size(width, height);
+        const std::vector<CEGUI::argb_t> pixels(
+            static_cast<size_t>(width * height), 0xFFFFFFFF);
+
+        CEGUI::BitmapImage* image = d_atlas.addGlyph(d_client, key,
+            "GlyphAtlasTest_" + std::to_string(key), size, pixels,
+            glm::vec2(0.0f, 0.0f), CEGUI::Sizef(640.0f, 480.0f));
+        d_images.push_back(image);
+        return image;
+    }
+
+    CEGUI::GlyphAtlasManager& d_atlas;
+    std::uint32_t d_pageSize;
+    size_t d_maxPageCount;
+    RecordingGlyphAtlasClient d_client;
+    std::vector<CEGUI::BitmapImage*> d_images;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GlyphAtlasManager, GlyphAtlasFixture)
+
+BOOST_AUTO_TEST_CASE(SkylinePlacement)
+{
+    // Glyphs are padded by one pixel to the right and bottom
+    const CEGUI::Rectf a = addGlyph(1, 20.0f, 10.0f)->getImageArea();
+    const CEGUI::Rectf b = addGlyph(2, 10.0f, 20.0f)->getImageArea();
+    const CEGUI::Rectf c = addGlyph(3, 30.0f, 5.0f)->getImageArea();
+    const CEGUI::Rectf d = addGlyph(4, 20.0f, 5.0f)->getImageArea();
+
+    BOOST_CHECK(a == CEGUI::Rectf(0.0f, 0.0f, 20.0f, 10.0f));
+    // Next to the first one, where it ends lower than on top of it
+    BOOST_CHECK(b == CEGUI::Rectf(21.0f, 0.0f, 31.0f, 20.0f));
+    // The lowest spot wide enough is the free space on the right
+    BOOST_CHECK(c == CEGUI::Rectf(32.0f, 0.0f, 62.0f, 5.0f));
+    // Stacked on the third glyph, which is lower than the first one
+    BOOST_CHECK(d == CEGUI::Rectf(32.0f, 6.0f, 52.0f, 11.0f));
+
+    const CEGUI::GlyphAtlasStats stats = d_atlas.getStats();
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 1u);
+    BOOST_CHECK_EQUAL(stats.d_glyphCount, 4u);
+    BOOST_CHECK_EQUAL(stats.d_usedPixels, 21u * 11u + 11u * 21u + 31u * 6u + 21u * 6u);
+    BOOST_CHECK_EQUAL(stats.d_totalPixels, 64u * 64u);
+}
+
+BOOST_AUTO_TEST_CASE(NoOverlap)
+{
+    std::vector<CEGUI::Rectf> areas;
+    for (std::uint64_t key = 0; key < 40; ++key)
+        areas.push_back(addGlyph(key, 3.0f + key % 7, 2.0f + key % 5)->getImageArea());
+
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_evictedGlyphs, 0u);
+
+    for (size_t i = 0; i < areas.size(); ++i)
+    {
+        BOOST_CHECK(areas[i].left() >= 0.0f && areas[i].top() >= 0.0f);
+        BOOST_CHECK(areas[i].right() <= 64.0f && areas[i].bottom() <= 64.0f);
+
+        for (size_t j = i + 1; j < areas.size(); ++j)
+        {
+            if (d_images[i]->getTexture() != d_images[j]->getTexture())
+                continue;
+
+            const CEGUI::Rectf overlap = areas[i].getIntersection(areas[j]);
+            BOOST_CHECK(overlap.getWidth() <= 0.0f || overlap.getHeight() <= 0.0f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RemovedGlyphsFreeTheirSpace)
+{
+    CEGUI::BitmapImage* first = addGlyph(1, 63.0f, 63.0f);
+    const CEGUI::Texture* texture = first->getTexture();
+
+    d_atlas.removeGlyph(first);
+    BOOST_CHECK(!d_atlas.isGlyphInAtlas(first));
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_usedPixels, 0u);
+
+    // The emptied page takes the next glyph
+    CEGUI::BitmapImage* second = addGlyph(2, 63.0f, 63.0f);
+    BOOST_CHECK(second->getTexture() == texture);
+    BOOST_CHECK(second->getImageArea() == CEGUI::Rectf(0.0f, 0.0f, 63.0f, 63.0f));
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_pageCount, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsLeastRecentlyUsedPage)
+{
+    // Each glyph fills a whole page
+    CEGUI::BitmapImage* first = addGlyph(1, 63.0f, 63.0f);
+    CEGUI::BitmapImage* second = addGlyph(2, 63.0f, 63.0f);
+    BOOST_CHECK(first->getTexture() != second->getTexture());
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_pageCount, 2u);
+
+    d_atlas.touchGlyph(first);
+    const CEGUI::Texture* secondTexture = second->getTexture();
+    CEGUI::BitmapImage* third = addGlyph(3, 63.0f, 63.0f);
+
+    BOOST_REQUIRE_EQUAL(d_client.d_evictedKeys.size(), 1u);
+    BOOST_CHECK_EQUAL(d_client.d_evictedKeys.front(), 2u);
+    BOOST_CHECK(d_atlas.isGlyphInAtlas(first));
+    BOOST_CHECK(!d_atlas.isGlyphInAtlas(second));
+    BOOST_CHECK(d_atlas.isGlyphInAtlas(third));
+    BOOST_CHECK(third->getTexture() == secondTexture);
+
+    const CEGUI::GlyphAtlasStats stats = d_atlas.getStats();
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 2u);
+    BOOST_CHECK_EQUAL(stats.d_glyphCount, 2u);
+    BOOST_CHECK_EQUAL(stats.d_evictedGlyphs, 1u);
+    BOOST_CHECK_EQUAL(stats.d_evictedPages, 1u);
+
+    // Without a touch the oldest page goes first
+    addGlyph(4, 63.0f, 63.0f);
+    BOOST_REQUIRE_EQUAL(d_client.d_evictedKeys.size(), 2u);
+    BOOST_CHECK_EQUAL(d_client.d_evictedKeys.back(), 1u);
+    BOOST_CHECK(!d_atlas.isGlyphInAtlas(first));
+    BOOST_CHECK(d_atlas.isGlyphInAtlas(third));
+}
+
+BOOST_AUTO_TEST_CASE(OversizedGlyphEvictsNothing)
+{
+    CEGUI::BitmapImage* first = addGlyph(1, 63.0f, 63.0f);
+    addGlyph(2, 63.0f, 63.0f);
+
+    // With the padding this is larger than a page
+    BOOST_CHECK_THROW(addGlyph(3, 64.0f, 10.0f), CEGUI::InvalidRequestException);
+    BOOST_CHECK(d_client.d_evictedKeys.empty());
+    BOOST_CHECK(d_atlas.isGlyphInAtlas(first));
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_evictedPages, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(EvictAllGlyphsAppliesPageSize)
+{
+    CEGUI::BitmapImage* first = addGlyph(1, 10.0f, 10.0f);
+    d_atlas.setPageSize(128);
+    addGlyph(2, 10.0f, 10.0f);
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_totalPixels, 64u * 64u);
+
+    d_atlas.evictAllGlyphs();
+    BOOST_CHECK_EQUAL(d_client.d_evictedKeys.size(), 2u);
+    BOOST_CHECK(!d_atlas.isGlyphInAtlas(first));
+
+    CEGUI::GlyphAtlasStats stats = d_atlas.getStats();
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 0u);
+    BOOST_CHECK_EQUAL(stats.d_usedPixels, 0u);
+    BOOST_CHECK_EQUAL(stats.d_evictedGlyphs, 2u);
+    BOOST_CHECK_EQUAL(stats.d_evictedPages, 1u);
+
+    addGlyph(3, 100.0f, 100.0f);
+    BOOST_CHECK_EQUAL(d_atlas.getStats().d_totalPixels, 128u * 128u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
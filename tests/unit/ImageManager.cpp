@@ -0,0 +1,100 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Image.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! DriveIcons imageset with a moved, a dropped and an extra image.
+static const char* const EditedDriveIcons =
+    "<?xml version=\"1.0\"?>"
+    "<Imageset version=\"2\" name=\"DriveIcons\" imagefile=\"DriveIcons.png\">"
+    "<Image name=\"Artic\" xPos=\"10\" yPos=\"10\" width=\"20\" height=\"20\" />"
+    "<Image name=\"Obsolete\" xPos=\"0\" yPos=\"0\" width=\"1\" height=\"1\" />"
+    "</Imageset>";
+
+BOOST_AUTO_TEST_SUITE(ImageManager)
+
+BOOST_AUTO_TEST_CASE(ReloadUpdatesImagesInPlace)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    const unsigned int imageCount = imgr.getImageCount();
+
+    imgr.loadImagesetFromString(EditedDriveIcons);
+    CEGUI::Image* artic = &imgr.get("DriveIcons/Artic");
+    BOOST_CHECK(artic->getImageArea() == CEGUI::Rectf(10, 10, 30, 30));
+
+    imgr.reloadImageset("DriveIcons.imageset");
+
+    BOOST_CHECK_EQUAL(&imgr.get("DriveIcons/Artic"), artic);
+    BOOST_CHECK(artic->getImageArea() == CEGUI::Rectf(1, 1, 63, 55));
+    BOOST_CHECK(imgr.isDefined("DriveIcons/Lime"));
+    BOOST_CHECK(!imgr.isDefined("DriveIcons/Obsolete"));
+    BOOST_CHECK_EQUAL(imgr.getImageCount(), imageCount + 9);
+
+    imgr.destroyImageCollection("DriveIcons");
+    BOOST_CHECK(!imgr.isDefined("DriveIcons/Artic"));
+    BOOST_CHECK_EQUAL(imgr.getImageCount(), imageCount);
+}
+
+BOOST_AUTO_TEST_CASE(FailedReloadKeepsImages)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    imgr.loadImagesetFromString(EditedDriveIcons);
+    const unsigned int imageCount = imgr.getImageCount();
+    CEGUI::Image* artic = &imgr.get("DriveIcons/Artic");
+
+    BOOST_CHECK_THROW(imgr.reloadImageset("DoesNotExist.imageset"), CEGUI::Exception);
+
+    BOOST_CHECK_EQUAL(imgr.getImageCount(), imageCount);
+    BOOST_CHECK_EQUAL(&imgr.get("DriveIcons/Artic"), artic);
+    BOOST_CHECK(artic->getImageArea() == CEGUI::Rectf(10, 10, 30, 30));
+
+    imgr.destroyImageCollection("DriveIcons");
+}
+
+BOOST_AUTO_TEST_CASE(DestroyImageCollectionMatchesWholePrefix)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    imgr.create("BitmapImage", "Collection/A");
+    imgr.create("BitmapImage", "Collection/Nested/B");
+    imgr.create("BitmapImage", "CollectionOther/C");
+
+    imgr.destroyImageCollection("Collection/Nested", false);
+    BOOST_CHECK(imgr.isDefined("Collection/A"));
+    BOOST_CHECK(!imgr.isDefined("Collection/Nested/B"));
+
+    imgr.destroyImageCollection("Collection", false);
+    BOOST_CHECK(!imgr.isDefined("Collection/A"));
+    BOOST_CHECK(imgr.isDefined("CollectionOther/C"));
+
+    imgr.destroy("CollectionOther/C");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
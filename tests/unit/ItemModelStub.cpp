@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "ItemModelStub.h"
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 
@@ -27,6 +27,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "CEGUI/views/ListView.h"
+#include "CEGUI/widgets/Scrollbar.h"
 #include "CEGUI/WindowManager.h"
 #include "ItemModelStub.h"
 
@@ -174,6 +175,51 @@ BOOST_AUTO_TEST_CASE(SetItemSelectionState_MultiSelectToggled_ModifiesSelectionA
             view->getIndexSelectionStates().at(0).d_selectedIndex.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SelectRange_FiresSingleSelectionChangedEvent)
+{
+    for (int i = 0; i < 5; ++i)
+        model.d_items.push_back(PropertyHelper<std::int32_t>::toString(i));
+    view->setMultiSelectEnabled(true);
+    int events = 0;
+    view->subscribeEvent(ItemView::EventSelectionChanged, [&events]() { ++events; });
+
+    BOOST_REQUIRE(view->selectRange(model.getRootIndex(), 1, 3));
+    BOOST_CHECK_EQUAL(1, events);
+    BOOST_REQUIRE_EQUAL(3, view->getIndexSelectionStates().size());
+    BOOST_CHECK(!view->isIndexSelected(model.makeIndex(0, model.getRootIndex())));
+    BOOST_CHECK(view->isIndexSelected(model.makeIndex(1, model.getRootIndex())));
+    BOOST_CHECK(view->isIndexSelected(model.makeIndex(3, model.getRootIndex())));
+    BOOST_CHECK(!view->isIndexSelected(model.makeIndex(4, model.getRootIndex())));
+
+    // selecting the same range again changes nothing
+    BOOST_CHECK(!view->selectRange(model.getRootIndex(), 1, 3));
+    BOOST_CHECK_EQUAL(1, events);
+
+    view->setIndexSelectionState(model.makeIndex(2, model.getRootIndex()), false);
+    BOOST_CHECK(!view->isIndexSelected(model.makeIndex(2, model.getRootIndex())));
+    BOOST_CHECK_EQUAL(2, view->getIndexSelectionStates().size());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SelectAll_MultiSelectToggled_SelectsAccordingly)
+{
+    for (int i = 0; i < 5; ++i)
+        model.d_items.push_back(PropertyHelper<std::int32_t>::toString(i));
+
+    BOOST_CHECK(!view->selectAll());
+    BOOST_CHECK_EQUAL(0, view->getIndexSelectionStates().size());
+
+    view->setMultiSelectEnabled(true);
+    BOOST_REQUIRE(view->selectAll());
+    BOOST_REQUIRE_EQUAL(5, view->getIndexSelectionStates().size());
+    for (size_t i = 0; i < 5; ++i)
+        BOOST_CHECK(view->isIndexSelected(model.makeIndex(i, model.getRootIndex())));
+
+    view->clearSelections();
+    BOOST_CHECK(!view->isIndexSelected(model.makeIndex(0, model.getRootIndex())));
+}
+
 //----------------------------------------------------------------------------//
 BOOST_AUTO_TEST_CASE(EnsureItemIsVisible_ScrollsHorizontallyAndVertically)
 {
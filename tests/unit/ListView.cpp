@@ -27,9 +27,11 @@
 #include <boost/test/unit_test.hpp>
 
 #include "ItemModelStub.h"
-#include "CEGUI/Font.h"
+#include "CEGUI/text/Font.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/widgets/Scrollbar.h"
+#include <cmath>
 
 // Yup. We need this in order to easily inject/call event handlers without having
 // to go through GUIContext, or inherit from widgets in order to test them.
@@ -49,14 +51,27 @@ struct ListViewFixture
 {
     ListViewFixture()
     {
-        System::getSingleton().notifyDisplaySizeChanged(Sizef(100, 100));
+        System::getSingleton().notifyDisplaySizeChanged(Sizef(800, 600));
 
         view = static_cast<ListView*>(WindowManager::getSingleton().createWindow("TaharezLook/ListView", "lv"));
         view->setWindowRenderer("Core/ListView");
         view->setModel(&model);
+        view->setFont("DejaVuSans-12");
+        view->setSize(USize(cegui_absdim(200), cegui_absdim(200)));
         font_height = view->getFont()->getFontHeight();
     }
 
+    ~ListViewFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(view);
+    }
+
+    //! Returns the view position of the point \a y pixels below the top of the items.
+    glm::vec2 rowPosition(float y) const
+    {
+        return view->getViewRenderer()->getViewRenderArea().d_min + glm::vec2(1, y);
+    }
+
     ListView* view;
     ItemModelStub model;
     float font_height;
@@ -67,7 +82,7 @@ BOOST_FIXTURE_TEST_SUITE(ListViewTestSuite, ListViewFixture)
 //----------------------------------------------------------------------------//
 BOOST_AUTO_TEST_CASE(IndexAt_NoItems_ReturnsInvalidIndex)
 {
-    ModelIndex index = view->indexAt(glm::vec2(1, 0));
+    ModelIndex index = view->indexAt(rowPosition(0));
 
     BOOST_REQUIRE(index.d_modelData == nullptr);
 }
@@ -77,7 +92,7 @@ BOOST_AUTO_TEST_CASE(IndexAt_PositionInsideSingleObject_ReturnsCorrectIndex)
 {
     model.d_items.push_back(ITEM1);
 
-    ModelIndex index = view->indexAt(glm::vec2(1, font_height / 2.0f));
+    ModelIndex index = view->indexAt(rowPosition(font_height / 2.0f));
 
     BOOST_REQUIRE(index.d_modelData != nullptr);
     BOOST_REQUIRE_EQUAL(ITEM1, *(static_cast<String*>(index.d_modelData)));
@@ -91,9 +106,8 @@ BOOST_AUTO_TEST_CASE(IndexAt_PositionInsideSingleObjectListWithOffset_ReturnsCor
     view->setPosition(UVector2(cegui_absdim(x_offset), cegui_absdim(y_offset)));
     model.d_items.push_back(ITEM1);
 
-    ModelIndex index = view->indexAt(glm::vec2(
-        x_offset + 1,
-        y_offset + font_height / 2.0f));
+    ModelIndex index = view->indexAt(
+        rowPosition(font_height / 2.0f) + glm::vec2(x_offset, y_offset));
 
     BOOST_REQUIRE(index.d_modelData != nullptr);
     BOOST_REQUIRE_EQUAL(ITEM1, *(static_cast<String*>(index.d_modelData)));
@@ -112,7 +126,7 @@ BOOST_AUTO_TEST_CASE(IndexAt_PositionInsideSingleObjectListWithScrollbar_Returns
     view->prepareForRender();
     view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
 
-    ModelIndex index = view->indexAt(glm::vec2(1, 9 * font_height + font_height / 2.0f));
+    ModelIndex index = view->indexAt(rowPosition(9 * font_height + font_height / 2.0f));
 
     BOOST_REQUIRE(index.d_modelData != nullptr);
     BOOST_REQUIRE_EQUAL(ITEM1, *(static_cast<String*>(index.d_modelData)));
@@ -125,7 +139,7 @@ BOOST_AUTO_TEST_CASE(IndexAt_PositionOutsideSingleObject_ReturnsInvalidIndex)
 {
     model.d_items.push_back(ITEM1);
 
-    ModelIndex index = view->indexAt(glm::vec2(1, font_height * 2));
+    ModelIndex index = view->indexAt(rowPosition(font_height * 2));
 
     BOOST_REQUIRE(index.d_modelData == nullptr);
 }
@@ -136,7 +150,7 @@ BOOST_AUTO_TEST_CASE(IndexAt_PositionInsideSecondObject_ReturnsCorrectIndex)
     model.d_items.push_back(ITEM1);
     model.d_items.push_back(ITEM2);
 
-    ModelIndex index = view->indexAt(glm::vec2(1, font_height * 2));
+    ModelIndex index = view->indexAt(rowPosition(font_height * 2));
 
     BOOST_REQUIRE(index.d_modelData != nullptr);
     BOOST_REQUIRE_EQUAL(ITEM2, *(static_cast<String*>(index.d_modelData)));
@@ -234,25 +248,17 @@ BOOST_AUTO_TEST_CASE(ItemNameChanged_UpdatesRenderedString)
 {
     model.d_items.push_back(ITEM1);
     view->prepareForRender();
-    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_string.getLineCount());
+    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_renderedText.getLineCount());
 
     model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
     model.d_items.at(0) = ITEM_WITH_6LINES;
     model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
 
     view->prepareForRender();
-    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string.getLineCount());
+    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_renderedText.getLineCount());
 }
 
 //----------------------------------------------------------------------------//
-void triggerSelectRangeEvent(glm::vec2 position, ItemView* view)
-{
-    SemanticEventArgs args(view);
-    args.d_semanticValue = SemanticValue::SelectRange;
-    view->getGUIContext().getCursor().setPosition(position);
-    view->onSemanticInputEvent(args);
-}
-
 BOOST_AUTO_TEST_CASE(SelectRange)
 {
     model.d_items.push_back(ITEM1);
@@ -263,7 +269,8 @@ BOOST_AUTO_TEST_CASE(SelectRange)
 
     view->setSelectedIndex(ModelIndex(&model.d_items.at(0)));
 
-    triggerSelectRangeEvent(glm::vec2(1, font_height * 2.0f + font_height / 2.0f), view);
+    view->handleSelection(view->indexAt(rowPosition(font_height * 2.0f + font_height / 2.0f)),
+        true, true, true);
 
     BOOST_REQUIRE_EQUAL(3, view->getIndexSelectionStates().size());
 }
@@ -279,8 +286,123 @@ BOOST_AUTO_TEST_CASE(SortEnabled_IsEnabled_ListIsSorted)
     view->setSortMode(ViewSortMode::Ascending);
     view->prepareForRender();
 
-    ModelIndex index = view->indexAt(glm::vec2(1, font_height * 2.0f + font_height / 2.0f));
+    ModelIndex index = view->indexAt(rowPosition(font_height * 2.0f + font_height / 2.0f));
     BOOST_REQUIRE_EQUAL(ITEM3, *(static_cast<String*>(index.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IndexAt_MixedRowHeights_FindsEveryRow)
+{
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM_WITH_6LINES);
+    model.d_items.push_back(ITEM2);
+    model.d_items.push_back("TWO\nLINES");
+    model.d_items.push_back(ITEM3);
+    view->setSize(USize(cegui_absdim(200), cegui_absdim(1000)));
+
+    for (bool virtualized : { false, true })
+    {
+        view->setVirtualizationEnabled(virtualized);
+        view->prepareForRender();
+
+        float top = 0.0f;
+        for (size_t i = 0; i < model.d_items.size(); ++i)
+        {
+            const Rectf rect = view->getIndexRect(model.makeIndex(i, model.getRootIndex()));
+            BOOST_CHECK_CLOSE(rect.top(), top, 0.01f);
+            top = rect.bottom();
+
+            // first and last pixel of the row
+            BOOST_CHECK_EQUAL(static_cast<String*>(view->indexAt(rowPosition(rect.top() + 0.5f)).d_modelData),
+                &model.d_items.at(i));
+            BOOST_CHECK_EQUAL(static_cast<String*>(view->indexAt(rowPosition(rect.bottom() - 0.5f)).d_modelData),
+                &model.d_items.at(i));
+        }
+
+        BOOST_CHECK_GT(view->getIndexRect(model.makeIndex(1, model.getRootIndex())).getHeight(),
+            view->getIndexRect(model.makeIndex(0, model.getRootIndex())).getHeight() * 4);
+        BOOST_CHECK(view->indexAt(rowPosition(top + 1.0f)).d_modelData == nullptr);
+    }
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_OnlyVisibleRowsAndMarginAreMaterialized)
+{
+    for (std::int32_t i = 0; i < 100; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(200), cegui_absdim(font_height * 10)));
+    view->setVirtualizationMargin(2);
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    const float row_height = view->getIndexRect(model.makeIndex(0, model.getRootIndex())).getHeight();
+    const float area_height = view->getViewRenderer()->getViewRenderArea().getHeight();
+    const size_t visible_rows = static_cast<size_t>(std::ceil(area_height / row_height));
+
+    // at the top there are no rows above the view to keep
+    BOOST_CHECK_EQUAL(view->getItems().front()->d_text, "item 0");
+    BOOST_CHECK_GE(view->getItems().size(), visible_rows + 2);
+    BOOST_CHECK_LE(view->getItems().size(), visible_rows + 3);
+
+    view->getVertScrollbar()->setScrollPosition(50 * row_height);
+    view->prepareForRender();
+
+    BOOST_CHECK_EQUAL(view->getItems().front()->d_text, "item 48");
+    BOOST_CHECK_CLOSE(view->getItemsOffset(), 48 * row_height, 0.01f);
+    BOOST_CHECK_GE(view->getItems().size(), visible_rows + 4);
+    BOOST_CHECK_LE(view->getItems().size(), visible_rows + 5);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_ToggleBeforeRender_KeepsViewConsistent)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM1);
+    view->prepareForRender();
+
+    view->setVirtualizationEnabled(true);
+    view->setVirtualizationEnabled(false);
+
+    // nothing is laid out until the next render, which must not be needed here
+    BOOST_CHECK_NO_THROW(view->setSortMode(ViewSortMode::Ascending));
+    model.d_items.push_back(ITEM2);
+    BOOST_CHECK_NO_THROW(model.notifyChildrenAdded(model.getRootIndex(), 2, 1));
+    BOOST_CHECK_NO_THROW(view->getIndexRect(model.makeIndex(0, model.getRootIndex())));
+
+    view->prepareForRender();
+    BOOST_REQUIRE_EQUAL(view->getItems().size(), 3u);
+    BOOST_CHECK_EQUAL(view->getItems().at(0)->d_text, ITEM1);
+    BOOST_CHECK_EQUAL(view->getItems().at(1)->d_text, ITEM2);
+    BOOST_CHECK_EQUAL(view->getItems().at(2)->d_text, ITEM3);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_SortedRowsAreLaidOutInDisplayOrder)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM_WITH_6LINES);
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM2);
+    view->setSize(USize(cegui_absdim(200), cegui_absdim(1000)));
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(view->getItems().size(), 4u);
+    BOOST_CHECK_EQUAL(view->getItems().at(0)->d_text, ITEM1);
+    BOOST_CHECK_EQUAL(view->getItems().at(1)->d_text, ITEM2);
+    BOOST_CHECK_EQUAL(view->getItems().at(2)->d_text, ITEM3);
+    BOOST_CHECK_EQUAL(view->getItems().at(3)->d_text, ITEM_WITH_6LINES);
+
+    // the tall row is last, so its measured height ends the list
+    const Rectf tall = view->getIndexRect(model.makeIndex(1, model.getRootIndex()));
+    BOOST_CHECK_CLOSE(tall.bottom(), view->getRenderedTotalHeight(), 0.01f);
+    BOOST_CHECK_EQUAL(static_cast<String*>(view->indexAt(rowPosition(tall.top() + 1.0f)).d_modelData),
+        &model.d_items.at(1));
+    BOOST_CHECK_EQUAL(static_cast<String*>(view->indexAt(rowPosition(font_height / 2.0f)).d_modelData),
+        &model.d_items.at(2));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
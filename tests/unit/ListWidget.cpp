@@ -104,6 +104,19 @@ BOOST_AUTO_TEST_CASE(GetNextSelectedItem_HappyFlow_ReturnsExpectedItem)
         view->getNextSelectedItem(view->getItemAtIndex(1)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IsItemSelected_EqualItems_OnlySelectedOneMatches)
+{
+    view->addItem("item");
+    view->addItem("item");
+
+    view->setIndexSelectionState(1, true);
+
+    BOOST_REQUIRE(!view->isItemSelected(view->getItemAtIndex(0)));
+    BOOST_REQUIRE(view->isItemSelected(view->getItemAtIndex(1)));
+    BOOST_REQUIRE(!view->isItemSelected(nullptr));
+}
+
 //----------------------------------------------------------------------------//
 BOOST_AUTO_TEST_CASE(RemoveItem_IsRemoved)
 {
@@ -0,0 +1,139 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! Creates a two column list and counts its content change notifications.
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture()
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_list = static_cast<CEGUI::MultiColumnList*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiColumnList"));
+        d_list->setFont("DejaVuSans-12");
+        d_list->setSize(CEGUI::USize(cegui_absdim(300), cegui_absdim(200)));
+        d_list->addColumn("Name", 0, cegui_reldim(0.5f));
+        d_list->addColumn("Value", 1, cegui_reldim(0.5f));
+        d_list->subscribeEvent(CEGUI::MultiColumnList::EventListContentsChanged,
+            [this]() { ++d_contentsChangedCount; });
+    }
+
+    ~MultiColumnListFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_list);
+    }
+
+    CEGUI::MultiColumnList* d_list;
+    int d_contentsChangedCount = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnList, MultiColumnListFixture)
+
+BOOST_AUTO_TEST_CASE(BatchedRowsAreSortedOnce)
+{
+    d_list->setSortColumn(0);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::SortDirection::Ascending);
+    d_contentsChangedCount = 0;
+
+    d_list->beginUpdate();
+    d_list->beginUpdate();
+    for (const char* name : { "c", "a", "d", "b" })
+    {
+        const unsigned int row = d_list->addRow(new CEGUI::ListboxTextItem(name), 0);
+        d_list->setItem(new CEGUI::ListboxTextItem("value"), 1, row);
+    }
+    d_list->endUpdate();
+    BOOST_CHECK(d_list->isUpdating());
+    BOOST_CHECK_EQUAL(d_contentsChangedCount, 0);
+    d_list->endUpdate();
+    BOOST_CHECK(!d_list->isUpdating());
+    BOOST_CHECK_EQUAL(d_contentsChangedCount, 1);
+
+    BOOST_REQUIRE_EQUAL(d_list->getRowCount(), 4u);
+    const char* const expected[] = { "a", "b", "c", "d" };
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        CEGUI::ListboxItem* item = d_list->getItemAtGridReference(CEGUI::MCLGridRef(i, 0));
+        BOOST_CHECK_EQUAL(item->getText(), expected[i]);
+        BOOST_CHECK_EQUAL(d_list->getItemRowIndex(item), i);
+        BOOST_CHECK_EQUAL(d_list->getItemColumnIndex(item), 0u);
+    }
+
+    // rows added outside of a batch are still inserted in order
+    d_list->addRow(new CEGUI::ListboxTextItem("bb"), 0);
+    BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(2, 0))->getText(), "bb");
+    BOOST_CHECK_EQUAL(d_contentsChangedCount, 2);
+
+    BOOST_CHECK_THROW(d_list->endUpdate(), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(RowOffsets)
+{
+    CEGUI::ListboxTextItem* first = new CEGUI::ListboxTextItem("first");
+    first->setAutoDeleted(false);
+    d_list->addRow(first, 0);
+    d_list->addRow();
+    d_list->addRow(new CEGUI::ListboxTextItem("two\nlines"), 1);
+
+    const float lineHeight = d_list->getHighestRowItemHeight(0);
+    BOOST_REQUIRE_GT(lineHeight, 0.f);
+    BOOST_CHECK_EQUAL(d_list->getHighestRowItemHeight(1), 0.f);
+    BOOST_CHECK_GT(d_list->getHighestRowItemHeight(2), lineHeight);
+
+    const float total = lineHeight + d_list->getHighestRowItemHeight(2);
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), total, 0.001f);
+    BOOST_CHECK_EQUAL(d_list->getRowOffset(1), lineHeight);
+    BOOST_CHECK_EQUAL(d_list->getRowOffset(2), lineHeight);
+    BOOST_CHECK_CLOSE(d_list->getRowOffset(3), total, 0.001f);
+
+    // the empty row is skipped
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(0.f), 0u);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(lineHeight), 2u);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(total), 3u);
+
+    // setting an item in the empty row changes its height
+    d_list->setItem(new CEGUI::ListboxTextItem("second"), 0, 1);
+    BOOST_CHECK_EQUAL(d_list->getRowOffset(2), 2.f * lineHeight);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(lineHeight), 1u);
+
+    d_list->removeRow(0);
+    BOOST_CHECK_EQUAL(d_list->getRowOffset(1), lineHeight);
+    BOOST_CHECK(!d_list->isListboxItemInList(first));
+    BOOST_CHECK_THROW(d_list->getItemRowIndex(first), CEGUI::InvalidRequestException);
+    delete first;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 BOOST_AUTO_TEST_SUITE(PropertySet)
 
 class TestPropertySet : public CEGUI::PropertySet
@@ -57,6 +61,13 @@ public:
         CEGUI_DEFINE_PROPERTY(TestPropertySet, int, "MemberValue", "", &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0);
     }
 
+    void defineOtherProperty()
+    {
+        const CEGUI::String propertyOrigin = "TestPropertySet";
+
+        CEGUI_DEFINE_PROPERTY(TestPropertySet, int, "OtherValue", "", &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0);
+    }
+
 private:
     int d_memberValue;
 };
@@ -93,4 +104,76 @@ BOOST_AUTO_TEST_CASE(SettingGetting)
     BOOST_CHECK_EQUAL(set.getProperty<int>("MemberValue"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(SharedClassProperties)
+{
+    CEGUI::TplWindowProperty<TestPropertySet, int> instanceProperty("InstanceValue", "", "TestPropertySet",
+        &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0);
+
+    TestPropertySet set;
+    TestPropertySet other;
+
+    // Properties added to one set must not show up in the other
+    other.defineOtherProperty();
+    set.addProperty(&instanceProperty);
+    BOOST_CHECK(other.isPropertyPresent("OtherValue"));
+    BOOST_CHECK(!set.isPropertyPresent("OtherValue"));
+    BOOST_CHECK(set.isPropertyPresent("InstanceValue"));
+    BOOST_CHECK(!other.isPropertyPresent("InstanceValue"));
+    BOOST_CHECK_THROW(set.addProperty(&instanceProperty), CEGUI::AlreadyExistsException);
+    BOOST_CHECK_THROW(other.defineOtherProperty(), CEGUI::AlreadyExistsException);
+
+    std::vector<CEGUI::String> names;
+    for (CEGUI::PropertySet::PropertyIterator it = set.getPropertyIterator(); !it.isAtEnd(); ++it)
+        names.push_back(it.getCurrentKey());
+    BOOST_REQUIRE_EQUAL(names.size(), 2u);
+    BOOST_CHECK_EQUAL(names[0], "MemberValue");
+    BOOST_CHECK_EQUAL(names[1], "InstanceValue");
+
+    // Removing a class property only affects the set it is removed from
+    set.removeProperty("MemberValue");
+    BOOST_CHECK(!set.isPropertyPresent("MemberValue"));
+    BOOST_CHECK(set.isPropertyPresent("InstanceValue"));
+    BOOST_CHECK(other.isPropertyPresent("MemberValue"));
+    BOOST_CHECK(TestPropertySet().isPropertyPresent("MemberValue"));
+
+    set.defineOtherProperty();
+    BOOST_CHECK_NO_THROW(set.setProperty<int>("OtherValue", 5));
+    BOOST_CHECK_EQUAL(set.getProperty<int>("InstanceValue"), 5);
+    BOOST_CHECK_EQUAL(other.getProperty<int>("OtherValue"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SharedClassPropertiesFromThreads)
+{
+    typedef CEGUI::TplWindowProperty<TestPropertySet, int> TestProperty;
+    const int threadCount = 4;
+    const int propertyCount = 64;
+
+    // All threads extend the table of "MemberValue" at once
+    std::vector<std::unique_ptr<TestProperty>> properties;
+    for (int i = 0; i < threadCount * propertyCount; ++i)
+        properties.emplace_back(new TestProperty("Value" + CEGUI::PropertyHelper<int>::toString(i),
+            "", "TestPropertySet", &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0));
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&properties, &failures, t]()
+        {
+            for (int i = 0; i < propertyCount; ++i)
+            {
+                TestPropertySet set;
+                TestProperty* property = properties[i * threadCount + t].get();
+                set.addProperty(property);
+                if (!set.isPropertyPresent(property->getName()) || !set.isPropertyPresent("MemberValue"))
+                    ++failures;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    BOOST_CHECK_EQUAL(failures, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
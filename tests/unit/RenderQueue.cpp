@@ -0,0 +1,152 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/RenderQueue.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/ColourRect.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct RenderQueueFixture
+{
+    RenderQueueFixture() :
+        d_renderer(CEGUI::System::getSingleton().getRenderer())
+    {
+        d_texture1 = &d_renderer->createTexture("RenderQueueTest1", CEGUI::Sizef(64, 64));
+        d_texture2 = &d_renderer->createTexture("RenderQueueTest2", CEGUI::Sizef(64, 64));
+        d_queue.setBatchingEnabled(true);
+    }
+
+    ~RenderQueueFixture()
+    {
+        d_queue.reset();
+        d_queue.setBatchingEnabled(false);
+        d_renderer->destroyGeometryBuffers(d_buffers);
+        d_renderer->destroyTexture(*d_texture1);
+        d_renderer->destroyTexture(*d_texture2);
+    }
+
+    //! Queues a textured quad at \a area, given in window coordinates and moved by \a offset.
+    CEGUI::GeometryBuffer& addQuad(const CEGUI::Texture* texture, const CEGUI::Rectf& area,
+        const glm::vec2& offset = glm::vec2(0.f, 0.f))
+    {
+        CEGUI::GeometryBuffer& buffer = d_renderer->createGeometryBufferTextured();
+        buffer.setMainTexture(texture);
+        buffer.setTranslation(glm::vec3(offset, 0.f));
+        buffer.setClippingActive(true);
+        buffer.setClippingRegion(CEGUI::Rectf(0.f, 0.f, 800.f, 600.f));
+        const CEGUI::Rectf texArea(0.f, 0.f, 1.f, 1.f);
+        const CEGUI::ColourRect colours(CEGUI::Colour(1.f, 1.f, 1.f, 1.f));
+        buffer.appendTexturedQuads(&area, &texArea, 1, &colours, 1);
+        d_buffers.push_back(&buffer);
+        d_queue.addGeometryBuffer(buffer);
+        return buffer;
+    }
+
+    CEGUI::Renderer* d_renderer;
+    CEGUI::Texture* d_texture1;
+    CEGUI::Texture* d_texture2;
+    CEGUI::RenderQueue d_queue;
+    std::vector<CEGUI::GeometryBuffer*> d_buffers;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderQueue, RenderQueueFixture)
+
+BOOST_AUTO_TEST_CASE(MergesBuffersWithSameState)
+{
+    for (int i = 0; i < 300; ++i)
+        addQuad(d_texture1, CEGUI::Rectf(0.f, 0.f, 10.f, 10.f), glm::vec2(i % 30 * 20.f, i / 30 * 20.f));
+
+    d_queue.updateBatches();
+
+    BOOST_CHECK_EQUAL(d_queue.getBatchStats().d_bufferCount, 300u);
+    BOOST_CHECK_EQUAL(d_queue.getBatchStats().d_drawCallCount, 1u);
+    BOOST_REQUIRE_EQUAL(d_queue.getDrawBuffers().size(), 1u);
+
+    // Translations are applied to the merged vertices
+    const CEGUI::GeometryBuffer* merged = d_queue.getDrawBuffers()[0];
+    BOOST_CHECK_EQUAL(merged->getVertexCount(), 300u * 6u);
+    BOOST_CHECK(merged->getTranslation() == glm::vec3(0.f, 0.f, 0.f));
+    BOOST_CHECK(merged->getTranslatedBounds() == CEGUI::Rectf(0.f, 0.f, 590.f, 190.f));
+    BOOST_CHECK(merged->getMainTexture() == d_texture1);
+}
+
+BOOST_AUTO_TEST_CASE(RespectsOverlappingGeometry)
+{
+    // The second quad of texture 1 overlaps the quad of texture 2, so it must be drawn after it
+    addQuad(d_texture1, CEGUI::Rectf(0.f, 0.f, 10.f, 10.f));
+    addQuad(d_texture2, CEGUI::Rectf(5.f, 5.f, 15.f, 15.f));
+    addQuad(d_texture1, CEGUI::Rectf(10.f, 10.f, 20.f, 20.f));
+    d_queue.updateBatches();
+    BOOST_CHECK_EQUAL(d_queue.getBatchStats().d_drawCallCount, 3u);
+
+    // Without overlap it can join the first one
+    d_buffers.back()->setTranslation(glm::vec3(100.f, 0.f, 0.f));
+    d_queue.updateBatches();
+    BOOST_CHECK_EQUAL(d_queue.getBatchStats().d_drawCallCount, 2u);
+    BOOST_CHECK(d_queue.getDrawBuffers()[1] == d_buffers[1]);
+}
+
+BOOST_AUTO_TEST_CASE(DoesNotMergeDifferentState)
+{
+    addQuad(d_texture1, CEGUI::Rectf(0.f, 0.f, 10.f, 10.f));
+    addQuad(d_texture1, CEGUI::Rectf(20.f, 0.f, 30.f, 10.f)).setAlpha(0.5f);
+    addQuad(d_texture1, CEGUI::Rectf(40.f, 0.f, 50.f, 10.f)).setBlendMode(CEGUI::BlendMode::RttPremultiplied);
+    addQuad(d_texture1, CEGUI::Rectf(60.f, 0.f, 70.f, 10.f)).setRotation(glm::quat(glm::vec3(0.f, 0.f, 1.f)));
+    d_queue.updateBatches();
+    BOOST_CHECK_EQUAL(d_queue.getBatchStats().d_drawCallCount, 4u);
+}
+
+BOOST_AUTO_TEST_CASE(MergesByEffectiveClipping)
+{
+    // Clipping that cuts geometry only merges with the same clipping region
+    addQuad(d_texture1, CEGUI::Rectf(0.f, 0.f, 10.f, 10.f)).setClippingRegion(CEGUI::Rectf(0.f, 0.f, 5.f, 5.f));
+    addQuad(d_texture1, CEGUI::Rectf(20.f, 0.f, 30.f, 10.f));
+    addQuad(d_texture1, CEGUI::Rectf(40.f, 0.f, 50.f, 10.f)).setClippingRegion(CEGUI::Rectf(0.f, 0.f, 45.f, 5.f));
+    addQuad(d_texture1, CEGUI::Rectf(60.f, 0.f, 70.f, 10.f)).setClippingRegion(CEGUI::Rectf(60.f, 0.f, 70.f, 10.f));
+    d_queue.updateBatches();
+    BOOST_CHECK_EQUAL(d_queue.getBatchStats().d_drawCallCount, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(QueueChangesDropBatches)
+{
+    addQuad(d_texture1, CEGUI::Rectf(0.f, 0.f, 10.f, 10.f));
+    addQuad(d_texture1, CEGUI::Rectf(20.f, 0.f, 30.f, 10.f));
+    d_queue.updateBatches();
+    BOOST_CHECK_EQUAL(d_queue.getDrawBuffers().size(), 1u);
+
+    addQuad(d_texture1, CEGUI::Rectf(40.f, 0.f, 50.f, 10.f));
+    BOOST_CHECK_EQUAL(d_queue.getDrawBuffers().size(), 3u);
+
+    d_queue.setBatchingEnabled(false);
+    d_queue.updateBatches();
+    BOOST_CHECK_EQUAL(d_queue.getDrawBuffers().size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
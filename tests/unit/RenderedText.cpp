@@ -0,0 +1,143 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/text/RenderedText.h"
+#include "CEGUI/text/Font.h"
+#include "CEGUI/FontManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct RenderedTextFixture
+{
+    RenderedTextFixture() :
+        d_font(&CEGUI::FontManager::getSingleton().get("DejaVuSans-12"))
+    {
+    }
+
+    //! Replaces a part of d_text in both the edited and a freshly rendered text and compares them.
+    void edit(size_t start, size_t length, const CEGUI::String& replacement)
+    {
+        d_text = d_text.substr(0, start) + replacement + d_text.substr(start + length);
+        d_edited.replaceText(d_text, start, length, replacement.size(), nullptr, d_font);
+        d_edited.updateFormatting(AreaWidth);
+
+        CEGUI::RenderedText expected;
+        expected.setWordWrapEnabled(true);
+        expected.renderText(d_text, nullptr, d_font);
+        expected.updateFormatting(AreaWidth);
+
+        BOOST_REQUIRE_EQUAL(d_edited.getParagraphCount(), expected.getParagraphCount());
+        BOOST_REQUIRE_EQUAL(d_edited.getLineCount(), expected.getLineCount());
+        BOOST_CHECK_CLOSE(d_edited.getExtents().d_width, expected.getExtents().d_width, 0.01f);
+        BOOST_CHECK_CLOSE(d_edited.getExtents().d_height, expected.getExtents().d_height, 0.01f);
+        BOOST_CHECK_EQUAL(d_edited.endTextIndex(), expected.endTextIndex());
+
+        for (size_t i = 0; i <= d_text.size(); ++i)
+        {
+            CEGUI::Rectf editedBounds;
+            CEGUI::Rectf expectedBounds;
+            BOOST_CHECK_EQUAL(d_edited.getTextIndexBounds(i, editedBounds),
+                expected.getTextIndexBounds(i, expectedBounds));
+            BOOST_CHECK(editedBounds == expectedBounds);
+            BOOST_CHECK_EQUAL(d_edited.nextTextIndex(i), expected.nextTextIndex(i));
+            BOOST_CHECK_EQUAL(d_edited.lineUpTextIndex(i, 10.f), expected.lineUpTextIndex(i, 10.f));
+            BOOST_CHECK_EQUAL(d_edited.lineDownTextIndex(i, 10.f), expected.lineDownTextIndex(i, 10.f));
+        }
+
+        for (float y = 0.f; y < expected.getExtents().d_height; y += 7.f)
+        {
+            BOOST_CHECK_EQUAL(d_edited.getTextIndexAtPoint(glm::vec2(30.f, y)),
+                expected.getTextIndexAtPoint(glm::vec2(30.f, y)));
+        }
+    }
+
+    void render(const CEGUI::String& text)
+    {
+        d_text = text;
+        d_edited.setWordWrapEnabled(true);
+        d_edited.renderText(d_text, nullptr, d_font);
+        d_edited.updateFormatting(AreaWidth);
+    }
+
+    static constexpr float AreaWidth = 150.f;
+
+    CEGUI::Font* d_font;
+    CEGUI::String d_text;
+    CEGUI::RenderedText d_edited;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderedText, RenderedTextFixture)
+
+BOOST_AUTO_TEST_CASE(ReplaceTextWithinParagraph)
+{
+    render("First line\nThe second line is long enough to be wrapped twice or even more\nThird");
+
+    edit(13, 0, "x");
+    edit(11, 4, "");
+    edit(0, 0, "Start ");
+    edit(d_text.size(), 0, " end");
+    edit(20, 30, "short");
+}
+
+BOOST_AUTO_TEST_CASE(ReplaceTextChangingParagraphs)
+{
+    render("one\ntwo\nthree\nfour\n\nsix");
+
+    // Split, join and remove paragraphs
+    edit(1, 0, "\n");
+    edit(4, 1, "");
+    edit(3, 6, "");
+    edit(0, 0, "a\nb\nc\n");
+    edit(d_text.size(), 0, "\n");
+    edit(d_text.size() - 1, 1, "");
+    edit(0, d_text.size() - 2, "");
+}
+
+BOOST_AUTO_TEST_CASE(ReplaceTextWithCarriageReturns)
+{
+    render("alpha\r\nbeta\rgamma\r\ndelta");
+
+    // Inserting between CR and LF splits the pair, removing the text between them joins it
+    edit(6, 0, "x");
+    edit(6, 1, "");
+    edit(12, 0, "\n");
+    edit(11, 1, "");
+    edit(5, 1, "");
+}
+
+BOOST_AUTO_TEST_CASE(ReplaceTextInLargeText)
+{
+    CEGUI::String text;
+    for (int i = 0; i < 300; ++i)
+        text += "Line number " + CEGUI::String(std::to_string(i)) + "\n";
+    render(text);
+
+    edit(1500, 0, "inserted words that wrap the paragraph to another line");
+    edit(3000, 20, "");
+    edit(2000, 0, "\n\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,201 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/text/RenderedTextCache.h"
+#include "CEGUI/text/RenderedText.h"
+#include "CEGUI/text/LegacyTextParser.h"
+#include "CEGUI/text/FreeTypeFont.h"
+#include "CEGUI/FontManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+/*!
+    Starts from an empty cache and restores its settings afterwards. Uses a
+    font of its own, so that resizing or destroying it doesn't affect other
+    tests.
+*/
+struct RenderedTextCacheFixture
+{
+    RenderedTextCacheFixture() :
+        d_cache(CEGUI::RenderedTextCache::getSingleton()),
+        d_enabled(d_cache.isEnabled()),
+        d_memoryBudget(d_cache.getMemoryBudget()),
+        d_font(&CEGUI::FontManager::getSingleton().createFreeTypeFont(
+            "RenderedTextCacheTest", 12.0f, CEGUI::FontSizeUnit::Pixels,
+            true, "DejaVuSans.ttf", "fonts"))
+    {
+        d_cache.setEnabled(true);
+        d_cache.clear();
+        d_cache.resetStats();
+    }
+
+    ~RenderedTextCacheFixture()
+    {
+        if (d_font)
+            CEGUI::FontManager::getSingleton().destroy(*d_font);
+
+        d_cache.setEnabled(d_enabled);
+        d_cache.setMemoryBudget(d_memoryBudget);
+        d_cache.clear();
+        d_cache.resetStats();
+    }
+
+    //! Renders \a text the way widgets do and returns its extents.
+    CEGUI::Sizef render(const CEGUI::String& text, CEGUI::TextParser* parser = nullptr,
+        CEGUI::DefaultParagraphDirection dir = CEGUI::DefaultParagraphDirection::LeftToRight)
+    {
+        CEGUI::RenderedText rendered;
+        rendered.renderText(text, parser, d_font, dir);
+        rendered.updateFormatting(1000.0f);
+        return rendered.getExtents();
+    }
+
+    CEGUI::RenderedTextCache& d_cache;
+    bool d_enabled;
+    size_t d_memoryBudget;
+    CEGUI::Font* d_font;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderedTextCache, RenderedTextCacheFixture)
+
+BOOST_AUTO_TEST_CASE(SameTextIsCopied)
+{
+    const CEGUI::Sizef first = render("Cached text");
+    const CEGUI::Sizef second = render("Cached text");
+
+    const CEGUI::RenderedTextCacheStats stats = d_cache.getStats();
+    BOOST_CHECK_EQUAL(stats.d_misses, 1u);
+    BOOST_CHECK_EQUAL(stats.d_hits, 1u);
+    BOOST_CHECK_EQUAL(stats.d_entryCount, 1u);
+    BOOST_CHECK_GT(stats.d_memoryUsage, 0u);
+    BOOST_CHECK(first == second);
+
+    render("Other text");
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_misses, 2u);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(DefaultFontIsPartOfTheKey)
+{
+    render("Cached text");
+
+    d_font = &CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+    render("Cached text");
+
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_hits, 0u);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 2u);
+
+    // The fixture destroys the font it created
+    d_font = &CEGUI::FontManager::getSingleton().get("RenderedTextCacheTest");
+}
+
+BOOST_AUTO_TEST_CASE(FontSizeChangeInvalidates)
+{
+    const CEGUI::Sizef small = render("Cached text");
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 1u);
+
+    static_cast<CEGUI::FreeTypeFont*>(d_font)->setSize(24.0f);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 0u);
+
+    // Stale glyph metrics would give the old extents
+    const CEGUI::Sizef large = render("Cached text");
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_hits, 0u);
+    BOOST_CHECK_GT(large.d_width, small.d_width);
+    BOOST_CHECK_GT(large.d_height, small.d_height);
+}
+
+BOOST_AUTO_TEST_CASE(FontDestructionInvalidates)
+{
+    render("Cached text");
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 1u);
+
+    CEGUI::FontManager::getSingleton().destroy(*d_font);
+    d_font = nullptr;
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ParserIsPartOfTheKey)
+{
+    const CEGUI::String text("[font='DejaVuSans-12']Marked up text");
+    CEGUI::LegacyTextParser parser;
+
+    const CEGUI::Sizef plain = render(text);
+    const CEGUI::Sizef parsed = render(text, &parser);
+
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_hits, 0u);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 2u);
+    // Without a parser the tag is rendered as text
+    BOOST_CHECK_GT(plain.d_width, parsed.d_width);
+
+    BOOST_CHECK(render(text, &parser) == parsed);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_hits, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ParagraphDirectionIsPartOfTheKey)
+{
+    render("Cached text");
+    render("Cached text", nullptr, CEGUI::DefaultParagraphDirection::RightToLeft);
+
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_hits, 0u);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_entryCount, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryBudgetEvictsLeastRecentlyUsed)
+{
+    render("First");
+    const size_t entrySize = d_cache.getStats().d_memoryUsage;
+    render("Other");
+    d_cache.setMemoryBudget(d_cache.getStats().d_memoryUsage);
+
+    // Use the first one again, then add one more than fits
+    render("First");
+    render("Third");
+
+    const CEGUI::RenderedTextCacheStats stats = d_cache.getStats();
+    BOOST_CHECK_EQUAL(stats.d_evictions, 1u);
+    BOOST_CHECK_EQUAL(stats.d_entryCount, 2u);
+    BOOST_CHECK_LE(stats.d_memoryUsage, 2 * entrySize);
+
+    d_cache.resetStats();
+    render("First");
+    render("Other");
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_hits, 1u);
+    BOOST_CHECK_EQUAL(d_cache.getStats().d_misses, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(DisabledCacheIsBypassed)
+{
+    d_cache.setEnabled(false);
+    render("Cached text");
+    render("Cached text");
+
+    const CEGUI::RenderedTextCacheStats stats = d_cache.getStats();
+    BOOST_CHECK_EQUAL(stats.d_hits, 0u);
+    BOOST_CHECK_EQUAL(stats.d_entryCount, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Renderer.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! Renders a button in its own GUIContext, so that it owns GeometryBuffers.
+struct RendererFixture
+{
+    RendererFixture() :
+        d_system(CEGUI::System::getSingleton()),
+        d_renderer(*d_system.getRenderer()),
+        d_context(d_system.createGUIContext(d_renderer.getDefaultRenderTarget()))
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_button = winMgr.createWindow("TaharezLook/Button");
+        d_button->setText("Button");
+        d_button->setSize(CEGUI::USize(cegui_absdim(100), cegui_absdim(30)));
+        d_root->addChild(d_button);
+        d_context.setRootWindow(d_root);
+
+        d_system.renderAllGUIContexts();
+    }
+
+    ~RendererFixture()
+    {
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        d_system.destroyGUIContext(d_context);
+    }
+
+    CEGUI::System& d_system;
+    CEGUI::Renderer& d_renderer;
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    CEGUI::Window* d_button;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Renderer, RendererFixture)
+
+BOOST_AUTO_TEST_CASE(GeometryBufferPool_RedrawReusesBuffers)
+{
+    d_renderer.resetGeometryBufferPoolStats();
+
+    d_button->invalidate();
+    d_system.renderAllGUIContexts();
+    const CEGUI::GeometryBufferPoolStats first = d_renderer.getGeometryBufferPoolStats();
+    BOOST_CHECK_GT(first.d_hits, 0u);
+    BOOST_CHECK_EQUAL(first.d_misses, 0u);
+
+    d_button->invalidate();
+    d_system.renderAllGUIContexts();
+    const CEGUI::GeometryBufferPoolStats second = d_renderer.getGeometryBufferPoolStats();
+    BOOST_CHECK_GT(second.d_hits, first.d_hits);
+    BOOST_CHECK_EQUAL(second.d_misses, first.d_misses);
+
+    d_renderer.resetGeometryBufferPoolStats();
+    BOOST_CHECK_EQUAL(d_renderer.getGeometryBufferPoolStats().d_hits, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GeometryBufferPool_ClearingReleasesBytes)
+{
+    const size_t before = d_renderer.getGeometryBufferPoolStats().d_pooledBytes;
+
+    // the buffers of a destroyed window wait in the pool
+    d_root->removeChild(d_button);
+    CEGUI::WindowManager::getSingleton().destroyWindow(d_button);
+    const CEGUI::GeometryBufferPoolStats pooled = d_renderer.getGeometryBufferPoolStats();
+    BOOST_CHECK_GT(pooled.d_pooledBuffers, 0u);
+    BOOST_CHECK_GT(pooled.d_pooledBytes, before);
+
+    d_renderer.clearGeometryBufferPool();
+    const CEGUI::GeometryBufferPoolStats cleared = d_renderer.getGeometryBufferPoolStats();
+    BOOST_CHECK_EQUAL(cleared.d_pooledBuffers, 0u);
+    BOOST_CHECK_LT(cleared.d_pooledBytes, pooled.d_pooledBytes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,160 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/svg/SVGGeometryCache.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct SVGGeometryCacheFixture
+{
+    SVGGeometryCacheFixture() :
+        d_data(createData()),
+        d_image("SVGGeometryCacheTest", d_data)
+    {
+    }
+
+    ~SVGGeometryCacheFixture()
+    {
+        CEGUI::SVGDataManager::getSingleton().destroy(d_data);
+    }
+
+    static CEGUI::SVGData& createData()
+    {
+        CEGUI::SVGData& data = CEGUI::SVGDataManager::getSingleton().create("SVGGeometryCacheTest");
+        data.setWidth(100.f);
+        data.setHeight(100.f);
+
+        CEGUI::SVGPaintStyle style;
+        style.d_fill.d_colour = glm::vec3(1.f, 0.f, 0.f);
+        style.d_strokeWidth = 2.f;
+        data.addShape(new CEGUI::SVGRect(style, glm::mat3(1.f), 10.f, 10.f, 30.f, 20.f));
+        data.addShape(new CEGUI::SVGCircle(style, glm::mat3(2.f, 0.f, 5.f, 0.f, 2.f, 5.f, 0.f, 0.f, 1.f),
+            20.f, 20.f, 10.f));
+
+        // Polygons are filled using the stencil buffer
+        const std::vector<glm::vec2> points { { 50.f, 50.f }, { 90.f, 60.f }, { 70.f, 90.f } };
+        data.addShape(new CEGUI::SVGPolygon(style, glm::mat3(1.f), points));
+
+        return data;
+    }
+
+    //! Draws the image and returns the positions and colours of the vertices, as rendered.
+    std::vector<float> draw(const CEGUI::Rectf& area, size_t* bufferCount = nullptr)
+    {
+        std::vector<CEGUI::GeometryBuffer*> buffers;
+        d_image.createRenderGeometry(buffers, CEGUI::ImageRenderSettings(area), 0);
+
+        std::vector<float> vertices;
+        for (const CEGUI::GeometryBuffer* buffer : buffers)
+        {
+            const std::vector<float>& data = buffer->getVertexData();
+            const glm::mat4 model = buffer->getModelMatrix();
+            for (size_t i = 0; i < data.size(); i += 7)
+            {
+                const glm::vec4 position = model * glm::vec4(data[i], data[i + 1], data[i + 2], 1.f);
+                vertices.insert(vertices.end(), { position.x, position.y });
+                vertices.insert(vertices.end(), data.begin() + i + 3, data.begin() + i + 7);
+            }
+        }
+
+        if (bufferCount)
+            *bufferCount = buffers.size();
+
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffers(buffers);
+        return vertices;
+    }
+
+    CEGUI::SVGData& d_data;
+    CEGUI::SVGImage d_image;
+};
+
+BOOST_FIXTURE_TEST_SUITE(SVGGeometryCache, SVGGeometryCacheFixture)
+
+BOOST_AUTO_TEST_CASE(CachedGeometryMatchesTesselation)
+{
+    const CEGUI::Rectf area(0.f, 0.f, 200.f, 100.f);
+
+    d_data.getGeometryCache().setMaxEntryCount(0);
+    size_t uncachedBufferCount;
+    const std::vector<float> expected = draw(area, &uncachedBufferCount);
+    BOOST_CHECK_EQUAL(uncachedBufferCount, 3u);
+
+    d_data.getGeometryCache().setMaxEntryCount(8);
+    for (int i = 0; i < 2; ++i)
+    {
+        // The rectangle and the circle share a buffer, the polygon needs its own
+        size_t bufferCount;
+        const std::vector<float> cached = draw(area, &bufferCount);
+        BOOST_CHECK_EQUAL(bufferCount, 2u);
+
+        BOOST_REQUIRE_EQUAL(cached.size(), expected.size());
+        for (size_t v = 0; v < cached.size(); ++v)
+            BOOST_CHECK_SMALL(cached[v] - expected[v], 0.001f);
+    }
+
+    const CEGUI::SVGGeometryCacheStats stats = d_data.getGeometryCache().getStats();
+    BOOST_CHECK_EQUAL(stats.d_misses, 1u);
+    BOOST_CHECK_EQUAL(stats.d_hits, 1u);
+    BOOST_CHECK_EQUAL(stats.d_entryCount, 1u);
+    BOOST_CHECK_GT(stats.d_memoryUsage, expected.size() * sizeof(float));
+}
+
+BOOST_AUTO_TEST_CASE(EntriesPerScaleBucketAndAntiAliasing)
+{
+    CEGUI::SVGGeometryCache& cache = d_data.getGeometryCache();
+
+    draw(CEGUI::Rectf(0.f, 0.f, 100.f, 100.f));
+    draw(CEGUI::Rectf(0.f, 0.f, 100.5f, 100.f));
+    BOOST_CHECK_EQUAL(cache.getStats().d_entryCount, 1u);
+
+    draw(CEGUI::Rectf(0.f, 0.f, 150.f, 100.f));
+    d_image.setUseGeometryAntialiasing(false);
+    draw(CEGUI::Rectf(0.f, 0.f, 150.f, 100.f));
+    BOOST_CHECK_EQUAL(cache.getStats().d_entryCount, 3u);
+    BOOST_CHECK_EQUAL(cache.getStats().d_hits, 1u);
+    BOOST_CHECK_EQUAL(CEGUI::SVGDataManager::getSingleton().getGeometryCacheStats().d_misses, 3u);
+
+    // The least recently used entries are dropped
+    cache.setMaxEntryCount(2);
+    BOOST_CHECK_EQUAL(cache.getStats().d_entryCount, 2u);
+    d_image.setUseGeometryAntialiasing(true);
+    draw(CEGUI::Rectf(0.f, 0.f, 100.f, 100.f));
+    BOOST_CHECK_EQUAL(cache.getStats().d_misses, 4u);
+    BOOST_CHECK_EQUAL(cache.getStats().d_entryCount, 2u);
+
+    // Changing the shapes drops the cached geometry
+    d_data.addShape(new CEGUI::SVGRect(CEGUI::SVGPaintStyle(), glm::mat3(1.f), 0.f, 0.f, 5.f, 5.f));
+    BOOST_CHECK_EQUAL(cache.getStats().d_entryCount, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
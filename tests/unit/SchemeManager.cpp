@@ -0,0 +1,106 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! Sets the loading thread count of the SchemeManager for the scope.
+class LoadingThreadCountScope
+{
+public:
+    LoadingThreadCountScope(size_t count)
+    {
+        CEGUI::SchemeManager::getSingleton().setLoadingThreadCount(count);
+    }
+
+    ~LoadingThreadCountScope()
+    {
+        CEGUI::SchemeManager::getSingleton().setLoadingThreadCount(0);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(SchemeManager)
+
+BOOST_AUTO_TEST_CASE(ParallelLoadingMatchesSequentialLoading)
+{
+    CEGUI::SchemeManager& smgr = CEGUI::SchemeManager::getSingleton();
+    std::vector<CEGUI::Scheme*> schemes;
+    {
+        LoadingThreadCountScope threads(4);
+        schemes = smgr.createFromFiles({ "WindowsLook.scheme", "VanillaSkin.scheme" });
+    }
+
+    BOOST_REQUIRE_EQUAL(schemes.size(), 2u);
+    BOOST_CHECK_EQUAL(schemes[0]->getName(), "WindowsLookSkin");
+    BOOST_CHECK_EQUAL(schemes[1]->getName(), "VanillaSkin");
+    BOOST_CHECK(schemes[0]->resourcesLoaded());
+    BOOST_CHECK(schemes[1]->resourcesLoaded());
+
+    // scheme, imageset, image and looknfeel files of both schemes
+    const std::vector<CEGUI::ResourcePreloader::FileTiming>& timings =
+        smgr.getResourceLoadTimings();
+    BOOST_CHECK_EQUAL(timings.size(), 8u);
+    for (const CEGUI::ResourcePreloader::FileTiming& timing : timings)
+        BOOST_CHECK_MESSAGE(timing.d_prepared, timing.d_filename);
+
+    BOOST_CHECK(CEGUI::WidgetLookManager::getSingleton().isWidgetLookAvailable("WindowsLook/Button"));
+    BOOST_CHECK(CEGUI::WidgetLookManager::getSingleton().isWidgetLookAvailable("Vanilla/Button"));
+
+    // The textures decoded on worker threads match the ones loaded as usual
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    const CEGUI::Image& image = CEGUI::ImageManager::getSingleton().get("WindowsLook/Background");
+    const CEGUI::Texture* texture = static_cast<const CEGUI::BitmapImage&>(image).getTexture();
+    CEGUI::Texture& expected = renderer->createTexture("SequentialWindowsLook",
+                                                       "WindowsLook.png", "imagesets");
+    BOOST_CHECK(texture->getOriginalDataSize() == expected.getOriginalDataSize());
+    BOOST_CHECK(texture->getSize() == expected.getSize());
+    renderer->destroyTexture(expected);
+
+    // Not destroyed: that would unregister the Core window renderers other tests use
+}
+
+BOOST_AUTO_TEST_CASE(ParallelLoadingKeepsSchemesBeforeAFailure)
+{
+    CEGUI::SchemeManager& smgr = CEGUI::SchemeManager::getSingleton();
+    {
+        LoadingThreadCountScope threads(2);
+        BOOST_CHECK_THROW(smgr.createFromFiles({ "Generic.scheme", "DoesNotExist.scheme" }),
+                          CEGUI::Exception);
+    }
+
+    BOOST_CHECK(smgr.isDefined("Generic"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
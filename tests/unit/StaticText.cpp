@@ -0,0 +1,116 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+//! Creates a word wrapped static text whose width is adjusted to the text.
+struct StaticTextFixture
+{
+    StaticTextFixture()
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_window = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/StaticText");
+        d_window->setFont("DejaVuSans-12");
+        d_window->setProperty("WordWrap", "true");
+        d_window->setSize(CEGUI::USize(cegui_absdim(300), cegui_absdim(100)));
+    }
+
+    ~StaticTextFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+    }
+
+    CEGUI::Window* d_window;
+};
+
+BOOST_FIXTURE_TEST_SUITE(StaticText, StaticTextFixture)
+
+BOOST_AUTO_TEST_CASE(MeasureContent)
+{
+    d_window->setText("The quick brown fox jumps over the lazy dog");
+
+    CEGUI::Sizef oneLine;
+    bool intact = false;
+    BOOST_REQUIRE(d_window->measureContent(1000.f, oneLine, intact));
+    BOOST_CHECK(intact);
+
+    CEGUI::Sizef wrapped;
+    BOOST_REQUIRE(d_window->measureContent(oneLine.d_width / 2.f, wrapped, intact));
+    BOOST_CHECK(intact);
+    BOOST_CHECK_LE(wrapped.d_width, oneLine.d_width / 2.f);
+    BOOST_CHECK_GT(wrapped.d_height, oneLine.d_height);
+
+    // measuring doesn't change the widget
+    BOOST_CHECK_EQUAL(d_window->getPixelSize(), CEGUI::Sizef(300.f, 100.f));
+}
+
+BOOST_AUTO_TEST_CASE(WidthAdjustedToContent)
+{
+    d_window->setProperty("HorzFormatting", "LeftAligned");
+    d_window->setText("The quick brown fox jumps over the lazy dog");
+
+    // the width of the text on a single line
+    CEGUI::Sizef oneLine;
+    bool intact = false;
+    BOOST_REQUIRE(d_window->measureContent(1000.f, oneLine, intact));
+
+    d_window->setProperty("AdjustWidthToContent", "true");
+    const CEGUI::UDim widthFunc(d_window->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent());
+    const float width = (oneLine.d_width + d_window->adjustSizeToContent_getEpsilon()) *
+        widthFunc.d_scale + widthFunc.d_offset;
+
+    const CEGUI::Sizef size = d_window->getPixelSize();
+    BOOST_CHECK_EQUAL(size.d_width, std::ceil(width));
+    BOOST_CHECK_EQUAL(size.d_height, 100.f);
+    BOOST_CHECK(d_window->contentFitsForSpecifiedElementSize(size));
+}
+
+BOOST_AUTO_TEST_CASE(ContentFits)
+{
+    d_window->setText("The quick brown fox");
+    BOOST_CHECK(d_window->contentFits());
+
+    // a word that has to be split doesn't fit
+    d_window->setText("Thequickbrownfoxjumpsoverthelazydogthequickbrownfoxjumpsoverthelazydog");
+    BOOST_CHECK(!d_window->contentFits());
+
+    // resizing the widget tries the same
+    d_window->setText("The quick brown fox jumps over the lazy dog");
+    const CEGUI::Sizef size(d_window->getPixelSize());
+    BOOST_CHECK(d_window->contentFitsForSpecifiedElementSize_tryByResizing(size));
+    BOOST_CHECK(!d_window->contentFitsForSpecifiedElementSize_tryByResizing(
+        CEGUI::Sizef(size.d_width, 10.f)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
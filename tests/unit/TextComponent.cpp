@@ -0,0 +1,108 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/falagard/TextComponent.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/falagard/WidgetLookFeel.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/text/LegacyTextParser.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! Creates a label and finds the TextComponent of its look.
+struct LabelFixture
+{
+    LabelFixture()
+    {
+        d_label = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Label");
+        d_label->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 100)));
+        d_label->setFont("DejaVuSans-12");
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        const CEGUI::WidgetLookFeel& look =
+            CEGUI::WidgetLookManager::getSingleton().getWidgetLook(d_label->getLookNFeel());
+        d_component = &look.getImagerySection("Label").getTextComponents().front();
+    }
+
+    ~LabelFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_label);
+    }
+
+    CEGUI::Window* d_label;
+    const CEGUI::TextComponent* d_component;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TextComponent, LabelFixture)
+
+BOOST_AUTO_TEST_CASE(TextChangeRefreshesCache)
+{
+    d_label->setText("Short");
+    const float shortWidth = d_component->getTextExtent(*d_label).d_width;
+
+    d_label->setText("Much longer text");
+    const float longWidth = d_component->getTextExtent(*d_label).d_width;
+    BOOST_CHECK_GT(longWidth, shortWidth);
+    BOOST_CHECK_EQUAL(d_label->getTextComponentCache(*d_component).d_text, "Much longer text");
+}
+
+BOOST_AUTO_TEST_CASE(FontChangeRefreshesCache)
+{
+    if (!CEGUI::FontManager::getSingleton().isDefined("DejaVuSans-14"))
+        CEGUI::FontManager::createFromFile("DejaVuSans-14.font");
+
+    d_label->setText("Text");
+    const float smallHeight = d_component->getTextExtent(*d_label).d_height;
+
+    CEGUI::Font& bigFont = CEGUI::FontManager::getSingleton().get("DejaVuSans-14");
+    d_label->setFont(&bigFont);
+    BOOST_CHECK_GT(d_component->getTextExtent(*d_label).d_height, smallHeight);
+    BOOST_CHECK(d_label->getTextComponentCache(*d_component).d_font == &bigFont);
+}
+
+BOOST_AUTO_TEST_CASE(ParserChangeRefreshesCache)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::TextParser* const previousParser = system.getDefaultTextParser();
+
+    d_label->setText("Text");
+    d_component->getTextExtent(*d_label);
+
+    CEGUI::LegacyTextParser parser;
+    system.setDefaultTextParser(&parser);
+    d_component->getTextExtent(*d_label);
+    BOOST_CHECK(d_label->getTextComponentCache(*d_component).d_parser == &parser);
+
+    system.setDefaultTextParser(previousParser);
+    d_component->getTextExtent(*d_label);
+    BOOST_CHECK(d_label->getTextComponentCache(*d_component).d_parser == previousParser);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,7 +28,8 @@
 
 #include "InventoryModel.h"
 #include "CEGUI/Event.h"
-#include "CEGUI/Font.h"
+#include "CEGUI/text/Font.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 
 // Yup. We need this in order to easily inject/call event handlers without having
@@ -44,11 +45,13 @@ struct TreeViewFixture
 {
     TreeViewFixture()
     {
-        System::getSingleton().notifyDisplaySizeChanged(Sizef(100, 100));
+        System::getSingleton().notifyDisplaySizeChanged(Sizef(800, 600));
 
         view = static_cast<TreeView*>(
             WindowManager::getSingleton().createWindow("TaharezLook/TreeView", "tv"));
         view->setModel(&model);
+        view->setFont("DejaVuSans-12");
+        view->setSize(USize(cegui_absdim(200), cegui_absdim(200)));
         view->setItemTooltipsEnabled(true);
         font_height = view->getFont()->getFontHeight();
         expander_width = view->getViewRenderer()->getSubtreeExpanderSize().d_width;
@@ -59,6 +62,11 @@ struct TreeViewFixture
             Event::Subscriber(&TreeViewFixture::onSubtreeCollapsed, this));
     }
 
+    ~TreeViewFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(view);
+    }
+
     bool onSubtreeExpanded(const EventArgs& args)
     {
         expanded_nodes.push_back(
@@ -74,6 +82,17 @@ struct TreeViewFixture
     }
 
 
+    //! Returns the view position at the middle of the visible row \a row,
+    //! right of the expanders.
+    glm::vec2 rowPosition(size_t row) const
+    {
+        const Rectf area(view->getViewRenderer()->getViewRenderArea());
+        const float row_height =
+            view->getRootItemState().d_renderedChildren.at(0)->d_rowHeight;
+        return glm::vec2(area.left() + area.getWidth() / 2,
+            area.top() + (row + 0.5f) * row_height);
+    }
+
     TreeView* view;
     InventoryModel model;
     float font_height;
@@ -84,14 +103,10 @@ struct TreeViewFixture
 };
 
 //----------------------------------------------------------------------------//
-CursorInputEventArgs createCursorEventArgs(float x, float y, TreeView* view)
+MouseButtonEventArgs createCursorEventArgs(float x, float y, TreeView* view)
 {
-    CursorInputEventArgs args(view);
-
-    args.source = CursorInputSource::Left;
-    args.position = glm::vec2(x, y);
-
-    return args;
+    return MouseButtonEventArgs(view, glm::vec2(x, y), MouseButtons(), ModifierKeys(),
+        MouseButton::Left);
 }
 
 BOOST_FIXTURE_TEST_SUITE(TreeViewTestSuite, TreeViewFixture)
@@ -243,9 +258,9 @@ BOOST_AUTO_TEST_CASE(ItemAdded_ProperChildSelectionIsPersisted)
     model.addRandomItemWithChildren(model.getRootIndex(), 0);
     model.addRandomItemWithChildren(model.getRootIndex(), 0);
     view->prepareForRender();
-    CursorInputEventArgs args =
+    MouseButtonEventArgs args =
         createCursorEventArgs(expander_width / 2, font_height * 3 / 2, view);
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
     // first child
     view->setSelectedIndex(model.makeIndex(0, model.makeIndex(1, model.getRootIndex())));
 
@@ -269,9 +284,9 @@ BOOST_AUTO_TEST_CASE(ItemAdded_InExpandedSubtree_IsRendered)
     model.addRandomItemWithChildren(child_index, 0);
     view->prepareForRender();
 
-    CursorInputEventArgs args =
+    MouseButtonEventArgs args =
         createCursorEventArgs(expander_width / 2, font_height / 2, view);
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
     view->prepareForRender();
 
     const std::vector<TreeViewItemRenderingState*>& children =
@@ -327,8 +342,8 @@ BOOST_AUTO_TEST_CASE(CursorMoved_OverSubtreeExpander_DoesNotTriggerExpanding)
     model.addRandomItemWithChildren(model.getRootIndex(), 0, 3);
     view->prepareForRender();
 
-    CursorInputEventArgs args =
-        createCursorEventArgs(expander_width / 2, font_height / 2, view);
+    CursorMoveEventArgs args(
+        createCursorEventArgs(expander_width / 2, font_height / 2, view), glm::vec2(0, 0));
     view->onCursorMove(args);
     view->prepareForRender();
 
@@ -346,10 +361,10 @@ BOOST_AUTO_TEST_CASE(CursorPressed_ExpandAndCollapseEventsFired)
 
     BOOST_REQUIRE_EQUAL(3, view->getRootItemState().d_renderedChildren.at(0)->d_totalChildCount);
 
-    CursorInputEventArgs args =
+    MouseButtonEventArgs args =
         createCursorEventArgs(expander_width / 2, font_height / 2, view);
     ModelIndex target_node = model.makeIndex(0, model.getRootIndex());
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
     BOOST_REQUIRE_INDICES_EQUAL(target_node, expanded_nodes.at(0));
     BOOST_REQUIRE(collapsed_nodes.empty());
     view->prepareForRender();
@@ -360,7 +375,7 @@ BOOST_AUTO_TEST_CASE(CursorPressed_ExpandAndCollapseEventsFired)
     BOOST_REQUIRE_EQUAL(3, children.at(0)->d_renderedChildren.size());
 
     // collapse
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
     BOOST_REQUIRE_INDICES_EQUAL(target_node, expanded_nodes.at(0));
     BOOST_REQUIRE_INDICES_EQUAL(target_node, collapsed_nodes.at(0));
     BOOST_REQUIRE(!children.at(0)->d_subtreeIsExpanded);
@@ -374,13 +389,13 @@ BOOST_AUTO_TEST_CASE(CursorPressed_ExpandChild)
     model.addRandomItemWithChildren(model.makeIndex(0, model.getRootIndex()), 0, 3);
     view->prepareForRender();
 
-    CursorInputEventArgs args = createCursorEventArgs(expander_width / 2, font_height / 2, view);
-    view->onCursorPressHold(args);
+    MouseButtonEventArgs args = createCursorEventArgs(expander_width / 2, font_height / 2, view);
+    view->onMouseButtonDown(args);
 
     args = createCursorEventArgs(
         view->getViewRenderer()->getSubtreeExpanderXIndent(1) + expander_width / 2,
         font_height + font_height / 2, view);
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
     ModelIndex first_node = model.makeIndex(0, model.getRootIndex());
     BOOST_REQUIRE_INDICES_EQUAL(first_node, expanded_nodes.at(0));
     BOOST_REQUIRE_INDICES_EQUAL(model.makeIndex(0, first_node), expanded_nodes.at(1));
@@ -401,9 +416,9 @@ BOOST_AUTO_TEST_CASE(SubtreeExpanded_SelectionChanges_DoesNotChangeExpandedState
     model.addRandomItemWithChildren(model.getRootIndex(), 0, 3);
     view->prepareForRender();
 
-    CursorInputEventArgs args =
+    MouseButtonEventArgs args =
         createCursorEventArgs(expander_width / 2, font_height / 2, view);
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
 
     const std::vector<TreeViewItemRenderingState*>& children =
         view->getRootItemState().d_renderedChildren;
@@ -422,9 +437,9 @@ BOOST_AUTO_TEST_CASE(SetSelectedItem_ChildInExpandedSubtree_SelectsChild)
     model.addRandomItemWithChildren(model.getRootIndex(), 0, 3);
     view->prepareForRender();
 
-    CursorInputEventArgs args =
+    MouseButtonEventArgs args =
         createCursorEventArgs(expander_width / 2, font_height / 2, view);
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
 
     const std::vector<TreeViewItemRenderingState*>& children =
         view->getRootItemState().d_renderedChildren;
@@ -501,9 +516,9 @@ BOOST_AUTO_TEST_CASE(GetTreeViewItemForIndex)
     BOOST_REQUIRE_EQUAL(
         static_cast<TreeViewItemRenderingState*>(nullptr),
         view->getTreeViewItemForIndex(index0_child));
-    CursorInputEventArgs args =
+    MouseButtonEventArgs args =
         createCursorEventArgs(expander_width / 2, font_height / 2, view);
-    view->onCursorPressHold(args);
+    view->onMouseButtonDown(args);
     view->prepareForRender();
 
     BOOST_REQUIRE_EQUAL(children.at(0)->d_renderedChildren.at(0),
@@ -567,4 +582,109 @@ BOOST_AUTO_TEST_CASE(MultipleLevelsHierarchy_RenderedMaxWidthGreaterThanViewSize
     BOOST_REQUIRE(view->getRenderedMaxWidth() > 100);
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IndexAt_AfterExpandAndCollapse_ReturnsVisibleRowIndex)
+{
+    ModelIndex root = model.getRootIndex();
+    model.addRandomItemWithChildren(root, 0, 3);
+    model.addRandomItemWithChildren(root, 1, 0);
+    ModelIndex first = model.makeIndex(0, root);
+    ModelIndex second = model.makeIndex(1, root);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_INDICES_EQUAL(second, view->indexAt(rowPosition(1)));
+
+    TreeViewItemRenderingState& first_item = *view->getTreeViewItemForIndex(first);
+    view->toggleSubtree(first_item);
+    BOOST_REQUIRE_INDICES_EQUAL(first, view->indexAt(rowPosition(0)));
+    BOOST_REQUIRE_INDICES_EQUAL(model.makeIndex(0, first), view->indexAt(rowPosition(1)));
+    BOOST_REQUIRE_INDICES_EQUAL(model.makeIndex(2, first), view->indexAt(rowPosition(3)));
+    BOOST_REQUIRE_INDICES_EQUAL(second, view->indexAt(rowPosition(4)));
+    BOOST_REQUIRE(view->indexAt(rowPosition(5)).d_modelData == nullptr);
+
+    view->toggleSubtree(first_item);
+    BOOST_REQUIRE_INDICES_EQUAL(second, view->indexAt(rowPosition(1)));
+    BOOST_REQUIRE(view->indexAt(rowPosition(2)).d_modelData == nullptr);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SubtreeToggled_AncestorHeightsAreUpdated)
+{
+    view->setIncrementalLayoutEnabled(true);
+
+    /*
+    ROOT
+        A
+            A0
+                3 children
+        B
+    */
+    ModelIndex root = model.getRootIndex();
+    model.addRandomItemWithChildren(root, 0, 0);
+    model.addRandomItemWithChildren(root, 0, 0);
+    ModelIndex a = model.makeIndex(0, root);
+    model.addRandomItemWithChildren(a, 0, 3);
+    ModelIndex a0 = model.makeIndex(0, a);
+    view->prepareForRender();
+
+    const TreeViewItemRenderingState& root_item = view->getRootItemState();
+    TreeViewItemRenderingState& a_item = *view->getTreeViewItemForIndex(a);
+    const float row_height = a_item.d_rowHeight;
+    BOOST_REQUIRE_CLOSE(2 * row_height, root_item.d_subtreeHeight, 0.01f);
+
+    view->toggleSubtree(a_item);
+    TreeViewItemRenderingState& a0_item = *view->getTreeViewItemForIndex(a0);
+    view->toggleSubtree(a0_item);
+
+    BOOST_REQUIRE_CLOSE(4 * row_height, a0_item.d_subtreeHeight, 0.01f);
+    BOOST_REQUIRE_CLOSE(5 * row_height, a_item.d_subtreeHeight, 0.01f);
+    BOOST_REQUIRE_CLOSE(6 * row_height, root_item.d_subtreeHeight, 0.01f);
+    BOOST_REQUIRE_CLOSE(5 * row_height, root_item.d_childrenHeights.getPrefixSum(1), 0.01f);
+    BOOST_REQUIRE_INDICES_EQUAL(model.makeIndex(1, root), view->indexAt(rowPosition(5)));
+
+    view->toggleSubtree(a0_item);
+
+    BOOST_REQUIRE_CLOSE(row_height, a0_item.d_subtreeHeight, 0.01f);
+    BOOST_REQUIRE_CLOSE(2 * row_height, a_item.d_subtreeHeight, 0.01f);
+    BOOST_REQUIRE_CLOSE(3 * row_height, root_item.d_subtreeHeight, 0.01f);
+    BOOST_REQUIRE_CLOSE(2 * row_height, root_item.d_childrenHeights.getPrefixSum(1), 0.01f);
+    BOOST_REQUIRE_INDICES_EQUAL(model.makeIndex(1, root), view->indexAt(rowPosition(2)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SubtreeCollapsed_ChildrenAreNotMaterialized)
+{
+    ModelIndex root = model.getRootIndex();
+    model.addRandomItemWithChildren(root, 0, 0);
+    ModelIndex first = model.makeIndex(0, root);
+    model.addRandomItemWithChildren(first, 0, 2);
+    model.addRandomItemWithChildren(first, 0, 2);
+    view->prepareForRender();
+
+    TreeViewItemRenderingState& first_item = *view->getTreeViewItemForIndex(first);
+    BOOST_REQUIRE_EQUAL(2, first_item.d_totalChildCount);
+    BOOST_REQUIRE(first_item.d_children.empty());
+    BOOST_REQUIRE(first_item.d_renderedChildren.empty());
+
+    // only the expanded level is materialized
+    view->toggleSubtree(first_item);
+    view->prepareForRender();
+    BOOST_REQUIRE_EQUAL(2, first_item.d_renderedChildren.size());
+    for (const TreeViewItemRenderingState* child : first_item.d_renderedChildren)
+    {
+        BOOST_REQUIRE(!child->d_subtreeIsExpanded);
+        BOOST_REQUIRE_EQUAL(2, child->d_totalChildCount);
+        BOOST_REQUIRE(child->d_children.empty());
+        BOOST_REQUIRE(child->d_renderedChildren.empty());
+    }
+    BOOST_REQUIRE_EQUAL(
+        static_cast<TreeViewItemRenderingState*>(nullptr),
+        view->getTreeViewItemForIndex(model.makeIndex(0, model.makeIndex(0, first))));
+
+    view->toggleSubtree(first_item);
+    view->prepareForRender();
+    BOOST_REQUIRE(first_item.d_children.empty());
+    BOOST_REQUIRE(first_item.d_renderedChildren.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
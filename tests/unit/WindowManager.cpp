@@ -0,0 +1,393 @@
+/***********************************************************************
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <sstream>
+
+//! Loads a binary layout from memory.
+static CEGUI::Window* loadBinaryLayout(const std::string& data)
+{
+    CEGUI::RawDataContainer container;
+    container.setData(reinterpret_cast<std::uint8_t*>(const_cast<char*>(data.data())));
+    container.setSize(data.size());
+
+    CEGUI::Window* root = nullptr;
+    try
+    {
+        root = CEGUI::WindowManager::getSingleton().loadLayoutFromBinaryContainer(container);
+    }
+    catch (...)
+    {
+        container.setData(nullptr);
+        throw;
+    }
+
+    container.setData(nullptr);
+    return root;
+}
+
+//! Writes the binary layout of \a window, destroys the window and loads the layout again.
+static CEGUI::Window* reloadAsBinaryLayout(CEGUI::Window* window)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    std::ostringstream stream(std::ios::binary);
+    wmgr.writeBinaryLayoutToStream(*window, stream);
+    wmgr.destroyWindow(window);
+    wmgr.cleanDeadPool();
+
+    return loadBinaryLayout(stream.str());
+}
+
+BOOST_AUTO_TEST_SUITE(WindowManager)
+
+BOOST_AUTO_TEST_CASE(Registry)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    std::vector<CEGUI::Window*> windows;
+    for (int i = 0; i < 4; ++i)
+        windows.push_back(wmgr.createWindow("DefaultWindow"));
+
+    wmgr.destroyWindow(windows[1]);
+    BOOST_CHECK(!wmgr.isAlive(windows[1]));
+    BOOST_CHECK(wmgr.isAlive(windows[0]));
+    BOOST_CHECK(wmgr.isAlive(windows[2]));
+    BOOST_CHECK(wmgr.isAlive(windows[3]));
+
+    size_t found = 0;
+    for (CEGUI::WindowManager::WindowIterator it = wmgr.getIterator(); !it.isAtEnd(); ++it)
+    {
+        BOOST_CHECK(*it != windows[1]);
+        if (*it == windows[0] || *it == windows[2] || *it == windows[3])
+            ++found;
+    }
+    BOOST_CHECK_EQUAL(found, 3u);
+
+    wmgr.destroyWindow(windows[3]);
+    wmgr.destroyWindow(windows[0]);
+    wmgr.destroyWindow(windows[2]);
+    BOOST_CHECK(!wmgr.isAlive(windows[2]));
+    wmgr.cleanDeadPool();
+}
+
+//! Maps the windows in the tree of \a window to their parents.
+static void collectParents(const CEGUI::Window& window,
+    std::map<const CEGUI::Window*, const CEGUI::Window*>& parents)
+{
+    for (size_t i = 0; i < window.getChildCount(); ++i)
+    {
+        const CEGUI::Window* child = window.getChildAtIndex(i);
+        parents[child] = &window;
+        collectParents(*child, parents);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DestroyAllWindowsDestroysParentsFirst)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    CEGUI::Window* early[2] = { wmgr.createWindow("DefaultWindow"), wmgr.createWindow("DefaultWindow") };
+    CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+    std::vector<CEGUI::Window*> frames;
+    for (int i = 0; i < 4; ++i)
+    {
+        frames.push_back(wmgr.createWindow("TaharezLook/FrameWindow"));
+        root->addChild(frames.back());
+        frames.back()->addChild(wmgr.createWindow("TaharezLook/FrameWindow"));
+    }
+
+    // Destroying windows created earlier moves the last created ones, the
+    // nested frame window and its auto windows, to the front of the registry
+    wmgr.destroyWindow(early[0]);
+    wmgr.destroyWindow(frames[1]);
+    wmgr.destroyWindow(early[1]);
+
+    std::map<const CEGUI::Window*, const CEGUI::Window*> parents;
+    collectParents(*root, parents);
+
+    size_t destroyedChildren = 0;
+    bool parentsDestroyedFirst = true;
+    CEGUI::Event::Connection connection = wmgr.subscribeEvent(
+        CEGUI::WindowManager::EventWindowDestroyed,
+        [&](const CEGUI::EventArgs& args)
+        {
+            const CEGUI::Window* window = static_cast<const CEGUI::WindowEventArgs&>(args).window;
+            auto it = parents.find(window);
+            if (it != parents.end())
+            {
+                ++destroyedChildren;
+                if (wmgr.isAlive(it->second))
+                    parentsDestroyedFirst = false;
+            }
+            return true;
+        });
+
+    wmgr.destroyAllWindows();
+    connection->disconnect();
+
+    BOOST_CHECK(parentsDestroyedFirst);
+    BOOST_CHECK_EQUAL(destroyedChildren, parents.size());
+    BOOST_CHECK(!wmgr.isAlive(root));
+    BOOST_CHECK(wmgr.getIterator().isAtEnd());
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(RecyclePool)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::String type("TaharezLook/Button");
+    wmgr.setRecyclePoolSize(type, 1);
+
+    CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+    CEGUI::Window* button = wmgr.createWindow(type, "First");
+    CEGUI::Window* child = wmgr.createWindow("DefaultWindow");
+    const size_t autoChildCount = button->getChildCount();
+    root->addChild(button);
+    button->addChild(child);
+    button->setText("Modified");
+    button->setAlpha(0.5f);
+    button->setUserString("Key", "Value");
+    button->setUserData(root);
+
+    wmgr.destroyWindow(button);
+    BOOST_CHECK(!wmgr.isAlive(button));
+    BOOST_CHECK(!wmgr.isAlive(child));
+    BOOST_CHECK_EQUAL(root->getChildCount(), 0u);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 1u);
+
+    // A reused window looks like a fresh one
+    CEGUI::Window* reused = wmgr.createWindow(type, "Second");
+    BOOST_CHECK_EQUAL(reused, button);
+    BOOST_CHECK(wmgr.isAlive(reused));
+    BOOST_CHECK_EQUAL(reused->getName(), "Second");
+    BOOST_CHECK_EQUAL(reused->getText(), "");
+    BOOST_CHECK_EQUAL(reused->getAlpha(), 1.0f);
+    BOOST_CHECK(!reused->isUserStringDefined("Key"));
+    BOOST_CHECK(reused->getUserData() == nullptr);
+    BOOST_CHECK_EQUAL(reused->getChildCount(), autoChildCount);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 0u);
+
+    // Windows that don't fit into the pool are destroyed
+    CEGUI::Window* other = wmgr.createWindow(type);
+    wmgr.destroyWindow(reused);
+    wmgr.destroyWindow(other);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 1u);
+
+    wmgr.setRecyclePoolSize(type, 0);
+    BOOST_CHECK_EQUAL(wmgr.getRecyclePoolSize(type), 0u);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 0u);
+
+    wmgr.destroyWindow(root);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(RecyclePoolResetsAutoWindowsAndDropsSubscriptions)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::String type("TaharezLook/FrameWindow");
+    wmgr.setRecyclePoolSize(type, 1);
+
+    CEGUI::Window* frame = wmgr.createWindow(type, "Recycled");
+    CEGUI::Window* closeButton = frame->getChild("__auto_closebutton__");
+    closeButton->setAlpha(0.5f);
+    closeButton->setUserString("Key", "Value");
+
+    int changeCount = 0;
+    frame->subscribeEvent(CEGUI::Window::EventTextChanged, [&changeCount]() { ++changeCount; });
+    closeButton->subscribeEvent(CEGUI::Window::EventAlphaChanged, [&changeCount]() { ++changeCount; });
+
+    wmgr.destroyWindow(frame);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 1u);
+
+    CEGUI::Window* reused = wmgr.createWindow(type, "Reused");
+    BOOST_REQUIRE_EQUAL(reused, frame);
+    BOOST_CHECK_EQUAL(closeButton->getAlpha(), 1.0f);
+    BOOST_CHECK(!closeButton->isUserStringDefined("Key"));
+
+    // The subscriptions of the previous owner are gone
+    reused->setText("Reused");
+    closeButton->setAlpha(0.25f);
+    BOOST_CHECK_EQUAL(changeCount, 0);
+
+    wmgr.setRecyclePoolSize(type, 0);
+    wmgr.destroyWindow(reused);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(RecyclePoolDestroysAwaitedWindows)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::String type("TaharezLook/FrameWindow");
+
+    // Windows created before the pool are not pooled
+    CEGUI::Window* early = wmgr.createWindow(type);
+    wmgr.setRecyclePoolSize(type, 2);
+    wmgr.destroyWindow(early);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 0u);
+
+    // Neither are windows whose destruction somebody waits for
+    CEGUI::Window* frame = wmgr.createWindow(type);
+    int destructionCount = 0;
+    frame->getChild("__auto_closebutton__")->subscribeEvent(
+        CEGUI::Window::EventDestructionStarted, [&destructionCount]() { ++destructionCount; });
+
+    wmgr.destroyWindow(frame);
+    BOOST_CHECK_EQUAL(destructionCount, 1);
+    BOOST_CHECK_EQUAL(wmgr.getRecycledWindowCount(type), 0u);
+
+    wmgr.setRecyclePoolSize(type, 0);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(CloneCopiesProperties)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    CEGUI::Window* original = wmgr.createWindow("TaharezLook/FrameWindow", "Original");
+    original->setText("Caption");
+    original->setAlpha(0.25f);
+    original->setProperty("SizingEnabled", "false");
+    original->addChild(wmgr.createWindow("TaharezLook/Button", "Button"));
+
+    CEGUI::Window* clone = original->clone();
+    BOOST_CHECK_EQUAL(clone->getText(), "Caption");
+    BOOST_CHECK_EQUAL(clone->getAlpha(), 0.25f);
+    BOOST_CHECK_EQUAL(clone->getProperty("SizingEnabled"), "false");
+    BOOST_CHECK(clone->isChild("Button"));
+
+    wmgr.destroyWindow(clone);
+    wmgr.destroyWindow(original);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(BinaryLayoutRoundTrip)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    CEGUI::Window* root = wmgr.createWindow("TaharezLook/FrameWindow", "Root");
+    root->setText("Caption");
+    root->setAlpha(0.25f);
+    root->setPosition(CEGUI::UVector2(cegui_reldim(0.1f), cegui_absdim(20.f)));
+    root->setProperty("SizingEnabled", "false");
+    root->setProperty("HorizontalAlignment", "Centre");
+    root->setUserString("Key", "Value");
+    root->getChild("__auto_titlebar__")->setProperty("CaptionColour", "FF102030");
+
+    CEGUI::Window* text = wmgr.createWindow("TaharezLook/StaticText");
+    text->setText("First line\nSecond line");
+    text->setProperty("TextColours", "tl:FF000000 tr:FFFF0000 bl:FF00FF00 br:FF0000FF");
+    root->addChild(text);
+    root->addChild(wmgr.createWindow("TaharezLook/Button", "Button"));
+
+    const CEGUI::String expected = wmgr.getLayoutAsString(*root);
+    root = reloadAsBinaryLayout(root);
+    BOOST_CHECK_EQUAL(wmgr.getLayoutAsString(*root), expected);
+
+    BOOST_CHECK_EQUAL(root->getName(), "Root");
+    BOOST_CHECK_EQUAL(root->getAlpha(), 0.25f);
+    BOOST_CHECK_EQUAL(root->getUserString("Key"), "Value");
+    BOOST_CHECK_EQUAL(root->getChildAtIndex(root->getChildCount() - 1)->getName(), "Button");
+
+    wmgr.destroyWindow(root);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(BinaryLayoutMatchesXMLLayout)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    // The tab control writes its tab contents instead of its auto windows
+    for (const char* layout : { "TextSample.layout", "MenuNavigationSample.layout" })
+    {
+        std::ostringstream stream(std::ios::binary);
+        wmgr.compileLayoutFromFile(layout, stream);
+
+        CEGUI::Window* root = wmgr.loadLayoutFromFile(layout);
+        const CEGUI::String expected = wmgr.getLayoutAsString(*root);
+        wmgr.destroyWindow(root);
+
+        root = loadBinaryLayout(stream.str());
+        BOOST_CHECK_EQUAL(wmgr.getLayoutAsString(*root), expected);
+
+        root = reloadAsBinaryLayout(root);
+        BOOST_CHECK_EQUAL(wmgr.getLayoutAsString(*root), expected);
+
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryLayoutRejectsInvalidData)
+{
+    BOOST_CHECK_THROW(loadBinaryLayout("<GUILayout/>"), CEGUI::InvalidRequestException);
+
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = wmgr.createWindow("DefaultWindow", "Truncated");
+    root->addChild(wmgr.createWindow("DefaultWindow", "Child"));
+
+    std::ostringstream stream(std::ios::binary);
+    wmgr.writeBinaryLayoutToStream(*root, stream);
+    wmgr.destroyWindow(root);
+    wmgr.cleanDeadPool();
+
+    // The windows created before the error are destroyed
+    const std::string data = stream.str();
+    BOOST_CHECK_THROW(loadBinaryLayout(data.substr(0, data.size() - 2)), CEGUI::InvalidRequestException);
+    wmgr.cleanDeadPool();
+    for (CEGUI::WindowManager::WindowIterator it = wmgr.getIterator(); !it.isAtEnd(); ++it)
+        BOOST_CHECK_NE((*it)->getName(), "Truncated");
+}
+
+BOOST_AUTO_TEST_CASE(BinaryLayoutRejectsMalformedHeader)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* root = wmgr.createWindow("DefaultWindow", "Header");
+
+    std::ostringstream stream(std::ios::binary);
+    wmgr.writeBinaryLayoutToStream(*root, stream);
+    wmgr.destroyWindow(root);
+    wmgr.cleanDeadPool();
+
+    // magic and version, followed by string counts the data can't hold
+    const std::string header = stream.str().substr(0, 8);
+    BOOST_CHECK_THROW(loadBinaryLayout(header + std::string(4, '\xff')),
+                      CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(loadBinaryLayout(header + std::string("\x03\0\0\0\0\0\0\0", 8)),
+                      CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(loadBinaryLayout(header + std::string("\x01\0", 2)),
+                      CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+    purpose:    Converts GUILayout XML files into binary layouts
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Null/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/ScriptModule.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/text/Font.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Resource group without a directory, the file names given on the command
+// line are used as they are.
+static const CEGUI::String CommandLineFilesGroup("LayoutCompilerFiles");
+
+//----------------------------------------------------------------------------//
+static void printUsage(const char* program)
+{
+    std::cerr <<
+        "Usage: " << program << " [-d <datafiles directory>] [-s <scheme>]... "
+        "<layout file> <output file>\n"
+        "\n"
+        "Converts a GUILayout XML file into a binary layout, which\n"
+        "WindowManager::loadLayoutFromBinary loads without parsing XML.\n"
+        "\n"
+        "  -d  Directory holding the 'schemes', 'imagesets', 'fonts',\n"
+        "      'looknfeel', 'layouts' and 'xml_schemas' directories.\n"
+        "      Defaults to the current directory.\n"
+        "  -s  Scheme file defining window types used by the layout, found\n"
+        "      in the 'schemes' directory. Can be given several times.\n"
+        "\n"
+        "The windows created by the binary layout are compared against the\n"
+        "ones created by the XML layout, the output file is removed if they\n"
+        "differ.\n";
+}
+
+//----------------------------------------------------------------------------//
+static void initialiseResourceGroups(const std::string& dataPath)
+{
+    CEGUI::DefaultResourceProvider* rp =
+        static_cast<CEGUI::DefaultResourceProvider*>(
+            CEGUI::System::getSingleton().getResourceProvider());
+
+    const std::string prefix(dataPath.empty() ? "." : dataPath);
+    rp->setResourceGroupDirectory("schemes", prefix + "/schemes/");
+    rp->setResourceGroupDirectory("imagesets", prefix + "/imagesets/");
+    rp->setResourceGroupDirectory("fonts", prefix + "/fonts/");
+    rp->setResourceGroupDirectory("layouts", prefix + "/layouts/");
+    rp->setResourceGroupDirectory("looknfeels", prefix + "/looknfeel/");
+    rp->setResourceGroupDirectory("lua_scripts", prefix + "/lua_scripts/");
+    rp->setResourceGroupDirectory("schemas", prefix + "/xml_schemas/");
+    rp->setResourceGroupDirectory("animations", prefix + "/animations/");
+
+    CEGUI::ImageManager::setImagesetDefaultResourceGroup("imagesets");
+    CEGUI::Font::setDefaultResourceGroup("fonts");
+    CEGUI::Scheme::setDefaultResourceGroup("schemes");
+    CEGUI::WidgetLookManager::setDefaultResourceGroup("looknfeels");
+    CEGUI::WindowManager::setDefaultResourceGroup("layouts");
+    CEGUI::ScriptModule::setDefaultResourceGroup("lua_scripts");
+    CEGUI::AnimationManager::setDefaultResourceGroup("animations");
+
+    CEGUI::XMLParser* parser = CEGUI::System::getSingleton().getXMLParser();
+    if (parser->isPropertyPresent("SchemaDefaultResourceGroup"))
+        parser->setProperty("SchemaDefaultResourceGroup", "schemas");
+}
+
+//----------------------------------------------------------------------------//
+static bool compileLayout(const std::string& layoutFile, const std::string& outputFile)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    {
+        std::ofstream output(outputFile.c_str(), std::ios::out | std::ios::binary);
+        wmgr.compileLayoutFromFile(layoutFile, output, CommandLineFilesGroup);
+        output.close();
+
+        if (!output)
+        {
+            std::cerr << "Failed to write '" << outputFile << "'." << std::endl;
+            return false;
+        }
+    }
+
+    CEGUI::Window* root = wmgr.loadLayoutFromFile(layoutFile, CommandLineFilesGroup);
+    const CEGUI::String expected(wmgr.getLayoutAsString(*root));
+    wmgr.destroyWindow(root);
+
+    root = wmgr.loadLayoutFromBinary(outputFile, CommandLineFilesGroup);
+    const bool matches = (wmgr.getLayoutAsString(*root) == expected);
+    wmgr.destroyWindow(root);
+    wmgr.cleanDeadPool();
+
+    if (!matches)
+    {
+        std::cerr << "The binary layout doesn't create the same windows as '"
+                  << layoutFile << "'." << std::endl;
+    }
+
+    return matches;
+}
+
+//----------------------------------------------------------------------------//
+int main(int argc, char* argv[])
+{
+    std::string dataPath;
+    std::vector<std::string> schemes;
+    std::vector<std::string> files;
+    bool validArguments = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "-d") == 0) && (i + 1 < argc))
+            dataPath = argv[++i];
+        else if ((std::strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+            schemes.push_back(argv[++i]);
+        else if (argv[i][0] == '-')
+            validArguments = false;
+        else
+            files.push_back(argv[i]);
+    }
+
+    if (!validArguments || files.size() != 2)
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    CEGUI::NullRenderer::bootstrapSystem();
+    // errors are reported below
+    CEGUI::Exception::setStdErrEnabled(false);
+
+    bool success = false;
+    try
+    {
+        initialiseResourceGroups(dataPath);
+
+        for (const std::string& scheme : schemes)
+            CEGUI::SchemeManager::getSingleton().createFromFile(scheme);
+
+        success = compileLayout(files[0], files[1]);
+    }
+    catch (const CEGUI::Exception& e)
+    {
+        std::cerr << e.getMessage() << std::endl;
+    }
+
+    if (!success)
+        std::remove(files[1].c_str());
+
+    CEGUI::NullRenderer::destroySystem();
+
+    return success ? 0 : 1;
+}